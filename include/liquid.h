@@ -359,6 +359,19 @@ void cvsd_decode8(cvsd _q, unsigned char _data, float * _audio);
 // MODULE : buffer
 //
 
+// Get minimum size in bytes of window and cbuffer storage which is backed
+// by memory mapped twice back to back (where supported) so that reads
+// never copy at the wrap-around point
+unsigned int liquid_buffer_mirror_get_min(void);
+
+// Set minimum size in bytes of window and cbuffer storage which is backed
+// by mirrored memory, for newly-created objects. Each mirrored object
+// holds two memory mappings. Mirrored memory is shared rather than copied
+// across fork(), so a process which uses such objects in both parent and
+// child should disable mirroring before creating them.
+//  _min    : minimum size in bytes, 0 disables mirrored memory
+int liquid_buffer_mirror_set_min(unsigned int _min);
+
 // circular buffer
 #define LIQUID_CBUFFER_MANGLE_FLOAT(name)  LIQUID_CONCAT(cbufferf,  name)
 #define LIQUID_CBUFFER_MANGLE_CFLOAT(name) LIQUID_CONCAT(cbuffercf, name)
@@ -454,11 +467,126 @@ void CBUFFER(_release)(CBUFFER()    _q,                                     \
 LIQUID_CBUFFER_DEFINE_API(LIQUID_CBUFFER_MANGLE_FLOAT,  float)
 LIQUID_CBUFFER_DEFINE_API(LIQUID_CBUFFER_MANGLE_CFLOAT, liquid_float_complex)
 
+// lock-free single-producer/single-consumer circular buffer
+#define LIQUID_CBUFFER_SPSC_MANGLE_FLOAT(name)  LIQUID_CONCAT(cbufferf_spsc,  name)
+#define LIQUID_CBUFFER_SPSC_MANGLE_CFLOAT(name) LIQUID_CONCAT(cbuffercf_spsc, name)
+
+// large macro
+//   CBUFFER : name-mangling macro
+//   T       : data type
+#define LIQUID_CBUFFER_SPSC_DEFINE_API(CBUFFER,T)                           \
+                                                                            \
+/* Circular buffer object for passing samples between exactly two       */  \
+/* threads without locking: one producer thread may push/write while    */  \
+/* one consumer thread concurrently pops/reads. Reads return pointers   */  \
+/* into the buffer itself so samples are never copied on the way out.   */  \
+typedef struct CBUFFER(_s) * CBUFFER();                                     \
+                                                                            \
+/* Create spsc circular buffer object of a particular maximum storage   */  \
+/* length                                                               */  \
+/*  _max_size  : maximum buffer size, _max_size > 0                     */  \
+CBUFFER() CBUFFER(_create)(unsigned int _max_size);                         \
+                                                                            \
+/* Create spsc circular buffer object of a particular maximum storage   */  \
+/* size and specify the maximum number of elements that can be read at  */  \
+/* any given time                                                       */  \
+/*  _max_size  : maximum buffer size, _max_size > 0                     */  \
+/*  _max_read  : maximum size that will be read from buffer             */  \
+CBUFFER() CBUFFER(_create_max)(unsigned int _max_size,                      \
+                               unsigned int _max_read);                     \
+                                                                            \
+/* Destroy object, freeing all internal memory; neither thread may be   */  \
+/* using the object                                                     */  \
+int CBUFFER(_destroy)(CBUFFER() _q);                                        \
+                                                                            \
+/* Print object properties to stdout                                    */  \
+int CBUFFER(_print)(CBUFFER() _q);                                          \
+                                                                            \
+/* Clear internal buffer; neither thread may be using the object        */  \
+int CBUFFER(_reset)(CBUFFER() _q);                                          \
+                                                                            \
+/* Get the number of elements currently in the buffer                   */  \
+unsigned int CBUFFER(_size)(CBUFFER() _q);                                  \
+                                                                            \
+/* Get the maximum number of elements the buffer can hold               */  \
+unsigned int CBUFFER(_max_size)(CBUFFER() _q);                              \
+                                                                            \
+/* Get the maximum number of elements you may read at once              */  \
+unsigned int CBUFFER(_max_read)(CBUFFER() _q);                              \
+                                                                            \
+/* Get the number of available slots (max_size - size)                  */  \
+unsigned int CBUFFER(_space_available)(CBUFFER() _q);                       \
+                                                                            \
+/* Write a single sample into the buffer (producer); returns            */  \
+/* LIQUID_EIRANGE without raising an error if the buffer is full        */  \
+/*  _q  : circular buffer object                                        */  \
+/*  _v  : input sample                                                  */  \
+int CBUFFER(_push)(CBUFFER() _q,                                            \
+                   T         _v);                                           \
+                                                                            \
+/* Write a block of samples to the buffer (producer); returns           */  \
+/* LIQUID_EIRANGE without writing anything or raising an error if       */  \
+/* there is not enough space available                                  */  \
+/*  _q  : circular buffer object                                        */  \
+/*  _v  : array of samples to write to buffer                           */  \
+/*  _n  : number of samples to write                                    */  \
+int CBUFFER(_write)(CBUFFER()    _q,                                        \
+                    T *          _v,                                        \
+                    unsigned int _n);                                       \
+                                                                            \
+/* Get pointer to contiguous free space in the buffer which the         */  \
+/* producer can fill directly, avoiding a copy; samples become visible  */  \
+/* to the consumer once published with _write_commit()                  */  \
+/*  _q              : circular buffer object                            */  \
+/*  _num_requested  : number of elements requested                      */  \
+/*  _v              : output pointer                                    */  \
+/*  _num_available  : number of elements that may be written to _v     */   \
+int CBUFFER(_write_reserve)(CBUFFER()      _q,                              \
+                            unsigned int   _num_requested,                  \
+                            T **           _v,                              \
+                            unsigned int * _num_available);                 \
+                                                                            \
+/* Publish _n samples written to the space from _write_reserve()        */  \
+/*  _q : circular buffer object                                         */  \
+/*  _n : number of elements to publish                                  */  \
+int CBUFFER(_write_commit)(CBUFFER()    _q,                                 \
+                           unsigned int _n);                                \
+                                                                            \
+/* Remove and return a single element from the buffer (consumer);       */  \
+/* returns LIQUID_EIRANGE without raising an error if it is empty       */  \
+/*  _q  : circular buffer object                                        */  \
+/*  _v  : pointer to sample output                                      */  \
+int CBUFFER(_pop)(CBUFFER() _q,                                             \
+                  T *       _v);                                            \
+                                                                            \
+/* Read buffer contents by returning a pointer to the linearized array  */  \
+/* (consumer); the pointer remains valid until the samples are released */  \
+/*  _q              : circular buffer object                            */  \
+/*  _num_requested  : number of elements requested                      */  \
+/*  _v              : output pointer                                    */  \
+/*  _num_read       : number of elements referenced by _v               */  \
+int CBUFFER(_read)(CBUFFER()      _q,                                       \
+                   unsigned int   _num_requested,                           \
+                   T **           _v,                                       \
+                   unsigned int * _num_read);                               \
+                                                                            \
+/* Release _n samples from the buffer back to the producer (consumer)   */  \
+/*  _q : circular buffer object                                         */  \
+/*  _n : number of elements to release                                  */  \
+int CBUFFER(_release)(CBUFFER()    _q,                                      \
+                      unsigned int _n);                                     \
+
+// Define spsc buffer APIs
+LIQUID_CBUFFER_SPSC_DEFINE_API(LIQUID_CBUFFER_SPSC_MANGLE_FLOAT,  float)
+LIQUID_CBUFFER_SPSC_DEFINE_API(LIQUID_CBUFFER_SPSC_MANGLE_CFLOAT, liquid_float_complex)
+
 
 
 // Windowing functions
 #define LIQUID_WINDOW_MANGLE_FLOAT(name)  LIQUID_CONCAT(windowf,  name)
 #define LIQUID_WINDOW_MANGLE_CFLOAT(name) LIQUID_CONCAT(windowcf, name)
+#define LIQUID_WINDOW_MANGLE_DOUBLE(name)  LIQUID_CONCAT(windowd,  name)
+#define LIQUID_WINDOW_MANGLE_CDOUBLE(name) LIQUID_CONCAT(windowcd, name)
 
 // large macro
 //   WINDOW : name-mangling macro
@@ -541,6 +669,8 @@ int WINDOW(_write)(WINDOW()     _q,                                         \
 // Define window APIs
 LIQUID_WINDOW_DEFINE_API(LIQUID_WINDOW_MANGLE_FLOAT,  float)
 LIQUID_WINDOW_DEFINE_API(LIQUID_WINDOW_MANGLE_CFLOAT, liquid_float_complex)
+LIQUID_WINDOW_DEFINE_API(LIQUID_WINDOW_MANGLE_DOUBLE,  double)
+LIQUID_WINDOW_DEFINE_API(LIQUID_WINDOW_MANGLE_CDOUBLE, liquid_double_complex)
 //LIQUID_WINDOW_DEFINE_API(LIQUID_WINDOW_MANGLE_UINT,   unsigned int)
 
 
@@ -751,6 +881,9 @@ LIQUID_TVMPCH_DEFINE_API(LIQUID_TVMPCH_MANGLE_CCCF,
 #define LIQUID_DOTPROD_MANGLE_RRRF(name) LIQUID_CONCAT(dotprod_rrrf,name)
 #define LIQUID_DOTPROD_MANGLE_CCCF(name) LIQUID_CONCAT(dotprod_cccf,name)
 #define LIQUID_DOTPROD_MANGLE_CRCF(name) LIQUID_CONCAT(dotprod_crcf,name)
+#define LIQUID_DOTPROD_MANGLE_RRRD(name) LIQUID_CONCAT(dotprod_rrrd,name)
+#define LIQUID_DOTPROD_MANGLE_CCCD(name) LIQUID_CONCAT(dotprod_cccd,name)
+#define LIQUID_DOTPROD_MANGLE_CRCD(name) LIQUID_CONCAT(dotprod_crcd,name)
 
 // large macro
 //   DOTPROD    : name-mangling macro
@@ -818,6 +951,20 @@ void DOTPROD(_print)(DOTPROD() _q);                                         \
 void DOTPROD(_execute)(DOTPROD() _q,                                        \
                        TI *      _x,                                        \
                        TO *      _y);                                       \
+                                                                            \
+/* Execute dot product on a block of consecutive, overlapping input     */  \
+/* windows, computing _y[k] = sum_i h[i] x[k+i] for k in [0,_n). This   */  \
+/* is equivalent to calling execute() _n times on &_x[k], but keeps     */  \
+/* coefficients in registers across several outputs. The input and     */  \
+/* output arrays must not overlap.                                      */  \
+/*  _q      : dotprod object                                            */  \
+/*  _x      : input array [size: (length + _n - 1) x 1]                 */  \
+/*  _n      : number of output samples                                  */  \
+/*  _y      : output array [size: _n x 1]                               */  \
+void DOTPROD(_execute_block)(DOTPROD()    _q,                               \
+                             TI *         _x,                               \
+                             unsigned int _n,                               \
+                             TO *         _y);                              \
 
 LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_RRRF,
                           float,
@@ -834,6 +981,80 @@ LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_CRCF,
                           float,
                           liquid_float_complex)
 
+// double-precision dot products
+LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_RRRD,
+                          double,
+                          double,
+                          double)
+
+LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_CCCD,
+                          liquid_double_complex,
+                          liquid_double_complex,
+                          liquid_double_complex)
+
+LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_CRCD,
+                          liquid_double_complex,
+                          double,
+                          liquid_double_complex)
+
+//
+// fixed-point (Q15) dot product
+//
+
+// Fixed-point dot product with 16-bit (Q15) coefficients and 16-bit
+// inputs. Products are accumulated with 64-bit precision and the result
+// is rounded, shifted right by a configurable amount (default: 15), and
+// saturated to 16 bits. SIMD kernels sum adjacent pairs of products with
+// 32-bit precision (pmaddwd), so a pair where both products are
+// (-32768)*(-32768) wraps around; avoid -32768 coefficients. Complex
+// inputs are interleaved I/Q pairs and are filtered with the same real
+// coefficients.
+typedef struct dotprod_q16_s * dotprod_q16;
+
+// Create fixed-point dot product object
+//  _h      : coefficients array (Q15) [size: _n x 1]
+//  _n      : dotprod length, _n > 0
+dotprod_q16 dotprod_q16_create(int16_t *    _h,
+                               unsigned int _n);
+
+// Re-create fixed-point dot product object with new coefficients,
+// retaining output shift
+//  _q      : old dotprod object
+//  _h      : coefficients array (Q15) [size: _n x 1]
+//  _n      : dotprod length, _n > 0
+dotprod_q16 dotprod_q16_recreate(dotprod_q16  _q,
+                                 int16_t *    _h,
+                                 unsigned int _n);
+
+// Destroy dotprod object, freeing all internal memory
+int dotprod_q16_destroy(dotprod_q16 _q);
+
+// Print dotprod object internals to standard output
+int dotprod_q16_print(dotprod_q16 _q);
+
+// Set output shift (right) applied to accumulated value, _shift < 32
+int dotprod_q16_set_shift(dotprod_q16  _q,
+                          unsigned int _shift);
+
+// Get output shift (right) applied to accumulated value
+unsigned int dotprod_q16_get_shift(dotprod_q16 _q);
+
+// Execute dot product on real input array
+//  _q      : dotprod object
+//  _x      : input array [size: _n x 1]
+//  _y      : output sample pointer
+int dotprod_q16_execute(dotprod_q16 _q,
+                        int16_t *   _x,
+                        int16_t *   _y);
+
+// Execute dot product on complex input array of interleaved I/Q pairs
+//  _q      : dotprod object
+//  _x      : input array [size: 2*_n x 1]
+//  _y      : output sample [size: 2 x 1]
+int dotprod_q16_execute_cq16(dotprod_q16 _q,
+                             int16_t *   _x,
+                             int16_t *   _y);
+
 //
 // sum squared methods
 //
@@ -844,6 +1065,51 @@ float liquid_sumsqf(float *      _v,
 float liquid_sumsqcf(liquid_float_complex * _v,
                      unsigned int           _n);
 
+//
+// SIMD processor extensions
+//
+// The dotprod and sumsq methods above are resolved at run time to the
+// best set of processor extensions available on the host. The selection
+// may be overridden with the LIQUID_SIMD environment variable (e.g.
+// LIQUID_SIMD=sse) or with liquid_simd_set_type() below.
+//
+
+// number of SIMD types available, including "auto"
+#define LIQUID_SIMD_NUM_TYPES (7)
+
+// SIMD extension types
+typedef enum {
+    LIQUID_SIMD_AUTO=0,     // automatically select best available
+    LIQUID_SIMD_PORTABLE,   // portable C (no extensions)
+    LIQUID_SIMD_SSE,        // x86 SSE2/SSE3
+    LIQUID_SIMD_AVX2,       // x86 AVX2 with fused multiply-add
+    LIQUID_SIMD_AVX512,     // x86 AVX-512F
+    LIQUID_SIMD_NEON,       // ARM Neon
+    LIQUID_SIMD_ALTIVEC,    // PowerPC AltiVec
+} liquid_simd_type;
+
+// pretty names for SIMD types
+extern const char * liquid_simd_str[LIQUID_SIMD_NUM_TYPES][2];
+
+// returns SIMD type based on input string
+liquid_simd_type liquid_getopt_str2simd(const char * _str);
+
+// Print compact list of SIMD types and their availability on this host
+int liquid_print_simd_types();
+
+// Determine if SIMD type is both compiled into the library and supported
+// by the host processor
+int liquid_simd_is_available(liquid_simd_type _type);
+
+// Get SIMD type currently in use for newly-created objects
+liquid_simd_type liquid_simd_get_type(void);
+
+// Set SIMD type for newly-created objects and methods, e.g. for A/B
+// benchmarking. Setting LIQUID_SIMD_AUTO restores the default selection.
+// Objects created before this call retain their original selection.
+//  _type   : SIMD type, e.g. LIQUID_SIMD_SSE
+int liquid_simd_set_type(liquid_simd_type _type);
+
 
 //
 // MODULE : equalization
@@ -1433,9 +1699,20 @@ typedef enum {
     // modified discrete cosine transform
     LIQUID_FFT_MDCT     =  30,  // MDCT
     LIQUID_FFT_IMDCT    =  31,  // IMDCT
+
+    // transforms of real-valued signals (non-redundant half-spectrum)
+    LIQUID_FFT_R2C      =  40,  // real-input one-dimensional FFT
+    LIQUID_FFT_C2R      =  41,  // real-output one-dimensional inverse FFT
 } liquid_fft_type;
 
-#define LIQUID_FFT_MANGLE_FLOAT(name) LIQUID_CONCAT(fft,name)
+// planner flags for creating transforms; methods recorded as wisdom (either
+// measured or imported from a file) are always preferred when available
+#define LIQUID_FFT_ESTIMATE (0)     // select method heuristically (default)
+#define LIQUID_FFT_MEASURE  (1<<0)  // time candidate methods, keep fastest
+#define LIQUID_FFT_THREADS  (1<<1)  // prefer methods that can use several threads
+
+#define LIQUID_FFT_MANGLE_FLOAT(name)  LIQUID_CONCAT(fft,name)
+#define LIQUID_FFT_MANGLE_DOUBLE(name) LIQUID_CONCAT(fftd,name)
 
 // Macro    :   FFT
 //  FFT     :   name-mangling macro
@@ -1451,13 +1728,67 @@ typedef struct FFT(plan_s) * FFT(plan);                                     \
 /*  _x      :   pointer to input array  [size: _n x 1]                  */  \
 /*  _y      :   pointer to output array [size: _n x 1]                  */  \
 /*  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)                     */  \
-/*  _flags  :   options, optimization                                   */  \
+/*  _flags  :   planner flags (e.g. LIQUID_FFT_MEASURE)                 */  \
 FFT(plan) FFT(_create_plan)(unsigned int _n,                                \
                             TC *         _x,                                \
                             TC *         _y,                                \
                             int          _dir,                              \
                             int          _flags);                           \
                                                                             \
+/* Create batch of regular complex one-dimensional transforms of the    */  \
+/* same size, computed together. Element i of transform b is read from  */  \
+/* _x[b*_idist + i*_istride] and written to _y[b*_odist + i*_ostride],  */  \
+/* so that e.g. contiguous transforms use _istride=1, _idist=_n and     */  \
+/* interleaved transforms use _istride=_howmany, _idist=1. Small non-   */  \
+/* contiguous transforms whose size is a power of two are computed      */  \
+/* several at a time across SIMD lanes, sharing twiddle factor loads. The */  \
+/* output may overwrite the input only if both have the same layout.    */  \
+/*  _n       :   transform size                                         */  \
+/*  _howmany :   number of transforms                                   */  \
+/*  _x       :   pointer to input array                                 */  \
+/*  _istride :   input distance between samples, _istride > 0           */  \
+/*  _idist   :   input distance between transforms                      */  \
+/*  _y       :   pointer to output array                                */  \
+/*  _ostride :   output distance between samples, _ostride > 0          */  \
+/*  _odist   :   output distance between transforms                     */  \
+/*  _dir     :   direction (e.g. LIQUID_FFT_FORWARD)                    */  \
+/*  _flags   :   planner flags (e.g. LIQUID_FFT_MEASURE)                */  \
+FFT(plan) FFT(_create_plan_many)(unsigned int _n,                           \
+                                 unsigned int _howmany,                     \
+                                 TC *         _x,                           \
+                                 unsigned int _istride,                     \
+                                 unsigned int _idist,                       \
+                                 TC *         _y,                           \
+                                 unsigned int _ostride,                     \
+                                 unsigned int _odist,                       \
+                                 int          _dir,                         \
+                                 int          _flags);                      \
+                                                                            \
+/* Create regular complex one-dimensional transform of an input with    */  \
+/* only its first _num_in samples non-zero (e.g. zero-padded), of which */  \
+/* only the _num_out outputs starting at index _out_offset (wrapping    */  \
+/* around modulo _n) are required. Butterflies operating only on zeros  */  \
+/* or producing unused outputs are skipped where this reduces the cost, */  \
+/* which is substantial when only a small fraction of the input or      */  \
+/* output is used. Input samples beyond _num_in must be zero (they may  */  \
+/* or may not be read) and other output samples are undefined.          */  \
+/*  _n          :   transform size                                      */  \
+/*  _x          :   pointer to input array  [size: _n x 1]              */  \
+/*  _y          :   pointer to output array [size: _n x 1]              */  \
+/*  _dir        :   direction (e.g. LIQUID_FFT_FORWARD)                 */  \
+/*  _flags      :   planner flags (e.g. LIQUID_FFT_MEASURE)             */  \
+/*  _num_in     :   number of non-zero input samples, in [1,_n]         */  \
+/*  _out_offset :   index of first required output, in [0,_n)           */  \
+/*  _num_out    :   number of required outputs, in [1,_n]               */  \
+FFT(plan) FFT(_create_plan_pruned)(unsigned int _n,                         \
+                                   TC *         _x,                         \
+                                   TC *         _y,                         \
+                                   int          _dir,                       \
+                                   int          _flags,                     \
+                                   unsigned int _num_in,                    \
+                                   unsigned int _out_offset,                \
+                                   unsigned int _num_out);                  \
+                                                                            \
 /* Create real-to-real one-dimensional transform                        */  \
 /*  _n      :   transform size                                          */  \
 /*  _x      :   pointer to input array  [size: _n x 1]                  */  \
@@ -1470,6 +1801,30 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _n,                         \
                                    int          _type,                      \
                                    int          _flags);                    \
                                                                             \
+/* Create real-input one-dimensional transform, computing the non-      */  \
+/* redundant half of the spectrum, X[k] for k in [0, _n/2]. Even sizes  */  \
+/* require only a complex transform of half the size.                   */  \
+/*  _n      :   transform size                                          */  \
+/*  _x      :   pointer to real input array [size: _n x 1]              */  \
+/*  _y      :   pointer to output array [size: _n/2+1 x 1]              */  \
+/*  _flags  :   planner flags (e.g. LIQUID_FFT_MEASURE)                 */  \
+FFT(plan) FFT(_create_plan_r2c)(unsigned int _n,                            \
+                                T *          _x,                            \
+                                TC *         _y,                            \
+                                int          _flags);                       \
+                                                                            \
+/* Create real-output one-dimensional transform, the inverse of the     */  \
+/* real-input transform: like the complex backward transform the output */  \
+/* is not normalized, i.e. is scaled by _n. The input is not modified.  */  \
+/*  _n      :   transform size                                          */  \
+/*  _x      :   pointer to input array [size: _n/2+1 x 1]               */  \
+/*  _y      :   pointer to real output array [size: _n x 1]             */  \
+/*  _flags  :   planner flags (e.g. LIQUID_FFT_MEASURE)                 */  \
+FFT(plan) FFT(_create_plan_c2r)(unsigned int _n,                            \
+                                TC *         _x,                            \
+                                T *          _y,                            \
+                                int          _flags);                       \
+                                                                            \
 /* Destroy transform and free all internally-allocated memory           */  \
 int FFT(_destroy_plan)(FFT(plan) _p);                                       \
                                                                             \
@@ -1481,6 +1836,33 @@ int FFT(_print_plan)(FFT(plan) _p);                                         \
 /* Run the transform                                                    */  \
 int FFT(_execute)(FFT(plan) _p);                                            \
                                                                             \
+/* Set number of threads used to run the transform (default: 1). Large  */  \
+/* transforms computed with the four-step algorithm (selected for large */  \
+/* sizes when the plan is created with LIQUID_FFT_THREADS) split their  */  \
+/* independent sub-transforms between threads. Other plans of at least  */  \
+/* 32768 points with a suitable factor are switched to the four-step    */  \
+/* algorithm; the remaining plans cannot be split and LIQUID_EIMODE is  */  \
+/* returned for more than one thread. The output does not depend on     */  \
+/* the number of threads. Worker threads are started here and reused by */  \
+/* each transform; additional threads allocate their own work buffers.  */  \
+/*  _p      : transform plan                                            */  \
+/*  _n      : number of threads, _n > 0                                 */  \
+int FFT(_set_num_threads)(FFT(plan) _p, unsigned int _n);                   \
+                                                                            \
+/* Run a complex transform on arrays other than those given when the    */  \
+/* plan was created, avoiding copies into and out of the plan's arrays. */  \
+/* The arrays must have the same size and layout as at creation, and    */  \
+/* _y may equal _x only if the plan was created in place. The plan      */  \
+/* keeps its own work buffers, so a plan must not be executed from      */  \
+/* several threads at once; create one plan per thread instead (plans   */  \
+/* of the same size share their read-only tables).                      */  \
+/*  _p      : complex (forward or backward) transform plan              */  \
+/*  _x      : input array [size: _n x 1]                                */  \
+/*  _y      : output array [size: _n x 1]                               */  \
+int FFT(_execute_arrays)(FFT(plan) _p,                                      \
+                         TC *      _x,                                      \
+                         TC *      _y);                                     \
+                                                                            \
 /* Perform n-point FFT allocating plan internally                       */  \
 /*  _nfft   : fft size                                                  */  \
 /*  _x      : input array [size: _nfft x 1]                             */  \
@@ -1505,6 +1887,22 @@ int FFT(_r2r_1d_run)(unsigned int _n,                                       \
                      int          _type,                                    \
                      int          _flags);                                  \
                                                                             \
+/* Export planner wisdom (methods selected by measurement for each      */  \
+/* transform size) to a file so that it can be imported later, e.g.     */  \
+/* after restarting an application, without measuring again.            */  \
+/*  _filename  : output filename                                        */  \
+int FFT(_wisdom_export)(const char * _filename);                            \
+                                                                            \
+/* Import planner wisdom from a file, merging with existing wisdom.     */  \
+/* Imported methods are used for all plans subsequently created with    */  \
+/* the same size and LIQUID_FFT_THREADS flag. Existing wisdom is        */  \
+/* unchanged if the file is invalid.                                    */  \
+/*  _filename  : input filename                                         */  \
+int FFT(_wisdom_import)(const char * _filename);                            \
+                                                                            \
+/* Forget all planner wisdom                                            */  \
+int FFT(_wisdom_clear)(void);                                               \
+                                                                            \
 /* Perform _n-point fft shift                                           */  \
 /*  _x      : input array [size: _n x 1]                                */  \
 /*  _n      : input array size                                          */  \
@@ -1514,6 +1912,10 @@ int FFT(_shift)(TC *         _x,                                            \
 
 LIQUID_FFT_DEFINE_API(LIQUID_FFT_MANGLE_FLOAT,float,liquid_float_complex)
 
+// double-precision transforms (e.g. fftd_create_plan()); these use the
+// portable radix-4 stages and never fftw, regardless of configuration
+LIQUID_FFT_DEFINE_API(LIQUID_FFT_MANGLE_DOUBLE,double,liquid_double_complex)
+
 // antiquated fft methods
 // FFT(plan) FFT(_create_plan_mdct)(unsigned int _n,
 //                                  T * _x,
@@ -1528,6 +1930,8 @@ LIQUID_FFT_DEFINE_API(LIQUID_FFT_MANGLE_FLOAT,float,liquid_float_complex)
 
 #define LIQUID_SPGRAM_MANGLE_CFLOAT(name) LIQUID_CONCAT(spgramcf,name)
 #define LIQUID_SPGRAM_MANGLE_FLOAT(name)  LIQUID_CONCAT(spgramf, name)
+#define LIQUID_SPGRAM_MANGLE_CDOUBLE(name) LIQUID_CONCAT(spgramcd,name)
+#define LIQUID_SPGRAM_MANGLE_DOUBLE(name)  LIQUID_CONCAT(spgramd, name)
 
 #define LIQUID_SPGRAM_PSD_MIN (1e-12)
 
@@ -1679,6 +2083,17 @@ LIQUID_SPGRAM_DEFINE_API(LIQUID_SPGRAM_MANGLE_FLOAT,
                          liquid_float_complex,
                          float)
 
+// double-precision periodograms (e.g. spgramcd_create()) using fftd
+LIQUID_SPGRAM_DEFINE_API(LIQUID_SPGRAM_MANGLE_CDOUBLE,
+                         double,
+                         liquid_double_complex,
+                         liquid_double_complex)
+
+LIQUID_SPGRAM_DEFINE_API(LIQUID_SPGRAM_MANGLE_DOUBLE,
+                         double,
+                         liquid_double_complex,
+                         double)
+
 //
 // asgram : ascii spectral periodogram
 //
@@ -1888,6 +2303,65 @@ LIQUID_SPWATERFALL_DEFINE_API(LIQUID_SPWATERFALL_MANGLE_FLOAT,
                               liquid_float_complex,
                               float)
 
+//
+// sdft : sliding discrete Fourier transform
+//
+
+// Sliding DFT object: maintains selected bins of an nfft-point transform
+// over the most recent nfft input samples, updated with each sample in
+// O(num_bins) operations. Bins are recomputed exactly from the input
+// buffer every nfft samples to keep rounding errors from accumulating.
+typedef struct sdft_cccf_s * sdft_cccf;
+
+// Create sliding DFT object tracking all bins
+//  _nfft   : transform size, _nfft > 0
+sdft_cccf sdft_cccf_create(unsigned int _nfft);
+
+// Create sliding DFT object tracking a set of bins
+//  _nfft       : transform size, _nfft > 0
+//  _bins       : bin indices to track, in [0,_nfft), [size: _num_bins x 1]
+//  _num_bins   : number of bins to track, _num_bins > 0
+sdft_cccf sdft_cccf_create_bins(unsigned int   _nfft,
+                                unsigned int * _bins,
+                                unsigned int   _num_bins);
+
+// Destroy sliding DFT object, freeing all internal memory
+int sdft_cccf_destroy(sdft_cccf _q);
+
+// Print sliding DFT object properties to stdout
+int sdft_cccf_print(sdft_cccf _q);
+
+// Reset sliding DFT object: clear input buffer and bins
+int sdft_cccf_reset(sdft_cccf _q);
+
+// Get transform size
+unsigned int sdft_cccf_get_nfft(sdft_cccf _q);
+
+// Get number of tracked bins
+unsigned int sdft_cccf_get_num_bins(sdft_cccf _q);
+
+// Push single sample into object, updating all tracked bins
+//  _q  : sliding DFT object
+//  _x  : input sample
+int sdft_cccf_push(sdft_cccf            _q,
+                   liquid_float_complex _x);
+
+// Write block of samples into object, updating all tracked bins
+//  _q  : sliding DFT object
+//  _x  : input buffer, [size: _n x 1]
+//  _n  : input buffer length
+int sdft_cccf_write(sdft_cccf              _q,
+                    liquid_float_complex * _x,
+                    unsigned int           _n);
+
+// Get tracked bins of the (unnormalized, forward) transform over the
+// most recent nfft samples, in the order given at creation, where the
+// oldest sample in the window has time index zero
+//  _q  : sliding DFT object
+//  _X  : output bins, [size: num_bins x 1]
+int sdft_cccf_get_bins(sdft_cccf              _q,
+                       liquid_float_complex * _X);
+
 
 //
 // MODULE : filter
@@ -2527,6 +3001,9 @@ LIQUID_AUTOCORR_DEFINE_API(LIQUID_AUTOCORR_MANGLE_RRRF,
 #define LIQUID_FIRFILT_MANGLE_RRRF(name) LIQUID_CONCAT(firfilt_rrrf,name)
 #define LIQUID_FIRFILT_MANGLE_CRCF(name) LIQUID_CONCAT(firfilt_crcf,name)
 #define LIQUID_FIRFILT_MANGLE_CCCF(name) LIQUID_CONCAT(firfilt_cccf,name)
+#define LIQUID_FIRFILT_MANGLE_RRRD(name) LIQUID_CONCAT(firfilt_rrrd,name)
+#define LIQUID_FIRFILT_MANGLE_CRCD(name) LIQUID_CONCAT(firfilt_crcd,name)
+#define LIQUID_FIRFILT_MANGLE_CCCD(name) LIQUID_CONCAT(firfilt_cccd,name)
 
 // Macro:
 //   FIRFILT    : name-mangling macro
@@ -2659,6 +3136,19 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,                               \
                              unsigned int _n,                               \
                              TO *         _y);                              \
                                                                             \
+/* Declare typical block size for execute_block(). When the filter is   */  \
+/* long enough, each full block of this size is computed with overlap-  */  \
+/* save FFT convolution instead of dot products; the outputs and the    */  \
+/* internal state are the same either way, so push() and execute() may  */  \
+/* still be mixed with block calls.                                     */  \
+/*  _q      : filter object                                             */  \
+/*  _n      : block size, 0 to always use dot products (default)        */  \
+int FIRFILT(_set_block_size)(FIRFILT()    _q,                               \
+                             unsigned int _n);                              \
+                                                                            \
+/* Get block size declared with set_block_size()                        */  \
+unsigned int FIRFILT(_get_block_size)(FIRFILT() _q);                        \
+                                                                            \
 /* Get length of filter object (number of internal coefficients)        */  \
 unsigned int FIRFILT(_get_length)(FIRFILT() _q);                            \
                                                                             \
@@ -2691,6 +3181,104 @@ LIQUID_FIRFILT_DEFINE_API(LIQUID_FIRFILT_MANGLE_CCCF,
                           liquid_float_complex,
                           liquid_float_complex)
 
+// double-precision filters; design methods (e.g. _create_kaiser) still
+// run in single precision with coefficients promoted to double
+LIQUID_FIRFILT_DEFINE_API(LIQUID_FIRFILT_MANGLE_RRRD,
+                          double,
+                          double,
+                          double)
+
+LIQUID_FIRFILT_DEFINE_API(LIQUID_FIRFILT_MANGLE_CRCD,
+                          liquid_double_complex,
+                          double,
+                          liquid_double_complex)
+
+LIQUID_FIRFILT_DEFINE_API(LIQUID_FIRFILT_MANGLE_CCCD,
+                          liquid_double_complex,
+                          liquid_double_complex,
+                          liquid_double_complex)
+
+//
+// Fixed-point (Q15) finite impulse response filter
+//
+// Coefficients are 16-bit Q15 values. Samples are 16-bit integers: one
+// value per sample for q16 (real) and two values (interleaved I/Q) per
+// sample for cq16 (complex). Each output is the accumulated sum shifted
+// right by a configurable amount (default: 15) and saturated.
+//
+
+#define LIQUID_FIRFILT_Q16_MANGLE_Q16(name)  LIQUID_CONCAT(firfilt_q16, name)
+#define LIQUID_FIRFILT_Q16_MANGLE_CQ16(name) LIQUID_CONCAT(firfilt_cq16,name)
+
+// Macro:
+//   FIRFILT    : name-mangling macro
+#define LIQUID_FIRFILT_Q16_DEFINE_API(FIRFILT)                              \
+                                                                            \
+/* Fixed-point finite impulse response filter                           */  \
+typedef struct FIRFILT(_s) * FIRFILT();                                     \
+                                                                            \
+/* Create fixed-point filter object from Q15 coefficients               */  \
+/*  _h      : filter coefficients (Q15) [size: _n x 1]                  */  \
+/*  _n      : number of filter coefficients, _n > 0                     */  \
+FIRFILT() FIRFILT(_create)(int16_t *    _h,                                 \
+                           unsigned int _n);                                \
+                                                                            \
+/* Create object using Kaiser-Bessel windowed sinc method, quantizing   */  \
+/* coefficients to Q15 in [-32767,32767] so that all kernels agree      */  \
+/*  _n      : filter length, _n > 0                                     */  \
+/*  _fc     : filter normalized cut-off frequency, 0 < _fc < 0.5        */  \
+/*  _As     : filter stop-band attenuation [dB], _As > 0                */  \
+/*  _mu     : fractional sample offset, -0.5 < _mu < 0.5                */  \
+FIRFILT() FIRFILT(_create_kaiser)(unsigned int _n,                          \
+                                  float        _fc,                         \
+                                  float        _As,                         \
+                                  float        _mu);                        \
+                                                                            \
+/* Destroy filter object and free all internal memory                   */  \
+int FIRFILT(_destroy)(FIRFILT() _q);                                        \
+                                                                            \
+/* Reset filter object's internal buffer                                */  \
+int FIRFILT(_reset)(FIRFILT() _q);                                          \
+                                                                            \
+/* Print filter object information to stdout                            */  \
+int FIRFILT(_print)(FIRFILT() _q);                                          \
+                                                                            \
+/* Set output shift (right) applied to accumulated value, _shift < 32   */  \
+int FIRFILT(_set_shift)(FIRFILT() _q, unsigned int _shift);                 \
+                                                                            \
+/* Get output shift (right) applied to accumulated value                */  \
+unsigned int FIRFILT(_get_shift)(FIRFILT() _q);                             \
+                                                                            \
+/* Push sample into filter object's internal buffer                     */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : single input sample [size: 1 x 1 (q16), 2 x 1 (cq16)]     */  \
+int FIRFILT(_push)(FIRFILT() _q,                                            \
+                   int16_t * _x);                                           \
+                                                                            \
+/* Execute vector dot product on the filter's internal buffer and       */  \
+/* coefficients                                                         */  \
+/*  _q      : filter object                                             */  \
+/*  _y      : output sample [size: 1 x 1 (q16), 2 x 1 (cq16)]           */  \
+int FIRFILT(_execute)(FIRFILT() _q,                                         \
+                      int16_t * _y);                                        \
+                                                                            \
+/* Execute the filter on a block of input samples; in-place operation   */  \
+/* is permitted (_x and _y may point to the same place in memory)       */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : input samples [size: _n x 1 (q16), 2*_n x 1 (cq16)]       */  \
+/*  _n      : number of input, output samples                           */  \
+/*  _y      : output samples [size: _n x 1 (q16), 2*_n x 1 (cq16)]      */  \
+int FIRFILT(_execute_block)(FIRFILT()    _q,                                \
+                            int16_t *    _x,                                \
+                            unsigned int _n,                                \
+                            int16_t *    _y);                               \
+                                                                            \
+/* Get length of filter object (number of internal coefficients)        */  \
+unsigned int FIRFILT(_get_length)(FIRFILT() _q);                            \
+
+LIQUID_FIRFILT_Q16_DEFINE_API(LIQUID_FIRFILT_Q16_MANGLE_Q16)
+LIQUID_FIRFILT_Q16_DEFINE_API(LIQUID_FIRFILT_Q16_MANGLE_CQ16)
+
 //
 // FIR Hilbert transform
 //  2:1 real-to-complex decimator
@@ -2906,10 +3494,12 @@ LIQUID_IIRHILB_DEFINE_API(LIQUID_IIRHILB_MANGLE_FLOAT, float, liquid_float_compl
 /* Fast Fourier transform (FFT) finite impulse response filter          */  \
 typedef struct FFTFILT(_s) * FFTFILT();                                     \
                                                                             \
-/* Create FFT-based FIR filter using external coefficients              */  \
+/* Create FFT-based FIR filter using external coefficients. The block  */  \
+/* size sets the latency; filters longer than _n+1 taps are split into  */  \
+/* partitions of _n taps, each transformed with the same 2*_n-point FFT */  \
 /*  _h      : filter coefficients, [size: _h_len x 1]                   */  \
 /*  _h_len  : filter length, _h_len > 0                                 */  \
-/*  _n      : block size = nfft/2, _n >= _h_len-1                       */  \
+/*  _n      : block size = nfft/2, _n > 0                               */  \
 FFTFILT() FFTFILT(_create)(TC *         _h,                                 \
                            unsigned int _h_len,                             \
                            unsigned int _n);                                \
@@ -2943,6 +3533,9 @@ void FFTFILT(_execute)(FFTFILT() _q,                                        \
                                                                             \
 /* Get length of filter object's internal coefficients                  */  \
 unsigned int FFTFILT(_get_length)(FFTFILT() _q);                            \
+                                                                            \
+/* Get number of partitions of filter coefficients, ceil((h_len-1)/_n)  */  \
+unsigned int FFTFILT(_get_num_partitions)(FFTFILT() _q);                    \
 
 LIQUID_FFTFILT_DEFINE_API(LIQUID_FFTFILT_MANGLE_RRRF,
                           float,
@@ -2967,6 +3560,9 @@ LIQUID_FFTFILT_DEFINE_API(LIQUID_FFTFILT_MANGLE_CCCF,
 #define LIQUID_IIRFILT_MANGLE_RRRF(name) LIQUID_CONCAT(iirfilt_rrrf,name)
 #define LIQUID_IIRFILT_MANGLE_CRCF(name) LIQUID_CONCAT(iirfilt_crcf,name)
 #define LIQUID_IIRFILT_MANGLE_CCCF(name) LIQUID_CONCAT(iirfilt_cccf,name)
+#define LIQUID_IIRFILT_MANGLE_RRRD(name) LIQUID_CONCAT(iirfilt_rrrd,name)
+#define LIQUID_IIRFILT_MANGLE_CRCD(name) LIQUID_CONCAT(iirfilt_crcd,name)
+#define LIQUID_IIRFILT_MANGLE_CCCD(name) LIQUID_CONCAT(iirfilt_cccd,name)
 
 // Macro:
 //   IIRFILT : name-mangling macro
@@ -3111,6 +3707,23 @@ LIQUID_IIRFILT_DEFINE_API(LIQUID_IIRFILT_MANGLE_CCCF,
                           liquid_float_complex,
                           liquid_float_complex)
 
+// double-precision filters; design methods (e.g. _create_kaiser) still
+// run in single precision with coefficients promoted to double
+LIQUID_IIRFILT_DEFINE_API(LIQUID_IIRFILT_MANGLE_RRRD,
+                          double,
+                          double,
+                          double)
+
+LIQUID_IIRFILT_DEFINE_API(LIQUID_IIRFILT_MANGLE_CRCD,
+                          liquid_double_complex,
+                          double,
+                          liquid_double_complex)
+
+LIQUID_IIRFILT_DEFINE_API(LIQUID_IIRFILT_MANGLE_CCCD,
+                          liquid_double_complex,
+                          liquid_double_complex,
+                          liquid_double_complex)
+
 
 //
 // FIR Polyphase filter bank
@@ -3583,6 +4196,72 @@ LIQUID_FIRDECIM_DEFINE_API(LIQUID_FIRDECIM_MANGLE_CCCF,
                            liquid_float_complex,
                            liquid_float_complex)
 
+// firdecim_q16 : fixed-point (Q15) finite impulse response decimator
+#define LIQUID_FIRDECIM_Q16_MANGLE_Q16(name)  LIQUID_CONCAT(firdecim_q16, name)
+#define LIQUID_FIRDECIM_Q16_MANGLE_CQ16(name) LIQUID_CONCAT(firdecim_cq16,name)
+
+#define LIQUID_FIRDECIM_Q16_DEFINE_API(FIRDECIM)                            \
+                                                                            \
+/* Fixed-point finite impulse response decimator; samples are 16-bit    */  \
+/* integers, interleaved I/Q for cq16, and coefficients are Q15         */  \
+typedef struct FIRDECIM(_s) * FIRDECIM();                                   \
+                                                                            \
+/* Create decimator from Q15 coefficients                               */  \
+/*  _M      : decimation factor, _M >= 2                                */  \
+/*  _h      : filter coefficients (Q15) [size: _h_len x 1]              */  \
+/*  _h_len  : filter length, _h_len >= _M                               */  \
+FIRDECIM() FIRDECIM(_create)(unsigned int _M,                               \
+                             int16_t *    _h,                               \
+                             unsigned int _h_len);                          \
+                                                                            \
+/* Create decimator from Kaiser prototype, quantizing coefficients to   */  \
+/* Q15 in [-32767,32767] so that all kernels agree                      */  \
+/*  _M      : decimation factor, _M >= 2                                */  \
+/*  _m      : filter delay (symbols), _m >= 1                           */  \
+/*  _As     : stop-band attenuation [dB], _As >= 0                      */  \
+FIRDECIM() FIRDECIM(_create_kaiser)(unsigned int _M,                        \
+                                    unsigned int _m,                        \
+                                    float        _As);                      \
+                                                                            \
+/* Destroy decimator object, freeing all internal memory                */  \
+int FIRDECIM(_destroy)(FIRDECIM() _q);                                      \
+                                                                            \
+/* Print decimator object properties to stdout                          */  \
+int FIRDECIM(_print)(FIRDECIM() _q);                                        \
+                                                                            \
+/* Reset decimator object internal state                                */  \
+int FIRDECIM(_reset)(FIRDECIM() _q);                                        \
+                                                                            \
+/* Get decimation rate                                                  */  \
+unsigned int FIRDECIM(_get_decim_rate)(FIRDECIM() _q);                      \
+                                                                            \
+/* Set output shift (right) applied to accumulated value, _shift < 32   */  \
+int FIRDECIM(_set_shift)(FIRDECIM() _q, unsigned int _shift);               \
+                                                                            \
+/* Get output shift (right) applied to accumulated value                */  \
+unsigned int FIRDECIM(_get_shift)(FIRDECIM() _q);                           \
+                                                                            \
+/* Execute decimator on _M input samples                                */  \
+/*  _q      : decimator object                                          */  \
+/*  _x      : input samples [size: _M x 1 (q16), 2*_M x 1 (cq16)]       */  \
+/*  _y      : output sample [size: 1 x 1 (q16), 2 x 1 (cq16)]           */  \
+int FIRDECIM(_execute)(FIRDECIM() _q,                                       \
+                       int16_t *  _x,                                       \
+                       int16_t *  _y);                                      \
+                                                                            \
+/* Execute decimator on block of _n*_M input samples                    */  \
+/*  _q      : decimator object                                          */  \
+/*  _x      : input array [size: _n*_M x 1 (q16), 2*_n*_M x 1 (cq16)]   */  \
+/*  _n      : number of _output_ samples                                */  \
+/*  _y      : output array [size: _n x 1 (q16), 2*_n x 1 (cq16)]        */  \
+int FIRDECIM(_execute_block)(FIRDECIM()   _q,                               \
+                             int16_t *    _x,                               \
+                             unsigned int _n,                               \
+                             int16_t *    _y);                              \
+
+LIQUID_FIRDECIM_Q16_DEFINE_API(LIQUID_FIRDECIM_Q16_MANGLE_Q16)
+LIQUID_FIRDECIM_Q16_DEFINE_API(LIQUID_FIRDECIM_Q16_MANGLE_CQ16)
+
 
 // iirdecim : infinite impulse response decimator
 #define LIQUID_IIRDECIM_MANGLE_RRRF(name) LIQUID_CONCAT(iirdecim_rrrf,name)
@@ -7293,6 +7972,11 @@ float fskdem_get_symbol_energy(fskdem       _q,
                                unsigned int _s,
                                unsigned int _range);
 
+// select bank of single-bin detectors (1) or full transform (0) for
+// demodulation; by default the cheaper is chosen at creation
+int fskdem_set_bank(fskdem _q,
+                    int    _bank);
+
 
 //
 // Analog frequency modulator
@@ -8805,6 +9489,47 @@ void VECTOR(_normalize)(T *          _x,                                    \
 LIQUID_VECTOR_DEFINE_API(LIQUID_VECTOR_MANGLE_RF, float,                float)
 LIQUID_VECTOR_DEFINE_API(LIQUID_VECTOR_MANGLE_CF, liquid_float_complex, float)
 
+//
+// element-wise transcendental functions (real)
+//
+
+// Compute sine and cosine of each element: s[i] = sin(theta[i]),
+// c[i] = cos(theta[i]). SIMD kernels evaluate polynomials after range
+// reduction, with absolute error below 1e-7 for |theta| <= 8192 and the
+// C library used beyond.
+void liquid_vectorf_sincos(float *      _theta,
+                           unsigned int _n,
+                           float *      _s,
+                           float *      _c);
+
+// Compute four-quadrant arctangent of each element pair:
+// theta[i] = atan2(y[i], x[i]) in [-pi,pi], with absolute error below
+// 4e-7 in SIMD kernels; atan2(0,0) is zero
+void liquid_vectorf_atan2(float *      _y,
+                          float *      _x,
+                          unsigned int _n,
+                          float *      _theta);
+
+// Compute base-10 logarithm of each element: y[i] = log10(x[i]), with
+// relative error below 2e-7 in SIMD kernels. Zero maps to -infinity and
+// negative values to NaN; subnormal inputs are treated as FLT_MIN.
+void liquid_vectorf_log10(float *      _x,
+                          unsigned int _n,
+                          float *      _y);
+
+// Convert each element to decibels: y[i] = 10 log10(x[i]), with relative
+// error below 3e-7 in SIMD kernels
+void liquid_vectorf_db(float *      _x,
+                       unsigned int _n,
+                       float *      _y);
+
+// Compute exponential of each element: y[i] = exp(x[i]), with relative
+// error below 2e-7 in SIMD kernels. Inputs above 88.72 overflow to
+// infinity and results below the subnormal range underflow to zero.
+void liquid_vectorf_exp(float *      _x,
+                        unsigned int _n,
+                        float *      _y);
+
 //
 // mixed types
 //
@@ -36,6 +36,7 @@
 #include "config.h"
 
 #include <stdarg.h>
+#include <stddef.h>
 #include <complex.h>
 #include "liquid.h"
 
@@ -67,6 +68,8 @@ void * liquid_error_config_fl(const char * _file, int _line, const char * _forma
 
 #define PRINTVAL_FLOAT(X,F)     printf(#F,crealf(X));
 #define PRINTVAL_CFLOAT(X,F)    printf(#F "+j*" #F, crealf(X), cimagf(X));
+#define PRINTVAL_DOUBLE(X,F)    printf(#F,creal(X));
+#define PRINTVAL_CDOUBLE(X,F)   printf(#F "+j*" #F, creal(X), cimag(X));
 
 //
 // MODULE : agc
@@ -82,11 +85,302 @@ void * liquid_error_config_fl(const char * _file, int _line, const char * _forma
 // MODULE : buffer
 //
 
+// assumed size of cache line for keeping data accessed by different
+// threads apart
+#define LIQUID_CACHE_LINE_SIZE      (64)
+
+// Default minimum ring size in bytes for window and cbuffer objects to be
+// backed by memory mapped twice contiguously (where supported), giving
+// contiguous reads without copies; smaller rings are not worth the two
+// mappings and extra system calls per object
+#define LIQUID_BUFFER_MIRROR_MIN    (65536)
+
+// allocate ring buffer memory mapped twice back to back, returning NULL
+// if not supported or if _size is below liquid_buffer_mirror_get_min();
+// [p, p+capacity) and [p+capacity, p+2*capacity) alias the same memory.
+// Each allocation holds two mappings (the memfd used to create them is
+// closed before returning) which a forked child shares with the parent.
+//  _size       : minimum size of ring in bytes
+//  _capacity   : resulting size in bytes, power of two multiple of page
+void * liquid_mirror_alloc(size_t   _size,
+                           size_t * _capacity);
+
+// free memory allocated with liquid_mirror_alloc()
+int liquid_mirror_free(void * _p,
+                       size_t _capacity);
+
 
 //
 // MODULE : dotprod
 //
 
+#define LIQUID_DOTPROD_DEFINE_INTERNAL_API(DOTPROD,TO,TC,TI)        \
+                                                                    \
+/* execute dot product on a block of input windows, each        */  \
+/* advanced by _stride samples from the previous one:           */  \
+/*   _y[k] = sum_i h[i] _x[k*_stride + i]                       */  \
+/*  _q      : dotprod object                                    */  \
+/*  _x      : input array [size: (length + (_n-1)*_stride) x 1] */  \
+/*  _stride : input advance between outputs, _stride > 0        */  \
+/*  _n      : number of output samples                          */  \
+/*  _y      : output array [size: _n x 1]                       */  \
+void DOTPROD(_execute_block_stride)(DOTPROD()    _q,                \
+                                    TI *         _x,                \
+                                    unsigned int _stride,           \
+                                    unsigned int _n,                \
+                                    TO *         _y);               \
+
+LIQUID_DOTPROD_DEFINE_INTERNAL_API(LIQUID_DOTPROD_MANGLE_RRRF,
+                                   float,
+                                   float,
+                                   float)
+
+LIQUID_DOTPROD_DEFINE_INTERNAL_API(LIQUID_DOTPROD_MANGLE_CCCF,
+                                   liquid_float_complex,
+                                   liquid_float_complex,
+                                   liquid_float_complex)
+
+LIQUID_DOTPROD_DEFINE_INTERNAL_API(LIQUID_DOTPROD_MANGLE_CRCF,
+                                   liquid_float_complex,
+                                   float,
+                                   liquid_float_complex)
+
+LIQUID_DOTPROD_DEFINE_INTERNAL_API(LIQUID_DOTPROD_MANGLE_RRRD,
+                                   double,
+                                   double,
+                                   double)
+
+LIQUID_DOTPROD_DEFINE_INTERNAL_API(LIQUID_DOTPROD_MANGLE_CCCD,
+                                   liquid_double_complex,
+                                   liquid_double_complex,
+                                   liquid_double_complex)
+
+LIQUID_DOTPROD_DEFINE_INTERNAL_API(LIQUID_DOTPROD_MANGLE_CRCD,
+                                   liquid_double_complex,
+                                   double,
+                                   liquid_double_complex)
+
+// fixed-point (Q15) dot product object
+struct dotprod_q16_s {
+    unsigned int n;     // length
+    int16_t * h;        // coefficients array
+    int16_t * hc;       // coefficients for complex input, in pairs
+                        //  { h[0], h[1], h[0], h[1], h[2], h[3], ... }
+    unsigned int shift; // output shift (right)
+#if LIQUID_SIMD_DISPATCH
+    const struct liquid_simd_kernels_s * simd; // kernels
+#endif
+};
+
+// round, shift, and saturate accumulated value to 16 bits
+//  _v      : accumulated value
+//  _shift  : output shift (right)
+int16_t dotprod_q16_output(int64_t      _v,
+                           unsigned int _shift);
+
+// quantize coefficient to Q15, rounding and saturating to [-32767,32767];
+// -32768 is excluded as it can wrap in the SIMD kernels
+int16_t dotprod_q16_quantize(float _v);
+
+// portable C kernels
+void dotprod_q16_execute_portable     (dotprod_q16 _q, int16_t * _x, int16_t * _y);
+void dotprod_q16_execute_cq16_portable(dotprod_q16 _q, int16_t * _x, int16_t * _y);
+
+#if LIQUID_SIMD_DISPATCH
+
+// memory alignment of coefficients for all SIMD kernels (bytes)
+#define LIQUID_SIMD_ALIGN (64)
+
+// structured dot product objects, common to all SIMD kernels so that
+// the kernel can be selected at run time
+struct dotprod_rrrf_s {
+    unsigned int n;     // length
+    float * h;          // coefficients array, aligned
+    const struct liquid_simd_kernels_s * simd; // kernels
+};
+
+struct dotprod_crcf_s {
+    unsigned int n;     // length
+    float * h;          // coefficients array, repeated and aligned
+                        //  { h[0], h[0], h[1], h[1], ... }
+    const struct liquid_simd_kernels_s * simd; // kernels
+};
+
+struct dotprod_cccf_s {
+    unsigned int n;     // length
+    float * hi;         // in-phase coefficients, repeated and aligned
+    float * hq;         // quadrature coefficients, repeated and aligned
+    const struct liquid_simd_kernels_s * simd; // kernels
+};
+
+struct dotprod_rrrd_s {
+    unsigned int n;     // length
+    double * h;         // coefficients array, aligned
+    const struct liquid_simd_kernels_s * simd; // kernels
+};
+
+struct dotprod_crcd_s {
+    unsigned int n;     // length
+    double * h;         // coefficients array, repeated and aligned
+                        //  { h[0], h[0], h[1], h[1], ... }
+    const struct liquid_simd_kernels_s * simd; // kernels
+};
+
+struct dotprod_cccd_s {
+    unsigned int n;     // length
+    double * hi;        // in-phase coefficients, repeated and aligned
+    double * hq;        // quadrature coefficients, repeated and aligned
+    const struct liquid_simd_kernels_s * simd; // kernels
+};
+
+// table of SIMD kernels for a particular set of processor extensions
+struct liquid_simd_kernels_s {
+    liquid_simd_type type;
+
+    // structured dot products
+    void (*dotprod_rrrf)(dotprod_rrrf _q, float *         _x, float *         _y);
+    void (*dotprod_crcf)(dotprod_crcf _q, float complex * _x, float complex * _y);
+    void (*dotprod_cccf)(dotprod_cccf _q, float complex * _x, float complex * _y);
+
+    // structured dot products on blocks of input windows
+    void (*dotprod_rrrf_block)(dotprod_rrrf _q, float *         _x, unsigned int _stride, unsigned int _n, float *         _y);
+    void (*dotprod_crcf_block)(dotprod_crcf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+    void (*dotprod_cccf_block)(dotprod_cccf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+
+    // double-precision structured dot products
+    void (*dotprod_rrrd)(dotprod_rrrd _q, double *         _x, double *         _y);
+    void (*dotprod_crcd)(dotprod_crcd _q, double complex * _x, double complex * _y);
+    void (*dotprod_cccd)(dotprod_cccd _q, double complex * _x, double complex * _y);
+
+    // fixed-point (Q15) dot products, real and complex inputs
+    void (*dotprod_q16) (dotprod_q16 _q, int16_t * _x, int16_t * _y);
+    void (*dotprod_cq16)(dotprod_q16 _q, int16_t * _x, int16_t * _y);
+
+    // sum of squares
+    float (*sumsqf) (float *         _v, unsigned int _n);
+    float (*sumsqcf)(float complex * _v, unsigned int _n);
+
+    // element-wise vector operations
+    void (*vectorf_add)       (float *         _x, float *         _y, unsigned int _n, float *         _z);
+    void (*vectorcf_add)      (float complex * _x, float complex * _y, unsigned int _n, float complex * _z);
+    void (*vectorf_addscalar) (float *         _x, unsigned int _n, float         _c, float *         _y);
+    void (*vectorcf_addscalar)(float complex * _x, unsigned int _n, float complex _c, float complex * _y);
+    void (*vectorf_mul)       (float *         _x, float *         _y, unsigned int _n, float *         _z);
+    void (*vectorcf_mul)      (float complex * _x, float complex * _y, unsigned int _n, float complex * _z);
+    void (*vectorf_mulscalar) (float *         _x, unsigned int _n, float         _c, float *         _y);
+    void (*vectorcf_mulscalar)(float complex * _x, unsigned int _n, float complex _c, float complex * _y);
+    void (*vectorf_abs)       (float *         _x, unsigned int _n, float *         _y);
+    void (*vectorcf_abs)      (float complex * _x, unsigned int _n, float *         _y);
+    void (*vectorcf_cexpj)    (float *         _theta, unsigned int _n, float complex * _x);
+    void (*vectorcf_carg)     (float complex * _x, unsigned int _n, float *         _theta);
+
+    // element-wise transcendental functions
+    void (*vectorf_sincos)    (float *         _theta, unsigned int _n, float * _s, float * _c);
+    void (*vectorf_atan2)     (float *         _y, float *         _x, unsigned int _n, float * _theta);
+    void (*vectorf_log10)     (float *         _x, unsigned int _n, float *         _y);
+    void (*vectorf_exp)       (float *         _x, unsigned int _n, float *         _y);
+
+    // radix-4 transform
+    void (*fftf_radix4)(unsigned int _nfft, unsigned int _howmany, float complex * _twiddle, int _dir, float complex * _x, float complex * _y, float complex * _buf);
+
+    // real-input transform split/merge stages
+    void (*fftf_real_split)(unsigned int _m, float complex * _twiddle, float complex * _z);
+    void (*fftf_real_merge)(unsigned int _m, float complex * _twiddle, float complex * _x, float complex * _z);
+};
+
+// declare element-wise vector kernels for a particular set of extensions
+//  EXT     : kernel name suffix, e.g. _sse
+#define LIQUID_VECTOR_DEFINE_KERNELS(EXT)                                   \
+void liquid_vectorf_add##EXT       (float *         _x, float *         _y, unsigned int _n, float *         _z); \
+void liquid_vectorcf_add##EXT      (float complex * _x, float complex * _y, unsigned int _n, float complex * _z); \
+void liquid_vectorf_addscalar##EXT (float *         _x, unsigned int _n, float         _c, float *         _y); \
+void liquid_vectorcf_addscalar##EXT(float complex * _x, unsigned int _n, float complex _c, float complex * _y); \
+void liquid_vectorf_mul##EXT       (float *         _x, float *         _y, unsigned int _n, float *         _z); \
+void liquid_vectorcf_mul##EXT      (float complex * _x, float complex * _y, unsigned int _n, float complex * _z); \
+void liquid_vectorf_mulscalar##EXT (float *         _x, unsigned int _n, float         _c, float *         _y); \
+void liquid_vectorcf_mulscalar##EXT(float complex * _x, unsigned int _n, float complex _c, float complex * _y); \
+void liquid_vectorf_abs##EXT       (float *         _x, unsigned int _n, float *         _y); \
+void liquid_vectorcf_abs##EXT      (float complex * _x, unsigned int _n, float *         _y); \
+void liquid_vectorcf_cexpj##EXT    (float *         _theta, unsigned int _n, float complex * _x); \
+void liquid_vectorcf_carg##EXT     (float complex * _x, unsigned int _n, float *         _theta); \
+void liquid_vectorf_sincos##EXT    (float *         _theta, unsigned int _n, float * _s, float * _c); \
+void liquid_vectorf_atan2##EXT     (float *         _y, float *         _x, unsigned int _n, float * _theta); \
+void liquid_vectorf_log10##EXT     (float *         _x, unsigned int _n, float *         _y); \
+void liquid_vectorf_exp##EXT       (float *         _x, unsigned int _n, float *         _y); \
+
+LIQUID_VECTOR_DEFINE_KERNELS(_portable)
+LIQUID_VECTOR_DEFINE_KERNELS(_sse)
+LIQUID_VECTOR_DEFINE_KERNELS(_avx2)
+
+// radix-4 transform kernels (see liquid_fftf_radix4_execute)
+void liquid_fftf_radix4_execute_portable(unsigned int, unsigned int, float complex *, int, float complex *, float complex *, float complex *);
+void liquid_fftf_radix4_execute_sse     (unsigned int, unsigned int, float complex *, int, float complex *, float complex *, float complex *);
+void liquid_fftf_radix4_execute_avx2    (unsigned int, unsigned int, float complex *, int, float complex *, float complex *, float complex *);
+
+// real-input transform split/merge kernels (see liquid_fftf_real_split)
+void liquid_fftf_real_split_portable(unsigned int, float complex *, float complex *);
+void liquid_fftf_real_split_sse     (unsigned int, float complex *, float complex *);
+void liquid_fftf_real_merge_portable(unsigned int, float complex *, float complex *, float complex *);
+void liquid_fftf_real_merge_sse     (unsigned int, float complex *, float complex *, float complex *);
+
+// get kernels currently selected, resolving on first call
+const struct liquid_simd_kernels_s * liquid_simd_get_kernels(void);
+
+// portable C
+void  dotprod_rrrf_execute_portable(dotprod_rrrf _q, float *         _x, float *         _y);
+void  dotprod_crcf_execute_portable(dotprod_crcf _q, float complex * _x, float complex * _y);
+void  dotprod_cccf_execute_portable(dotprod_cccf _q, float complex * _x, float complex * _y);
+void  dotprod_rrrf_execute_block_portable(dotprod_rrrf _q, float *         _x, unsigned int _stride, unsigned int _n, float *         _y);
+void  dotprod_crcf_execute_block_portable(dotprod_crcf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+void  dotprod_cccf_execute_block_portable(dotprod_cccf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+float liquid_sumsqf_portable (float *         _v, unsigned int _n);
+float liquid_sumsqcf_portable(float complex * _v, unsigned int _n);
+void  dotprod_rrrd_execute_portable(dotprod_rrrd _q, double *         _x, double *         _y);
+void  dotprod_crcd_execute_portable(dotprod_crcd _q, double complex * _x, double complex * _y);
+void  dotprod_cccd_execute_portable(dotprod_cccd _q, double complex * _x, double complex * _y);
+
+// SSE2/SSE3
+void  dotprod_rrrf_execute_sse(dotprod_rrrf _q, float *         _x, float *         _y);
+void  dotprod_crcf_execute_sse(dotprod_crcf _q, float complex * _x, float complex * _y);
+void  dotprod_cccf_execute_sse(dotprod_cccf _q, float complex * _x, float complex * _y);
+void  dotprod_rrrf_execute_block_sse(dotprod_rrrf _q, float *         _x, unsigned int _stride, unsigned int _n, float *         _y);
+void  dotprod_crcf_execute_block_sse(dotprod_crcf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+void  dotprod_cccf_execute_block_sse(dotprod_cccf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+float liquid_sumsqf_sse (float *         _v, unsigned int _n);
+float liquid_sumsqcf_sse(float complex * _v, unsigned int _n);
+void  dotprod_q16_execute_sse     (dotprod_q16 _q, int16_t * _x, int16_t * _y);
+void  dotprod_q16_execute_cq16_sse(dotprod_q16 _q, int16_t * _x, int16_t * _y);
+void  dotprod_rrrd_execute_sse(dotprod_rrrd _q, double *         _x, double *         _y);
+void  dotprod_crcd_execute_sse(dotprod_crcd _q, double complex * _x, double complex * _y);
+void  dotprod_cccd_execute_sse(dotprod_cccd _q, double complex * _x, double complex * _y);
+
+// AVX2/FMA
+void  dotprod_rrrf_execute_avx2(dotprod_rrrf _q, float *         _x, float *         _y);
+void  dotprod_crcf_execute_avx2(dotprod_crcf _q, float complex * _x, float complex * _y);
+void  dotprod_cccf_execute_avx2(dotprod_cccf _q, float complex * _x, float complex * _y);
+void  dotprod_rrrf_execute_block_avx2(dotprod_rrrf _q, float *         _x, unsigned int _stride, unsigned int _n, float *         _y);
+void  dotprod_crcf_execute_block_avx2(dotprod_crcf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+void  dotprod_cccf_execute_block_avx2(dotprod_cccf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+float liquid_sumsqf_avx2 (float *         _v, unsigned int _n);
+float liquid_sumsqcf_avx2(float complex * _v, unsigned int _n);
+void  dotprod_q16_execute_avx2     (dotprod_q16 _q, int16_t * _x, int16_t * _y);
+void  dotprod_q16_execute_cq16_avx2(dotprod_q16 _q, int16_t * _x, int16_t * _y);
+void  dotprod_rrrd_execute_avx2(dotprod_rrrd _q, double *         _x, double *         _y);
+void  dotprod_crcd_execute_avx2(dotprod_crcd _q, double complex * _x, double complex * _y);
+void  dotprod_cccd_execute_avx2(dotprod_cccd _q, double complex * _x, double complex * _y);
+
+// AVX-512F
+void  dotprod_rrrf_execute_avx512(dotprod_rrrf _q, float *         _x, float *         _y);
+void  dotprod_crcf_execute_avx512(dotprod_crcf _q, float complex * _x, float complex * _y);
+void  dotprod_cccf_execute_avx512(dotprod_cccf _q, float complex * _x, float complex * _y);
+void  dotprod_rrrf_execute_block_avx512(dotprod_rrrf _q, float *         _x, unsigned int _stride, unsigned int _n, float *         _y);
+void  dotprod_crcf_execute_block_avx512(dotprod_crcf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+void  dotprod_cccf_execute_block_avx512(dotprod_cccf _q, float complex * _x, unsigned int _stride, unsigned int _n, float complex * _y);
+float liquid_sumsqf_avx512 (float *         _v, unsigned int _n);
+float liquid_sumsqcf_avx512(float complex * _v, unsigned int _n);
+
+#endif // LIQUID_SIMD_DISPATCH
+
 
 //
 // MODULE : fec (forward error-correction)
@@ -683,8 +977,24 @@ typedef enum {
     LIQUID_FFT_METHOD_RADER,        // Rader's method for FFTs of prime length
     LIQUID_FFT_METHOD_RADER2,       // Rader's method for FFTs of prime length (alternate)
     LIQUID_FFT_METHOD_DFT,          // regular discrete Fourier transform
+    LIQUID_FFT_METHOD_RADIX4,       // Radix-4 (Stockham, decimation in frequency)
+    LIQUID_FFT_METHOD_MANY,         // batch of transforms of the same size
+    LIQUID_FFT_METHOD_FOUR_STEP,    // four-step (six-step) algorithm for large transforms
+    LIQUID_FFT_METHOD_PRUNED,       // zero-padded input or partial output (pruned)
 } liquid_fft_method;
 
+// read-only tables shared between plans (see fft_cache.c)
+typedef enum {
+    LIQUID_FFT_TABLE_TWIDDLE=0,     // exp(-/+ j 2 pi i / nfft), radix-2 and mixed-radix
+    LIQUID_FFT_TABLE_INDEX_REV,     // bit-reversed indices, radix-2
+    LIQUID_FFT_TABLE_RADIX4,        // twiddle factors for each stage, radix-4
+    LIQUID_FFT_TABLE_RADER_SEQ,     // sequence g^(i+1) mod nfft, Rader's algorithms
+    LIQUID_FFT_TABLE_RADER_R,       // transform of exp(-/+ j 2 pi seq / nfft), Rader
+    LIQUID_FFT_TABLE_RADER2_R,      // transform of exp(-/+ j 2 pi seq / nfft), Rader-II
+    LIQUID_FFT_TABLE_REAL,          // exp(-j 2 pi i / nfft) for i <= nfft/4, r2c/c2r
+    LIQUID_FFT_TABLE_FOUR_STEP,     // exp(-/+ j 2 pi n1 k2 / nfft), four-step
+} liquid_fft_table;
+
 // Macro    :   FFT (internal)
 //  FFT     :   name-mangling macro
 //  T       :   primitive data type
@@ -710,6 +1020,8 @@ FFT(_create_t) FFT(_create_plan_radix2);                        \
 FFT(_create_t) FFT(_create_plan_mixed_radix);                   \
 FFT(_create_t) FFT(_create_plan_rader);                         \
 FFT(_create_t) FFT(_create_plan_rader2);                        \
+FFT(_create_t) FFT(_create_plan_radix4);                        \
+FFT(_create_t) FFT(_create_plan_four_step);                     \
                                                                 \
 /* FFT destroy methods */                                       \
 FFT(_destroy_t) FFT(_destroy_plan_dft);                         \
@@ -717,6 +1029,8 @@ FFT(_destroy_t) FFT(_destroy_plan_radix2);                      \
 FFT(_destroy_t) FFT(_destroy_plan_mixed_radix);                 \
 FFT(_destroy_t) FFT(_destroy_plan_rader);                       \
 FFT(_destroy_t) FFT(_destroy_plan_rader2);                      \
+FFT(_destroy_t) FFT(_destroy_plan_radix4);                      \
+FFT(_destroy_t) FFT(_destroy_plan_four_step);                   \
                                                                 \
 /* FFT execute methods */                                       \
 FFT(_execute_t) FFT(_execute_dft);                              \
@@ -724,6 +1038,10 @@ FFT(_execute_t) FFT(_execute_radix2);                           \
 FFT(_execute_t) FFT(_execute_mixed_radix);                      \
 FFT(_execute_t) FFT(_execute_rader);                            \
 FFT(_execute_t) FFT(_execute_rader2);                           \
+FFT(_execute_t) FFT(_execute_radix4);                           \
+FFT(_execute_t) FFT(_execute_four_step);                        \
+int FFT(_set_num_threads_four_step)(FFT(plan)    _q,            \
+                                    unsigned int _num_threads); \
                                                                 \
 /* specific codelets for small DFTs */                          \
 FFT(_execute_t) FFT(_execute_dft_2);                            \
@@ -735,6 +1053,60 @@ FFT(_execute_t) FFT(_execute_dft_7);                            \
 FFT(_execute_t) FFT(_execute_dft_8);                            \
 FFT(_execute_t) FFT(_execute_dft_16);                           \
                                                                 \
+/* create plan using specific method and mixed-radix factor */  \
+FFT(plan) FFT(_create_plan_method)(unsigned int      _nfft,     \
+                                   TC *              _x,        \
+                                   TC *              _y,        \
+                                   int               _dir,      \
+                                   int               _flags,    \
+                                   liquid_fft_method _method,   \
+                                   unsigned int      _factor);  \
+                                                                \
+/* create mixed-radix plan with specific factor */              \
+FFT(plan) FFT(_create_plan_mixed_radix_factor)(                 \
+                                   unsigned int _nfft,          \
+                                   unsigned int _Q,             \
+                                   TC *         _x,             \
+                                   TC *         _y,             \
+                                   int          _dir,           \
+                                   int          _flags);        \
+                                                                \
+/* select method from wisdom, measurement, or estimate */       \
+int FFT(_planner_select)(unsigned int        _nfft,             \
+                         int                 _flags,            \
+                         liquid_fft_method * _method,           \
+                         unsigned int      * _factor);          \
+                                                                \
+/* shared read-only tables: look up existing table (adding a */ \
+/* reference), insert newly-computed table, and release; the */ \
+/* table is keyed on type, size, direction, and an additional */ \
+/* parameter (e.g. four-step factor, zero if unused)         */ \
+void * FFT(_cache_lookup)(liquid_fft_table _table,              \
+                          unsigned int     _nfft,               \
+                          int              _dir,                \
+                          unsigned int     _param);             \
+void * FFT(_cache_insert)(liquid_fft_table _table,              \
+                          unsigned int     _nfft,               \
+                          int              _dir,                \
+                          unsigned int     _param,              \
+                          void *           _data);              \
+int FFT(_cache_release)(void * _data);                          \
+unsigned int FFT(_cache_num_tables)(void);                      \
+                                                                \
+/* acquire shared twiddle factors exp(-/+ j 2 pi i / _nfft) */  \
+TC * FFT(_cache_twiddle)(unsigned int _nfft, int _dir);         \
+                                                                \
+/* acquire shared radix-4 stage twiddle factors */             \
+TC * FFT(_cache_radix4)(unsigned int _nfft, int _dir);          \
+                                                                \
+/* acquire shared four-step twiddle factors for factor _n1   */ \
+TC * FFT(_cache_four_step)(unsigned int _nfft,                  \
+                           unsigned int _n1,                    \
+                           int          _dir);                  \
+                                                                \
+/* acquire shared Rader sequence g^(i+1) mod _nfft */           \
+unsigned int * FFT(_cache_rader_seq)(unsigned int _nfft);       \
+                                                                \
 /* additional methods */                                        \
 unsigned int FFT(_estimate_mixed_radix)(unsigned int _nfft);    \
                                                                 \
@@ -750,43 +1122,165 @@ int FFT(_execute_RODFT10)(FFT(plan) _q);    /* DST-II  */       \
 int FFT(_execute_RODFT01)(FFT(plan) _q);    /* DST-III */       \
 int FFT(_execute_RODFT11)(FFT(plan) _q);    /* DST-IV  */       \
                                                                 \
+/* batch of transforms of the same size */                     \
+FFT(_destroy_t) FFT(_destroy_plan_many);                        \
+FFT(_execute_t) FFT(_execute_many);                             \
+                                                                \
+/* pruned transforms */                                         \
+FFT(_destroy_t) FFT(_destroy_plan_pruned);                      \
+FFT(_execute_t) FFT(_execute_pruned);                           \
+                                                                \
+/* real-input and real-output transforms */                    \
+int FFT(_destroy_plan_real)(FFT(plan) _q);                      \
+FFT(_execute_t) FFT(_execute_r2c);                              \
+FFT(_execute_t) FFT(_execute_c2r);                              \
+                                                                \
 /* destroy real-to-real one-dimensional plan */                 \
 int FFT(_destroy_plan_r2r_1d)(FFT(plan) _q);                    \
                                                                 \
 /* print real-to-real one-dimensional plan */                   \
 int FFT(_print_plan_r2r_1d)(FFT(plan) _q);                      \
 
+// execute radix-4 (Stockham) transform stages on one transform, or on
+// a batch of transforms interleaved sample by sample (element i of
+// transform b at index i*_howmany + b)
+//  _nfft       : transform size, power of two (at least 16 unless batched)
+//  _howmany    : number of interleaved transforms, 1 or a multiple of 4
+//  _twiddle    : twiddle factors for each radix-4 stage
+//  _dir        : direction (LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD)
+//  _x          : input array [size: _nfft*_howmany x 1]
+//  _y          : output array [size: _nfft*_howmany x 1], may be equal to _x
+//  _buf        : work buffer [size: _nfft*_howmany x 1]
+void liquid_fftf_radix4_execute(unsigned int    _nfft,
+                                unsigned int    _howmany,
+                                float complex * _twiddle,
+                                int             _dir,
+                                float complex * _x,
+                                float complex * _y,
+                                float complex * _buf);
+
+// split packed transform of size _m, Z, into half-spectrum X of real-input
+// transform of size 2*_m, in place
+//  _m          : packed transform size
+//  _twiddle    : twiddle factors exp(-j 2 pi k / 2_m) [size: _m/2+1 x 1]
+//  _z          : input Z [size: _m x 1], output X [size: _m+1 x 1]
+void liquid_fftf_real_split(unsigned int    _m,
+                            float complex * _twiddle,
+                            float complex * _z);
+
+// merge half-spectrum X of real-output transform of size 2*_m into packed
+// spectrum Z of size _m (scaled by two), inverse of split
+//  _m          : packed transform size
+//  _twiddle    : twiddle factors exp(-j 2 pi k / 2_m) [size: _m/2+1 x 1]
+//  _x          : input X [size: _m+1 x 1]
+//  _z          : output Z [size: _m x 1]
+void liquid_fftf_real_merge(unsigned int    _m,
+                            float complex * _twiddle,
+                            float complex * _x,
+                            float complex * _z);
+
+// double-precision stages (portable C), as above
+void liquid_fftd_radix4_execute(unsigned int     _nfft,
+                                unsigned int     _howmany,
+                                double complex * _twiddle,
+                                int              _dir,
+                                double complex * _x,
+                                double complex * _y,
+                                double complex * _buf);
+void liquid_fftd_real_split(unsigned int     _m,
+                            double complex * _twiddle,
+                            double complex * _z);
+void liquid_fftd_real_merge(unsigned int     _m,
+                            double complex * _twiddle,
+                            double complex * _x,
+                            double complex * _z);
+
 // determine best FFT method based on size
 liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft);
 
 // is input radix-2?
 int fft_is_radix2(unsigned int _n);
 
+// smallest size computed with the four-step algorithm unless measured
+// otherwise: composite sizes, and powers of two when planning for threads
+#define FFT_FOUR_STEP_NFFT_MIN      (32768)
+
+// smallest factor considered for the four-step algorithm
+#define FFT_FOUR_STEP_FACTOR_MIN    (16)
+
+// find factor N1 of _n for four-step transform of size N1*(_n/N1),
+// returning zero if _n has no suitable factor
+unsigned int fft_estimate_four_step(unsigned int _n);
+
+// task run in parallel: process items [_begin, _end) using resources of
+// thread with index _thread
+typedef void (liquid_fft_task)(void *       _context,
+                               unsigned int _thread,
+                               unsigned int _begin,
+                               unsigned int _end);
+
+// pool of threads running tasks in parallel; worker threads are started
+// when the pool is created and wait for tasks between runs
+typedef struct liquid_fft_pool_s * liquid_fft_pool;
+
+// create pool of _num_threads threads, the calling thread included; the
+// pool may hold fewer threads if they cannot all be started
+liquid_fft_pool liquid_fft_pool_create(unsigned int _num_threads);
+
+// stop worker threads and free pool
+int liquid_fft_pool_destroy(liquid_fft_pool _p);
+
+// get number of threads in pool, the calling thread included
+unsigned int liquid_fft_pool_get_num_threads(liquid_fft_pool _p);
+
+// run task on _n items split into contiguous ranges across the threads
+// of the pool (the calling thread takes the first range), returning once
+// all ranges are complete
+int liquid_fft_pool_execute(liquid_fft_pool   _p,
+                            unsigned int      _n,
+                            liquid_fft_task * _task,
+                            void *            _context);
+
 // miscellaneous functions
 unsigned int fft_reverse_index(unsigned int _i, unsigned int _n);
 
 
-LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_complex)
+LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT,  float,  liquid_float_complex)
+LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_DOUBLE, double, liquid_double_complex)
 
 // Use fftw library if installed (and not overridden with configuration),
-// otherwise use internal (less efficient) fft library.
+// otherwise use internal (less efficient) fft library. Plans executed
+// with FFT_EXECUTE_ARRAYS on caller-provided arrays are created with
+// FFT_METHOD_ARRAYS as fftw cannot assume the arrays are aligned.
 #if HAVE_FFTW3_H && !defined LIQUID_FFTOVERRIDE
 #   include <fftw3.h>
 #   define FFT_PLAN             fftwf_plan
 #   define FFT_CREATE_PLAN      fftwf_plan_dft_1d
+#   define FFT_CREATE_PLAN_R2C  fftwf_plan_dft_r2c_1d
+#   define FFT_CREATE_PLAN_C2R  fftwf_plan_dft_c2r_1d
+#   define FFT_CREATE_PLAN_PRUNED(N,X,Y,D,F,NI,KO,NO) \
+        fftwf_plan_dft_1d(N,X,Y,D,F)
 #   define FFT_DESTROY_PLAN     fftwf_destroy_plan
 #   define FFT_EXECUTE          fftwf_execute
+#   define FFT_EXECUTE_ARRAYS(P,X,Y) \
+        fftwf_execute_dft(P,(fftwf_complex*)(X),(fftwf_complex*)(Y))
 #   define FFT_DIR_FORWARD      FFTW_FORWARD
 #   define FFT_DIR_BACKWARD     FFTW_BACKWARD
 #   define FFT_METHOD           FFTW_ESTIMATE
+#   define FFT_METHOD_ARRAYS    (FFTW_ESTIMATE | FFTW_UNALIGNED)
 #else
 #   define FFT_PLAN             fftplan
 #   define FFT_CREATE_PLAN      fft_create_plan
+#   define FFT_CREATE_PLAN_R2C  fft_create_plan_r2c
+#   define FFT_CREATE_PLAN_C2R  fft_create_plan_c2r
+#   define FFT_CREATE_PLAN_PRUNED fft_create_plan_pruned
 #   define FFT_DESTROY_PLAN     fft_destroy_plan
 #   define FFT_EXECUTE          fft_execute
+#   define FFT_EXECUTE_ARRAYS   fft_execute_arrays
 #   define FFT_DIR_FORWARD      LIQUID_FFT_FORWARD
 #   define FFT_DIR_BACKWARD     LIQUID_FFT_BACKWARD
 #   define FFT_METHOD           0
+#   define FFT_METHOD_ARRAYS    0
 #endif
 
 
@@ -810,6 +1304,36 @@ float estimate_req_filter_len_Herrmann(float _df,
                                        float _As);
 
 
+// firpfb
+#define LIQUID_FIRPFB_DEFINE_INTERNAL_API(FIRPFB,TO,TC,TI)          \
+                                                                    \
+/* execute all filters in the bank on a block of input samples, */  \
+/* interleaving outputs such that _y[k*M + i] is the output of  */  \
+/* filter i after pushing _x[k] into the buffer                 */  \
+/*  _q      : firpfb object                                     */  \
+/*  _x      : input array [size: _n x 1]                        */  \
+/*  _n      : number of input samples                           */  \
+/*  _y      : output array [size: _n*M x 1]                     */  \
+void FIRPFB(_execute_block_bank)(FIRPFB()     _q,                   \
+                                 TI *         _x,                   \
+                                 unsigned int _n,                   \
+                                 TO *         _y);                  \
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(LIQUID_FIRPFB_MANGLE_RRRF,
+                                  float,
+                                  float,
+                                  float)
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(LIQUID_FIRPFB_MANGLE_CRCF,
+                                  liquid_float_complex,
+                                  float,
+                                  liquid_float_complex)
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(LIQUID_FIRPFB_MANGLE_CCCF,
+                                  liquid_float_complex,
+                                  liquid_float_complex,
+                                  liquid_float_complex)
+
 // fir_farrow
 #define LIQUID_FIRFARROW_DEFINE_INTERNAL_API(FIRFARROW,TO,TC,TI)  \
 void FIRFARROW(_genpoly)(FIRFARROW() _q);
@@ -825,6 +1349,23 @@ LIQUID_FIRFARROW_DEFINE_INTERNAL_API(LIQUID_FIRFARROW_MANGLE_CRCF,
                                      liquid_float_complex)
 
 
+// firfilt : block execution method (overlap-save transforms or dot
+// products); _set_fft() overrides the automatic selection made by
+// _set_block_size() using _fft_select()
+#define LIQUID_FIRFILT_DEFINE_INTERNAL_API(FIRFILT,TO,TC,TI)    \
+int FIRFILT(_fft_select)(unsigned int _h_len,                   \
+                         unsigned int _block_size);             \
+int FIRFILT(_set_fft)(FIRFILT() _q,                             \
+                      int       _fft);
+
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_RRRF, float, float, float)
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_CRCF, liquid_float_complex, float, liquid_float_complex)
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_CCCF, liquid_float_complex, liquid_float_complex, liquid_float_complex)
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_RRRD, double, double, double)
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_CRCD, liquid_double_complex, double, liquid_double_complex)
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_CCCD, liquid_double_complex, liquid_double_complex, liquid_double_complex)
+
+
 
 // 
 // iirfiltsos : infinite impulse respone filter (second-order sections)
@@ -832,6 +1373,9 @@ LIQUID_FIRFARROW_DEFINE_INTERNAL_API(LIQUID_FIRFARROW_MANGLE_CRCF,
 #define LIQUID_IIRFILTSOS_MANGLE_RRRF(name)  LIQUID_CONCAT(iirfiltsos_rrrf,name)
 #define LIQUID_IIRFILTSOS_MANGLE_CRCF(name)  LIQUID_CONCAT(iirfiltsos_crcf,name)
 #define LIQUID_IIRFILTSOS_MANGLE_CCCF(name)  LIQUID_CONCAT(iirfiltsos_cccf,name)
+#define LIQUID_IIRFILTSOS_MANGLE_RRRD(name)  LIQUID_CONCAT(iirfiltsos_rrrd,name)
+#define LIQUID_IIRFILTSOS_MANGLE_CRCD(name)  LIQUID_CONCAT(iirfiltsos_crcd,name)
+#define LIQUID_IIRFILTSOS_MANGLE_CCCD(name)  LIQUID_CONCAT(iirfiltsos_cccd,name)
 
 #define LIQUID_IIRFILTSOS_DEFINE_INTERNAL_API(IIRFILTSOS,TO,TC,TI)  \
 typedef struct IIRFILTSOS(_s) * IIRFILTSOS();                   \
@@ -904,6 +1448,21 @@ LIQUID_IIRFILTSOS_DEFINE_INTERNAL_API(LIQUID_IIRFILTSOS_MANGLE_CCCF,
                                       liquid_float_complex,
                                       liquid_float_complex)
 
+LIQUID_IIRFILTSOS_DEFINE_INTERNAL_API(LIQUID_IIRFILTSOS_MANGLE_RRRD,
+                                      double,
+                                      double,
+                                      double)
+
+LIQUID_IIRFILTSOS_DEFINE_INTERNAL_API(LIQUID_IIRFILTSOS_MANGLE_CRCD,
+                                      liquid_double_complex,
+                                      double,
+                                      liquid_double_complex)
+
+LIQUID_IIRFILTSOS_DEFINE_INTERNAL_API(LIQUID_IIRFILTSOS_MANGLE_CCCD,
+                                      liquid_double_complex,
+                                      liquid_double_complex,
+                                      liquid_double_complex)
+
 
 // firdes : finite impulse response filter design
 
@@ -1308,6 +1867,11 @@ unsigned short int smatrix_indexsearch(unsigned short int * _list,
 // MODULE : modem
 //
 
+// fskdem: get frequency bin of transform of most recent symbol,
+// computing it directly if the detector bank is in use
+liquid_float_complex fskdem_get_bin(fskdem       _q,
+                                    unsigned int _index);
+
 // 'Square' QAM
 #define QAM4_ALPHA      (1./sqrt(2))
 #define QAM8_ALPHA      (1./sqrt(6))
@@ -20,7 +20,7 @@
 #   And defines:
 #
 #     HAVE_MMX / HAVE_SSE / HAVE_SSE2 / HAVE_SSE3 / HAVE_SSSE3 /
-#     HAVE_SSE41 / HAVE_SSE42 / HAVE_AVX
+#     HAVE_SSE41 / HAVE_SSE42 / HAVE_AVX / HAVE_AVX2 / HAVE_FMA
 #
 # LICENSE
 #
@@ -42,6 +42,7 @@
 #     SSSE3         :   tmmintrin.h
 #     SSE4.1/4.2    :   smmintrin.h
 #     AVX           :   immintrin.h
+#     AVX2/FMA      :   immintrin.h
 
 #serial 9
 
@@ -58,6 +59,13 @@ AC_DEFUN([AX_EXT],
      edx=`echo $ax_cv_gcc_x86_cpuid_0x00000001 | cut -d ":" -f 4`
   fi
 
+  AX_GCC_X86_CPUID(0x00000007)
+  ebx7=0
+  if test "$ax_cv_gcc_x86_cpuid_0x00000007" != "unknown";
+  then
+     ebx7=`echo $ax_cv_gcc_x86_cpuid_0x00000007 | cut -d ":" -f 2`
+  fi
+
  AC_CHECK_HEADERS(mmintrin.h xmmintrin.h emmintrin.h pmmintrin.h tmmintrin.h smmintrin.h immintrin.h)
 
  AC_CACHE_CHECK([whether mmx is supported], [ax_cv_have_mmx_ext],
@@ -124,6 +132,22 @@ AC_DEFUN([AX_EXT],
     fi
   ])
 
+ AC_CACHE_CHECK([whether avx2 is supported], [ax_cv_have_avx2_ext],
+  [
+    ax_cv_have_avx2_ext=no
+    if test "$((0x$ebx7>>5&0x01))" = 1; then
+      ax_cv_have_avx2_ext=yes
+    fi
+  ])
+
+ AC_CACHE_CHECK([whether fma is supported], [ax_cv_have_fma_ext],
+  [
+    ax_cv_have_fma_ext=no
+    if test "$((0x$ecx>>12&0x01))" = 1; then
+      ax_cv_have_fma_ext=yes
+    fi
+  ])
+
   if [ test "$ax_cv_have_mmx_ext" = yes && test "$ac_cv_header_mmintrin_h" = yes ]; then
     AC_DEFINE(HAVE_MMX,1, [Support MMX instructions])
     AX_CHECK_COMPILE_FLAG(-mmmx, SIMD_FLAGS="$SIMD_FLAGS -mmmx", [])
@@ -164,5 +188,15 @@ AC_DEFUN([AX_EXT],
     AX_CHECK_COMPILE_FLAG(-mavx, SIMD_FLAGS="$SIMD_FLAGS -mavx", [])
   fi
 
+  if [ test "$ax_cv_have_avx2_ext" = yes && test "$ac_cv_header_immintrin_h" = yes ]; then
+    AC_DEFINE(HAVE_AVX2,1,[Support AVX2 (Advanced Vector Extensions 2) instructions])
+    AX_CHECK_COMPILE_FLAG(-mavx2, SIMD_FLAGS="$SIMD_FLAGS -mavx2", [])
+  fi
+
+  if [ test "$ax_cv_have_fma_ext" = yes && test "$ac_cv_header_immintrin_h" = yes ]; then
+    AC_DEFINE(HAVE_FMA,1,[Support FMA (fused multiply-add) instructions])
+    AX_CHECK_COMPILE_FLAG(-mfma, SIMD_FLAGS="$SIMD_FLAGS -mfma", [])
+  fi
+
   AC_SUBST(SIMD_FLAGS)
 ])
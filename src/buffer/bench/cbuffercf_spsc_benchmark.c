@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// cbuffercf_spsc throughput and latency between two threads, compared
+// against a cbuffercf guarded by a mutex; note that run times include
+// the cpu time of both threads
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#   include <pthread.h>
+#   include <sched.h>
+#   define CBUFFERCF_SPSC_BENCH_THREADS 1
+#else
+#   define CBUFFERCF_SPSC_BENCH_THREADS 0
+#endif
+
+#define CBUFFERCF_SPSC_BENCH_API(N, W, LOCK)        \
+(   struct rusage *     _start,                     \
+    struct rusage *     _finish,                    \
+    unsigned long int * _num_iterations)            \
+{ cbuffercf_spsc_bench(_start, _finish, _num_iterations, N, W, LOCK); }
+
+#define CBUFFERCF_SPSC_LATENCY_BENCH_API(LOCK)      \
+(   struct rusage *     _start,                     \
+    struct rusage *     _finish,                    \
+    unsigned long int * _num_iterations)            \
+{ cbuffercf_spsc_latency_bench(_start, _finish, _num_iterations, LOCK); }
+
+// queue shared between threads: either lock-free or mutex-protected
+struct cbuffercf_spsc_bench_s {
+    cbuffercf_spsc      q;              // lock-free buffer
+    cbuffercf           b;              // buffer guarded by lock
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_mutex_t     lock;
+#endif
+    int                 use_lock;
+    unsigned int        write_size;     // number of samples per write
+    unsigned long int   num_samples;    // total number of samples
+};
+
+// give up cpu when waiting on the other thread, in case both threads
+// are sharing a single core
+void cbuffercf_spsc_bench_yield()
+{
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    sched_yield();
+#endif
+}
+
+// create shared queue
+void cbuffercf_spsc_bench_init(struct cbuffercf_spsc_bench_s * _p,
+                               unsigned int                    _n,
+                               int                             _use_lock)
+{
+    _p->use_lock = _use_lock;
+    _p->q = cbuffercf_spsc_create(_n);
+    _p->b = cbuffercf_create(_n);
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_mutex_init(&_p->lock, NULL);
+#endif
+}
+
+// destroy shared queue
+void cbuffercf_spsc_bench_free(struct cbuffercf_spsc_bench_s * _p)
+{
+    cbuffercf_spsc_destroy(_p->q);
+    cbuffercf_destroy(_p->b);
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_mutex_destroy(&_p->lock);
+#endif
+}
+
+// try to write block of samples, returning number written
+unsigned int cbuffercf_spsc_bench_write(struct cbuffercf_spsc_bench_s * _p,
+                                        float complex *                 _v,
+                                        unsigned int                    _n)
+{
+    if (!_p->use_lock) {
+        if (cbuffercf_spsc_space_available(_p->q) < _n)
+            return 0;
+        cbuffercf_spsc_write(_p->q, _v, _n);
+        return _n;
+    }
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_mutex_lock(&_p->lock);
+#endif
+    unsigned int n = cbuffercf_space_available(_p->b) < _n ? 0 : _n;
+    if (n)
+        cbuffercf_write(_p->b, _v, n);
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_mutex_unlock(&_p->lock);
+#endif
+    return n;
+}
+
+// try to read up to _n samples, returning number read; the lock-based
+// queue has to copy samples out since its read pointer is only valid
+// while the lock is held
+unsigned int cbuffercf_spsc_bench_read(struct cbuffercf_spsc_bench_s * _p,
+                                       float complex *                 _v,
+                                       unsigned int                    _n)
+{
+    float complex * r;
+    unsigned int    num_read;
+    if (!_p->use_lock) {
+        cbuffercf_spsc_read(_p->q, _n, &r, &num_read);
+        if (num_read)
+            _v[0] = r[num_read-1];
+        cbuffercf_spsc_release(_p->q, num_read);
+        return num_read;
+    }
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_mutex_lock(&_p->lock);
+#endif
+    cbuffercf_read(_p->b, _n, &r, &num_read);
+    memmove(_v, r, num_read*sizeof(float complex));
+    cbuffercf_release(_p->b, num_read);
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_mutex_unlock(&_p->lock);
+#endif
+    return num_read;
+}
+
+// producer thread: write samples in blocks
+void * cbuffercf_spsc_bench_producer(void * _p)
+{
+    struct cbuffercf_spsc_bench_s * p = (struct cbuffercf_spsc_bench_s *) _p;
+    float complex v[p->write_size];
+    unsigned int i;
+    for (i=0; i<p->write_size; i++)
+        v[i] = (float)i;
+
+    unsigned long int num_written = 0;
+    while (num_written < p->num_samples) {
+        unsigned int n = cbuffercf_spsc_bench_write(p, v, p->write_size);
+        if (n == 0)
+            cbuffercf_spsc_bench_yield();
+        num_written += n;
+    }
+    return NULL;
+}
+
+// throughput: stream samples from producer to consumer thread
+void cbuffercf_spsc_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _n,
+                          unsigned int        _write_size,
+                          int                 _use_lock)
+{
+    // normalize number of iterations
+    *_num_iterations *= 64;
+
+    struct cbuffercf_spsc_bench_s p;
+    cbuffercf_spsc_bench_init(&p, _n, _use_lock);
+    p.write_size  = _write_size;
+    p.num_samples = *_num_iterations - (*_num_iterations % _write_size);
+
+    float complex v[_n];
+    unsigned long int num_read = 0;
+
+    getrusage(RUSAGE_SELF, _start);
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_t producer;
+    pthread_create(&producer, NULL, cbuffercf_spsc_bench_producer, &p);
+    while (num_read < p.num_samples) {
+        unsigned int n = cbuffercf_spsc_bench_read(&p, v, _n);
+        if (n == 0)
+            cbuffercf_spsc_bench_yield();
+        num_read += n;
+    }
+    pthread_join(producer, NULL);
+#else
+    // no threads: alternate between writing and reading
+    while (num_read < p.num_samples) {
+        cbuffercf_spsc_bench_write(&p, v, _write_size);
+        num_read += cbuffercf_spsc_bench_read(&p, v, _n);
+    }
+#endif
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_read;
+
+    cbuffercf_spsc_bench_free(&p);
+}
+
+// echo thread: return each sample received on one queue on the other
+struct cbuffercf_spsc_echo_s {
+    struct cbuffercf_spsc_bench_s * q[2];
+    unsigned long int               num_trials;
+};
+
+void * cbuffercf_spsc_bench_echo(void * _p)
+{
+    struct cbuffercf_spsc_echo_s * p = (struct cbuffercf_spsc_echo_s *) _p;
+    float complex v;
+    unsigned long int i;
+    for (i=0; i<p->num_trials; i++) {
+        while (cbuffercf_spsc_bench_read(p->q[0], &v, 1) == 0)
+            cbuffercf_spsc_bench_yield();
+        cbuffercf_spsc_bench_write(p->q[1], &v, 1);
+    }
+    return NULL;
+}
+
+// latency: round trip of a single sample to another thread and back
+void cbuffercf_spsc_latency_bench(struct rusage *     _start,
+                                  struct rusage *     _finish,
+                                  unsigned long int * _num_iterations,
+                                  int                 _use_lock)
+{
+    // normalize number of iterations
+    *_num_iterations /= 4;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    struct cbuffercf_spsc_bench_s q0, q1;
+    cbuffercf_spsc_bench_init(&q0, 64, _use_lock);
+    cbuffercf_spsc_bench_init(&q1, 64, _use_lock);
+    struct cbuffercf_spsc_echo_s p = {{&q0, &q1}, *_num_iterations};
+
+    float complex v = 1.0f;
+    unsigned long int i;
+    getrusage(RUSAGE_SELF, _start);
+#if CBUFFERCF_SPSC_BENCH_THREADS
+    pthread_t echo;
+    pthread_create(&echo, NULL, cbuffercf_spsc_bench_echo, &p);
+    for (i=0; i<*_num_iterations; i++) {
+        cbuffercf_spsc_bench_write(&q0, &v, 1);
+        while (cbuffercf_spsc_bench_read(&q1, &v, 1) == 0)
+            cbuffercf_spsc_bench_yield();
+    }
+    pthread_join(echo, NULL);
+#else
+    // no threads: pass sample through both queues in turn
+    for (i=0; i<*_num_iterations; i++) {
+        cbuffercf_spsc_bench_write(&q0, &v, 1);
+        cbuffercf_spsc_bench_read (&q0, &v, 1);
+        cbuffercf_spsc_bench_write(&q1, &v, 1);
+        cbuffercf_spsc_bench_read (&q1, &v, 1);
+    }
+#endif
+    getrusage(RUSAGE_SELF, _finish);
+
+    cbuffercf_spsc_bench_free(&q0);
+    cbuffercf_spsc_bench_free(&q1);
+}
+
+// throughput: buffer size, write size, lock?
+void benchmark_cbuffercf_spsc_n256       CBUFFERCF_SPSC_BENCH_API( 256,  64, 0)
+void benchmark_cbuffercf_spsc_n4096      CBUFFERCF_SPSC_BENCH_API(4096, 512, 0)
+void benchmark_cbuffercf_mutex_n256      CBUFFERCF_SPSC_BENCH_API( 256,  64, 1)
+void benchmark_cbuffercf_mutex_n4096     CBUFFERCF_SPSC_BENCH_API(4096, 512, 1)
+
+// round-trip latency
+void benchmark_cbuffercf_spsc_latency    CBUFFERCF_SPSC_LATENCY_BENCH_API(0)
+void benchmark_cbuffercf_mutex_latency   CBUFFERCF_SPSC_LATENCY_BENCH_API(1)
+
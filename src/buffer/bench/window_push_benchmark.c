@@ -65,4 +65,6 @@ void benchmark_windowcf_push_n32     WINDOW_PUSH_BENCH_API(32)
 void benchmark_windowcf_push_n64     WINDOW_PUSH_BENCH_API(64)
 void benchmark_windowcf_push_n128    WINDOW_PUSH_BENCH_API(128)
 void benchmark_windowcf_push_n256    WINDOW_PUSH_BENCH_API(256)
+void benchmark_windowcf_push_n1024   WINDOW_PUSH_BENCH_API(1024)
+void benchmark_windowcf_push_n4096   WINDOW_PUSH_BENCH_API(4096)
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define WINDOW_WRITE_BENCH_API(N)       \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ window_write_bench(_start, _finish, _num_iterations, N); }
+
+// Helper function to keep code base small
+void window_write_bench(struct rusage *_start,
+                        struct rusage *_finish,
+                        unsigned long int *_num_iterations,
+                        unsigned int _n)
+{
+    // write blocks of 64 samples at a time
+    unsigned int block_size = 64;
+    *_num_iterations /= 8;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // initialize window and input block
+    windowcf w = windowcf_create(_n);
+    float complex x[block_size];
+    unsigned long int i;
+    for (i=0; i<block_size; i++)
+        x[i] = (float)i;
+
+    // start trials
+    float complex * r;
+    float complex v = 0;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        windowcf_write(w, x, block_size);
+        windowcf_read(w, &r);
+        v += r[0];
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= block_size;
+
+    windowcf_destroy(w);
+    if (crealf(v) < 0) printf("v = %f\n", crealf(v));
+}
+
+// 
+void benchmark_windowcf_write_n16      WINDOW_WRITE_BENCH_API(16)
+void benchmark_windowcf_write_n64      WINDOW_WRITE_BENCH_API(64)
+void benchmark_windowcf_write_n256     WINDOW_WRITE_BENCH_API(256)
+void benchmark_windowcf_write_n1024    WINDOW_WRITE_BENCH_API(1024)
+void benchmark_windowcf_write_n4096    WINDOW_WRITE_BENCH_API(4096)
+
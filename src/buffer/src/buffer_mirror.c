@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// buffer_mirror.c : ring buffer memory mapped twice back to back
+//
+// The same physical pages are mapped at [p, p+size) and [p+size, p+2*size)
+// so a ring buffer can hand out contiguous pointers to any window of up to
+// size bytes, and accept writes of up to size bytes, without copying at the
+// wrap-around point.
+//
+// Each ring costs a few system calls to create and two mappings (VMAs) for
+// its lifetime, so only rings of at least liquid_buffer_mirror_get_min()
+// bytes are mirrored. The memfd backing them is only held while mapping,
+// so no file descriptor stays open. The pages are shared mappings: after
+// fork() the child sees the same ring contents as the parent rather than
+// a private copy as it would for heap memory.
+//
+
+// memfd_create() is a GNU extension
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_SYS_MMAN_H && HAVE_MEMFD_CREATE
+#   include <sys/mman.h>
+#   include <unistd.h>
+#endif
+
+// minimum ring size in bytes for mirrored memory; zero disables mirroring
+static unsigned int liquid_buffer_mirror_min = LIQUID_BUFFER_MIRROR_MIN;
+
+// get minimum size in bytes of buffers backed by mirrored memory
+unsigned int liquid_buffer_mirror_get_min(void)
+{
+    return liquid_buffer_mirror_min;
+}
+
+// set minimum size in bytes of buffers backed by mirrored memory for
+// newly-created objects; zero disables mirrored memory entirely
+int liquid_buffer_mirror_set_min(unsigned int _min)
+{
+    liquid_buffer_mirror_min = _min;
+    return LIQUID_OK;
+}
+
+// allocate ring buffer memory mapped twice contiguously, returning NULL
+// if _size is below the mirroring threshold
+//  _size       : minimum size of ring in bytes
+//  _capacity   : resulting size of ring in bytes, a power of two multiple
+//                of the page size
+void * liquid_mirror_alloc(size_t   _size,
+                           size_t * _capacity)
+{
+    if (liquid_buffer_mirror_min == 0 || _size < liquid_buffer_mirror_min)
+        return NULL;
+#if HAVE_SYS_MMAN_H && HAVE_MEMFD_CREATE
+    long page = sysconf(_SC_PAGESIZE);
+    if (page <= 0)
+        return NULL;
+    size_t n = (size_t)page;
+    while (n < _size)
+        n <<= 1;
+
+    // backing memory; closed once mapped
+    int fd = memfd_create("liquid-mirror", MFD_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, n) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // reserve contiguous address range, then map pages twice over it
+    unsigned char * p = (unsigned char*) mmap(NULL, 2*n, PROT_NONE,
+                                              MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+    void * a = mmap(p,   n, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void * b = mmap(p+n, n, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+    if (a != (void*)p || b != (void*)(p+n)) {
+        munmap(p, 2*n);
+        return NULL;
+    }
+    *_capacity = n;
+    return p;
+#else
+    // not supported on this platform; caller falls back to copying
+    return NULL;
+#endif
+}
+
+// free memory allocated with liquid_mirror_alloc()
+//  _p          : pointer returned by liquid_mirror_alloc()
+//  _capacity   : size of ring in bytes
+int liquid_mirror_free(void * _p,
+                       size_t _capacity)
+{
+#if HAVE_SYS_MMAN_H && HAVE_MEMFD_CREATE
+    if (munmap(_p, 2*_capacity) != 0)
+        return liquid_error(LIQUID_EIMEM,"liquid_mirror_free(), could not unmap memory");
+    return LIQUID_OK;
+#else
+    return liquid_error(LIQUID_EIMODE,"liquid_mirror_free(), not supported on this platform");
+#endif
+}
@@ -46,6 +46,12 @@ struct CBUFFER(_s) {
 
     // number of elements allocated in memory
     unsigned int num_allocated;
+
+    // length of ring; read and write indices wrap at this value
+    unsigned int ring_size;
+
+    // memory mapped twice back to back?
+    int mirror;
     
     // number of elements currently in buffer
     unsigned int num_elements;
@@ -82,9 +88,22 @@ CBUFFER() CBUFFER(_create_max)(unsigned int _max_size,
 
     // internal memory allocation
     q->num_allocated = q->max_size + q->max_read - 1;
-
-    // allocate internal memory array
-    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    q->ring_size     = q->max_size;
+
+    // try mirrored memory for larger buffers: reads never have to be
+    // linearized and writes are a single copy
+    q->v      = NULL;
+    q->mirror = 0;
+    size_t capacity = 0;
+    q->v = (T*) liquid_mirror_alloc(q->max_size*sizeof(T), &capacity);
+    if (q->v != NULL) {
+        q->mirror        = 1;
+        q->ring_size     = capacity / sizeof(T);
+        q->num_allocated = q->ring_size;
+    } else {
+        // allocate internal memory array
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    }
 
     // reset object
     CBUFFER(_reset)(q);
@@ -97,7 +116,10 @@ CBUFFER() CBUFFER(_create_max)(unsigned int _max_size,
 void CBUFFER(_destroy)(CBUFFER() _q)
 {
     // free internal memory
-    free(_q->v);
+    if (_q->mirror)
+        liquid_mirror_free(_q->v, _q->ring_size*sizeof(T));
+    else
+        free(_q->v);
 
     // free main object
     free(_q);
@@ -115,7 +137,7 @@ void CBUFFER(_print)(CBUFFER() _q)
     unsigned int i;
     for (i=0; i<_q->num_elements; i++) {
         printf("%u", i);
-        BUFFER_PRINT_LINE(_q,(_q->read_index+i)%(_q->max_size))
+        BUFFER_PRINT_LINE(_q,(_q->read_index+i)%(_q->ring_size))
         printf("\n");
     }
 }
@@ -130,7 +152,7 @@ void CBUFFER(_debug_print)(CBUFFER() _q)
             _q->num_elements);
 
     unsigned int i;
-    for (i=0; i<_q->max_size; i++) {
+    for (i=0; i<_q->ring_size; i++) {
         // print read index pointer
         if (i==_q->read_index)
             printf("<r>");
@@ -150,7 +172,7 @@ void CBUFFER(_debug_print)(CBUFFER() _q)
     printf("----------------------------------\n");
 
     // print excess buffer memory
-    for (i=_q->max_size; i<_q->num_allocated; i++) {
+    for (i=_q->ring_size; i<_q->num_allocated; i++) {
         printf("      ");
         BUFFER_PRINT_LINE(_q,i)
         printf("\n");
@@ -213,7 +235,7 @@ void CBUFFER(_push)(CBUFFER() _q,
     _q->v[_q->write_index] = _v;
 
     // update write index
-    _q->write_index = (_q->write_index+1) % _q->max_size;
+    _q->write_index = (_q->write_index+1) % _q->ring_size;
 
     // increment number of elements
     _q->num_elements++;
@@ -234,6 +256,13 @@ void CBUFFER(_write)(CBUFFER()    _q,
     }
 
     _q->num_elements += _n;
+    if (_q->mirror) {
+        // mirrored memory handles wrapping around
+        memmove(_q->v + _q->write_index, _v, _n*sizeof(T));
+        _q->write_index = (_q->write_index + _n) % _q->ring_size;
+        return;
+    }
+
     // space available at end of buffer
     unsigned int k = _q->max_size - _q->write_index;
     //printf("n : %u, k : %u\n", _n, k);
@@ -267,7 +296,7 @@ void CBUFFER(_pop)(CBUFFER()    _q,
         *_v = _q->v[ _q->read_index ];
 
     // increment read index
-    _q->read_index = (_q->read_index + 1) % _q->max_size;
+    _q->read_index = (_q->read_index + 1) % _q->ring_size;
 
     // decrement number of elements in the buffer
     _q->num_elements--;
@@ -292,7 +321,7 @@ void CBUFFER(_read)(CBUFFER()      _q,
         _num_requested = _q->max_read;
 
     // linearize tail end of buffer if necessary
-    if (_num_requested > (_q->max_size - _q->read_index))
+    if (!_q->mirror && _num_requested > (_q->max_size - _q->read_index))
         CBUFFER(_linearize)(_q);
     
     // set output pointer appropriately
@@ -310,7 +339,7 @@ void CBUFFER(_release)(CBUFFER()    _q,
         return;
     }
 
-    _q->read_index = (_q->read_index + _n) % _q->max_size;
+    _q->read_index = (_q->read_index + _n) % _q->ring_size;
     _q->num_elements -= _n;
 }
 
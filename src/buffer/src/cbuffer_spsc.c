@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// lock-free single-producer/single-consumer circular buffer
+//
+// One thread may call the producer methods (push, write, write_reserve,
+// write_commit) while another concurrently calls the consumer methods
+// (pop, read, release) without any locking. Each side owns one index
+// and only reads the other with acquire semantics, publishing its own
+// with release semantics. Indices run over [0, 2*ring_size) so that a
+// full buffer can be distinguished from an empty one for any ring size.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+#ifndef LIQUID_CBUFFER_SPSC_ATOMICS
+#define LIQUID_CBUFFER_SPSC_ATOMICS
+#if HAVE_STDATOMIC_H
+#   include <stdatomic.h>
+typedef atomic_uint cbuffer_spsc_index_t;
+#   define SPSC_LOAD_RELAXED(P)    atomic_load_explicit(P, memory_order_relaxed)
+#   define SPSC_LOAD_ACQUIRE(P)    atomic_load_explicit(P, memory_order_acquire)
+#   define SPSC_STORE_RELAXED(P,V) atomic_store_explicit(P, V, memory_order_relaxed)
+#   define SPSC_STORE_RELEASE(P,V) atomic_store_explicit(P, V, memory_order_release)
+#else
+// gcc/clang built-in atomics
+typedef unsigned int cbuffer_spsc_index_t;
+#   define SPSC_LOAD_RELAXED(P)    __atomic_load_n(P, __ATOMIC_RELAXED)
+#   define SPSC_LOAD_ACQUIRE(P)    __atomic_load_n(P, __ATOMIC_ACQUIRE)
+#   define SPSC_STORE_RELAXED(P,V) __atomic_store_n(P, V, __ATOMIC_RELAXED)
+#   define SPSC_STORE_RELEASE(P,V) __atomic_store_n(P, V, __ATOMIC_RELEASE)
+#endif
+#endif
+
+// forward declaration of internal methods
+unsigned int CBUFFER_SPSC(_count)(CBUFFER_SPSC() _q,
+                                  unsigned int   _write_index,
+                                  unsigned int   _read_index);
+unsigned int CBUFFER_SPSC(_advance)(CBUFFER_SPSC() _q,
+                                    unsigned int   _index,
+                                    unsigned int   _n);
+
+// spsc cbuffer object
+struct CBUFFER_SPSC(_s) {
+    // fixed after creation, shared by both threads
+    T *          v;             // allocated memory array
+    unsigned int max_size;      // maximum number of elements in buffer
+    unsigned int max_read;      // maximum number of elements read at once
+    unsigned int ring_size;     // length of ring
+    unsigned int num_allocated; // number of elements allocated in memory
+    int          mirror;        // memory mapped twice back to back?
+
+    // padding keeps each thread's index on its own cache line
+    char pad0[LIQUID_CACHE_LINE_SIZE];
+
+    // owned by producer
+    cbuffer_spsc_index_t write_index;
+    unsigned int         read_cache;    // last read index seen
+
+    char pad1[LIQUID_CACHE_LINE_SIZE];
+
+    // owned by consumer
+    cbuffer_spsc_index_t read_index;
+    unsigned int         write_cache;   // last write index seen
+
+    char pad2[LIQUID_CACHE_LINE_SIZE];
+};
+
+// create spsc circular buffer object of a particular size
+CBUFFER_SPSC() CBUFFER_SPSC(_create)(unsigned int _max_size)
+{
+    return CBUFFER_SPSC(_create_max)(_max_size, _max_size);
+}
+
+// create spsc circular buffer object of a particular size and
+// specify the maximum number of elements that can be read
+// at any given time.
+CBUFFER_SPSC() CBUFFER_SPSC(_create_max)(unsigned int _max_size,
+                                         unsigned int _max_read)
+{
+    // validate input
+    if (_max_size == 0)
+        return liquid_error_config("cbuffer%s_spsc_create_max(), max size must be greater than zero", EXTENSION);
+    if (_max_read == 0)
+        return liquid_error_config("cbuffer%s_spsc_create_max(), max read must be greater than zero", EXTENSION);
+
+    // create main object
+    CBUFFER_SPSC() q = (CBUFFER_SPSC()) malloc(sizeof(struct CBUFFER_SPSC(_s)));
+
+    // set internal properties
+    q->max_size      = _max_size;
+    q->max_read      = _max_read < _max_size ? _max_read : _max_size;
+    q->num_allocated = q->max_size + q->max_read - 1;
+    q->ring_size     = q->max_size;
+
+    // try mirrored memory for larger buffers so reads never have to be
+    // linearized and writes never have to be split
+    q->v      = NULL;
+    q->mirror = 0;
+    size_t capacity = 0;
+    q->v = (T*) liquid_mirror_alloc(q->max_size*sizeof(T), &capacity);
+    if (q->v != NULL) {
+        q->mirror        = 1;
+        q->ring_size     = capacity / sizeof(T);
+        q->num_allocated = q->ring_size;
+    } else {
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    }
+
+    // reset object
+    CBUFFER_SPSC(_reset)(q);
+    return q;
+}
+
+// destroy spsc cbuffer object, freeing all internal memory
+int CBUFFER_SPSC(_destroy)(CBUFFER_SPSC() _q)
+{
+    // free internal memory
+    if (_q->mirror)
+        liquid_mirror_free(_q->v, _q->ring_size*sizeof(T));
+    else
+        free(_q->v);
+
+    // free main object
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print spsc cbuffer object properties
+int CBUFFER_SPSC(_print)(CBUFFER_SPSC() _q)
+{
+    printf("<liquid.cbuffer%s_spsc, max_size=%u, max_read=%u, size=%u, mirror=%d>\n",
+            EXTENSION,
+            _q->max_size,
+            _q->max_read,
+            CBUFFER_SPSC(_size)(_q),
+            _q->mirror);
+    return LIQUID_OK;
+}
+
+// clear internal buffer; not safe while either thread is running
+int CBUFFER_SPSC(_reset)(CBUFFER_SPSC() _q)
+{
+    SPSC_STORE_RELAXED(&_q->write_index, 0);
+    SPSC_STORE_RELAXED(&_q->read_index,  0);
+    _q->read_cache  = 0;
+    _q->write_cache = 0;
+    return LIQUID_OK;
+}
+
+// get the number of elements currently in the buffer; this is a
+// snapshot and may be stale by the time it is returned
+unsigned int CBUFFER_SPSC(_size)(CBUFFER_SPSC() _q)
+{
+    unsigned int r = SPSC_LOAD_ACQUIRE(&_q->read_index);
+    unsigned int w = SPSC_LOAD_ACQUIRE(&_q->write_index);
+    return CBUFFER_SPSC(_count)(_q, w, r);
+}
+
+// get the maximum number of elements the buffer can hold
+unsigned int CBUFFER_SPSC(_max_size)(CBUFFER_SPSC() _q)
+{
+    return _q->max_size;
+}
+
+// get the maximum number of elements that can be read at once
+unsigned int CBUFFER_SPSC(_max_read)(CBUFFER_SPSC() _q)
+{
+    return _q->max_read;
+}
+
+// return number of elements available for writing; from the
+// producer thread this is a lower bound
+unsigned int CBUFFER_SPSC(_space_available)(CBUFFER_SPSC() _q)
+{
+    return _q->max_size - CBUFFER_SPSC(_size)(_q);
+}
+
+// write a single sample into the buffer (producer)
+int CBUFFER_SPSC(_push)(CBUFFER_SPSC() _q,
+                        T              _v)
+{
+    return CBUFFER_SPSC(_write)(_q, &_v, 1);
+}
+
+// write samples to the buffer (producer); either all samples are
+// written or none are. A full buffer is a normal condition for a
+// producer that polls, so it is reported without invoking liquid_error()
+int CBUFFER_SPSC(_write)(CBUFFER_SPSC() _q,
+                         T *            _v,
+                         unsigned int   _n)
+{
+    unsigned int w = SPSC_LOAD_RELAXED(&_q->write_index);
+
+    // check cached read index first to avoid touching consumer's line
+    if (_n > _q->max_size - CBUFFER_SPSC(_count)(_q, w, _q->read_cache)) {
+        _q->read_cache = SPSC_LOAD_ACQUIRE(&_q->read_index);
+        if (_n > _q->max_size - CBUFFER_SPSC(_count)(_q, w, _q->read_cache))
+            return LIQUID_EIRANGE;
+    }
+
+    // copy samples, splitting at the end of ring unless mirrored
+    unsigned int p = w < _q->ring_size ? w : w - _q->ring_size;
+    unsigned int k = _q->ring_size - p;
+    if (_q->mirror || _n <= k) {
+        memmove(_q->v + p, _v, _n*sizeof(T));
+    } else {
+        memmove(_q->v + p, _v,      k *sizeof(T));
+        memmove(_q->v,     _v + k, (_n-k)*sizeof(T));
+    }
+
+    // publish samples to consumer
+    SPSC_STORE_RELEASE(&_q->write_index, CBUFFER_SPSC(_advance)(_q, w, _n));
+    return LIQUID_OK;
+}
+
+// get pointer to contiguous free space in the buffer to be filled by
+// the producer directly and published with write_commit()
+//  _q              : spsc cbuffer object
+//  _num_requested  : number of elements requested
+//  _v              : output pointer
+//  _num_available  : number of elements that can be written to _v
+int CBUFFER_SPSC(_write_reserve)(CBUFFER_SPSC() _q,
+                                 unsigned int   _num_requested,
+                                 T **           _v,
+                                 unsigned int * _num_available)
+{
+    unsigned int w = SPSC_LOAD_RELAXED(&_q->write_index);
+    unsigned int n = _q->max_size - CBUFFER_SPSC(_count)(_q, w, _q->read_cache);
+    if (_num_requested > n) {
+        _q->read_cache = SPSC_LOAD_ACQUIRE(&_q->read_index);
+        n = _q->max_size - CBUFFER_SPSC(_count)(_q, w, _q->read_cache);
+    }
+
+    // restrict to contiguous memory unless mirrored
+    unsigned int p = w < _q->ring_size ? w : w - _q->ring_size;
+    if (!_q->mirror && n > _q->ring_size - p)
+        n = _q->ring_size - p;
+
+    *_v             = _q->v + p;
+    *_num_available = _num_requested < n ? _num_requested : n;
+    return LIQUID_OK;
+}
+
+// publish _n samples written to memory from write_reserve()
+int CBUFFER_SPSC(_write_commit)(CBUFFER_SPSC() _q,
+                                unsigned int   _n)
+{
+    unsigned int w = SPSC_LOAD_RELAXED(&_q->write_index);
+    if (_n > _q->max_size - CBUFFER_SPSC(_count)(_q, w, _q->read_cache))
+        return liquid_error(LIQUID_EIRANGE,"cbuffer%s_spsc_write_commit(), cannot commit more elements than were reserved", EXTENSION);
+
+    SPSC_STORE_RELEASE(&_q->write_index, CBUFFER_SPSC(_advance)(_q, w, _n));
+    return LIQUID_OK;
+}
+
+// remove and return a single element from the buffer (consumer); an
+// empty buffer is reported without invoking liquid_error()
+int CBUFFER_SPSC(_pop)(CBUFFER_SPSC() _q,
+                       T *            _v)
+{
+    T *          r;
+    unsigned int num_read;
+    CBUFFER_SPSC(_read)(_q, 1, &r, &num_read);
+    if (num_read == 0)
+        return LIQUID_EIRANGE;
+
+    if (_v != NULL)
+        *_v = r[0];
+    return CBUFFER_SPSC(_release)(_q, 1);
+}
+
+// read buffer contents (consumer); the returned pointer remains valid
+// until the samples are released
+//  _q              : spsc cbuffer object
+//  _num_requested  : number of elements requested
+//  _v              : output pointer
+//  _num_read       : number of elements referenced by _v
+int CBUFFER_SPSC(_read)(CBUFFER_SPSC() _q,
+                        unsigned int   _num_requested,
+                        T **           _v,
+                        unsigned int * _num_read)
+{
+    unsigned int r = SPSC_LOAD_RELAXED(&_q->read_index);
+
+    // check cached write index first to avoid touching producer's line
+    unsigned int n = CBUFFER_SPSC(_count)(_q, _q->write_cache, r);
+    if (_num_requested > n) {
+        _q->write_cache = SPSC_LOAD_ACQUIRE(&_q->write_index);
+        n = CBUFFER_SPSC(_count)(_q, _q->write_cache, r);
+    }
+
+    // restrict to number available and maximum read size
+    if (_num_requested > n)
+        _num_requested = n;
+    if (_num_requested > _q->max_read)
+        _num_requested = _q->max_read;
+
+    // linearize samples at start of ring if necessary; these have
+    // already been published so the producer will not touch them
+    unsigned int p = r < _q->ring_size ? r : r - _q->ring_size;
+    unsigned int k = _q->ring_size - p;
+    if (!_q->mirror && _num_requested > k)
+        memmove(_q->v + _q->ring_size, _q->v, (_num_requested-k)*sizeof(T));
+
+    *_v        = _q->v + p;
+    *_num_read = _num_requested;
+    return LIQUID_OK;
+}
+
+// release _n samples in the buffer back to the producer (consumer)
+int CBUFFER_SPSC(_release)(CBUFFER_SPSC() _q,
+                           unsigned int   _n)
+{
+    unsigned int r = SPSC_LOAD_RELAXED(&_q->read_index);
+    if (_n > CBUFFER_SPSC(_count)(_q, _q->write_cache, r)) {
+        _q->write_cache = SPSC_LOAD_ACQUIRE(&_q->write_index);
+        if (_n > CBUFFER_SPSC(_count)(_q, _q->write_cache, r))
+            return liquid_error(LIQUID_EIRANGE,"cbuffer%s_spsc_release(), cannot release more elements in buffer than exist", EXTENSION);
+    }
+
+    SPSC_STORE_RELEASE(&_q->read_index, CBUFFER_SPSC(_advance)(_q, r, _n));
+    return LIQUID_OK;
+}
+
+
+//
+// internal methods
+//
+
+// number of elements between read and write indices
+unsigned int CBUFFER_SPSC(_count)(CBUFFER_SPSC() _q,
+                                  unsigned int   _write_index,
+                                  unsigned int   _read_index)
+{
+    return _write_index >= _read_index ?
+        _write_index - _read_index :
+        _write_index + 2*_q->ring_size - _read_index;
+}
+
+// advance index by _n, wrapping at twice the ring size
+unsigned int CBUFFER_SPSC(_advance)(CBUFFER_SPSC() _q,
+                                    unsigned int   _index,
+                                    unsigned int   _n)
+{
+    _index += _n;
+    return _index >= 2*_q->ring_size ? _index - 2*_q->ring_size : _index;
+}
+
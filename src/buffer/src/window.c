@@ -39,6 +39,7 @@ struct WINDOW(_s) {
     unsigned int num_allocated; // number of elements allocated
                                 // in memory
     unsigned int read_index;
+    int          mirror;        // memory mapped twice back to back?
 };
 
 // create window buffer object of length _n
@@ -57,11 +58,25 @@ WINDOW() WINDOW(_create)(unsigned int _n)
     q->n    = 1<<(q->m);            // 2^m
     q->mask = q->n - 1;             // bit mask
 
+    // try mirrored memory for larger windows: pushes never have to
+    // shift the buffer and writes are a single copy
+    q->v      = NULL;
+    q->mirror = 0;
+    size_t capacity = 0;
+    q->v = (T*) liquid_mirror_alloc(q->len*sizeof(T), &capacity);
+    if (q->v != NULL) {
+        q->mirror = 1;
+        q->n      = capacity / sizeof(T);
+        q->m      = liquid_msb_index(q->n) - 1;
+        q->mask   = q->n - 1;
+    }
+
     // number of elements to allocate to memory
     q->num_allocated = q->n + q->len - 1;
 
     // allocte memory
-    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    if (!q->mirror)
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
     q->read_index = 0;
 
     // reset window
@@ -111,7 +126,10 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
 int WINDOW(_destroy)(WINDOW() _q)
 {
     // free internal memory array
-    free(_q->v);
+    if (_q->mirror)
+        liquid_mirror_free(_q->v, _q->n*sizeof(T));
+    else
+        free(_q->v);
 
     // free main object memory
     free(_q);
@@ -163,8 +181,8 @@ int WINDOW(_reset)(WINDOW() _q)
     // reset read index
     _q->read_index = 0;
 
-    // clear all allocated memory
-    memset(_q->v, 0, (_q->num_allocated)*sizeof(T));
+    // clear all allocated memory (mirrored memory aliases past n)
+    memset(_q->v, 0, (_q->mirror ? _q->n : _q->num_allocated)*sizeof(T));
     return LIQUID_OK;
 }
 
@@ -207,7 +225,7 @@ int WINDOW(_push)(WINDOW() _q, T _v)
     _q->read_index &= _q->mask;
 
     // if pointer wraps around, copy excess memory
-    if (_q->read_index == 0)
+    if (_q->read_index == 0 && !_q->mirror)
         memmove(_q->v, _q->v + _q->n, (_q->len-1)*sizeof(T));
 
     // append value to end of buffer
@@ -223,10 +241,28 @@ int WINDOW(_write)(WINDOW()     _q,
                    T *          _v,
                    unsigned int _n)
 {
-    // TODO make this more efficient
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        WINDOW(_push)(_q, _v[i]);
+    unsigned int k;
+    while (_n > 0) {
+        if (_q->mirror) {
+            // copy up to the full ring at once; mirror handles wrapping
+            k = _n < _q->n ? _n : _q->n;
+            memmove(_q->v + ((_q->read_index + _q->len) & _q->mask), _v, k*sizeof(T));
+            _q->read_index = (_q->read_index + k) & _q->mask;
+        } else {
+            // copy as many values as fit before the pointer wraps around
+            k = _q->mask - _q->read_index;
+            if (k == 0) {
+                WINDOW(_push)(_q, _v[0]);
+                k = 1;
+            } else {
+                k = _n < k ? _n : k;
+                memmove(_q->v + _q->read_index + _q->len, _v, k*sizeof(T));
+                _q->read_index += k;
+            }
+        }
+        _v += k;
+        _n -= k;
+    }
     return LIQUID_OK;
 }
 
@@ -211,12 +211,16 @@ void autotest_cbuffercf()
 }
 
 // test general flow
-void autotest_cbufferf_flow()
+//  _max_size       : maximum number of elements in buffer
+//  _max_read       : maximum number of elements to read
+//  _num_elements   : total number of elements for run
+void testbench_cbufferf_flow(unsigned int _max_size,
+                             unsigned int _max_read,
+                             unsigned int _num_elements)
 {
-    // options
-    unsigned int max_size     =   48; // maximum number of elements in buffer
-    unsigned int max_read     =   17; // maximum number of elements to read
-    unsigned int num_elements = 1200; // total number of elements for run
+    unsigned int max_size     = _max_size;
+    unsigned int max_read     = _max_read;
+    unsigned int num_elements = _num_elements;
 
     // flag to indicate if test was successful
     int success = 1;
@@ -292,3 +296,19 @@ void autotest_cbufferf_flow()
 }
 
 
+
+// buffers this small use compact memory by default
+void autotest_cbufferf_flow()      { testbench_cbufferf_flow(  48,  17,  1200); }
+void autotest_cbufferf_flow_large(){ testbench_cbufferf_flow(1000, 700, 20000); }
+void autotest_cbufferf_flow_read() { testbench_cbufferf_flow(1500,1500, 20000); }
+
+// force mirrored memory where supported
+void autotest_cbufferf_flow_mirror()
+{
+    unsigned int mirror_min = liquid_buffer_mirror_get_min();
+    liquid_buffer_mirror_set_min(1);
+    testbench_cbufferf_flow(  48,  17,  1200);
+    testbench_cbufferf_flow(1000, 700, 20000);
+    testbench_cbufferf_flow(1500,1500, 20000);
+    liquid_buffer_mirror_set_min(mirror_min);
+}
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// lock-free single-producer/single-consumer circular buffer autotest
+//
+
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#   include <pthread.h>
+#   include <sched.h>
+#   define SPSC_YIELD() sched_yield()
+#else
+#   define SPSC_YIELD()
+#endif
+
+void autotest_cbufferf_spsc_config_errors()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping cbuffer spsc config test with strict exit enabled\n");
+    return;
+#else
+    CONTEND_EXPRESSION(cbufferf_spsc_create(0)==NULL);
+    CONTEND_EXPRESSION(cbufferf_spsc_create_max(10,0)==NULL);
+
+    // cannot over-commit or over-release
+    cbufferf_spsc q = cbufferf_spsc_create(4);
+    float v[4] = {1,2,3,4};
+    CONTEND_INEQUALITY(cbufferf_spsc_write_commit(q, 5), LIQUID_OK);
+    CONTEND_EQUALITY  (cbufferf_spsc_write(q, v, 4), LIQUID_OK);
+    CONTEND_INEQUALITY(cbufferf_spsc_release(q, 5), LIQUID_OK);
+    CONTEND_EQUALITY  (cbufferf_spsc_size(q), 4);
+    cbufferf_spsc_destroy(q);
+#endif
+}
+
+// a full or empty buffer is not an error: writes and pops fail quietly
+// without changing the buffer, even with strict exit enabled
+void autotest_cbufferf_spsc_full_empty()
+{
+    cbufferf_spsc q = cbufferf_spsc_create(4);
+    float v[5] = {1,2,3,4,5};
+    float x = 0;
+    CONTEND_EQUALITY(cbufferf_spsc_write(q, v, 5), LIQUID_EIRANGE);
+    CONTEND_EQUALITY(cbufferf_spsc_size(q), 0);
+    CONTEND_EQUALITY(cbufferf_spsc_pop(q, &x), LIQUID_EIRANGE);
+    CONTEND_EQUALITY(x, 0);
+    CONTEND_EQUALITY(cbufferf_spsc_write(q, v, 4), LIQUID_OK);
+    CONTEND_EQUALITY(cbufferf_spsc_push(q, 0), LIQUID_EIRANGE);
+    CONTEND_EQUALITY(cbufferf_spsc_size(q), 4);
+    CONTEND_EQUALITY(cbufferf_spsc_pop(q, &x), LIQUID_OK);
+    CONTEND_EQUALITY(x, 1);
+    CONTEND_EQUALITY(cbufferf_spsc_push(q, 6), LIQUID_OK);
+    cbufferf_spsc_destroy(q);
+}
+
+// single-threaded check of wrapping, linearization, and zero-copy writes
+void autotest_cbuffercf_spsc()
+{
+    float complex v[]   = {1, 2, 3, 4, 5, 6, 7, 8};
+    float complex test0[] = {1, 2, 3, 4};
+    float complex test1[] = {5, 6, 7, 1, 2};
+    float complex test2[] = {5, 6, 7, 1, 2, 3};
+    float complex * r;
+    unsigned int num_read;
+
+    cbuffercf_spsc q = cbuffercf_spsc_create_max(8, 6);
+    CONTEND_EQUALITY(cbuffercf_spsc_max_size(q), 8);
+    CONTEND_EQUALITY(cbuffercf_spsc_max_read(q), 6);
+
+    // write 7 elements, read and release first four
+    cbuffercf_spsc_write(q, v, 7);
+    CONTEND_EQUALITY(cbuffercf_spsc_size(q), 7);
+    cbuffercf_spsc_read(q, 4, &r, &num_read);
+    CONTEND_EQUALITY(num_read, 4);
+    CONTEND_SAME_DATA(r, test0, 4*sizeof(float complex));
+    cbuffercf_spsc_release(q, 4);
+    CONTEND_EQUALITY(cbuffercf_spsc_space_available(q), 5);
+
+    // write across end of ring and read back contiguously
+    cbuffercf_spsc_write(q, v, 3);
+    cbuffercf_spsc_read(q, 5, &r, &num_read);
+    CONTEND_EQUALITY(num_read, 5);
+    CONTEND_SAME_DATA(r, test1, 5*sizeof(float complex));
+
+    // fill directly into buffer memory
+    float complex * w;
+    unsigned int num_available;
+    cbuffercf_spsc_write_reserve(q, 4, &w, &num_available);
+    CONTEND_EXPRESSION(num_available > 0 && num_available <= 2);
+    w[0] = 4;
+    cbuffercf_spsc_write_commit(q, 1);
+    CONTEND_EQUALITY(cbuffercf_spsc_size(q), 7);
+
+    // read is limited to max_read
+    cbuffercf_spsc_read(q, 8, &r, &num_read);
+    CONTEND_EQUALITY(num_read, 6);
+    CONTEND_SAME_DATA(r, test2, 6*sizeof(float complex));
+
+    // pop remaining elements one at a time
+    cbuffercf_spsc_release(q, 6);
+    float complex x;
+    cbuffercf_spsc_pop(q, &x);
+    CONTEND_EQUALITY(x, 4.0f);
+    CONTEND_EQUALITY(cbuffercf_spsc_size(q), 0);
+
+    // reset
+    cbuffercf_spsc_push(q, 1);
+    cbuffercf_spsc_reset(q);
+    CONTEND_EQUALITY(cbuffercf_spsc_size(q), 0);
+    CONTEND_EQUALITY(cbuffercf_spsc_space_available(q), 8);
+
+    if (liquid_autotest_verbose)
+        cbuffercf_spsc_print(q);
+    cbuffercf_spsc_destroy(q);
+}
+
+// options for producer thread
+struct cbufferf_spsc_flow_s {
+    cbufferf_spsc q;
+    unsigned int  num_elements;
+    int           reserve;      // write with write_reserve/commit?
+    unsigned int  seed;
+    unsigned int  write_id;     // running total number of values written
+};
+
+// producer: write ramp in blocks of random size
+void * cbufferf_spsc_flow_producer(void * _p)
+{
+    struct cbufferf_spsc_flow_s * p = (struct cbufferf_spsc_flow_s *) _p;
+    unsigned int max_size = cbufferf_spsc_max_size(p->q);
+    float buf[max_size];
+    unsigned int write_id = p->write_id;
+    while (write_id < p->num_elements) {
+        unsigned int n = (rand_r(&p->seed) % max_size) + 1;
+        if (n > p->num_elements - write_id)
+            n = p->num_elements - write_id;
+
+        unsigned int i;
+        if (p->reserve) {
+            float * w;
+            cbufferf_spsc_write_reserve(p->q, n, &w, &n);
+            for (i=0; i<n; i++)
+                w[i] = (float)(write_id + i);
+            cbufferf_spsc_write_commit(p->q, n);
+            write_id += n;
+            if (n == 0)
+                SPSC_YIELD();
+        } else if (cbufferf_spsc_space_available(p->q) >= n) {
+            for (i=0; i<n; i++)
+                buf[i] = (float)(write_id + i);
+            cbufferf_spsc_write(p->q, buf, n);
+            write_id += n;
+        } else {
+            // let consumer run if sharing a cpu
+            SPSC_YIELD();
+        }
+#if !(HAVE_PTHREAD_H && HAVE_LIBPTHREAD)
+        // single-threaded: return to consumer after each attempt
+        break;
+#endif
+    }
+    p->write_id = write_id;
+    return NULL;
+}
+
+// test flow of samples from producer thread to consumer thread
+void testbench_cbufferf_spsc_flow(unsigned int _max_size,
+                                  unsigned int _max_read,
+                                  unsigned int _num_elements,
+                                  int          _reserve)
+{
+    cbufferf_spsc q = cbufferf_spsc_create_max(_max_size, _max_read);
+    struct cbufferf_spsc_flow_s p = {q, _num_elements, _reserve, 1, 0};
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+    pthread_t producer;
+    pthread_create(&producer, NULL, cbufferf_spsc_flow_producer, &p);
+#endif
+
+    // consumer: read blocks of random size and check ramp, draining the
+    // buffer even after a failure so the producer can finish
+    int success = 1;
+    unsigned int read_id = 0;
+    while (read_id < _num_elements) {
+#if !(HAVE_PTHREAD_H && HAVE_LIBPTHREAD)
+        cbufferf_spsc_flow_producer(&p);
+#endif
+        float * r;
+        unsigned int i, num_read;
+        cbufferf_spsc_read(q, (rand() % _max_read) + 1, &r, &num_read);
+        for (i=0; i<num_read; i++) {
+            if (r[i] != (float)read_id)
+                success = 0;
+            read_id++;
+        }
+        cbufferf_spsc_release(q, num_read);
+        if (num_read == 0)
+            SPSC_YIELD();
+    }
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+    pthread_join(producer, NULL);
+#endif
+
+    CONTEND_EXPRESSION(success == 1);
+    CONTEND_EQUALITY(read_id, _num_elements);
+    cbufferf_spsc_destroy(q);
+}
+
+// buffers this small use compact memory by default
+void autotest_cbufferf_spsc_flow()          { testbench_cbufferf_spsc_flow(  48,  17,  50000, 0); }
+void autotest_cbufferf_spsc_flow_reserve()  { testbench_cbufferf_spsc_flow(  48,  17,  50000, 1); }
+void autotest_cbufferf_spsc_flow_large()    { testbench_cbufferf_spsc_flow(1000, 700, 200000, 0); }
+void autotest_cbufferf_spsc_flow_large_reserve() { testbench_cbufferf_spsc_flow(1000, 700, 200000, 1); }
+
+// force mirrored memory where supported
+void autotest_cbufferf_spsc_flow_mirror()
+{
+    unsigned int mirror_min = liquid_buffer_mirror_get_min();
+    liquid_buffer_mirror_set_min(1);
+    testbench_cbufferf_spsc_flow(1000, 700, 200000, 0);
+    testbench_cbufferf_spsc_flow(1000, 700, 200000, 1);
+    liquid_buffer_mirror_set_min(mirror_min);
+}
@@ -23,6 +23,11 @@
 #include "autotest/autotest.h"
 #include "liquid.internal.h"
 
+#if HAVE_SYS_MMAN_H && HAVE_MEMFD_CREATE
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
 void autotest_window_config_errors()
 {
 #if LIQUID_STRICT_EXIT
@@ -149,3 +154,88 @@ void autotest_windowf()
     printf("done.\n");
 }
 
+
+// compare bulk writes against single pushes for a window of length _n
+void testbench_windowcf_write(unsigned int _n)
+{
+    unsigned int num_samples = 5*_n + 7;
+    float complex x[num_samples];
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        x[i] = (float)i + _Complex_I*(float)(num_samples-i);
+
+    windowcf q0 = windowcf_create(_n);  // single pushes
+    windowcf q1 = windowcf_create(_n);  // bulk writes
+
+    // write blocks of varying size, including larger than the window
+    unsigned int n = 0, block = 1;
+    float complex * r0, * r1;
+    while (n < num_samples) {
+        unsigned int k = n + block > num_samples ? num_samples - n : block;
+        for (i=0; i<k; i++)
+            windowcf_push(q0, x[n+i]);
+        windowcf_write(q1, x+n, k);
+        n += k;
+        block = (3*block + 1) % (2*_n) + 1;
+
+        windowcf_read(q0, &r0);
+        windowcf_read(q1, &r1);
+        CONTEND_SAME_DATA(r0, r1, _n*sizeof(float complex));
+    }
+
+    // most recent sample is always at the end of the window
+    windowcf_read(q1, &r1);
+    CONTEND_EQUALITY(r1[_n-1], x[num_samples-1]);
+
+    // reset clears entire window
+    windowcf_reset(q1);
+    windowcf_read(q1, &r1);
+    for (i=0; i<_n; i++)
+        CONTEND_EQUALITY(r1[i], 0.0f);
+
+    windowcf_destroy(q0);
+    windowcf_destroy(q1);
+}
+
+// windows use compact memory by default; lowering the threshold forces
+// mirrored memory where supported
+void autotest_windowcf_write_n10()   { testbench_windowcf_write(  10); }
+void autotest_windowcf_write_n300()  { testbench_windowcf_write( 300); }
+void autotest_windowcf_write_n1200() { testbench_windowcf_write(1200); }
+void autotest_windowcf_write_mirror()
+{
+    unsigned int mirror_min = liquid_buffer_mirror_get_min();
+    liquid_buffer_mirror_set_min(1);
+    testbench_windowcf_write(  10);
+    testbench_windowcf_write( 300);
+    testbench_windowcf_write(1200);
+    liquid_buffer_mirror_set_min(mirror_min);
+}
+
+// a window created before fork() remains usable in the child
+void autotest_windowcf_fork()
+{
+#if HAVE_SYS_MMAN_H && HAVE_MEMFD_CREATE
+    unsigned int mirror_min = liquid_buffer_mirror_get_min();
+    liquid_buffer_mirror_set_min(1);
+    windowcf q = windowcf_create(256);
+    liquid_buffer_mirror_set_min(mirror_min);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        // child: push and read back through the inherited object
+        float complex * r;
+        windowcf_push(q, 1.0f);
+        windowcf_read(q, &r);
+        _exit(r[255] == 1.0f ? 0 : 1);
+    }
+    CONTEND_EXPRESSION(pid > 0);
+    int status = 0;
+    CONTEND_EQUALITY(waitpid(pid, &status, 0), pid);
+    CONTEND_EXPRESSION(WIFEXITED(status));
+    CONTEND_EQUALITY(WEXITSTATUS(status), 0);
+    windowcf_destroy(q);
+#else
+    AUTOTEST_WARN("mirrored memory not supported on this platform\n");
+#endif
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void dotprod_cccd_bench(struct rusage *_start,
+                        struct rusage *_finish,
+                        unsigned long int *_num_iterations,
+                        unsigned int _n)
+{
+    // normalize number of iterations
+    *_num_iterations *= 100;
+    *_num_iterations /= _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    double complex x[_n];
+    double complex h[_n];
+    double complex y[8];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        h[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // create dotprod structure;
+    dotprod_cccd dp = dotprod_cccd_create(h,_n);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        dotprod_cccd_execute(dp, x, &y[0]);
+        dotprod_cccd_execute(dp, x, &y[1]);
+        dotprod_cccd_execute(dp, x, &y[2]);
+        dotprod_cccd_execute(dp, x, &y[3]);
+        dotprod_cccd_execute(dp, x, &y[4]);
+        dotprod_cccd_execute(dp, x, &y[5]);
+        dotprod_cccd_execute(dp, x, &y[6]);
+        dotprod_cccd_execute(dp, x, &y[7]);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 8;
+
+    // clean up objects
+    dotprod_cccd_destroy(dp);
+}
+
+#define DOTPROD_CCCD_BENCHMARK_API(N)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ dotprod_cccd_bench(_start, _finish, _num_iterations, N); }
+
+void benchmark_dotprod_cccd_4      DOTPROD_CCCD_BENCHMARK_API(4)
+void benchmark_dotprod_cccd_16     DOTPROD_CCCD_BENCHMARK_API(16)
+void benchmark_dotprod_cccd_64     DOTPROD_CCCD_BENCHMARK_API(64)
+void benchmark_dotprod_cccd_256    DOTPROD_CCCD_BENCHMARK_API(256)
+void benchmark_dotprod_cccd_1024   DOTPROD_CCCD_BENCHMARK_API(1024)
+
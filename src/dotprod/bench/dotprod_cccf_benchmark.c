@@ -75,4 +75,5 @@ void benchmark_dotprod_cccf_4      DOTPROD_CCCF_BENCHMARK_API(4)
 void benchmark_dotprod_cccf_16     DOTPROD_CCCF_BENCHMARK_API(16)
 void benchmark_dotprod_cccf_64     DOTPROD_CCCF_BENCHMARK_API(64)
 void benchmark_dotprod_cccf_256    DOTPROD_CCCF_BENCHMARK_API(256)
+void benchmark_dotprod_cccf_1024   DOTPROD_CCCF_BENCHMARK_API(1024)
 
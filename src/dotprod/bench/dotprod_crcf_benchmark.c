@@ -75,4 +75,5 @@ void benchmark_dotprod_crcf_4      DOTPROD_CRCF_BENCHMARK_API(4)
 void benchmark_dotprod_crcf_16     DOTPROD_CRCF_BENCHMARK_API(16)
 void benchmark_dotprod_crcf_64     DOTPROD_CRCF_BENCHMARK_API(64)
 void benchmark_dotprod_crcf_256    DOTPROD_CRCF_BENCHMARK_API(256)
+void benchmark_dotprod_crcf_1024   DOTPROD_CRCF_BENCHMARK_API(1024)
 
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void dotprod_q16_bench(struct rusage *_start,
+                       struct rusage *_finish,
+                       unsigned long int *_num_iterations,
+                       unsigned int _n,
+                       int _complex)
+{
+    // normalize number of iterations
+    *_num_iterations *= 128;
+    *_num_iterations /= _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    int16_t x[2*_n], h[_n], y[2];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        x[2*i+0] = 1000;
+        x[2*i+1] = -1000;
+        h[i]     = 1000;
+    }
+
+    // create dotprod structure;
+    dotprod_q16 dp = dotprod_q16_create(h,_n);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    if (_complex) {
+        for (i=0; i<(*_num_iterations); i++) {
+            dotprod_q16_execute_cq16(dp,x,y);
+            dotprod_q16_execute_cq16(dp,x,y);
+            dotprod_q16_execute_cq16(dp,x,y);
+            dotprod_q16_execute_cq16(dp,x,y);
+        }
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            dotprod_q16_execute(dp,x,y);
+            dotprod_q16_execute(dp,x,y);
+            dotprod_q16_execute(dp,x,y);
+            dotprod_q16_execute(dp,x,y);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    // clean up objects
+    dotprod_q16_destroy(dp);
+}
+
+#define DOTPROD_Q16_BENCHMARK_API(N,C)  \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ dotprod_q16_bench(_start, _finish, _num_iterations, N, C); }
+
+void benchmark_dotprod_q16_4        DOTPROD_Q16_BENCHMARK_API(4,   0)
+void benchmark_dotprod_q16_16       DOTPROD_Q16_BENCHMARK_API(16,  0)
+void benchmark_dotprod_q16_64       DOTPROD_Q16_BENCHMARK_API(64,  0)
+void benchmark_dotprod_q16_256      DOTPROD_Q16_BENCHMARK_API(256, 0)
+void benchmark_dotprod_q16_1024     DOTPROD_Q16_BENCHMARK_API(1024,0)
+
+void benchmark_dotprod_cq16_4       DOTPROD_Q16_BENCHMARK_API(4,   1)
+void benchmark_dotprod_cq16_16      DOTPROD_Q16_BENCHMARK_API(16,  1)
+void benchmark_dotprod_cq16_64      DOTPROD_Q16_BENCHMARK_API(64,  1)
+void benchmark_dotprod_cq16_256     DOTPROD_Q16_BENCHMARK_API(256, 1)
+void benchmark_dotprod_cq16_1024    DOTPROD_Q16_BENCHMARK_API(1024,1)
@@ -69,4 +69,5 @@ void benchmark_dotprod_rrrf_4       DOTPROD_RRRF_BENCHMARK_API(4)
 void benchmark_dotprod_rrrf_16      DOTPROD_RRRF_BENCHMARK_API(16)
 void benchmark_dotprod_rrrf_64      DOTPROD_RRRF_BENCHMARK_API(64)
 void benchmark_dotprod_rrrf_256     DOTPROD_RRRF_BENCHMARK_API(256)
+void benchmark_dotprod_rrrf_1024    DOTPROD_RRRF_BENCHMARK_API(1024)
 
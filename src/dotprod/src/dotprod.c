@@ -166,3 +166,54 @@ void DOTPROD(_execute)(DOTPROD() _q,
     DOTPROD(_run4)(_q->h, _x, _q->n, _y);
 }
 
+// execute structured dot product on block of input windows, computing
+// four outputs at a time so that each coefficient is loaded once for
+// several input windows
+//  _q      :   dot product object
+//  _x      :   input array [size: 1 x (_q->n + (_n-1)*_stride)]
+//  _stride :   input advance between outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: 1 x _n]
+void DOTPROD(_execute_block_stride)(DOTPROD()    _q,
+                                    TI *         _x,
+                                    unsigned int _stride,
+                                    unsigned int _n,
+                                    TO *         _y)
+{
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        TI * x0 = _x + (k+0)*_stride;
+        TI * x1 = _x + (k+1)*_stride;
+        TI * x2 = _x + (k+2)*_stride;
+        TI * x3 = _x + (k+3)*_stride;
+        TO y0 = 0, y1 = 0, y2 = 0, y3 = 0;
+        for (i=0; i<_q->n; i++) {
+            TC h = _q->h[i];
+            y0 += h * x0[i];
+            y1 += h * x1[i];
+            y2 += h * x2[i];
+            y3 += h * x3[i];
+        }
+        _y[k+0] = y0;
+        _y[k+1] = y1;
+        _y[k+2] = y2;
+        _y[k+3] = y3;
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++)
+        DOTPROD(_execute)(_q, &_x[k*_stride], &_y[k]);
+}
+
+// execute structured dot product on block of consecutive input windows
+//  _q      :   dot product object
+//  _x      :   input array [size: 1 x (_q->n + _n - 1)]
+//  _n      :   number of outputs
+//  _y      :   output array [size: 1 x _n]
+void DOTPROD(_execute_block)(DOTPROD()    _q,
+                             TI *         _x,
+                             unsigned int _n,
+                             TO *         _y)
+{
+    DOTPROD(_execute_block_stride)(_q, _x, 1, _n, _y);
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Complex floating-point dot product, double precision (AVX2/FMA)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX/AVX2/FMA
+
+// execute structured dot product (AVX2/FMA), two complex values per
+// register; as with the SSE2 kernel, the products with the repeated
+// in-phase and quadrature coefficients are accumulated separately
+//
+// sum_i = { sum(ac), sum(bc) }
+// sum_q = { sum(ad), sum(bd) }
+// y     = (sum_i[0] - sum_q[1]) + j(sum_i[1] + sum_q[0])
+//
+void dotprod_cccd_execute_avx2(dotprod_cccd     _q,
+                               double complex * _x,
+                               double complex * _y)
+{
+    // type cast input as floating point array
+    double * x = (double*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256d si0 = _mm256_setzero_pd(), sq0 = _mm256_setzero_pd();
+    __m256d si1 = _mm256_setzero_pd(), sq1 = _mm256_setzero_pd();
+
+    // r = 8*floor(n/8)
+    unsigned int r = (n >> 3) << 3;
+
+    unsigned int i;
+    for (i=0; i<r; i+=8) {
+        // load inputs into register (unaligned)
+        __m256d v0 = _mm256_loadu_pd(&x[i+0]);
+        __m256d v1 = _mm256_loadu_pd(&x[i+4]);
+
+        // multiply by coefficients (aligned) and accumulate
+        si0 = _mm256_fmadd_pd(v0, _mm256_load_pd(&_q->hi[i+0]), si0);
+        sq0 = _mm256_fmadd_pd(v0, _mm256_load_pd(&_q->hq[i+0]), sq0);
+        si1 = _mm256_fmadd_pd(v1, _mm256_load_pd(&_q->hi[i+4]), si1);
+        sq1 = _mm256_fmadd_pd(v1, _mm256_load_pd(&_q->hq[i+4]), sq1);
+    }
+
+    // fold down into 2-element registers
+    si0 = _mm256_add_pd(si0, si1);
+    sq0 = _mm256_add_pd(sq0, sq1);
+    __m128d si = _mm_add_pd(_mm256_castpd256_pd128(si0), _mm256_extractf128_pd(si0, 1));
+    __m128d sq = _mm_add_pd(_mm256_castpd256_pd128(sq0), _mm256_extractf128_pd(sq0, 1));
+
+    // remaining complex values
+    for ( ; i<n; i+=2) {
+        __m128d v = _mm_loadu_pd(&x[i]);
+        si = _mm_fmadd_pd(v, _mm_load_pd(&_q->hi[i]), si);
+        sq = _mm_fmadd_pd(v, _mm_load_pd(&_q->hq[i]), sq);
+    }
+
+    // unload packed arrays
+    double wi[2] __attribute__((aligned(16)));
+    double wq[2] __attribute__((aligned(16)));
+    _mm_store_pd(wi, si);
+    _mm_store_pd(wq, sq);
+
+    // set return value
+    *_y = (wi[0] - wq[1]) + _Complex_I*(wi[1] + wq[0]);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// 
+// Complex floating-point dot product, double precision (SSE2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <emmintrin.h>  // SSE2
+
+// execute structured dot product (SSE2), one complex value per register
+//
+// (a + jb)(c + jd) = (ac - bd) + j(ad + bc)
+//
+// mm_x  = { x[i].real, x[i].imag }
+// mm_hi = { h[i].real, h[i].real }
+// mm_hq = { h[i].imag, h[i].imag }
+//
+// The products mm_x * mm_hi and mm_x * mm_hq are accumulated separately
+// and only combined once at the end:
+//
+// sum_i = { sum(ac), sum(bc) }
+// sum_q = { sum(ad), sum(bd) }
+// y     = (sum_i[0] - sum_q[1]) + j(sum_i[1] + sum_q[0])
+//
+void dotprod_cccd_execute_sse(dotprod_cccd     _q,
+                              double complex * _x,
+                              double complex * _y)
+{
+    // type cast input as floating point array
+    double * x = (double*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m128d si0 = _mm_setzero_pd(), sq0 = _mm_setzero_pd();
+    __m128d si1 = _mm_setzero_pd(), sq1 = _mm_setzero_pd();
+
+    // r = 4*floor(n/4)
+    unsigned int r = (n >> 2) << 2;
+
+    unsigned int i;
+    for (i=0; i<r; i+=4) {
+        // load inputs into register (unaligned)
+        __m128d v0 = _mm_loadu_pd(&x[i+0]);
+        __m128d v1 = _mm_loadu_pd(&x[i+2]);
+
+        // multiply by coefficients (aligned) and accumulate
+        si0 = _mm_add_pd(si0, _mm_mul_pd(v0, _mm_load_pd(&_q->hi[i+0])));
+        sq0 = _mm_add_pd(sq0, _mm_mul_pd(v0, _mm_load_pd(&_q->hq[i+0])));
+        si1 = _mm_add_pd(si1, _mm_mul_pd(v1, _mm_load_pd(&_q->hi[i+2])));
+        sq1 = _mm_add_pd(sq1, _mm_mul_pd(v1, _mm_load_pd(&_q->hq[i+2])));
+    }
+
+    // remaining value
+    if (i < n) {
+        __m128d v0 = _mm_loadu_pd(&x[i]);
+        si0 = _mm_add_pd(si0, _mm_mul_pd(v0, _mm_load_pd(&_q->hi[i])));
+        sq0 = _mm_add_pd(sq0, _mm_mul_pd(v0, _mm_load_pd(&_q->hq[i])));
+    }
+
+    // unload packed arrays
+    double wi[2] __attribute__((aligned(16)));
+    double wq[2] __attribute__((aligned(16)));
+    _mm_store_pd(wi, _mm_add_pd(si0, si1));
+    _mm_store_pd(wq, _mm_add_pd(sq0, sq1));
+
+    // set return value
+    *_y = (wi[0] - wq[1]) + _Complex_I*(wi[1] + wq[0]);
+}
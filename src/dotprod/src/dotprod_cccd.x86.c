@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Complex floating-point dot product (double precision), run-time
+// selection of SIMD kernels (x86)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmmintrin.h>  // _mm_malloc, _mm_free
+
+#include "liquid.internal.h"
+
+// basic dot product (ordinal calculation)
+void dotprod_cccd_run(double complex * _h,
+                      double complex * _x,
+                      unsigned int     _n,
+                      double complex * _y)
+{
+    double complex r = 0;
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        r += _h[i] * _x[i];
+    *_y = r;
+}
+
+// basic dot product (ordinal calculation) with loop unrolled
+void dotprod_cccd_run4(double complex * _h,
+                       double complex * _x,
+                       unsigned int     _n,
+                       double complex * _y)
+{
+    double complex r = 0;
+
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2; 
+
+    // compute dotprod in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        r += _h[i]   * _x[i];
+        r += _h[i+1] * _x[i+1];
+        r += _h[i+2] * _x[i+2];
+        r += _h[i+3] * _x[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        r += _h[i] * _x[i];
+
+    *_y = r;
+}
+
+
+//
+// structured dot product
+//
+
+dotprod_cccd dotprod_cccd_create(double complex * _h,
+                                 unsigned int     _n)
+{
+    dotprod_cccd q = (dotprod_cccd)malloc(sizeof(struct dotprod_cccd_s));
+    q->n = _n;
+
+    // allocate aligned memory for coefficients
+    q->hi = (double*) _mm_malloc( 2*q->n*sizeof(double), LIQUID_SIMD_ALIGN );
+    q->hq = (double*) _mm_malloc( 2*q->n*sizeof(double), LIQUID_SIMD_ALIGN );
+
+    // set coefficients, repeated
+    //  hi = { creal(_h[0]), creal(_h[0]), ... creal(_h[n-1]), creal(_h[n-1])}
+    //  hq = { cimag(_h[0]), cimag(_h[0]), ... cimag(_h[n-1]), cimag(_h[n-1])}
+    unsigned int i;
+    for (i=0; i<q->n; i++) {
+        q->hi[2*i+0] = creal(_h[i]);
+        q->hi[2*i+1] = creal(_h[i]);
+
+        q->hq[2*i+0] = cimag(_h[i]);
+        q->hq[2*i+1] = cimag(_h[i]);
+    }
+
+    // resolve kernels
+    q->simd = liquid_simd_get_kernels();
+
+    // return object
+    return q;
+}
+
+// re-create the structured dotprod object
+dotprod_cccd dotprod_cccd_recreate(dotprod_cccd     _q,
+                                   double complex * _h,
+                                   unsigned int     _n)
+{
+    // completely destroy and re-create dotprod object
+    dotprod_cccd_destroy(_q);
+    return dotprod_cccd_create(_h,_n);
+}
+
+void dotprod_cccd_destroy(dotprod_cccd _q)
+{
+    _mm_free(_q->hi);
+    _mm_free(_q->hq);
+    free(_q);
+}
+
+void dotprod_cccd_print(dotprod_cccd _q)
+{
+    printf("dotprod_cccd [%s, %u coefficients]\n", liquid_simd_str[_q->simd->type][0], _q->n);
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        printf("  %3u : %16.12f +j%16.12f\n", i, _q->hi[2*i], _q->hq[2*i]);
+}
+
+// execute structured dot product using selected kernel
+//  _q      :   dotprod object
+//  _x      :   input array
+//  _y      :   output sample
+void dotprod_cccd_execute(dotprod_cccd     _q,
+                          double complex * _x,
+                          double complex * _y)
+{
+    _q->simd->dotprod_cccd(_q, _x, _y);
+}
+
+// execute structured dot product on block of input windows using
+// selected kernel, one output at a time
+void dotprod_cccd_execute_block_stride(dotprod_cccd     _q,
+                                       double complex * _x,
+                                       unsigned int     _stride,
+                                       unsigned int     _n,
+                                       double complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        _q->simd->dotprod_cccd(_q, &_x[k*_stride], &_y[k]);
+}
+
+// execute structured dot product on block of consecutive input windows
+void dotprod_cccd_execute_block(dotprod_cccd     _q,
+                                double complex * _x,
+                                unsigned int     _n,
+                                double complex * _y)
+{
+    dotprod_cccd_execute_block_stride(_q, _x, 1, _n, _y);
+}
+
+// portable C kernel
+//
+// (a + jb)(c + jd) = (ac - bd) + j(ad + bc)
+void dotprod_cccd_execute_portable(dotprod_cccd     _q,
+                                   double complex * _x,
+                                   double complex * _y)
+{
+    double * x = (double*) _x;
+    double yi = 0, yq = 0;
+    unsigned int i;
+    for (i=0; i<2*_q->n; i+=2) {
+        yi += _q->hi[i]*x[i  ] - _q->hq[i]*x[i+1];
+        yq += _q->hi[i]*x[i+1] + _q->hq[i]*x[i  ];
+    }
+    *_y = yi + _Complex_I*yq;
+}
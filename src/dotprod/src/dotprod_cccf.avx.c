@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Floating-point dot product (AVX2/FMA)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX/AVX2/FMA
+
+#define DEBUG_DOTPROD_CCCF_AVX   0
+
+// forward declaration of internal methods
+void dotprod_cccf_execute_avx(dotprod_cccf    _q,
+                              float complex * _x,
+                              float complex * _y);
+
+void dotprod_cccf_execute_avxu(dotprod_cccf    _q,
+                               float complex * _x,
+                               float complex * _y);
+
+// execute structured dot product (AVX2/FMA), selecting method based
+// on size
+//  _q      :   dotprod object
+//  _x      :   input array
+//  _y      :   output sample
+void dotprod_cccf_execute_avx2(dotprod_cccf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // switch based on size
+    if (_q->n < 32) {
+        dotprod_cccf_execute_avx(_q, _x, _y);
+    } else {
+        dotprod_cccf_execute_avxu(_q, _x, _y);
+    }
+}
+
+// fold in-phase and quadrature accumulators down to complex value
+//
+// sumi = { x[k].real * h[k].real, x[k].imag * h[k].real, ... }
+// sumq = { x[k].real * h[k].imag, x[k].imag * h[k].imag, ... }
+//
+// swapping adjacent pairs of sumq and combining with addsub yields
+// { re, im, re, im, ... } which is then folded down
+static inline float complex dotprod_cccf_avx_fold(__m256 _sumi,
+                                                  __m256 _sumq)
+{
+    // shuffle values
+    _sumq = _mm256_permute_ps( _sumq, _MM_SHUFFLE(2,3,0,1) );
+
+    // combine using addsub_ps()
+    __m256 sum = _mm256_addsub_ps( _sumi, _sumq );
+
+    // add upper and lower halves: { re, im, re, im }
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum),
+                          _mm256_extractf128_ps(sum, 1));
+
+    // add in-phase and quadrature components
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+    // aligned output array
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+    return w[0] + _Complex_I*w[1];
+}
+
+// use AVX2/FMA extensions
+//
+// (a + jb)(c + jd) = (ac - bd) + j(ad + bc)
+//
+// mm_x  = { x[0].real, x[0].imag, x[1].real, x[1].imag, ... }
+// mm_hi = { h[0].real, h[0].real, h[1].real, h[1].real, ... }
+// mm_hq = { h[0].imag, h[0].imag, h[1].imag, h[1].imag, ... }
+//
+// mm_y0 = mm_x * mm_hi
+//       = { x[0].real * h[0].real,
+//           x[0].imag * h[0].real,
+//           x[1].real * h[1].real,
+//           x[1].imag * h[1].real, ... };
+//
+// mm_y1 = mm_x * mm_hq
+//       = { x[0].real * h[0].imag,
+//           x[0].imag * h[0].imag,
+//           x[1].real * h[1].imag,
+//           x[1].imag * h[1].imag, ... };
+//
+void dotprod_cccf_execute_avx(dotprod_cccf    _q,
+                              float complex * _x,
+                              float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // temporary buffers
+    __m256 v;   // input vector
+    __m256 hi;  // coefficients vector (real)
+    __m256 hq;  // coefficients vector (imag)
+
+    // load zeros into sum registers
+    __m256 sumi = _mm256_setzero_ps();
+    __m256 sumq = _mm256_setzero_ps();
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (n >> 3) << 3;
+
+    //
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        // load inputs into register (unaligned)
+        v = _mm256_loadu_ps(&x[i]);
+
+        // load coefficients into register (aligned)
+        hi = _mm256_load_ps(&_q->hi[i]);
+        hq = _mm256_load_ps(&_q->hq[i]);
+
+        // compute parallel multiply-accumulate
+        sumi = _mm256_fmadd_ps(v, hi, sumi);
+        sumq = _mm256_fmadd_ps(v, hq, sumq);
+    }
+
+    // fold down into complex value
+    float complex total = dotprod_cccf_avx_fold(sumi, sumq);
+
+    // cleanup
+    for (i=t/2; i<_q->n; i++)
+        total += _x[i] * ( _q->hi[2*i] + _q->hq[2*i]*_Complex_I );
+
+    // set return value
+    *_y = total;
+}
+
+// use AVX2/FMA extensions, unrolled loop with independent accumulators
+void dotprod_cccf_execute_avxu(dotprod_cccf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256 v0,  v1;     // input vectors
+    __m256 hi0, hi1;    // coefficients vectors (real)
+    __m256 hq0, hq1;    // coefficients vectors (imag)
+
+    // load zeros into sum registers
+    __m256 sumi0 = _mm256_setzero_ps();
+    __m256 sumi1 = _mm256_setzero_ps();
+    __m256 sumq0 = _mm256_setzero_ps();
+    __m256 sumq1 = _mm256_setzero_ps();
+
+    // r = 16*floor(n/16)
+    unsigned int r = (n >> 4) << 4;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        // load inputs into register (unaligned)
+        v0 = _mm256_loadu_ps(&x[i+0]);
+        v1 = _mm256_loadu_ps(&x[i+8]);
+
+        // load real coefficients into registers (aligned)
+        hi0 = _mm256_load_ps(&_q->hi[i+0]);
+        hi1 = _mm256_load_ps(&_q->hi[i+8]);
+
+        // load imaginary coefficients into registers (aligned)
+        hq0 = _mm256_load_ps(&_q->hq[i+0]);
+        hq1 = _mm256_load_ps(&_q->hq[i+8]);
+
+        // compute parallel multiply-accumulate on independent registers
+        sumi0 = _mm256_fmadd_ps(v0, hi0, sumi0);
+        sumi1 = _mm256_fmadd_ps(v1, hi1, sumi1);
+        sumq0 = _mm256_fmadd_ps(v0, hq0, sumq0);
+        sumq1 = _mm256_fmadd_ps(v1, hq1, sumq1);
+    }
+
+    // continue in groups of 8
+    unsigned int t = (n >> 3) << 3;
+    for ( ; i<t; i+=8) {
+        v0    = _mm256_loadu_ps(&x[i]);
+        hi0   = _mm256_load_ps(&_q->hi[i]);
+        hq0   = _mm256_load_ps(&_q->hq[i]);
+        sumi0 = _mm256_fmadd_ps(v0, hi0, sumi0);
+        sumq0 = _mm256_fmadd_ps(v0, hq0, sumq0);
+    }
+
+    // fold down
+    sumi0 = _mm256_add_ps( sumi0, sumi1 );
+    sumq0 = _mm256_add_ps( sumq0, sumq1 );
+
+    // fold down into complex value
+    float complex total = dotprod_cccf_avx_fold(sumi0, sumq0);
+
+    // cleanup
+    for (i=t/2; i<_q->n; i++)
+        total += _x[i] * ( _q->hi[2*i] + _q->hq[2*i]*_Complex_I );
+
+    // set return value
+    *_y = total;
+}
+
+// execute structured dot product (AVX2/FMA) on block of input windows,
+// computing four outputs at a time so that each pair of coefficient
+// registers is shared by four pairs of independent accumulators
+void dotprod_cccf_execute_block_avx2(dotprod_cccf    _q,
+                                     float complex * _x,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (n >> 3) << 3;
+
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        __m256 sumi0 = _mm256_setzero_ps(), sumq0 = _mm256_setzero_ps();
+        __m256 sumi1 = _mm256_setzero_ps(), sumq1 = _mm256_setzero_ps();
+        __m256 sumi2 = _mm256_setzero_ps(), sumq2 = _mm256_setzero_ps();
+        __m256 sumi3 = _mm256_setzero_ps(), sumq3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into registers (aligned)
+            __m256 hi = _mm256_load_ps(&_q->hi[i]);
+            __m256 hq = _mm256_load_ps(&_q->hq[i]);
+
+            // compute parallel multiply-accumulate for each output
+            __m256 v;
+            v = _mm256_loadu_ps(&x0[i]);
+            sumi0 = _mm256_fmadd_ps(v, hi, sumi0);
+            sumq0 = _mm256_fmadd_ps(v, hq, sumq0);
+            v = _mm256_loadu_ps(&x1[i]);
+            sumi1 = _mm256_fmadd_ps(v, hi, sumi1);
+            sumq1 = _mm256_fmadd_ps(v, hq, sumq1);
+            v = _mm256_loadu_ps(&x2[i]);
+            sumi2 = _mm256_fmadd_ps(v, hi, sumi2);
+            sumq2 = _mm256_fmadd_ps(v, hq, sumq2);
+            v = _mm256_loadu_ps(&x3[i]);
+            sumi3 = _mm256_fmadd_ps(v, hi, sumi3);
+            sumq3 = _mm256_fmadd_ps(v, hq, sumq3);
+        }
+
+        // fold down into complex values
+        _y[k+0] = dotprod_cccf_avx_fold(sumi0, sumq0);
+        _y[k+1] = dotprod_cccf_avx_fold(sumi1, sumq1);
+        _y[k+2] = dotprod_cccf_avx_fold(sumi2, sumq2);
+        _y[k+3] = dotprod_cccf_avx_fold(sumi3, sumq3);
+
+        // cleanup
+        for (i=t/2; i<_q->n; i++) {
+            float complex h = _q->hi[2*i] + _q->hq[2*i]*_Complex_I;
+            _y[k+0] += h * _x[(k+0)*_stride + i];
+            _y[k+1] += h * _x[(k+1)*_stride + i];
+            _y[k+2] += h * _x[(k+2)*_stride + i];
+            _y[k+3] += h * _x[(k+3)*_stride + i];
+        }
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_avx2(_q, &_x[k*_stride], &_y[k]);
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Floating-point dot product (AVX-512F)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX-512F
+
+#define DEBUG_DOTPROD_CCCF_AVX512   0
+
+// fold in-phase and quadrature accumulators down to complex value
+static inline float complex dotprod_cccf_avx512_fold(__m512 _sumi,
+                                                     __m512 _sumq)
+{
+    // swap adjacent pairs of quadrature sum:
+    //  sumq = { x[k].imag * h[k].imag, x[k].real * h[k].imag, ... }
+    _sumq = _mm512_permute_ps( _sumq, _MM_SHUFFLE(2,3,0,1) );
+
+    // subtract in even (real) lanes, add in odd (imaginary) lanes
+    __m512 sum = _mm512_mask_sub_ps(_mm512_add_ps(_sumi, _sumq), 0x5555, _sumi, _sumq);
+
+    // add in-phase and quadrature components separately
+    float yi = _mm512_mask_reduce_add_ps(0x5555, sum);
+    float yq = _mm512_mask_reduce_add_ps(0xaaaa, sum);
+    return yi + _Complex_I*yq;
+}
+
+// execute structured dot product (AVX-512F), unrolled loop with
+// independent accumulators; remaining elements (fewer than 16) are
+// computed with a masked load rather than a scalar cleanup loop
+//
+// (a + jb)(c + jd) = (ac - bd) + j(ad + bc)
+//
+// mm_x  = { x[0].real, x[0].imag, x[1].real, x[1].imag, ... }
+// mm_hi = { h[0].real, h[0].real, h[1].real, h[1].real, ... }
+// mm_hq = { h[0].imag, h[0].imag, h[1].imag, h[1].imag, ... }
+//
+// sumi  = { x[k].real * h[k].real, x[k].imag * h[k].real, ... }
+// sumq  = { x[k].real * h[k].imag, x[k].imag * h[k].imag, ... }
+//
+//  _q      :   dotprod object
+//  _x      :   input array
+//  _y      :   output sample
+void dotprod_cccf_execute_avx512(dotprod_cccf    _q,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m512 v0,  v1;     // input vectors
+    __m512 hi0, hi1;    // coefficients vectors (real)
+    __m512 hq0, hq1;    // coefficients vectors (imag)
+
+    // load zeros into sum registers
+    __m512 sumi0 = _mm512_setzero_ps();
+    __m512 sumi1 = _mm512_setzero_ps();
+    __m512 sumq0 = _mm512_setzero_ps();
+    __m512 sumq1 = _mm512_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (n >> 5) << 5;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // load inputs into register (unaligned)
+        v0 = _mm512_loadu_ps(&x[i+ 0]);
+        v1 = _mm512_loadu_ps(&x[i+16]);
+
+        // load real coefficients into registers (aligned)
+        hi0 = _mm512_load_ps(&_q->hi[i+ 0]);
+        hi1 = _mm512_load_ps(&_q->hi[i+16]);
+
+        // load imaginary coefficients into registers (aligned)
+        hq0 = _mm512_load_ps(&_q->hq[i+ 0]);
+        hq1 = _mm512_load_ps(&_q->hq[i+16]);
+
+        // compute parallel multiply-accumulate on independent registers
+        sumi0 = _mm512_fmadd_ps(v0, hi0, sumi0);
+        sumi1 = _mm512_fmadd_ps(v1, hi1, sumi1);
+        sumq0 = _mm512_fmadd_ps(v0, hq0, sumq0);
+        sumq1 = _mm512_fmadd_ps(v1, hq1, sumq1);
+    }
+
+    // continue in groups of 16
+    unsigned int t = (n >> 4) << 4;
+    for ( ; i<t; i+=16) {
+        v0    = _mm512_loadu_ps(&x[i]);
+        hi0   = _mm512_load_ps(&_q->hi[i]);
+        hq0   = _mm512_load_ps(&_q->hq[i]);
+        sumi0 = _mm512_fmadd_ps(v0, hi0, sumi0);
+        sumq0 = _mm512_fmadd_ps(v0, hq0, sumq0);
+    }
+
+    // remaining elements, zeroing unused lanes
+    if (i < n) {
+        __mmask16 mask = (__mmask16)((1u << (n - i)) - 1);
+        v0    = _mm512_maskz_loadu_ps(mask, &x[i]);
+        hi0   = _mm512_maskz_load_ps (mask, &_q->hi[i]);
+        hq0   = _mm512_maskz_load_ps (mask, &_q->hq[i]);
+        sumi1 = _mm512_fmadd_ps(v0, hi0, sumi1);
+        sumq1 = _mm512_fmadd_ps(v0, hq0, sumq1);
+    }
+
+    // fold down
+    sumi0 = _mm512_add_ps( sumi0, sumi1 );
+    sumq0 = _mm512_add_ps( sumq0, sumq1 );
+
+    // fold down into complex value
+    *_y = dotprod_cccf_avx512_fold(sumi0, sumq0);
+}
+
+// execute structured dot product (AVX-512F) on block of input windows,
+// computing four outputs at a time so that each pair of coefficient
+// registers is shared by four pairs of independent accumulators
+void dotprod_cccf_execute_block_avx512(dotprod_cccf    _q,
+                                       float complex * _x,
+                                       unsigned int    _stride,
+                                       unsigned int    _n,
+                                       float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // t = 16*(floor(_n/16)), and mask for remaining elements
+    unsigned int t = (n >> 4) << 4;
+    __mmask16 mask = (__mmask16)((1u << (n - t)) - 1);
+
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        __m512 sumi0 = _mm512_setzero_ps(), sumq0 = _mm512_setzero_ps();
+        __m512 sumi1 = _mm512_setzero_ps(), sumq1 = _mm512_setzero_ps();
+        __m512 sumi2 = _mm512_setzero_ps(), sumq2 = _mm512_setzero_ps();
+        __m512 sumi3 = _mm512_setzero_ps(), sumq3 = _mm512_setzero_ps();
+
+        __m512 v, hi, hq;
+        for (i=0; i<t; i+=16) {
+            // load coefficients into registers (aligned)
+            hi = _mm512_load_ps(&_q->hi[i]);
+            hq = _mm512_load_ps(&_q->hq[i]);
+
+            // compute parallel multiply-accumulate for each output
+            v = _mm512_loadu_ps(&x0[i]);
+            sumi0 = _mm512_fmadd_ps(v, hi, sumi0);
+            sumq0 = _mm512_fmadd_ps(v, hq, sumq0);
+            v = _mm512_loadu_ps(&x1[i]);
+            sumi1 = _mm512_fmadd_ps(v, hi, sumi1);
+            sumq1 = _mm512_fmadd_ps(v, hq, sumq1);
+            v = _mm512_loadu_ps(&x2[i]);
+            sumi2 = _mm512_fmadd_ps(v, hi, sumi2);
+            sumq2 = _mm512_fmadd_ps(v, hq, sumq2);
+            v = _mm512_loadu_ps(&x3[i]);
+            sumi3 = _mm512_fmadd_ps(v, hi, sumi3);
+            sumq3 = _mm512_fmadd_ps(v, hq, sumq3);
+        }
+
+        // remaining elements, zeroing unused lanes
+        if (mask) {
+            hi = _mm512_maskz_load_ps(mask, &_q->hi[i]);
+            hq = _mm512_maskz_load_ps(mask, &_q->hq[i]);
+            v = _mm512_maskz_loadu_ps(mask, &x0[i]);
+            sumi0 = _mm512_fmadd_ps(v, hi, sumi0);
+            sumq0 = _mm512_fmadd_ps(v, hq, sumq0);
+            v = _mm512_maskz_loadu_ps(mask, &x1[i]);
+            sumi1 = _mm512_fmadd_ps(v, hi, sumi1);
+            sumq1 = _mm512_fmadd_ps(v, hq, sumq1);
+            v = _mm512_maskz_loadu_ps(mask, &x2[i]);
+            sumi2 = _mm512_fmadd_ps(v, hi, sumi2);
+            sumq2 = _mm512_fmadd_ps(v, hq, sumq2);
+            v = _mm512_maskz_loadu_ps(mask, &x3[i]);
+            sumi3 = _mm512_fmadd_ps(v, hi, sumi3);
+            sumq3 = _mm512_fmadd_ps(v, hq, sumq3);
+        }
+
+        // fold down into complex values
+        _y[k+0] = dotprod_cccf_avx512_fold(sumi0, sumq0);
+        _y[k+1] = dotprod_cccf_avx512_fold(sumi1, sumq1);
+        _y[k+2] = dotprod_cccf_avx512_fold(sumi2, sumq2);
+        _y[k+3] = dotprod_cccf_avx512_fold(sumi3, sumq3);
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_avx512(_q, &_x[k*_stride], &_y[k]);
+}
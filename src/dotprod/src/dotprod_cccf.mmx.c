@@ -60,116 +60,14 @@ void dotprod_cccf_execute_mmx4(dotprod_cccf    _q,
                                float complex * _x,
                                float complex * _y);
 
-// basic dot product (ordinal calculation)
-void dotprod_cccf_run(float complex * _h,
-                      float complex * _x,
-                      unsigned int    _n,
-                      float complex * _y)
-{
-    float complex r = 0;
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        r += _h[i] * _x[i];
-    *_y = r;
-}
-
-// basic dot product (ordinal calculation) with loop unrolled
-void dotprod_cccf_run4(float complex * _h,
-                       float complex * _x,
-                       unsigned int    _n,
-                       float complex * _y)
-{
-    float complex r = 0;
-
-    // t = 4*(floor(_n/4))
-    unsigned int t=(_n>>2)<<2; 
-
-    // compute dotprod in groups of 4
-    unsigned int i;
-    for (i=0; i<t; i+=4) {
-        r += _h[i]   * _x[i];
-        r += _h[i+1] * _x[i+1];
-        r += _h[i+2] * _x[i+2];
-        r += _h[i+3] * _x[i+3];
-    }
-
-    // clean up remaining
-    for ( ; i<_n; i++)
-        r += _h[i] * _x[i];
-
-    *_y = r;
-}
-
-
-//
-// structured MMX dot product
-//
-
-struct dotprod_cccf_s {
-    unsigned int n;     // length
-    float * hi;         // in-phase
-    float * hq;         // quadrature
-};
-
-dotprod_cccf dotprod_cccf_create(float complex * _h,
-                                 unsigned int    _n)
-{
-    dotprod_cccf q = (dotprod_cccf)malloc(sizeof(struct dotprod_cccf_s));
-    q->n = _n;
-
-    // allocate memory for coefficients, 16-byte aligned
-    q->hi = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
-    q->hq = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
-
-    // set coefficients, repeated
-    //  hi = { crealf(_h[0]), crealf(_h[0]), ... crealf(_h[n-1]), crealf(_h[n-1])}
-    //  hq = { cimagf(_h[0]), cimagf(_h[0]), ... cimagf(_h[n-1]), cimagf(_h[n-1])}
-    unsigned int i;
-    for (i=0; i<q->n; i++) {
-        q->hi[2*i+0] = crealf(_h[i]);
-        q->hi[2*i+1] = crealf(_h[i]);
-
-        q->hq[2*i+0] = cimagf(_h[i]);
-        q->hq[2*i+1] = cimagf(_h[i]);
-    }
-
-    // return object
-    return q;
-}
-
-// re-create the structured dotprod object
-dotprod_cccf dotprod_cccf_recreate(dotprod_cccf    _q,
-                                   float complex * _h,
-                                   unsigned int    _n)
-{
-    // completely destroy and re-create dotprod object
-    dotprod_cccf_destroy(_q);
-    return dotprod_cccf_create(_h,_n);
-}
-
-
-void dotprod_cccf_destroy(dotprod_cccf _q)
-{
-    _mm_free(_q->hi);
-    _mm_free(_q->hq);
-    free(_q);
-}
-
-void dotprod_cccf_print(dotprod_cccf _q)
-{
-    printf("dotprod_cccf [mmx, %u coefficients]\n", _q->n);
-    unsigned int i;
-    for (i=0; i<_q->n; i++)
-        printf("  %3u : %12.9f +j%12.9f\n", i, _q->hi[i], _q->hq[i]);
-}
-
-// execute structured dot product
+// execute structured dot product (SSE), selecting method based
+// on size
 //  _q      :   dotprod object
 //  _x      :   input array
 //  _y      :   output sample
-void dotprod_cccf_execute(dotprod_cccf    _q,
-                          float complex * _x,
-                          float complex * _y)
+void dotprod_cccf_execute_sse(dotprod_cccf    _q,
+                              float complex * _x,
+                              float complex * _y)
 {
     // switch based on size
     if (_q->n < 32) {
@@ -380,3 +278,15 @@ void dotprod_cccf_execute_mmx4(dotprod_cccf    _q,
     *_y = total;
 }
 
+// execute structured dot product (SSE) on block of input windows, one
+// output at a time
+void dotprod_cccf_execute_block_sse(dotprod_cccf    _q,
+                                    float complex * _x,
+                                    unsigned int    _stride,
+                                    unsigned int    _n,
+                                    float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_cccf_execute_sse(_q, &_x[k*_stride], &_y[k]);
+}
@@ -340,3 +340,24 @@ void dotprod_cccf_execute_neon4(dotprod_cccf    _q,
     *_y = total;
 }
 
+// execute structured dot product on block of input windows, one output
+// at a time
+void dotprod_cccf_execute_block_stride(dotprod_cccf    _q,
+                                       float complex * _x,
+                                       unsigned int    _stride,
+                                       unsigned int    _n,
+                                       float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_cccf_execute(_q, &_x[k*_stride], &_y[k]);
+}
+
+// execute structured dot product on block of consecutive input windows
+void dotprod_cccf_execute_block(dotprod_cccf    _q,
+                                float complex * _x,
+                                unsigned int    _n,
+                                float complex * _y)
+{
+    dotprod_cccf_execute_block_stride(_q, _x, 1, _n, _y);
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Complex floating-point dot product with real coefficients, double
+// precision (AVX2/FMA)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX/AVX2/FMA
+
+// execute structured dot product (AVX2/FMA), two complex values per
+// register multiplied by their repeated real coefficients
+// { h[i], h[i], h[i+1], h[i+1] }, with independent accumulators for
+// each group of eight
+void dotprod_crcd_execute_avx2(dotprod_crcd     _q,
+                               double complex * _x,
+                               double complex * _y)
+{
+    // type cast input as floating point array
+    double * x = (double*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256d sum0 = _mm256_setzero_pd();
+    __m256d sum1 = _mm256_setzero_pd();
+    __m256d sum2 = _mm256_setzero_pd();
+    __m256d sum3 = _mm256_setzero_pd();
+
+    // r = 16*floor(n/16)
+    unsigned int r = (n >> 4) << 4;
+
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        // multiply inputs (unaligned) by coefficients (aligned) and accumulate
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(&x[i+ 0]), _mm256_load_pd(&_q->h[i+ 0]), sum0);
+        sum1 = _mm256_fmadd_pd(_mm256_loadu_pd(&x[i+ 4]), _mm256_load_pd(&_q->h[i+ 4]), sum1);
+        sum2 = _mm256_fmadd_pd(_mm256_loadu_pd(&x[i+ 8]), _mm256_load_pd(&_q->h[i+ 8]), sum2);
+        sum3 = _mm256_fmadd_pd(_mm256_loadu_pd(&x[i+12]), _mm256_load_pd(&_q->h[i+12]), sum3);
+    }
+
+    // remaining pairs of complex values
+    for ( ; i+4<=n; i+=4)
+        sum0 = _mm256_fmadd_pd(_mm256_loadu_pd(&x[i]), _mm256_load_pd(&_q->h[i]), sum0);
+
+    // fold down into single 2-element register { real, imag }
+    sum0 = _mm256_add_pd(_mm256_add_pd(sum0, sum1), _mm256_add_pd(sum2, sum3));
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(sum0),
+                             _mm256_extractf128_pd(sum0, 1));
+
+    // remaining complex value
+    if (i < n)
+        sum = _mm_add_pd(sum, _mm_mul_pd(_mm_loadu_pd(&x[i]), _mm_load_pd(&_q->h[i])));
+
+    // unload packed array
+    double w[2] __attribute__((aligned(16)));
+    _mm_store_pd(w, sum);
+
+    // set return value
+    *_y = w[0] + _Complex_I*w[1];
+}
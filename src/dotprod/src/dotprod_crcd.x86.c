@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Complex floating-point dot product with real coefficients (double
+// precision), run-time selection of SIMD kernels (x86)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmmintrin.h>  // _mm_malloc, _mm_free
+
+#include "liquid.internal.h"
+
+// basic dot product (ordinal calculation)
+void dotprod_crcd_run(double *         _h,
+                      double complex * _x,
+                      unsigned int     _n,
+                      double complex * _y)
+{
+    double complex r = 0;
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        r += _h[i] * _x[i];
+    *_y = r;
+}
+
+// basic dot product (ordinal calculation) with loop unrolled
+void dotprod_crcd_run4(double *         _h,
+                       double complex * _x,
+                       unsigned int     _n,
+                       double complex * _y)
+{
+    double complex r = 0;
+
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2; 
+
+    // compute dotprod in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        r += _h[i]   * _x[i];
+        r += _h[i+1] * _x[i+1];
+        r += _h[i+2] * _x[i+2];
+        r += _h[i+3] * _x[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        r += _h[i] * _x[i];
+
+    *_y = r;
+}
+
+
+//
+// structured dot product
+//
+
+dotprod_crcd dotprod_crcd_create(double *     _h,
+                                 unsigned int _n)
+{
+    dotprod_crcd q = (dotprod_crcd)malloc(sizeof(struct dotprod_crcd_s));
+    q->n = _n;
+
+    // allocate aligned memory for coefficients
+    q->h = (double*) _mm_malloc( 2*q->n*sizeof(double), LIQUID_SIMD_ALIGN);
+
+    // set coefficients, repeated
+    //  h = { _h[0], _h[0], _h[1], _h[1], ... _h[n-1], _h[n-1]}
+    unsigned int i;
+    for (i=0; i<q->n; i++) {
+        q->h[2*i+0] = _h[i];
+        q->h[2*i+1] = _h[i];
+    }
+
+    // resolve kernels
+    q->simd = liquid_simd_get_kernels();
+
+    // return object
+    return q;
+}
+
+// re-create the structured dotprod object
+dotprod_crcd dotprod_crcd_recreate(dotprod_crcd _q,
+                                   double *     _h,
+                                   unsigned int _n)
+{
+    // completely destroy and re-create dotprod object
+    dotprod_crcd_destroy(_q);
+    return dotprod_crcd_create(_h,_n);
+}
+
+void dotprod_crcd_destroy(dotprod_crcd _q)
+{
+    _mm_free(_q->h);
+    free(_q);
+}
+
+void dotprod_crcd_print(dotprod_crcd _q)
+{
+    printf("dotprod_crcd [%s, %u coefficients]\n", liquid_simd_str[_q->simd->type][0], _q->n);
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        printf("%3u : %16.12f\n", i, _q->h[2*i]);
+}
+
+// execute structured dot product using selected kernel
+void dotprod_crcd_execute(dotprod_crcd     _q,
+                          double complex * _x,
+                          double complex * _y)
+{
+    _q->simd->dotprod_crcd(_q, _x, _y);
+}
+
+// execute structured dot product on block of input windows using
+// selected kernel, one output at a time
+void dotprod_crcd_execute_block_stride(dotprod_crcd     _q,
+                                       double complex * _x,
+                                       unsigned int     _stride,
+                                       unsigned int     _n,
+                                       double complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        _q->simd->dotprod_crcd(_q, &_x[k*_stride], &_y[k]);
+}
+
+// execute structured dot product on block of consecutive input windows
+void dotprod_crcd_execute_block(dotprod_crcd     _q,
+                                double complex * _x,
+                                unsigned int     _n,
+                                double complex * _y)
+{
+    dotprod_crcd_execute_block_stride(_q, _x, 1, _n, _y);
+}
+
+// portable C kernel
+void dotprod_crcd_execute_portable(dotprod_crcd     _q,
+                                   double complex * _x,
+                                   double complex * _y)
+{
+    double * x = (double*) _x;
+    double yi = 0, yq = 0;
+    unsigned int i;
+    for (i=0; i<2*_q->n; i+=2) {
+        yi += _q->h[i] * x[i  ];
+        yq += _q->h[i] * x[i+1];
+    }
+    *_y = yi + _Complex_I*yq;
+}
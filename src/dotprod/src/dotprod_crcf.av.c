@@ -207,3 +207,24 @@ void dotprod_crcf_execute(dotprod_crcf    _q,
     *_r = (s.w[0] + s.w[2]) + (s.w[1] + s.w[3]) * _Complex_I;
 }
 
+// execute structured dot product on block of input windows, one output
+// at a time
+void dotprod_crcf_execute_block_stride(dotprod_crcf    _q,
+                                       float complex * _x,
+                                       unsigned int    _stride,
+                                       unsigned int    _n,
+                                       float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_crcf_execute(_q, &_x[k*_stride], &_y[k]);
+}
+
+// execute structured dot product on block of consecutive input windows
+void dotprod_crcf_execute_block(dotprod_crcf    _q,
+                                float complex * _x,
+                                unsigned int    _n,
+                                float complex * _y)
+{
+    dotprod_crcf_execute_block_stride(_q, _x, 1, _n, _y);
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// 
+// Floating-point dot product (AVX2/FMA)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <immintrin.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+#define DEBUG_DOTPROD_CRCF_AVX   0
+
+// forward declaration of internal methods
+void dotprod_crcf_execute_avx(dotprod_crcf    _q,
+                              float complex * _x,
+                              float complex * _y);
+void dotprod_crcf_execute_avxu(dotprod_crcf    _q,
+                               float complex * _x,
+                               float complex * _y);
+
+// execute structured dot product (AVX2/FMA), selecting method based on size
+void dotprod_crcf_execute_avx2(dotprod_crcf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // switch based on size
+    if (_q->n < 32) {
+        dotprod_crcf_execute_avx(_q, _x, _y);
+    } else {
+        dotprod_crcf_execute_avxu(_q, _x, _y);
+    }
+}
+
+// fold 8-element register { re, im, re, im, ... } down to complex value
+static inline float complex dotprod_crcf_avx_fold(__m256 _sum)
+{
+    // add upper and lower halves: { re, im, re, im }
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(_sum),
+                          _mm256_extractf128_ps(_sum, 1));
+
+    // add in-phase and quadrature components: { re, im, re, im }
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+    // aligned output array
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+    return w[0] + _Complex_I*w[1];
+}
+
+// fold two 8-element registers down to single 4-element register
+// { re(_s0), im(_s0), re(_s1), im(_s1) }
+static inline __m128 dotprod_crcf_avx_fold2(__m256 _s0,
+                                            __m256 _s1)
+{
+    // add upper and lower halves: { re, im, re, im }
+    __m128 a = _mm_add_ps(_mm256_castps256_ps128(_s0),
+                          _mm256_extractf128_ps(_s0, 1));
+    __m128 b = _mm_add_ps(_mm256_castps256_ps128(_s1),
+                          _mm256_extractf128_ps(_s1, 1));
+
+    // add in-phase and quadrature components of each
+    return _mm_add_ps(_mm_movelh_ps(a, b), _mm_movehl_ps(b, a));
+}
+
+// use AVX2/FMA extensions
+void dotprod_crcf_execute_avx(dotprod_crcf    _q,
+                              float complex * _x,
+                              float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256 v;   // input vector
+    __m256 h;   // coefficients vector
+    __m256 sum = _mm256_setzero_ps();  // load zeros into sum register
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (n >> 3) << 3;
+
+    //
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        // load inputs into register (unaligned)
+        v = _mm256_loadu_ps(&x[i]);
+
+        // load coefficients into register (aligned)
+        h = _mm256_load_ps(&_q->h[i]);
+
+        // compute multiply-accumulate
+        sum = _mm256_fmadd_ps(v, h, sum);
+    }
+
+    // fold down into complex value
+    float complex total = dotprod_crcf_avx_fold(sum);
+
+    // cleanup (note: n _must_ be even)
+    for (i=t/2; i<_q->n; i++)
+        total += _x[i] * _q->h[2*i];
+
+    // set return value
+    *_y = total;
+}
+
+// use AVX2/FMA extensions, unrolled loop with independent accumulators
+void dotprod_crcf_execute_avxu(dotprod_crcf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256 v0, v1, v2, v3;  // input vectors
+    __m256 h0, h1, h2, h3;  // coefficients vectors
+
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (n >> 5) << 5;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // load inputs into register (unaligned)
+        v0 = _mm256_loadu_ps(&x[i+ 0]);
+        v1 = _mm256_loadu_ps(&x[i+ 8]);
+        v2 = _mm256_loadu_ps(&x[i+16]);
+        v3 = _mm256_loadu_ps(&x[i+24]);
+
+        // load coefficients into register (aligned)
+        h0 = _mm256_load_ps(&_q->h[i+ 0]);
+        h1 = _mm256_load_ps(&_q->h[i+ 8]);
+        h2 = _mm256_load_ps(&_q->h[i+16]);
+        h3 = _mm256_load_ps(&_q->h[i+24]);
+
+        // compute multiply-accumulate on independent registers
+        sum0 = _mm256_fmadd_ps(v0, h0, sum0);
+        sum1 = _mm256_fmadd_ps(v1, h1, sum1);
+        sum2 = _mm256_fmadd_ps(v2, h2, sum2);
+        sum3 = _mm256_fmadd_ps(v3, h3, sum3);
+    }
+
+    // continue in groups of 8
+    unsigned int t = (n >> 3) << 3;
+    for ( ; i<t; i+=8) {
+        v0   = _mm256_loadu_ps(&x[i]);
+        h0   = _mm256_load_ps(&_q->h[i]);
+        sum0 = _mm256_fmadd_ps(v0, h0, sum0);
+    }
+
+    // fold down
+    sum0 = _mm256_add_ps( sum0, sum1 );
+    sum2 = _mm256_add_ps( sum2, sum3 );
+    sum0 = _mm256_add_ps( sum0, sum2 );
+
+    // fold down into complex value
+    float complex total = dotprod_crcf_avx_fold(sum0);
+
+    // cleanup (note: n _must_ be even)
+    for (i=t/2; i<_q->n; i++)
+        total += _x[i] * _q->h[2*i];
+
+    // set return value
+    *_y = total;
+}
+
+// execute structured dot product (AVX2/FMA) on block of input windows,
+// computing four outputs at a time so that each coefficient register
+// is shared by four independent accumulators
+void dotprod_crcf_execute_block_avx2(dotprod_crcf    _q,
+                                     float complex * _x,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (n >> 3) << 3;
+
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        __m256 sum0 = _mm256_setzero_ps();
+        __m256 sum1 = _mm256_setzero_ps();
+        __m256 sum2 = _mm256_setzero_ps();
+        __m256 sum3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into register (aligned)
+            __m256 h = _mm256_load_ps(&_q->h[i]);
+
+            // compute multiply-accumulate for each output
+            sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x0[i]), h, sum0);
+            sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x1[i]), h, sum1);
+            sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(&x2[i]), h, sum2);
+            sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(&x3[i]), h, sum3);
+        }
+
+        // fold down into four complex values
+        _mm_storeu_ps((float*)&_y[k+0], dotprod_crcf_avx_fold2(sum0, sum1));
+        _mm_storeu_ps((float*)&_y[k+2], dotprod_crcf_avx_fold2(sum2, sum3));
+
+        // cleanup (note: n _must_ be even)
+        for (i=t/2; i<_q->n; i++) {
+            _y[k+0] += _q->h[2*i] * _x[(k+0)*_stride + i];
+            _y[k+1] += _q->h[2*i] * _x[(k+1)*_stride + i];
+            _y[k+2] += _q->h[2*i] * _x[(k+2)*_stride + i];
+            _y[k+3] += _q->h[2*i] * _x[(k+3)*_stride + i];
+        }
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_crcf_execute_avx2(_q, &_x[k*_stride], &_y[k]);
+}
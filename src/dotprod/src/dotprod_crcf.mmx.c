@@ -42,108 +42,10 @@ void dotprod_crcf_execute_mmx4(dotprod_crcf    _q,
                                float complex * _x,
                                float complex * _y);
 
-// basic dot product (ordinal calculation)
-void dotprod_crcf_run(float *         _h,
-                      float complex * _x,
-                      unsigned int    _n,
-                      float complex * _y)
-{
-    float complex r = 0;
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        r += _h[i] * _x[i];
-    *_y = r;
-}
-
-// basic dot product (ordinal calculation) with loop unrolled
-void dotprod_crcf_run4(float *         _h,
-                       float complex * _x,
-                       unsigned int    _n,
-                       float complex * _y)
-{
-    float complex r = 0;
-
-    // t = 4*(floor(_n/4))
-    unsigned int t=(_n>>2)<<2; 
-
-    // compute dotprod in groups of 4
-    unsigned int i;
-    for (i=0; i<t; i+=4) {
-        r += _h[i]   * _x[i];
-        r += _h[i+1] * _x[i+1];
-        r += _h[i+2] * _x[i+2];
-        r += _h[i+3] * _x[i+3];
-    }
-
-    // clean up remaining
-    for ( ; i<_n; i++)
-        r += _h[i] * _x[i];
-
-    *_y = r;
-}
-
-
-//
-// structured MMX dot product
-//
-
-struct dotprod_crcf_s {
-    unsigned int n;     // length
-    float * h;          // coefficients array
-};
-
-dotprod_crcf dotprod_crcf_create(float *      _h,
-                                 unsigned int _n)
-{
-    dotprod_crcf q = (dotprod_crcf)malloc(sizeof(struct dotprod_crcf_s));
-    q->n = _n;
-
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
-
-    // set coefficients, repeated
-    //  h = { _h[0], _h[0], _h[1], _h[1], ... _h[n-1], _h[n-1]}
-    unsigned int i;
-    for (i=0; i<q->n; i++) {
-        q->h[2*i+0] = _h[i];
-        q->h[2*i+1] = _h[i];
-    }
-
-    // return object
-    return q;
-}
-
-// re-create the structured dotprod object
-dotprod_crcf dotprod_crcf_recreate(dotprod_crcf _q,
-                                   float *      _h,
-                                   unsigned int _n)
-{
-    // completely destroy and re-create dotprod object
-    dotprod_crcf_destroy(_q);
-    return dotprod_crcf_create(_h,_n);
-}
-
-
-void dotprod_crcf_destroy(dotprod_crcf _q)
-{
-    _mm_free(_q->h);
-    free(_q);
-}
-
-void dotprod_crcf_print(dotprod_crcf _q)
-{
-    // print coefficients to screen, skipping odd entries (due
-    // to repeated coefficients)
-    printf("dotprod_crcf [mmx, %u coefficients]\n", _q->n);
-    unsigned int i;
-    for (i=0; i<_q->n; i++)
-        printf("  %3u : %12.9f\n", i, _q->h[2*i]);
-}
-
-// 
-void dotprod_crcf_execute(dotprod_crcf    _q,
-                          float complex * _x,
-                          float complex * _y)
+// execute structured dot product (SSE), selecting method based on size
+void dotprod_crcf_execute_sse(dotprod_crcf    _q,
+                              float complex * _x,
+                              float complex * _y)
 {
     // switch based on size
     if (_q->n < 32) {
@@ -285,3 +187,15 @@ void dotprod_crcf_execute_mmx4(dotprod_crcf    _q,
     *_y = w[0] + w[1]*_Complex_I;
 }
 
+// execute structured dot product (SSE) on block of input windows, one
+// output at a time
+void dotprod_crcf_execute_block_sse(dotprod_crcf    _q,
+                                    float complex * _x,
+                                    unsigned int    _stride,
+                                    unsigned int    _n,
+                                    float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_crcf_execute_sse(_q, &_x[k*_stride], &_y[k]);
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Fixed-point (Q15) dot product (AVX2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX2
+
+// load 16-bit values into register (unaligned)
+#define DOTPROD_Q16_LOAD(p) _mm256_loadu_si256((__m256i*)(p))
+
+// re-order each group of four 16-bit values from { re0, im0, re1, im1 }
+// to { re0, re1, im0, im1 } so adjacent pairs share a component
+static inline __m256i dotprod_q16_avx2_deinterleave(__m256i _v)
+{
+    _v = _mm256_shufflelo_epi16(_v, _MM_SHUFFLE(3,1,2,0));
+    return _mm256_shufflehi_epi16(_v, _MM_SHUFFLE(3,1,2,0));
+}
+
+// sign-extend 32-bit products to 64 bits and accumulate; lanes of even
+// and odd index remain in even and odd 64-bit lanes, respectively
+static inline __m256i dotprod_q16_avx2_accumulate(__m256i _sum,
+                                                  __m256i _m)
+{
+    __m256i s  = _mm256_srai_epi32(_m, 31);
+    __m256i lo = _mm256_unpacklo_epi32(_m, s);
+    __m256i hi = _mm256_unpackhi_epi32(_m, s);
+    return _mm256_add_epi64(_sum, _mm256_add_epi64(lo, hi));
+}
+
+// execute fixed-point dot product (AVX2) on real input, multiplying
+// pairs of 16-bit values and accumulating into 64-bit lanes
+void dotprod_q16_execute_avx2(dotprod_q16 _q,
+                              int16_t *   _x,
+                              int16_t *   _y)
+{
+    __m256i v0, v1;
+    __m256i h0, h1;
+
+    // load zeros into sum registers
+    __m256i sum0 = _mm256_setzero_si256();
+    __m256i sum1 = _mm256_setzero_si256();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (_q->n >> 5) << 5;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // load inputs and coefficients into registers
+        v0 = DOTPROD_Q16_LOAD(&_x[i   ]);
+        v1 = DOTPROD_Q16_LOAD(&_x[i+16]);
+        h0 = DOTPROD_Q16_LOAD(&_q->h[i   ]);
+        h1 = DOTPROD_Q16_LOAD(&_q->h[i+16]);
+
+        // multiply pairs and accumulate on independent registers
+        sum0 = dotprod_q16_avx2_accumulate(sum0, _mm256_madd_epi16(v0, h0));
+        sum1 = dotprod_q16_avx2_accumulate(sum1, _mm256_madd_epi16(v1, h1));
+    }
+
+    // continue in groups of 16
+    unsigned int t = (_q->n >> 4) << 4;
+    for ( ; i<t; i+=16) {
+        v0   = DOTPROD_Q16_LOAD(&_x[i]);
+        h0   = DOTPROD_Q16_LOAD(&_q->h[i]);
+        sum0 = dotprod_q16_avx2_accumulate(sum0, _mm256_madd_epi16(v0, h0));
+    }
+    sum0 = _mm256_add_epi64(sum0, sum1);
+
+    // fold down into single value
+    int64_t w[4] __attribute__((aligned(32)));
+    _mm256_store_si256((__m256i*)w, sum0);
+    int64_t total = w[0] + w[1] + w[2] + w[3];
+
+    // cleanup
+    for ( ; i<_q->n; i++)
+        total += (int32_t)_q->h[i] * (int32_t)_x[i];
+
+    // round, shift, and saturate
+    *_y = dotprod_q16_output(total, _q->shift);
+}
+
+// execute fixed-point dot product (AVX2) on complex input of
+// interleaved I/Q pairs; in-phase and quadrature components of
+// consecutive samples are paired so that each multiply-add yields
+// partial sums for both components in alternating lanes
+void dotprod_q16_execute_cq16_avx2(dotprod_q16 _q,
+                                   int16_t *   _x,
+                                   int16_t *   _y)
+{
+    __m256i v0, v1;
+    __m256i h0, h1;
+
+    // load zeros into sum registers
+    __m256i sum0 = _mm256_setzero_si256();
+    __m256i sum1 = _mm256_setzero_si256();
+
+    // r = 16*floor(n/16) complex samples
+    unsigned int r = (_q->n >> 4) << 4;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        // load inputs and coefficients into registers
+        v0 = dotprod_q16_avx2_deinterleave(DOTPROD_Q16_LOAD(&_x[2*i   ]));
+        v1 = dotprod_q16_avx2_deinterleave(DOTPROD_Q16_LOAD(&_x[2*i+16]));
+        h0 = DOTPROD_Q16_LOAD(&_q->hc[2*i   ]);
+        h1 = DOTPROD_Q16_LOAD(&_q->hc[2*i+16]);
+
+        // multiply pairs and accumulate on independent registers
+        sum0 = dotprod_q16_avx2_accumulate(sum0, _mm256_madd_epi16(v0, h0));
+        sum1 = dotprod_q16_avx2_accumulate(sum1, _mm256_madd_epi16(v1, h1));
+    }
+
+    // continue in groups of 8 complex samples
+    unsigned int t = (_q->n >> 3) << 3;
+    for ( ; i<t; i+=8) {
+        v0   = dotprod_q16_avx2_deinterleave(DOTPROD_Q16_LOAD(&_x[2*i]));
+        h0   = DOTPROD_Q16_LOAD(&_q->hc[2*i]);
+        sum0 = dotprod_q16_avx2_accumulate(sum0, _mm256_madd_epi16(v0, h0));
+    }
+    sum0 = _mm256_add_epi64(sum0, sum1);
+
+    // fold down into in-phase and quadrature values
+    int64_t w[4] __attribute__((aligned(32)));
+    _mm256_store_si256((__m256i*)w, sum0);
+    int64_t ri = w[0] + w[2];
+    int64_t rq = w[1] + w[3];
+
+    // cleanup
+    for ( ; i<_q->n; i++) {
+        ri += (int32_t)_q->h[i] * (int32_t)_x[2*i+0];
+        rq += (int32_t)_q->h[i] * (int32_t)_x[2*i+1];
+    }
+
+    // round, shift, and saturate
+    _y[0] = dotprod_q16_output(ri, _q->shift);
+    _y[1] = dotprod_q16_output(rq, _q->shift);
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Fixed-point (Q15) dot product
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// create fixed-point dot product object
+//  _h      :   coefficients array (Q15) [size: _n x 1]
+//  _n      :   dot product length
+dotprod_q16 dotprod_q16_create(int16_t *    _h,
+                               unsigned int _n)
+{
+    // validate input
+    if (_n == 0)
+        return liquid_error_config("dotprod_q16_create(), length must be greater than zero");
+
+    dotprod_q16 q = (dotprod_q16) malloc(sizeof(struct dotprod_q16_s));
+    q->n     = _n;
+    q->shift = 15;
+
+    // allocate memory for coefficients
+    q->h  = (int16_t*) malloc(q->n*sizeof(int16_t));
+    q->hc = (int16_t*) malloc(2*(q->n+1)*sizeof(int16_t));
+
+    // set coefficients
+    memmove(q->h, _h, q->n*sizeof(int16_t));
+
+    // set coefficients for complex input in pairs (zero-padded to even length)
+    //  hc = { _h[0], _h[1], _h[0], _h[1], _h[2], _h[3], _h[2], _h[3], ... }
+    unsigned int i;
+    for (i=0; i<q->n; i+=2) {
+        int16_t h0 = _h[i];
+        int16_t h1 = i+1 < q->n ? _h[i+1] : 0;
+        q->hc[2*i+0] = h0;
+        q->hc[2*i+1] = h1;
+        q->hc[2*i+2] = h0;
+        q->hc[2*i+3] = h1;
+    }
+
+#if LIQUID_SIMD_DISPATCH
+    // resolve kernels
+    q->simd = liquid_simd_get_kernels();
+#endif
+
+    // return object
+    return q;
+}
+
+// re-create fixed-point dot product object, retaining output shift
+dotprod_q16 dotprod_q16_recreate(dotprod_q16  _q,
+                                 int16_t *    _h,
+                                 unsigned int _n)
+{
+    unsigned int shift = _q->shift;
+    dotprod_q16_destroy(_q);
+    dotprod_q16 q = dotprod_q16_create(_h, _n);
+    if (q != NULL)
+        q->shift = shift;
+    return q;
+}
+
+// destroy fixed-point dot product object
+int dotprod_q16_destroy(dotprod_q16 _q)
+{
+    free(_q->h);
+    free(_q->hc);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print fixed-point dot product object
+int dotprod_q16_print(dotprod_q16 _q)
+{
+#if LIQUID_SIMD_DISPATCH
+    const char * type = liquid_simd_str[_q->simd->type][0];
+#else
+    const char * type = "portable";
+#endif
+    printf("dotprod_q16 [%s, %u coefficients, shift=%u]\n", type, _q->n, _q->shift);
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        printf("  %3u : %6d (%12.9f)\n", i, _q->h[i], (float)_q->h[i] / 32768.0f);
+    return LIQUID_OK;
+}
+
+// set output shift (right) applied to accumulated value
+int dotprod_q16_set_shift(dotprod_q16  _q,
+                          unsigned int _shift)
+{
+    if (_shift > 31)
+        return liquid_error(LIQUID_EICONFIG,"dotprod_q16_set_shift(), shift (%u) must be less than 32", _shift);
+    _q->shift = _shift;
+    return LIQUID_OK;
+}
+
+// get output shift (right) applied to accumulated value
+unsigned int dotprod_q16_get_shift(dotprod_q16 _q)
+{
+    return _q->shift;
+}
+
+// execute dot product on real input array
+int dotprod_q16_execute(dotprod_q16 _q,
+                        int16_t *   _x,
+                        int16_t *   _y)
+{
+#if LIQUID_SIMD_DISPATCH
+    _q->simd->dotprod_q16(_q, _x, _y);
+#else
+    dotprod_q16_execute_portable(_q, _x, _y);
+#endif
+    return LIQUID_OK;
+}
+
+// execute dot product on complex input array of interleaved I/Q pairs
+int dotprod_q16_execute_cq16(dotprod_q16 _q,
+                             int16_t *   _x,
+                             int16_t *   _y)
+{
+#if LIQUID_SIMD_DISPATCH
+    _q->simd->dotprod_cq16(_q, _x, _y);
+#else
+    dotprod_q16_execute_cq16_portable(_q, _x, _y);
+#endif
+    return LIQUID_OK;
+}
+
+// round, shift, and saturate accumulated value to 16 bits
+int16_t dotprod_q16_output(int64_t      _v,
+                           unsigned int _shift)
+{
+    // round to nearest
+    if (_shift > 0)
+        _v = (_v + ((int64_t)1 << (_shift-1))) >> _shift;
+
+    // saturate
+    if      (_v >  32767) return  32767;
+    else if (_v < -32768) return -32768;
+    return (int16_t)_v;
+}
+
+// quantize coefficient to Q15, rounding and saturating; the lower limit
+// is -32767 so that pairs of products never wrap in pmaddwd-style kernels
+// and all kernels give the same result
+int16_t dotprod_q16_quantize(float _v)
+{
+    float v = roundf(_v * 32768.0f);
+    if      (v >  32767.0f) return  32767;
+    else if (v < -32767.0f) return -32767;
+    return (int16_t)v;
+}
+
+// portable C kernel (real input)
+void dotprod_q16_execute_portable(dotprod_q16 _q,
+                                  int16_t *   _x,
+                                  int16_t *   _y)
+{
+    int64_t r = 0;
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        r += (int32_t)_q->h[i] * (int32_t)_x[i];
+    *_y = dotprod_q16_output(r, _q->shift);
+}
+
+// portable C kernel (complex input, interleaved I/Q pairs)
+void dotprod_q16_execute_cq16_portable(dotprod_q16 _q,
+                                       int16_t *   _x,
+                                       int16_t *   _y)
+{
+    int64_t ri = 0;
+    int64_t rq = 0;
+    unsigned int i;
+    for (i=0; i<_q->n; i++) {
+        ri += (int32_t)_q->h[i] * (int32_t)_x[2*i+0];
+        rq += (int32_t)_q->h[i] * (int32_t)_x[2*i+1];
+    }
+    _y[0] = dotprod_q16_output(ri, _q->shift);
+    _y[1] = dotprod_q16_output(rq, _q->shift);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// 
+// Floating-point dot product, double precision (SSE2)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <emmintrin.h>  // SSE2
+
+// execute structured dot product (SSE2), two values per register with
+// independent accumulators for each group of eight
+void dotprod_rrrd_execute_sse(dotprod_rrrd _q,
+                              double *     _x,
+                              double *     _y)
+{
+    __m128d sum0 = _mm_setzero_pd();
+    __m128d sum1 = _mm_setzero_pd();
+    __m128d sum2 = _mm_setzero_pd();
+    __m128d sum3 = _mm_setzero_pd();
+
+    // r = 8*floor(n/8)
+    unsigned int r = (_q->n >> 3) << 3;
+
+    unsigned int i;
+    for (i=0; i<r; i+=8) {
+        // multiply inputs (unaligned) by coefficients (aligned) and accumulate
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_loadu_pd(&_x[i+0]), _mm_load_pd(&_q->h[i+0])));
+        sum1 = _mm_add_pd(sum1, _mm_mul_pd(_mm_loadu_pd(&_x[i+2]), _mm_load_pd(&_q->h[i+2])));
+        sum2 = _mm_add_pd(sum2, _mm_mul_pd(_mm_loadu_pd(&_x[i+4]), _mm_load_pd(&_q->h[i+4])));
+        sum3 = _mm_add_pd(sum3, _mm_mul_pd(_mm_loadu_pd(&_x[i+6]), _mm_load_pd(&_q->h[i+6])));
+    }
+
+    // remaining pairs
+    for ( ; i+2<=_q->n; i+=2)
+        sum0 = _mm_add_pd(sum0, _mm_mul_pd(_mm_loadu_pd(&_x[i]), _mm_load_pd(&_q->h[i])));
+
+    // fold down into single register
+    sum0 = _mm_add_pd(_mm_add_pd(sum0, sum1), _mm_add_pd(sum2, sum3));
+
+    // unload packed array
+    double w[2] __attribute__((aligned(16)));
+    _mm_store_pd(w, sum0);
+    double total = w[0] + w[1];
+
+    // cleanup
+    for ( ; i<_q->n; i++)
+        total += _x[i] * _q->h[i];
+
+    // set return value
+    *_y = total;
+}
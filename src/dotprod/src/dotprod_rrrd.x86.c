@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Floating-point dot product (double precision), run-time selection of
+// SIMD kernels (x86)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmmintrin.h>  // _mm_malloc, _mm_free
+
+#include "liquid.internal.h"
+
+// basic dot product (ordinal calculation)
+void dotprod_rrrd_run(double *     _h,
+                      double *     _x,
+                      unsigned int _n,
+                      double *     _y)
+{
+    double r=0;
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        r += _h[i] * _x[i];
+    *_y = r;
+}
+
+// basic dot product (ordinal calculation) with loop unrolled
+void dotprod_rrrd_run4(double *     _h,
+                       double *     _x,
+                       unsigned int _n,
+                       double *     _y)
+{
+    double r=0;
+
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2; 
+
+    // compute dotprod in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        r += _h[i]   * _x[i];
+        r += _h[i+1] * _x[i+1];
+        r += _h[i+2] * _x[i+2];
+        r += _h[i+3] * _x[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        r += _h[i] * _x[i];
+
+    *_y = r;
+}
+
+
+//
+// structured dot product
+//
+
+dotprod_rrrd dotprod_rrrd_create(double *     _h,
+                                 unsigned int _n)
+{
+    dotprod_rrrd q = (dotprod_rrrd)malloc(sizeof(struct dotprod_rrrd_s));
+    q->n = _n;
+
+    // allocate aligned memory for coefficients
+    q->h = (double*) _mm_malloc( q->n*sizeof(double), LIQUID_SIMD_ALIGN);
+
+    // set coefficients
+    memmove(q->h, _h, _n*sizeof(double));
+
+    // resolve kernels
+    q->simd = liquid_simd_get_kernels();
+
+    // return object
+    return q;
+}
+
+// re-create the structured dotprod object
+dotprod_rrrd dotprod_rrrd_recreate(dotprod_rrrd _q,
+                                   double *     _h,
+                                   unsigned int _n)
+{
+    // completely destroy and re-create dotprod object
+    dotprod_rrrd_destroy(_q);
+    return dotprod_rrrd_create(_h,_n);
+}
+
+void dotprod_rrrd_destroy(dotprod_rrrd _q)
+{
+    _mm_free(_q->h);
+    free(_q);
+}
+
+void dotprod_rrrd_print(dotprod_rrrd _q)
+{
+    printf("dotprod_rrrd [%s, %u coefficients]\n", liquid_simd_str[_q->simd->type][0], _q->n);
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        printf("%3u : %16.12f\n", i, _q->h[i]);
+}
+
+// execute structured dot product using selected kernel
+void dotprod_rrrd_execute(dotprod_rrrd _q,
+                          double *     _x,
+                          double *     _y)
+{
+    _q->simd->dotprod_rrrd(_q, _x, _y);
+}
+
+// execute structured dot product on block of input windows using
+// selected kernel, one output at a time
+void dotprod_rrrd_execute_block_stride(dotprod_rrrd _q,
+                                       double *     _x,
+                                       unsigned int _stride,
+                                       unsigned int _n,
+                                       double *     _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        _q->simd->dotprod_rrrd(_q, &_x[k*_stride], &_y[k]);
+}
+
+// execute structured dot product on block of consecutive input windows
+void dotprod_rrrd_execute_block(dotprod_rrrd _q,
+                                double *     _x,
+                                unsigned int _n,
+                                double *     _y)
+{
+    dotprod_rrrd_execute_block_stride(_q, _x, 1, _n, _y);
+}
+
+// portable C kernel
+void dotprod_rrrd_execute_portable(dotprod_rrrd _q,
+                                   double *     _x,
+                                   double *     _y)
+{
+    dotprod_rrrd_run4(_q->h, _x, _q->n, _y);
+}
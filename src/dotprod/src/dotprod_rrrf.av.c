@@ -200,3 +200,24 @@ void dotprod_rrrf_execute(dotprod_rrrf _q,
     *_r = s.w[0] + s.w[1] + s.w[2] + s.w[3];
 }
 
+// execute structured dot product on block of input windows, one output
+// at a time
+void dotprod_rrrf_execute_block_stride(dotprod_rrrf _q,
+                                       float *      _x,
+                                       unsigned int _stride,
+                                       unsigned int _n,
+                                       float *      _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_rrrf_execute(_q, &_x[k*_stride], &_y[k]);
+}
+
+// execute structured dot product on block of consecutive input windows
+void dotprod_rrrf_execute_block(dotprod_rrrf _q,
+                                float *      _x,
+                                unsigned int _n,
+                                float *      _y)
+{
+    dotprod_rrrf_execute_block_stride(_q, _x, 1, _n, _y);
+}
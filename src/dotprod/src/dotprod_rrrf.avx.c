@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Floating-point dot product (AVX2/FMA)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX/AVX2/FMA
+
+#define DEBUG_DOTPROD_RRRF_AVX   0
+
+// internal methods
+void dotprod_rrrf_execute_avx(dotprod_rrrf _q,
+                              float *      _x,
+                              float *      _y);
+void dotprod_rrrf_execute_avxu(dotprod_rrrf _q,
+                               float *      _x,
+                               float *      _y);
+
+// execute structured dot product (AVX2/FMA), selecting method based on size
+void dotprod_rrrf_execute_avx2(dotprod_rrrf _q,
+                               float *      _x,
+                               float *      _y)
+{
+    // switch based on size
+    if (_q->n < 32) {
+        dotprod_rrrf_execute_avx(_q, _x, _y);
+    } else {
+        dotprod_rrrf_execute_avxu(_q, _x, _y);
+    }
+}
+
+// fold 8-element register down to 4-element register
+static inline __m128 dotprod_rrrf_avx_fold(__m256 _sum)
+{
+    // add upper and lower halves
+    return _mm_add_ps(_mm256_castps256_ps128(_sum),
+                      _mm256_extractf128_ps(_sum, 1));
+}
+
+// fold four 8-element registers down to single 4-element register
+// { sum(_s0), sum(_s1), sum(_s2), sum(_s3) }
+static inline __m128 dotprod_rrrf_avx_fold4(__m256 _s0,
+                                            __m256 _s1,
+                                            __m256 _s2,
+                                            __m256 _s3)
+{
+    // horizontal additions within each 128-bit lane
+    __m256 s01 = _mm256_hadd_ps(_s0, _s1);
+    __m256 s23 = _mm256_hadd_ps(_s2, _s3);
+    return dotprod_rrrf_avx_fold(_mm256_hadd_ps(s01, s23));
+}
+
+// accumulate remaining group of 4 (if available) and fold down to
+// single value
+static inline float dotprod_rrrf_avx_total(dotprod_rrrf _q,
+                                           float *      _x,
+                                           unsigned int _i,
+                                           __m128       _sum)
+{
+    // input index is a multiple of 8, so coefficients remain aligned
+    if (_i + 4 <= _q->n)
+        _sum = _mm_fmadd_ps(_mm_loadu_ps(&_x[_i]), _mm_load_ps(&_q->h[_i]), _sum);
+
+    // fold remaining four elements using horizontal additions
+    _sum = _mm_hadd_ps(_sum, _sum);
+    _sum = _mm_hadd_ps(_sum, _sum);
+    float total = _mm_cvtss_f32(_sum);
+
+    // cleanup
+    unsigned int i;
+    for (i = _i + (_q->n - _i) / 4 * 4; i<_q->n; i++)
+        total += _x[i] * _q->h[i];
+
+    return total;
+}
+
+// use AVX2/FMA extensions
+void dotprod_rrrf_execute_avx(dotprod_rrrf _q,
+                              float *      _x,
+                              float *      _y)
+{
+    __m256 v;   // input vector
+    __m256 h;   // coefficients vector
+    __m256 sum = _mm256_setzero_ps(); // load zeros into sum register
+
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_q->n >> 3) << 3;
+
+    //
+    unsigned int i;
+    for (i=0; i<t; i+=8) {
+        // load inputs into register (unaligned)
+        v = _mm256_loadu_ps(&_x[i]);
+
+        // load coefficients into register (aligned)
+        h = _mm256_load_ps(&_q->h[i]);
+
+        // compute multiply-accumulate
+        sum = _mm256_fmadd_ps(v, h, sum);
+    }
+
+    // fold down into single value and clean up remaining
+    *_y = dotprod_rrrf_avx_total(_q, _x, i, dotprod_rrrf_avx_fold(sum));
+}
+
+// use AVX2/FMA extensions, unrolled loop with independent accumulators
+void dotprod_rrrf_execute_avxu(dotprod_rrrf _q,
+                               float *      _x,
+                               float *      _y)
+{
+    __m256 v0, v1, v2, v3;
+    __m256 h0, h1, h2, h3;
+
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (_q->n >> 5) << 5;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // load inputs into register (unaligned)
+        v0 = _mm256_loadu_ps(&_x[i+ 0]);
+        v1 = _mm256_loadu_ps(&_x[i+ 8]);
+        v2 = _mm256_loadu_ps(&_x[i+16]);
+        v3 = _mm256_loadu_ps(&_x[i+24]);
+
+        // load coefficients into register (aligned)
+        h0 = _mm256_load_ps(&_q->h[i+ 0]);
+        h1 = _mm256_load_ps(&_q->h[i+ 8]);
+        h2 = _mm256_load_ps(&_q->h[i+16]);
+        h3 = _mm256_load_ps(&_q->h[i+24]);
+
+        // compute multiply-accumulate on independent registers
+        sum0 = _mm256_fmadd_ps(v0, h0, sum0);
+        sum1 = _mm256_fmadd_ps(v1, h1, sum1);
+        sum2 = _mm256_fmadd_ps(v2, h2, sum2);
+        sum3 = _mm256_fmadd_ps(v3, h3, sum3);
+    }
+
+    // continue in groups of 8
+    unsigned int t = (_q->n >> 3) << 3;
+    for ( ; i<t; i+=8) {
+        v0   = _mm256_loadu_ps(&_x[i]);
+        h0   = _mm256_load_ps(&_q->h[i]);
+        sum0 = _mm256_fmadd_ps(v0, h0, sum0);
+    }
+
+    // fold down into single 8-element register
+    sum0 = _mm256_add_ps( sum0, sum1 );
+    sum2 = _mm256_add_ps( sum2, sum3 );
+    sum0 = _mm256_add_ps( sum0, sum2 );
+
+    // fold down into single value and clean up remaining
+    *_y = dotprod_rrrf_avx_total(_q, _x, i, dotprod_rrrf_avx_fold(sum0));
+}
+
+// execute structured dot product (AVX2/FMA) on block of input windows,
+// computing four outputs at a time so that each coefficient register
+// is shared by four independent accumulators
+void dotprod_rrrf_execute_block_avx2(dotprod_rrrf _q,
+                                     float *      _x,
+                                     unsigned int _stride,
+                                     unsigned int _n,
+                                     float *      _y)
+{
+    // t = 8*(floor(_n/8))
+    unsigned int t = (_q->n >> 3) << 3;
+
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        float * x0 = _x + (k+0)*_stride;
+        float * x1 = _x + (k+1)*_stride;
+        float * x2 = _x + (k+2)*_stride;
+        float * x3 = _x + (k+3)*_stride;
+
+        // load zeros into sum registers
+        __m256 sum0 = _mm256_setzero_ps();
+        __m256 sum1 = _mm256_setzero_ps();
+        __m256 sum2 = _mm256_setzero_ps();
+        __m256 sum3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into register (aligned)
+            __m256 h = _mm256_load_ps(&_q->h[i]);
+
+            // compute multiply-accumulate for each output
+            sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x0[i]), h, sum0);
+            sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x1[i]), h, sum1);
+            sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(&x2[i]), h, sum2);
+            sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(&x3[i]), h, sum3);
+        }
+
+        // fold down into four values
+        float w[4] __attribute__((aligned(16)));
+        _mm_store_ps(w, dotprod_rrrf_avx_fold4(sum0, sum1, sum2, sum3));
+
+        // cleanup
+        for ( ; i<_q->n; i++) {
+            w[0] += _q->h[i] * x0[i];
+            w[1] += _q->h[i] * x1[i];
+            w[2] += _q->h[i] * x2[i];
+            w[3] += _q->h[i] * x3[i];
+        }
+        memmove(&_y[k], w, 4*sizeof(float));
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_rrrf_execute_avx2(_q, &_x[k*_stride], &_y[k]);
+}
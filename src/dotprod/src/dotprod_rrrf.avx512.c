@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Floating-point dot product (AVX-512F)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX-512F
+
+#define DEBUG_DOTPROD_RRRF_AVX512   0
+
+// execute structured dot product (AVX-512F), unrolled loop with
+// independent accumulators; remaining elements (fewer than 16) are
+// computed with a masked load rather than a scalar cleanup loop
+void dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
+                                 float *      _x,
+                                 float *      _y)
+{
+    __m512 v0, v1, v2, v3;
+    __m512 h0, h1, h2, h3;
+
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+
+    // r = 64*floor(n/64)
+    unsigned int r = (_q->n >> 6) << 6;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=64) {
+        // load inputs into register (unaligned)
+        v0 = _mm512_loadu_ps(&_x[i+ 0]);
+        v1 = _mm512_loadu_ps(&_x[i+16]);
+        v2 = _mm512_loadu_ps(&_x[i+32]);
+        v3 = _mm512_loadu_ps(&_x[i+48]);
+
+        // load coefficients into register (aligned)
+        h0 = _mm512_load_ps(&_q->h[i+ 0]);
+        h1 = _mm512_load_ps(&_q->h[i+16]);
+        h2 = _mm512_load_ps(&_q->h[i+32]);
+        h3 = _mm512_load_ps(&_q->h[i+48]);
+
+        // compute multiply-accumulate on independent registers
+        sum0 = _mm512_fmadd_ps(v0, h0, sum0);
+        sum1 = _mm512_fmadd_ps(v1, h1, sum1);
+        sum2 = _mm512_fmadd_ps(v2, h2, sum2);
+        sum3 = _mm512_fmadd_ps(v3, h3, sum3);
+    }
+
+    // continue in groups of 16
+    unsigned int t = (_q->n >> 4) << 4;
+    for ( ; i<t; i+=16) {
+        v0   = _mm512_loadu_ps(&_x[i]);
+        h0   = _mm512_load_ps(&_q->h[i]);
+        sum1 = _mm512_fmadd_ps(v0, h0, sum1);
+    }
+
+    // remaining elements, zeroing unused lanes
+    if (i < _q->n) {
+        __mmask16 mask = (__mmask16)((1u << (_q->n - i)) - 1);
+        v0   = _mm512_maskz_loadu_ps(mask, &_x[i]);
+        h0   = _mm512_maskz_load_ps (mask, &_q->h[i]);
+        sum2 = _mm512_fmadd_ps(v0, h0, sum2);
+    }
+
+    // fold down into single register
+    sum0 = _mm512_add_ps( sum0, sum1 );
+    sum2 = _mm512_add_ps( sum2, sum3 );
+    sum0 = _mm512_add_ps( sum0, sum2 );
+
+    // fold down into single value
+    *_y = _mm512_reduce_add_ps(sum0);
+}
+
+// execute structured dot product (AVX-512F) on block of input windows,
+// computing four outputs at a time so that each coefficient register
+// is shared by four independent accumulators
+void dotprod_rrrf_execute_block_avx512(dotprod_rrrf _q,
+                                       float *      _x,
+                                       unsigned int _stride,
+                                       unsigned int _n,
+                                       float *      _y)
+{
+    // t = 16*(floor(_n/16)), and mask for remaining elements
+    unsigned int t = (_q->n >> 4) << 4;
+    __mmask16 mask = (__mmask16)((1u << (_q->n - t)) - 1);
+
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        float * x0 = _x + (k+0)*_stride;
+        float * x1 = _x + (k+1)*_stride;
+        float * x2 = _x + (k+2)*_stride;
+        float * x3 = _x + (k+3)*_stride;
+
+        // load zeros into sum registers
+        __m512 sum0 = _mm512_setzero_ps();
+        __m512 sum1 = _mm512_setzero_ps();
+        __m512 sum2 = _mm512_setzero_ps();
+        __m512 sum3 = _mm512_setzero_ps();
+
+        __m512 h;
+        for (i=0; i<t; i+=16) {
+            // load coefficients into register (aligned)
+            h = _mm512_load_ps(&_q->h[i]);
+
+            // compute multiply-accumulate for each output
+            sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x0[i]), h, sum0);
+            sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x1[i]), h, sum1);
+            sum2 = _mm512_fmadd_ps(_mm512_loadu_ps(&x2[i]), h, sum2);
+            sum3 = _mm512_fmadd_ps(_mm512_loadu_ps(&x3[i]), h, sum3);
+        }
+
+        // remaining elements, zeroing unused lanes
+        if (mask) {
+            h = _mm512_maskz_load_ps(mask, &_q->h[i]);
+            sum0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &x0[i]), h, sum0);
+            sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &x1[i]), h, sum1);
+            sum2 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &x2[i]), h, sum2);
+            sum3 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, &x3[i]), h, sum3);
+        }
+
+        // fold down into single values
+        _y[k+0] = _mm512_reduce_add_ps(sum0);
+        _y[k+1] = _mm512_reduce_add_ps(sum1);
+        _y[k+2] = _mm512_reduce_add_ps(sum2);
+        _y[k+3] = _mm512_reduce_add_ps(sum3);
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_rrrf_execute_avx512(_q, &_x[k*_stride], &_y[k]);
+}
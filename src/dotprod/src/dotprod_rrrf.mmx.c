@@ -60,101 +60,10 @@ void dotprod_rrrf_execute_mmx4(dotprod_rrrf _q,
                                float *      _x,
                                float *      _y);
 
-// basic dot product (ordinal calculation)
-void dotprod_rrrf_run(float *      _h,
-                      float *      _x,
-                      unsigned int _n,
-                      float *      _y)
-{
-    float r=0;
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        r += _h[i] * _x[i];
-    *_y = r;
-}
-
-// basic dot product (ordinal calculation) with loop unrolled
-void dotprod_rrrf_run4(float *      _h,
-                       float *      _x,
-                       unsigned int _n,
-                       float *      _y)
-{
-    float r=0;
-
-    // t = 4*(floor(_n/4))
-    unsigned int t=(_n>>2)<<2; 
-
-    // compute dotprod in groups of 4
-    unsigned int i;
-    for (i=0; i<t; i+=4) {
-        r += _h[i]   * _x[i];
-        r += _h[i+1] * _x[i+1];
-        r += _h[i+2] * _x[i+2];
-        r += _h[i+3] * _x[i+3];
-    }
-
-    // clean up remaining
-    for ( ; i<_n; i++)
-        r += _h[i] * _x[i];
-
-    *_y = r;
-}
-
-
-//
-// structured MMX dot product
-//
-
-struct dotprod_rrrf_s {
-    unsigned int n;     // length
-    float * h;          // coefficients array
-};
-
-dotprod_rrrf dotprod_rrrf_create(float *      _h,
-                                 unsigned int _n)
-{
-    dotprod_rrrf q = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
-    q->n = _n;
-
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( q->n*sizeof(float), 16);
-
-    // set coefficients
-    memmove(q->h, _h, _n*sizeof(float));
-
-    // return object
-    return q;
-}
-
-// re-create the structured dotprod object
-dotprod_rrrf dotprod_rrrf_recreate(dotprod_rrrf _q,
-                                   float * _h,
-                                   unsigned int _n)
-{
-    // completely destroy and re-create dotprod object
-    dotprod_rrrf_destroy(_q);
-    return dotprod_rrrf_create(_h,_n);
-}
-
-
-void dotprod_rrrf_destroy(dotprod_rrrf _q)
-{
-    _mm_free(_q->h);
-    free(_q);
-}
-
-void dotprod_rrrf_print(dotprod_rrrf _q)
-{
-    printf("dotprod_rrrf [mmx, %u coefficients]\n", _q->n);
-    unsigned int i;
-    for (i=0; i<_q->n; i++)
-        printf("%3u : %12.9f\n", i, _q->h[i]);
-}
-
-// 
-void dotprod_rrrf_execute(dotprod_rrrf _q,
-                          float *      _x,
-                          float *      _y)
+// execute structured dot product (SSE), selecting method based on size
+void dotprod_rrrf_execute_sse(dotprod_rrrf _q,
+                              float *      _x,
+                              float *      _y)
 {
     // switch based on size
     if (_q->n < 16) {
@@ -299,3 +208,15 @@ void dotprod_rrrf_execute_mmx4(dotprod_rrrf _q,
     *_y = total;
 }
 
+// execute structured dot product (SSE) on block of input windows, one
+// output at a time
+void dotprod_rrrf_execute_block_sse(dotprod_rrrf _q,
+                                    float *      _x,
+                                    unsigned int _stride,
+                                    unsigned int _n,
+                                    float *      _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_rrrf_execute_sse(_q, &_x[k*_stride], &_y[k]);
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Floating-point dot product, run-time selection of SIMD kernels (x86)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <xmmintrin.h>  // _mm_malloc, _mm_free
+
+#include "liquid.internal.h"
+
+// basic dot product (ordinal calculation)
+void dotprod_rrrf_run(float *      _h,
+                      float *      _x,
+                      unsigned int _n,
+                      float *      _y)
+{
+    float r=0;
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        r += _h[i] * _x[i];
+    *_y = r;
+}
+
+// basic dot product (ordinal calculation) with loop unrolled
+void dotprod_rrrf_run4(float *      _h,
+                       float *      _x,
+                       unsigned int _n,
+                       float *      _y)
+{
+    float r=0;
+
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2; 
+
+    // compute dotprod in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        r += _h[i]   * _x[i];
+        r += _h[i+1] * _x[i+1];
+        r += _h[i+2] * _x[i+2];
+        r += _h[i+3] * _x[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        r += _h[i] * _x[i];
+
+    *_y = r;
+}
+
+
+//
+// structured dot product
+//
+
+dotprod_rrrf dotprod_rrrf_create(float *      _h,
+                                 unsigned int _n)
+{
+    dotprod_rrrf q = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
+    q->n = _n;
+
+    // allocate aligned memory for coefficients
+    q->h = (float*) _mm_malloc( q->n*sizeof(float), LIQUID_SIMD_ALIGN);
+
+    // set coefficients
+    memmove(q->h, _h, _n*sizeof(float));
+
+    // resolve kernels
+    q->simd = liquid_simd_get_kernels();
+
+    // return object
+    return q;
+}
+
+// re-create the structured dotprod object
+dotprod_rrrf dotprod_rrrf_recreate(dotprod_rrrf _q,
+                                   float *      _h,
+                                   unsigned int _n)
+{
+    // completely destroy and re-create dotprod object
+    dotprod_rrrf_destroy(_q);
+    return dotprod_rrrf_create(_h,_n);
+}
+
+void dotprod_rrrf_destroy(dotprod_rrrf _q)
+{
+    _mm_free(_q->h);
+    free(_q);
+}
+
+void dotprod_rrrf_print(dotprod_rrrf _q)
+{
+    printf("dotprod_rrrf [%s, %u coefficients]\n", liquid_simd_str[_q->simd->type][0], _q->n);
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        printf("%3u : %12.9f\n", i, _q->h[i]);
+}
+
+// execute structured dot product using selected kernel
+void dotprod_rrrf_execute(dotprod_rrrf _q,
+                          float *      _x,
+                          float *      _y)
+{
+    _q->simd->dotprod_rrrf(_q, _x, _y);
+}
+
+// execute structured dot product on block of input windows using
+// selected kernel
+void dotprod_rrrf_execute_block_stride(dotprod_rrrf _q,
+                                       float *      _x,
+                                       unsigned int _stride,
+                                       unsigned int _n,
+                                       float *      _y)
+{
+    _q->simd->dotprod_rrrf_block(_q, _x, _stride, _n, _y);
+}
+
+// execute structured dot product on block of consecutive input windows
+void dotprod_rrrf_execute_block(dotprod_rrrf _q,
+                                float *      _x,
+                                unsigned int _n,
+                                float *      _y)
+{
+    _q->simd->dotprod_rrrf_block(_q, _x, 1, _n, _y);
+}
+
+// portable C kernel
+void dotprod_rrrf_execute_portable(dotprod_rrrf _q,
+                                   float *      _x,
+                                   float *      _y)
+{
+    dotprod_rrrf_run4(_q->h, _x, _q->n, _y);
+}
+
+// portable C kernel, computing four outputs at a time so that each
+// coefficient is loaded once for several input windows
+void dotprod_rrrf_execute_block_portable(dotprod_rrrf _q,
+                                         float *      _x,
+                                         unsigned int _stride,
+                                         unsigned int _n,
+                                         float *      _y)
+{
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        float * x0 = _x + (k+0)*_stride;
+        float * x1 = _x + (k+1)*_stride;
+        float * x2 = _x + (k+2)*_stride;
+        float * x3 = _x + (k+3)*_stride;
+        float y0 = 0, y1 = 0, y2 = 0, y3 = 0;
+        for (i=0; i<_q->n; i++) {
+            float h = _q->h[i];
+            y0 += h * x0[i];
+            y1 += h * x1[i];
+            y2 += h * x2[i];
+            y3 += h * x3[i];
+        }
+        _y[k+0] = y0;
+        _y[k+1] = y1;
+        _y[k+2] = y2;
+        _y[k+3] = y3;
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_rrrf_execute_portable(_q, &_x[k*_stride], &_y[k]);
+}
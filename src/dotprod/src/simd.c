@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// SIMD processor extensions, run-time selection
+//
+// On x86 platforms all kernels are compiled into the library, each with
+// its own architecture flags, and the best set supported by the host
+// (as reported by cpuid) is resolved once, either when the library is
+// loaded or on first use. Other platforms select their kernels when the
+// library is configured and only report that selection here.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+const char * liquid_simd_str[LIQUID_SIMD_NUM_TYPES][2] = {
+    // short name,  long name
+    {"auto",        "automatic (best available)"},
+    {"portable",    "portable C"                },
+    {"sse",         "x86 SSE2/SSE3"             },
+    {"avx2",        "x86 AVX2/FMA"              },
+    {"avx512",      "x86 AVX-512F"              },
+    {"neon",        "ARM Neon"                  },
+    {"altivec",     "PowerPC AltiVec"           },
+};
+
+// returns SIMD type based on input string
+liquid_simd_type liquid_getopt_str2simd(const char * _str)
+{
+    // compare each string to short name
+    unsigned int i;
+    for (i=0; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (strcmp(_str,liquid_simd_str[i][0])==0) {
+            return i;
+        }
+    }
+
+    fprintf(stderr,"warning: liquid_getopt_str2simd(), unknown/unsupported SIMD type : %s\n", _str);
+    return LIQUID_SIMD_AUTO;
+}
+
+// Print compact list of SIMD types and their availability on this host
+int liquid_print_simd_types()
+{
+    unsigned int i;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        printf("  %-10s %-28s %s%s\n",
+                liquid_simd_str[i][0],
+                liquid_simd_str[i][1],
+                liquid_simd_is_available(i) ? "available" : "-",
+                liquid_simd_get_type() == i ? " (selected)" : "");
+    }
+    return LIQUID_OK;
+}
+
+#if LIQUID_SIMD_DISPATCH
+
+// kernel tables
+static const struct liquid_simd_kernels_s liquid_simd_kernels_portable = {
+    .type               = LIQUID_SIMD_PORTABLE,
+    .dotprod_rrrf       = dotprod_rrrf_execute_portable,
+    .dotprod_crcf       = dotprod_crcf_execute_portable,
+    .dotprod_cccf       = dotprod_cccf_execute_portable,
+    .dotprod_rrrf_block = dotprod_rrrf_execute_block_portable,
+    .dotprod_crcf_block = dotprod_crcf_execute_block_portable,
+    .dotprod_cccf_block = dotprod_cccf_execute_block_portable,
+    .dotprod_rrrd       = dotprod_rrrd_execute_portable,
+    .dotprod_crcd       = dotprod_crcd_execute_portable,
+    .dotprod_cccd       = dotprod_cccd_execute_portable,
+    .dotprod_q16        = dotprod_q16_execute_portable,
+    .dotprod_cq16       = dotprod_q16_execute_cq16_portable,
+    .sumsqf             = liquid_sumsqf_portable,
+    .sumsqcf            = liquid_sumsqcf_portable,
+    .vectorf_add        = liquid_vectorf_add_portable,
+    .vectorcf_add       = liquid_vectorcf_add_portable,
+    .vectorf_addscalar  = liquid_vectorf_addscalar_portable,
+    .vectorcf_addscalar = liquid_vectorcf_addscalar_portable,
+    .vectorf_mul        = liquid_vectorf_mul_portable,
+    .vectorcf_mul       = liquid_vectorcf_mul_portable,
+    .vectorf_mulscalar  = liquid_vectorf_mulscalar_portable,
+    .vectorcf_mulscalar = liquid_vectorcf_mulscalar_portable,
+    .vectorf_abs        = liquid_vectorf_abs_portable,
+    .vectorcf_abs       = liquid_vectorcf_abs_portable,
+    .vectorcf_cexpj     = liquid_vectorcf_cexpj_portable,
+    .vectorcf_carg      = liquid_vectorcf_carg_portable,
+    .vectorf_sincos     = liquid_vectorf_sincos_portable,
+    .vectorf_atan2      = liquid_vectorf_atan2_portable,
+    .vectorf_log10      = liquid_vectorf_log10_portable,
+    .vectorf_exp        = liquid_vectorf_exp_portable,
+    .fftf_radix4        = liquid_fftf_radix4_execute_portable,
+    .fftf_real_split    = liquid_fftf_real_split_portable,
+    .fftf_real_merge    = liquid_fftf_real_merge_portable,
+};
+
+static const struct liquid_simd_kernels_s liquid_simd_kernels_sse = {
+    .type               = LIQUID_SIMD_SSE,
+    .dotprod_rrrf       = dotprod_rrrf_execute_sse,
+    .dotprod_crcf       = dotprod_crcf_execute_sse,
+    .dotprod_cccf       = dotprod_cccf_execute_sse,
+    .dotprod_rrrf_block = dotprod_rrrf_execute_block_sse,
+    .dotprod_crcf_block = dotprod_crcf_execute_block_sse,
+    .dotprod_cccf_block = dotprod_cccf_execute_block_sse,
+    .dotprod_rrrd       = dotprod_rrrd_execute_sse,
+    .dotprod_crcd       = dotprod_crcd_execute_sse,
+    .dotprod_cccd       = dotprod_cccd_execute_sse,
+    .dotprod_q16        = dotprod_q16_execute_sse,
+    .dotprod_cq16       = dotprod_q16_execute_cq16_sse,
+    .sumsqf             = liquid_sumsqf_sse,
+    .sumsqcf            = liquid_sumsqcf_sse,
+    .vectorf_add        = liquid_vectorf_add_sse,
+    .vectorcf_add       = liquid_vectorcf_add_sse,
+    .vectorf_addscalar  = liquid_vectorf_addscalar_sse,
+    .vectorcf_addscalar = liquid_vectorcf_addscalar_sse,
+    .vectorf_mul        = liquid_vectorf_mul_sse,
+    .vectorcf_mul       = liquid_vectorcf_mul_sse,
+    .vectorf_mulscalar  = liquid_vectorf_mulscalar_sse,
+    .vectorcf_mulscalar = liquid_vectorcf_mulscalar_sse,
+    .vectorf_abs        = liquid_vectorf_abs_sse,
+    .vectorcf_abs       = liquid_vectorcf_abs_sse,
+    .vectorcf_cexpj     = liquid_vectorcf_cexpj_sse,
+    .vectorcf_carg      = liquid_vectorcf_carg_sse,
+    .vectorf_sincos     = liquid_vectorf_sincos_sse,
+    .vectorf_atan2      = liquid_vectorf_atan2_sse,
+    .vectorf_log10      = liquid_vectorf_log10_sse,
+    .vectorf_exp        = liquid_vectorf_exp_sse,
+    .fftf_radix4        = liquid_fftf_radix4_execute_sse,
+    .fftf_real_split    = liquid_fftf_real_split_sse,
+    .fftf_real_merge    = liquid_fftf_real_merge_sse,
+};
+
+#if LIQUID_SIMD_DISPATCH_AVX2
+static const struct liquid_simd_kernels_s liquid_simd_kernels_avx2 = {
+    .type               = LIQUID_SIMD_AVX2,
+    .dotprod_rrrf       = dotprod_rrrf_execute_avx2,
+    .dotprod_crcf       = dotprod_crcf_execute_avx2,
+    .dotprod_cccf       = dotprod_cccf_execute_avx2,
+    .dotprod_rrrf_block = dotprod_rrrf_execute_block_avx2,
+    .dotprod_crcf_block = dotprod_crcf_execute_block_avx2,
+    .dotprod_cccf_block = dotprod_cccf_execute_block_avx2,
+    .dotprod_rrrd       = dotprod_rrrd_execute_avx2,
+    .dotprod_crcd       = dotprod_crcd_execute_avx2,
+    .dotprod_cccd       = dotprod_cccd_execute_avx2,
+    .dotprod_q16        = dotprod_q16_execute_avx2,
+    .dotprod_cq16       = dotprod_q16_execute_cq16_avx2,
+    .sumsqf             = liquid_sumsqf_avx2,
+    .sumsqcf            = liquid_sumsqcf_avx2,
+    .vectorf_add        = liquid_vectorf_add_avx2,
+    .vectorcf_add       = liquid_vectorcf_add_avx2,
+    .vectorf_addscalar  = liquid_vectorf_addscalar_avx2,
+    .vectorcf_addscalar = liquid_vectorcf_addscalar_avx2,
+    .vectorf_mul        = liquid_vectorf_mul_avx2,
+    .vectorcf_mul       = liquid_vectorcf_mul_avx2,
+    .vectorf_mulscalar  = liquid_vectorf_mulscalar_avx2,
+    .vectorcf_mulscalar = liquid_vectorcf_mulscalar_avx2,
+    .vectorf_abs        = liquid_vectorf_abs_avx2,
+    .vectorcf_abs       = liquid_vectorcf_abs_avx2,
+    .vectorcf_cexpj     = liquid_vectorcf_cexpj_avx2,
+    .vectorcf_carg      = liquid_vectorcf_carg_avx2,
+    .vectorf_sincos     = liquid_vectorf_sincos_avx2,
+    .vectorf_atan2      = liquid_vectorf_atan2_avx2,
+    .vectorf_log10      = liquid_vectorf_log10_avx2,
+    .vectorf_exp        = liquid_vectorf_exp_avx2,
+    .fftf_radix4        = liquid_fftf_radix4_execute_avx2,
+
+    // real-input split/merge stages are memory bound; use 128-bit kernels
+    .fftf_real_split    = liquid_fftf_real_split_sse,
+    .fftf_real_merge    = liquid_fftf_real_merge_sse,
+};
+#endif
+
+#if LIQUID_SIMD_DISPATCH_AVX512
+static const struct liquid_simd_kernels_s liquid_simd_kernels_avx512 = {
+    .type               = LIQUID_SIMD_AVX512,
+    .dotprod_rrrf       = dotprod_rrrf_execute_avx512,
+    .dotprod_crcf       = dotprod_crcf_execute_avx512,
+    .dotprod_cccf       = dotprod_cccf_execute_avx512,
+    .dotprod_rrrf_block = dotprod_rrrf_execute_block_avx512,
+    .dotprod_crcf_block = dotprod_crcf_execute_block_avx512,
+    .dotprod_cccf_block = dotprod_cccf_execute_block_avx512,
+    // double-precision dot products use 256-bit kernels
+#if LIQUID_SIMD_DISPATCH_AVX2
+    .dotprod_rrrd       = dotprod_rrrd_execute_avx2,
+    .dotprod_crcd       = dotprod_crcd_execute_avx2,
+    .dotprod_cccd       = dotprod_cccd_execute_avx2,
+#else
+    .dotprod_rrrd       = dotprod_rrrd_execute_sse,
+    .dotprod_crcd       = dotprod_crcd_execute_sse,
+    .dotprod_cccd       = dotprod_cccd_execute_sse,
+#endif
+    // 16-bit multiply-add on 512-bit registers requires AVX-512BW
+#if LIQUID_SIMD_DISPATCH_AVX2
+    .dotprod_q16        = dotprod_q16_execute_avx2,
+    .dotprod_cq16       = dotprod_q16_execute_cq16_avx2,
+#else
+    .dotprod_q16        = dotprod_q16_execute_sse,
+    .dotprod_cq16       = dotprod_q16_execute_cq16_sse,
+#endif
+    .sumsqf             = liquid_sumsqf_avx512,
+    .sumsqcf            = liquid_sumsqcf_avx512,
+
+    // element-wise operations are memory bound; use 256-bit kernels
+#if LIQUID_SIMD_DISPATCH_AVX2
+    .vectorf_add        = liquid_vectorf_add_avx2,
+    .vectorcf_add       = liquid_vectorcf_add_avx2,
+    .vectorf_addscalar  = liquid_vectorf_addscalar_avx2,
+    .vectorcf_addscalar = liquid_vectorcf_addscalar_avx2,
+    .vectorf_mul        = liquid_vectorf_mul_avx2,
+    .vectorcf_mul       = liquid_vectorcf_mul_avx2,
+    .vectorf_mulscalar  = liquid_vectorf_mulscalar_avx2,
+    .vectorcf_mulscalar = liquid_vectorcf_mulscalar_avx2,
+    .vectorf_abs        = liquid_vectorf_abs_avx2,
+    .vectorcf_abs       = liquid_vectorcf_abs_avx2,
+    .vectorcf_cexpj     = liquid_vectorcf_cexpj_avx2,
+    .vectorcf_carg      = liquid_vectorcf_carg_avx2,
+    .vectorf_sincos     = liquid_vectorf_sincos_avx2,
+    .vectorf_atan2      = liquid_vectorf_atan2_avx2,
+    .vectorf_log10      = liquid_vectorf_log10_avx2,
+    .vectorf_exp        = liquid_vectorf_exp_avx2,
+    .fftf_radix4        = liquid_fftf_radix4_execute_avx2,
+#else
+    .vectorf_add        = liquid_vectorf_add_sse,
+    .vectorcf_add       = liquid_vectorcf_add_sse,
+    .vectorf_addscalar  = liquid_vectorf_addscalar_sse,
+    .vectorcf_addscalar = liquid_vectorcf_addscalar_sse,
+    .vectorf_mul        = liquid_vectorf_mul_sse,
+    .vectorcf_mul       = liquid_vectorcf_mul_sse,
+    .vectorf_mulscalar  = liquid_vectorf_mulscalar_sse,
+    .vectorcf_mulscalar = liquid_vectorcf_mulscalar_sse,
+    .vectorf_abs        = liquid_vectorf_abs_sse,
+    .vectorcf_abs       = liquid_vectorcf_abs_sse,
+    .vectorcf_cexpj     = liquid_vectorcf_cexpj_sse,
+    .vectorcf_carg      = liquid_vectorcf_carg_sse,
+    .vectorf_sincos     = liquid_vectorf_sincos_sse,
+    .vectorf_atan2      = liquid_vectorf_atan2_sse,
+    .vectorf_log10      = liquid_vectorf_log10_sse,
+    .vectorf_exp        = liquid_vectorf_exp_sse,
+    .fftf_radix4        = liquid_fftf_radix4_execute_sse,
+#endif
+    .fftf_real_split    = liquid_fftf_real_split_sse,
+    .fftf_real_merge    = liquid_fftf_real_merge_sse,
+};
+#endif
+
+// currently selected kernels (NULL until resolved)
+static const struct liquid_simd_kernels_s * liquid_simd_kernels = NULL;
+
+// get kernel table for a particular type, NULL if not compiled into
+// the library or not supported by the host processor
+static const struct liquid_simd_kernels_s * liquid_simd_lookup(liquid_simd_type _type)
+{
+#if defined(__GNUC__)
+    __builtin_cpu_init();
+#endif
+    switch (_type) {
+    case LIQUID_SIMD_PORTABLE:
+        return &liquid_simd_kernels_portable;
+#if defined(__GNUC__)
+    case LIQUID_SIMD_SSE:
+        return __builtin_cpu_supports("sse3") ? &liquid_simd_kernels_sse : NULL;
+#  if LIQUID_SIMD_DISPATCH_AVX2
+    case LIQUID_SIMD_AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ?
+            &liquid_simd_kernels_avx2 : NULL;
+#  endif
+#  if LIQUID_SIMD_DISPATCH_AVX512
+    case LIQUID_SIMD_AVX512:
+        return __builtin_cpu_supports("avx512f") ? &liquid_simd_kernels_avx512 : NULL;
+#  endif
+#endif
+    default:;
+    }
+    return NULL;
+}
+
+// resolve best available kernels, starting with the widest extensions
+static const struct liquid_simd_kernels_s * liquid_simd_resolve()
+{
+    const struct liquid_simd_kernels_s * k = liquid_simd_lookup(LIQUID_SIMD_AVX512);
+    if (k == NULL) k = liquid_simd_lookup(LIQUID_SIMD_AVX2);
+    if (k == NULL) k = liquid_simd_lookup(LIQUID_SIMD_SSE);
+    if (k == NULL) k = liquid_simd_lookup(LIQUID_SIMD_PORTABLE);
+    return k;
+}
+
+// resolve kernels when library is loaded, honoring LIQUID_SIMD environment
+// variable if set
+#if defined(__GNUC__)
+__attribute__((constructor))
+#endif
+static void liquid_simd_init()
+{
+    if (liquid_simd_kernels != NULL)
+        return;
+
+    const char * env = getenv("LIQUID_SIMD");
+    liquid_simd_type type = (env == NULL) ? LIQUID_SIMD_AUTO : liquid_getopt_str2simd(env);
+    if (type != LIQUID_SIMD_AUTO && liquid_simd_lookup(type) == NULL) {
+        liquid_error(LIQUID_EUMODE,"liquid_simd_init(), SIMD type '%s' requested by LIQUID_SIMD is not available",
+                liquid_simd_str[type][0]);
+        type = LIQUID_SIMD_AUTO;
+    }
+
+    liquid_simd_kernels = type == LIQUID_SIMD_AUTO ? liquid_simd_resolve() : liquid_simd_lookup(type);
+}
+
+// get kernels currently selected, resolving on first call
+const struct liquid_simd_kernels_s * liquid_simd_get_kernels(void)
+{
+    if (liquid_simd_kernels == NULL)
+        liquid_simd_init();
+    return liquid_simd_kernels;
+}
+
+int liquid_simd_is_available(liquid_simd_type _type)
+{
+    if (_type == LIQUID_SIMD_AUTO)
+        return 1;
+    return liquid_simd_lookup(_type) != NULL;
+}
+
+liquid_simd_type liquid_simd_get_type(void)
+{
+    return liquid_simd_get_kernels()->type;
+}
+
+int liquid_simd_set_type(liquid_simd_type _type)
+{
+    if (_type >= LIQUID_SIMD_NUM_TYPES)
+        return liquid_error(LIQUID_EIMODE,"liquid_simd_set_type(), invalid type (%u)", _type);
+
+    const struct liquid_simd_kernels_s * k = _type == LIQUID_SIMD_AUTO ?
+        liquid_simd_resolve() : liquid_simd_lookup(_type);
+    if (k == NULL)
+        return liquid_error(LIQUID_EUMODE,"liquid_simd_set_type(), '%s' is not available", liquid_simd_str[_type][0]);
+
+    liquid_simd_kernels = k;
+    return LIQUID_OK;
+}
+
+#else // LIQUID_SIMD_DISPATCH
+
+// kernels are selected when the library is configured
+#if LIQUID_SIMDOVERRIDE
+#  define LIQUID_SIMD_BUILTIN LIQUID_SIMD_PORTABLE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  define LIQUID_SIMD_BUILTIN LIQUID_SIMD_NEON
+#elif defined(__ALTIVEC__)
+#  define LIQUID_SIMD_BUILTIN LIQUID_SIMD_ALTIVEC
+#else
+#  define LIQUID_SIMD_BUILTIN LIQUID_SIMD_PORTABLE
+#endif
+
+int liquid_simd_is_available(liquid_simd_type _type)
+{
+    return _type == LIQUID_SIMD_AUTO || _type == LIQUID_SIMD_BUILTIN;
+}
+
+liquid_simd_type liquid_simd_get_type(void)
+{
+    return LIQUID_SIMD_BUILTIN;
+}
+
+int liquid_simd_set_type(liquid_simd_type _type)
+{
+    if (_type >= LIQUID_SIMD_NUM_TYPES)
+        return liquid_error(LIQUID_EIMODE,"liquid_simd_set_type(), invalid type (%u)", _type);
+
+    if (!liquid_simd_is_available(_type))
+        return liquid_error(LIQUID_EUMODE,"liquid_simd_set_type(), '%s' is not available", liquid_simd_str[_type][0]);
+
+    return LIQUID_OK;
+}
+
+#endif // LIQUID_SIMD_DISPATCH
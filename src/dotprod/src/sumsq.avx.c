@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// sumsq.avx.c : floating-point sum of squares (AVX2/FMA)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX/AVX2/FMA
+
+// sum squares, unrolled loop with independent accumulators
+//  _v      :   input array [size: 1 x _n]
+//  _n      :   input length
+float liquid_sumsqf_avx2(float *      _v,
+                         unsigned int _n)
+{
+    __m256 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+
+    // r = 16*floor(n/16)
+    unsigned int r = (_n >> 4) << 4;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        // load inputs into register (unaligned)
+        v0 = _mm256_loadu_ps(&_v[i+0]);
+        v1 = _mm256_loadu_ps(&_v[i+8]);
+
+        // compute multiply-accumulate on independent registers
+        sum0 = _mm256_fmadd_ps(v0, v0, sum0);
+        sum1 = _mm256_fmadd_ps(v1, v1, sum1);
+    }
+
+    // continue in groups of 8
+    unsigned int t = (_n >> 3) << 3;
+    for ( ; i<t; i+=8) {
+        v0   = _mm256_loadu_ps(&_v[i]);
+        sum0 = _mm256_fmadd_ps(v0, v0, sum0);
+    }
+
+    // fold down into single 4-element register
+    sum0 = _mm256_add_ps(sum0, sum1);
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum0),
+                          _mm256_extractf128_ps(sum0, 1));
+
+    // fold down into single value
+    s = _mm_hadd_ps(s, s);
+    s = _mm_hadd_ps(s, s);
+    float total = _mm_cvtss_f32(s);
+
+    // cleanup
+    for (; i<_n; i++)
+        total += _v[i] * _v[i];
+
+    // set return value
+    return total;
+}
+
+// sum squares, basic loop
+//  _v      :   input array [size: 1 x _n]
+//  _n      :   input length
+float liquid_sumsqcf_avx2(float complex * _v,
+                          unsigned int    _n)
+{
+    // simple method: type cast input as real pointer, run double
+    // length sumsqf method
+    float * v = (float*) _v;
+    return liquid_sumsqf_avx2(v, 2*_n);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// sumsq.avx512.c : floating-point sum of squares (AVX-512F)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX-512F
+
+// sum squares, unrolled loop with independent accumulators and masked
+// load for remaining elements
+//  _v      :   input array [size: 1 x _n]
+//  _n      :   input length
+float liquid_sumsqf_avx512(float *      _v,
+                           unsigned int _n)
+{
+    __m512 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (_n >> 5) << 5;
+
+    //
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // load inputs into register (unaligned)
+        v0 = _mm512_loadu_ps(&_v[i+ 0]);
+        v1 = _mm512_loadu_ps(&_v[i+16]);
+
+        // compute multiply-accumulate on independent registers
+        sum0 = _mm512_fmadd_ps(v0, v0, sum0);
+        sum1 = _mm512_fmadd_ps(v1, v1, sum1);
+    }
+
+    // continue in groups of 16
+    unsigned int t = (_n >> 4) << 4;
+    for ( ; i<t; i+=16) {
+        v0   = _mm512_loadu_ps(&_v[i]);
+        sum0 = _mm512_fmadd_ps(v0, v0, sum0);
+    }
+
+    // remaining elements, zeroing unused lanes
+    if (i < _n) {
+        __mmask16 mask = (__mmask16)((1u << (_n - i)) - 1);
+        v1   = _mm512_maskz_loadu_ps(mask, &_v[i]);
+        sum1 = _mm512_fmadd_ps(v1, v1, sum1);
+    }
+
+    // fold down into single value
+    return _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+}
+
+// sum squares, basic loop
+//  _v      :   input array [size: 1 x _n]
+//  _n      :   input length
+float liquid_sumsqcf_avx512(float complex * _v,
+                            unsigned int    _n)
+{
+    // simple method: type cast input as real pointer, run double
+    // length sumsqf method
+    float * v = (float*) _v;
+    return liquid_sumsqf_avx512(v, 2*_n);
+}
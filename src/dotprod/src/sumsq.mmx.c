@@ -52,8 +52,8 @@
 // sum squares, basic loop
 //  _v      :   input array [size: 1 x _n]
 //  _n      :   input length
-float liquid_sumsqf(float *      _v,
-                    unsigned int _n)
+float liquid_sumsqf_sse(float *      _v,
+                        unsigned int _n)
 {
     // first cut: ...
     __m128 v;   // input vector
@@ -105,11 +105,11 @@ float liquid_sumsqf(float *      _v,
 // sum squares, basic loop
 //  _v      :   input array [size: 1 x _n]
 //  _n      :   input length
-float liquid_sumsqcf(float complex * _v,
-                     unsigned int    _n)
+float liquid_sumsqcf_sse(float complex * _v,
+                         unsigned int    _n)
 {
     // simple method: type cast input as real pointer, run double
     // length sumsqf method
     float * v = (float*) _v;
-    return liquid_sumsqf(v, 2*_n);
+    return liquid_sumsqf_sse(v, 2*_n);
 }
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// reference: accumulate, round, shift, and saturate
+static int16_t dotprod_q16_ref(int16_t *    _h,
+                               int16_t *    _x,
+                               unsigned int _stride,
+                               unsigned int _n,
+                               unsigned int _shift)
+{
+    int64_t v = 0;
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        v += (int64_t)_h[i] * (int64_t)_x[i*_stride];
+    if (_shift > 0)
+        v = (v + ((int64_t)1 << (_shift-1))) >> _shift;
+    return v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+}
+
+// helper function (compare real and complex kernels against reference
+// for a particular length)
+void runtest_dotprod_q16(unsigned int _n,
+                         unsigned int _shift)
+{
+    int16_t h[_n], x[_n], xc[2*_n], y, yc[2];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        h[i]       = (int16_t)(rand() & 0xffff);
+        x[i]       = (int16_t)(rand() & 0xffff);
+        xc[2*i+0]  = (int16_t)(rand() & 0xffff);
+        xc[2*i+1]  = (int16_t)(rand() & 0xffff);
+    }
+
+    dotprod_q16 q = dotprod_q16_create(h, _n);
+    CONTEND_EQUALITY(dotprod_q16_set_shift(q, _shift), LIQUID_OK);
+    CONTEND_EQUALITY(dotprod_q16_get_shift(q), _shift);
+
+    dotprod_q16_execute(q, x, &y);
+    CONTEND_EQUALITY(y, dotprod_q16_ref(h, x, 1, _n, _shift));
+
+    dotprod_q16_execute_cq16(q, xc, yc);
+    CONTEND_EQUALITY(yc[0], dotprod_q16_ref(h, xc+0, 2, _n, _shift));
+    CONTEND_EQUALITY(yc[1], dotprod_q16_ref(h, xc+1, 2, _n, _shift));
+
+    dotprod_q16_destroy(q);
+}
+
+// run kernels for each SIMD type available on this host
+void autotest_dotprod_q16_types()
+{
+    unsigned int i, n;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (!liquid_simd_is_available(i))
+            continue;
+        liquid_simd_set_type(i);
+        for (n=1; n<=256; n++) {
+            runtest_dotprod_q16(n, 15);
+            runtest_dotprod_q16(n, 20);
+        }
+    }
+
+    // restore automatic selection
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
+
+// check output saturation at full scale
+void autotest_dotprod_q16_saturate()
+{
+    unsigned int n = 40;
+    int16_t h[n], x[n], xc[2*n], y, yc[2];
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        h[i] = 32767;
+        x[i] = i % 2 ? -32768 : 32767;
+        xc[2*i+0] = 32767;
+        xc[2*i+1] = -32768;
+    }
+
+    dotprod_q16 q = dotprod_q16_create(h, n);
+
+    // alternating input sums to a small value
+    dotprod_q16_execute(q, x, &y);
+    CONTEND_EQUALITY(y, dotprod_q16_ref(h, x, 1, n, 15));
+
+    // full-scale input saturates at output
+    dotprod_q16_execute_cq16(q, xc, yc);
+    CONTEND_EQUALITY(yc[0],  32767);
+    CONTEND_EQUALITY(yc[1], -32768);
+
+    // with enough shift the full accumulated value is preserved
+    dotprod_q16_set_shift(q, 21);
+    dotprod_q16_execute_cq16(q, xc, yc);
+    CONTEND_EQUALITY(yc[0], dotprod_q16_ref(h, xc+0, 2, n, 21));
+    CONTEND_EQUALITY(yc[1], dotprod_q16_ref(h, xc+1, 2, n, 21));
+
+    dotprod_q16_destroy(q);
+}
+
+// check configuration errors
+void autotest_dotprod_q16_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping dotprod_q16 config test with strict exit enabled\n");
+    return;
+#else
+    int16_t h[4] = {1, 2, 3, 4};
+    CONTEND_EXPRESSION(dotprod_q16_create(h, 0)==NULL);
+
+    dotprod_q16 q = dotprod_q16_create(h, 4);
+    CONTEND_INEQUALITY(dotprod_q16_set_shift(q, 32), LIQUID_OK);
+    CONTEND_EQUALITY  (dotprod_q16_get_shift(q), 15);
+
+    // re-create retains output shift
+    dotprod_q16_set_shift(q, 12);
+    q = dotprod_q16_recreate(q, h, 3);
+    CONTEND_EQUALITY  (dotprod_q16_get_shift(q), 12);
+    dotprod_q16_destroy(q);
+#endif
+}
+
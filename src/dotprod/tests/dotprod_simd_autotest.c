@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// helper function (compare all dot product and sum-of-squares kernels
+// against ordinal computation for a particular length)
+void runtest_dotprod_simd(unsigned int _n)
+{
+    float tol = 1e-3;
+    float         hr[_n], xr[_n];
+    float complex hc[_n], xc[_n];
+
+    // generate random coefficients and inputs
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        hr[i] = randnf();
+        xr[i] = randnf();
+        hc[i] = randnf() + randnf() * _Complex_I;
+        xc[i] = randnf() + randnf() * _Complex_I;
+    }
+
+    // compute expected values (ordinal computation)
+    float         rrrf_test = 0, sumsqf_test = 0;
+    float complex crcf_test = 0, cccf_test = 0;
+    float         sumsqcf_test = 0;
+    for (i=0; i<_n; i++) {
+        rrrf_test    += hr[i] * xr[i];
+        crcf_test    += hr[i] * xc[i];
+        cccf_test    += hc[i] * xc[i];
+        sumsqf_test  += xr[i] * xr[i];
+        sumsqcf_test += crealf(xc[i] * conjf(xc[i]));
+    }
+
+    // run structured objects
+    float         rrrf_y;
+    float complex crcf_y, cccf_y;
+    dotprod_rrrf qr = dotprod_rrrf_create(hr,_n);
+    dotprod_crcf qm = dotprod_crcf_create(hr,_n);
+    dotprod_cccf qc = dotprod_cccf_create(hc,_n);
+    dotprod_rrrf_execute(qr, xr, &rrrf_y);
+    dotprod_crcf_execute(qm, xc, &crcf_y);
+    dotprod_cccf_execute(qc, xc, &cccf_y);
+    dotprod_rrrf_destroy(qr);
+    dotprod_crcf_destroy(qm);
+    dotprod_cccf_destroy(qc);
+
+    // validate results
+    CONTEND_DELTA(rrrf_y,         rrrf_test,         tol);
+    CONTEND_DELTA(crealf(crcf_y), crealf(crcf_test), tol);
+    CONTEND_DELTA(cimagf(crcf_y), cimagf(crcf_test), tol);
+    CONTEND_DELTA(crealf(cccf_y), crealf(cccf_test), tol);
+    CONTEND_DELTA(cimagf(cccf_y), cimagf(cccf_test), tol);
+    CONTEND_DELTA(liquid_sumsqf (xr,_n), sumsqf_test,  tol);
+    CONTEND_DELTA(liquid_sumsqcf(xc,_n), sumsqcf_test, tol);
+}
+
+// helper function (compare block execution against executing each
+// input window individually)
+void runtest_dotprod_simd_block(unsigned int _n,
+                                unsigned int _stride)
+{
+    float tol = 1e-3;
+    unsigned int num_outputs = 11;
+    unsigned int x_len = _n + (num_outputs-1)*_stride;
+    float         hr[_n], xr[x_len], yr[num_outputs], yr_test;
+    float complex hc[_n], xc[x_len], ym[num_outputs], ym_test;
+    float complex yc[num_outputs], yc_test;
+
+    // generate random coefficients and inputs
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        hr[i] = randnf();
+        hc[i] = randnf() + randnf() * _Complex_I;
+    }
+    for (i=0; i<x_len; i++) {
+        xr[i] = randnf();
+        xc[i] = randnf() + randnf() * _Complex_I;
+    }
+
+    dotprod_rrrf qr = dotprod_rrrf_create(hr,_n);
+    dotprod_crcf qm = dotprod_crcf_create(hr,_n);
+    dotprod_cccf qc = dotprod_cccf_create(hc,_n);
+    dotprod_rrrf_execute_block_stride(qr, xr, _stride, num_outputs, yr);
+    dotprod_crcf_execute_block_stride(qm, xc, _stride, num_outputs, ym);
+    dotprod_cccf_execute_block_stride(qc, xc, _stride, num_outputs, yc);
+    for (i=0; i<num_outputs; i++) {
+        dotprod_rrrf_execute(qr, &xr[i*_stride], &yr_test);
+        dotprod_crcf_execute(qm, &xc[i*_stride], &ym_test);
+        dotprod_cccf_execute(qc, &xc[i*_stride], &yc_test);
+        CONTEND_DELTA(yr[i],         yr_test,         tol);
+        CONTEND_DELTA(crealf(ym[i]), crealf(ym_test), tol);
+        CONTEND_DELTA(cimagf(ym[i]), cimagf(ym_test), tol);
+        CONTEND_DELTA(crealf(yc[i]), crealf(yc_test), tol);
+        CONTEND_DELTA(cimagf(yc[i]), cimagf(yc_test), tol);
+    }
+
+    // consecutive windows
+    if (_stride == 1) {
+        dotprod_rrrf_execute_block(qr, xr, num_outputs, yr);
+        dotprod_rrrf_execute(qr, &xr[num_outputs-1], &yr_test);
+        CONTEND_DELTA(yr[num_outputs-1], yr_test, tol);
+    }
+
+    dotprod_rrrf_destroy(qr);
+    dotprod_crcf_destroy(qm);
+    dotprod_cccf_destroy(qc);
+}
+
+// helper function (compare double-precision dot product kernels
+// against ordinal computation, for single and strided block execution)
+void runtest_dotprod_simd_double(unsigned int _n)
+{
+    double tol = 1e-9;
+    unsigned int num_outputs = 5;
+    unsigned int stride = 3;
+    unsigned int x_len = _n + (num_outputs-1)*stride;
+    double         hr[_n], xr[x_len], yr[num_outputs];
+    double complex hc[_n], xc[x_len], ym[num_outputs], yc[num_outputs];
+
+    // generate random coefficients and inputs
+    unsigned int i, k;
+    for (i=0; i<_n; i++) {
+        hr[i] = randnf();
+        hc[i] = randnf() + randnf() * _Complex_I;
+    }
+    for (i=0; i<x_len; i++) {
+        xr[i] = randnf();
+        xc[i] = randnf() + randnf() * _Complex_I;
+    }
+
+    dotprod_rrrd qr = dotprod_rrrd_create(hr,_n);
+    dotprod_crcd qm = dotprod_crcd_create(hr,_n);
+    dotprod_cccd qc = dotprod_cccd_create(hc,_n);
+    dotprod_rrrd_execute_block_stride(qr, xr, stride, num_outputs, yr);
+    dotprod_crcd_execute_block_stride(qm, xc, stride, num_outputs, ym);
+    dotprod_cccd_execute_block_stride(qc, xc, stride, num_outputs, yc);
+    for (k=0; k<num_outputs; k++) {
+        // compute expected values (ordinal computation)
+        double         rrrd_test = 0;
+        double complex crcd_test = 0, cccd_test = 0;
+        for (i=0; i<_n; i++) {
+            rrrd_test += hr[i] * xr[k*stride+i];
+            crcd_test += hr[i] * xc[k*stride+i];
+            cccd_test += hc[i] * xc[k*stride+i];
+        }
+
+        // validate block results
+        CONTEND_DELTA(yr[k],        rrrd_test,        tol);
+        CONTEND_DELTA(creal(ym[k]), creal(crcd_test), tol);
+        CONTEND_DELTA(cimag(ym[k]), cimag(crcd_test), tol);
+        CONTEND_DELTA(creal(yc[k]), creal(cccd_test), tol);
+        CONTEND_DELTA(cimag(yc[k]), cimag(cccd_test), tol);
+
+        // validate single output and run/run4 methods
+        double         rrrd_y;
+        double complex crcd_y, cccd_y;
+        dotprod_rrrd_execute(qr, &xr[k*stride], &rrrd_y);
+        CONTEND_DELTA(rrrd_y, rrrd_test, tol);
+        dotprod_crcd_execute(qm, &xc[k*stride], &crcd_y);
+        CONTEND_DELTA(creal(crcd_y), creal(crcd_test), tol);
+        CONTEND_DELTA(cimag(crcd_y), cimag(crcd_test), tol);
+        dotprod_cccd_run4(hc, &xc[k*stride], _n, &cccd_y);
+        CONTEND_DELTA(creal(cccd_y), creal(cccd_test), tol);
+        CONTEND_DELTA(cimag(cccd_y), cimag(cccd_test), tol);
+    }
+
+    dotprod_rrrd_destroy(qr);
+    dotprod_crcd_destroy(qm);
+    dotprod_cccd_destroy(qc);
+}
+
+// run all kernels for each SIMD type available on this host
+void autotest_dotprod_simd_types()
+{
+    unsigned int i, n;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (!liquid_simd_is_available(i))
+            continue;
+
+        CONTEND_EQUALITY(liquid_simd_set_type(i), LIQUID_OK);
+        CONTEND_EQUALITY(liquid_simd_get_type(), i);
+        if (liquid_autotest_verbose)
+            printf("  testing SIMD type '%s'\n", liquid_simd_str[i][0]);
+
+        for (n=1; n<=256; n++)
+            runtest_dotprod_simd(n);
+
+        for (n=1; n<=80; n++) {
+            runtest_dotprod_simd_block(n, 1);
+            runtest_dotprod_simd_block(n, 3);
+        }
+
+        for (n=1; n<=80; n++)
+            runtest_dotprod_simd_double(n);
+    }
+
+    // restore automatic selection
+    CONTEND_EQUALITY(liquid_simd_set_type(LIQUID_SIMD_AUTO), LIQUID_OK);
+}
+
+// check string conversion of SIMD types
+void autotest_dotprod_simd_str()
+{
+    unsigned int i;
+    for (i=0; i<LIQUID_SIMD_NUM_TYPES; i++)
+        CONTEND_EQUALITY(liquid_getopt_str2simd(liquid_simd_str[i][0]), i);
+
+    // automatic selection and currently selected type are always available
+    CONTEND_EXPRESSION(liquid_simd_is_available(LIQUID_SIMD_AUTO));
+    CONTEND_EXPRESSION(liquid_simd_is_available(liquid_simd_get_type()));
+}
@@ -227,3 +227,11 @@ void benchmark_fft_252    LIQUID_FFT_BENCHMARK_API(   252, LIQUID_FFT_FORWARD)
 void benchmark_fft_253    LIQUID_FFT_BENCHMARK_API(   253, LIQUID_FFT_FORWARD)
 void benchmark_fft_254    LIQUID_FFT_BENCHMARK_API(   254, LIQUID_FFT_FORWARD)
 void benchmark_fft_255    LIQUID_FFT_BENCHMARK_API(   255, LIQUID_FFT_FORWARD)
+
+// large composite numbers, beyond cache (four-step algorithm)
+void benchmark_fft_49152   LIQUID_FFT_BENCHMARK_API(  49152, LIQUID_FFT_FORWARD)
+void benchmark_fft_196608  LIQUID_FFT_BENCHMARK_API( 196608, LIQUID_FFT_FORWARD)
+void benchmark_fft_786432  LIQUID_FFT_BENCHMARK_API( 786432, LIQUID_FFT_FORWARD)
+void benchmark_fft_1000000 LIQUID_FFT_BENCHMARK_API(1000000, LIQUID_FFT_FORWARD)
+void benchmark_fft_1310720 LIQUID_FFT_BENCHMARK_API(1310720, LIQUID_FFT_FORWARD)
+void benchmark_fft_3145728 LIQUID_FFT_BENCHMARK_API(3145728, LIQUID_FFT_FORWARD)
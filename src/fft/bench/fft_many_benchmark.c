@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_many_benchmark.c : batch of transforms of the same size, computed
+//                        with a single plan or with one plan per transform
+//
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// number of transforms in each batch
+#define FFT_MANY_BENCH_HOWMANY  (64)
+
+#define LIQUID_FFT_MANY_BENCH_API(N,B,I) \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ fft_many_bench(_start, _finish, _num_iterations, N, B, I); }
+
+// Helper function to keep code base small
+//  _nfft       :   transform size
+//  _batch      :   use single plan for batch (otherwise one plan per transform)
+//  _interleave :   transforms interleaved sample by sample (otherwise contiguous)
+void fft_many_bench(struct rusage *     _start,
+                    struct rusage *     _finish,
+                    unsigned long int * _num_iterations,
+                    unsigned int        _nfft,
+                    int                 _batch,
+                    int                 _interleave)
+{
+    // initialize arrays, plans
+    unsigned int howmany = FFT_MANY_BENCH_HOWMANY;
+    unsigned int stride  = _interleave ? howmany : 1;
+    unsigned int dist    = _interleave ? 1       : _nfft;
+    float complex * x = (float complex *) malloc(_nfft*howmany*sizeof(float complex));
+    float complex * y = (float complex *) malloc(_nfft*howmany*sizeof(float complex));
+    float complex * u = (float complex *) malloc(_nfft*sizeof(float complex));
+    float complex * v = (float complex *) malloc(_nfft*sizeof(float complex));
+    fftplan q[FFT_MANY_BENCH_HOWMANY];
+    unsigned long int i;
+    unsigned int b, k;
+    if (_batch) {
+        q[0] = fft_create_plan_many(_nfft, howmany, x, stride, dist, y, stride, dist, LIQUID_FFT_FORWARD, 0);
+    } else if (_interleave) {
+        // single plan, copying samples in and out
+        q[0] = fft_create_plan(_nfft, u, v, LIQUID_FFT_FORWARD, 0);
+    } else {
+        for (b=0; b<howmany; b++)
+            q[b] = fft_create_plan(_nfft, x + b*_nfft, y + b*_nfft, LIQUID_FFT_FORWARD, 0);
+    }
+
+    // initialize input with random values
+    for (i=0; i<_nfft*howmany; i++)
+        x[i] = randnf() + randnf()*_Complex_I;
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= _nfft * howmany;
+    *_num_iterations += 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_batch) {
+            fft_execute(q[0]);
+        } else if (_interleave) {
+            for (b=0; b<howmany; b++) {
+                for (k=0; k<_nfft; k++)
+                    u[k] = x[b + k*howmany];
+                fft_execute(q[0]);
+                for (k=0; k<_nfft; k++)
+                    y[b + k*howmany] = v[k];
+            }
+        } else {
+            for (b=0; b<howmany; b++)
+                fft_execute(q[b]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    // clean up
+    for (b=0; b<(_batch || _interleave ? 1 : howmany); b++)
+        fft_destroy_plan(q[b]);
+    free(x);
+    free(y);
+    free(u);
+    free(v);
+}
+
+// batch of 64 contiguous transforms
+void benchmark_fft_many_16      LIQUID_FFT_MANY_BENCH_API(16,   1, 0)
+void benchmark_fft_many_32      LIQUID_FFT_MANY_BENCH_API(32,   1, 0)
+void benchmark_fft_many_64      LIQUID_FFT_MANY_BENCH_API(64,   1, 0)
+void benchmark_fft_many_128     LIQUID_FFT_MANY_BENCH_API(128,  1, 0)
+void benchmark_fft_many_256     LIQUID_FFT_MANY_BENCH_API(256,  1, 0)
+void benchmark_fft_many_1024    LIQUID_FFT_MANY_BENCH_API(1024, 1, 0)
+void benchmark_fft_many_24      LIQUID_FFT_MANY_BENCH_API(24,   1, 0)
+
+// contiguous transforms, one plan per transform
+void benchmark_fft_many_loop_16     LIQUID_FFT_MANY_BENCH_API(16,   0, 0)
+void benchmark_fft_many_loop_32     LIQUID_FFT_MANY_BENCH_API(32,   0, 0)
+void benchmark_fft_many_loop_64     LIQUID_FFT_MANY_BENCH_API(64,   0, 0)
+void benchmark_fft_many_loop_128    LIQUID_FFT_MANY_BENCH_API(128,  0, 0)
+void benchmark_fft_many_loop_256    LIQUID_FFT_MANY_BENCH_API(256,  0, 0)
+void benchmark_fft_many_loop_1024   LIQUID_FFT_MANY_BENCH_API(1024, 0, 0)
+void benchmark_fft_many_loop_24     LIQUID_FFT_MANY_BENCH_API(24,   0, 0)
+
+// batch of 64 interleaved transforms (e.g. channelizer outputs)
+void benchmark_fft_many_interleave_16       LIQUID_FFT_MANY_BENCH_API(16,   1, 1)
+void benchmark_fft_many_interleave_32       LIQUID_FFT_MANY_BENCH_API(32,   1, 1)
+void benchmark_fft_many_interleave_64       LIQUID_FFT_MANY_BENCH_API(64,   1, 1)
+void benchmark_fft_many_interleave_128      LIQUID_FFT_MANY_BENCH_API(128,  1, 1)
+void benchmark_fft_many_interleave_256      LIQUID_FFT_MANY_BENCH_API(256,  1, 1)
+
+// interleaved transforms, single plan copying samples in and out
+void benchmark_fft_many_loop_interleave_16  LIQUID_FFT_MANY_BENCH_API(16,   0, 1)
+void benchmark_fft_many_loop_interleave_32  LIQUID_FFT_MANY_BENCH_API(32,   0, 1)
+void benchmark_fft_many_loop_interleave_64  LIQUID_FFT_MANY_BENCH_API(64,   0, 1)
+void benchmark_fft_many_loop_interleave_128 LIQUID_FFT_MANY_BENCH_API(128,  0, 1)
+void benchmark_fft_many_loop_interleave_256 LIQUID_FFT_MANY_BENCH_API(256,  0, 1)
+
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_pruned_benchmark.c : transforms of zero-padded inputs and with
+//                          partial outputs (pruned transforms)
+//
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define LIQUID_FFT_PRUNED_BENCH_API(N,I,O)  \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ fft_pruned_bench(_start, _finish, _num_iterations, N, I, O); }
+
+// Helper function to keep code base small
+//  _nfft       :   transform size
+//  _num_in     :   number of non-zero input samples (0: regular transform)
+//  _num_out    :   number of required outputs
+void fft_pruned_bench(struct rusage *     _start,
+                      struct rusage *     _finish,
+                      unsigned long int * _num_iterations,
+                      unsigned int        _nfft,
+                      unsigned int        _num_in,
+                      unsigned int        _num_out)
+{
+    // initialize arrays, plan
+    float complex * x = (float complex *) malloc(_nfft*sizeof(float complex));
+    float complex * y = (float complex *) malloc(_nfft*sizeof(float complex));
+    unsigned long int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = (_num_in == 0 || i < _num_in) ? randnf() + randnf()*_Complex_I : 0.0f;
+    fftplan q = _num_in == 0 ?
+        fft_create_plan(_nfft, x, y, LIQUID_FFT_FORWARD, 0) :
+        fft_create_plan_pruned(_nfft, x, y, LIQUID_FFT_FORWARD, 0, _num_in, 0, _num_out);
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= _nfft;
+    *_num_iterations += 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        fft_execute(q);
+    getrusage(RUSAGE_SELF, _finish);
+
+    // clean up
+    fft_destroy_plan(q);
+    free(x);
+    free(y);
+}
+
+// regular transforms for reference
+void benchmark_fft_pruned_ref_1024      LIQUID_FFT_PRUNED_BENCH_API(1024,     0,  1024)
+void benchmark_fft_pruned_ref_65536     LIQUID_FFT_PRUNED_BENCH_API(65536,    0, 65536)
+
+// zero-padded input
+void benchmark_fft_pruned_in_1024_16    LIQUID_FFT_PRUNED_BENCH_API(1024,    16,  1024)
+void benchmark_fft_pruned_in_1024_64    LIQUID_FFT_PRUNED_BENCH_API(1024,    64,  1024)
+void benchmark_fft_pruned_in_65536_64   LIQUID_FFT_PRUNED_BENCH_API(65536,   64, 65536)
+void benchmark_fft_pruned_in_65536_1024 LIQUID_FFT_PRUNED_BENCH_API(65536, 1024, 65536)
+
+// partial output
+void benchmark_fft_pruned_out_1024_16    LIQUID_FFT_PRUNED_BENCH_API(1024,  1024,   16)
+void benchmark_fft_pruned_out_1024_64    LIQUID_FFT_PRUNED_BENCH_API(1024,  1024,   64)
+void benchmark_fft_pruned_out_65536_64   LIQUID_FFT_PRUNED_BENCH_API(65536, 65536,   64)
+void benchmark_fft_pruned_out_65536_1024 LIQUID_FFT_PRUNED_BENCH_API(65536, 65536, 1024)
@@ -23,9 +23,14 @@
 //
 // fft_r2r_benchmark.h
 //
-// Real even/odd FFT benchmarks (discrete cosine/sine transforms)
+// Real even/odd FFT benchmarks (discrete cosine/sine transforms), and
+// direct evaluation of the DCT-II (matrix-vector product with precomputed
+// cosine table) for comparison; the FFT-based transforms overtake direct
+// evaluation at small sizes and scale as n log(n) thereafter
 //
 
+#include <stdlib.h>
+#include <math.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -35,6 +40,12 @@
     unsigned long int *_num_iterations) \
 { fft_r2r_bench(_start, _finish, _num_iterations, N, K); }
 
+#define LIQUID_FFT_R2R_DIRECT_BENCH_API(N) \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ fft_r2r_direct_bench(_start, _finish, _num_iterations, N); }
+
 // Helper function to keep code base small
 void fft_r2r_bench(struct rusage *_start,
                    struct rusage *_finish,
@@ -55,7 +66,7 @@ void fft_r2r_bench(struct rusage *_start,
 
     // scale number of iterations to keep execution time
     // relatively linear
-    *_num_iterations /= _n * _n;
+    *_num_iterations /= _n * (1 + liquid_nextpow2(_n));
     *_num_iterations *= 10;
     *_num_iterations += 1;
 
@@ -73,6 +84,65 @@ void fft_r2r_bench(struct rusage *_start,
     fft_destroy_plan(p);
 }
 
+// direct DCT-II: one dot product per output with precomputed cosine table
+void fft_r2r_direct_bench(struct rusage *_start,
+                          struct rusage *_finish,
+                          unsigned long int *_num_iterations,
+                          unsigned int _n)
+{
+    // initialize arrays, dot products with rows of cosine table
+    float x[_n], y[_n], h[_n];
+    dotprod_rrrf * dp = (dotprod_rrrf*) malloc(_n*sizeof(dotprod_rrrf));
+    unsigned long int i;
+    unsigned int k;
+    for (k=0; k<_n; k++) {
+        for (i=0; i<_n; i++)
+            h[i] = 2*cosf(M_PI*((float)i + 0.5f)*(float)k / (float)_n);
+        dp[k] = dotprod_rrrf_create(h, _n);
+    }
+
+    // initialize input with random values
+    for (i=0; i<_n; i++)
+        x[i] = randnf();
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= _n * (1 + liquid_nextpow2(_n));
+    *_num_iterations *= 10;
+    *_num_iterations += 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        for (k=0; k<_n; k++)
+            dotprod_rrrf_execute(dp[k], x, &y[k]);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    for (k=0; k<_n; k++)
+        dotprod_rrrf_destroy(dp[k]);
+    free(dp);
+}
+
+// DCT-II crossover: direct evaluation and FFT-based method
+
+void benchmark_fft_REDFT10_direct_4     LIQUID_FFT_R2R_DIRECT_BENCH_API(4)
+void benchmark_fft_REDFT10_direct_8     LIQUID_FFT_R2R_DIRECT_BENCH_API(8)
+void benchmark_fft_REDFT10_direct_16    LIQUID_FFT_R2R_DIRECT_BENCH_API(16)
+void benchmark_fft_REDFT10_direct_32    LIQUID_FFT_R2R_DIRECT_BENCH_API(32)
+void benchmark_fft_REDFT10_direct_64    LIQUID_FFT_R2R_DIRECT_BENCH_API(64)
+void benchmark_fft_REDFT10_direct_128   LIQUID_FFT_R2R_DIRECT_BENCH_API(128)
+void benchmark_fft_REDFT10_direct_256   LIQUID_FFT_R2R_DIRECT_BENCH_API(256)
+
+void benchmark_fft_REDFT10_4    LIQUID_FFT_R2R_BENCH_API(4,    LIQUID_FFT_REDFT10)
+void benchmark_fft_REDFT10_8    LIQUID_FFT_R2R_BENCH_API(8,    LIQUID_FFT_REDFT10)
+void benchmark_fft_REDFT10_16   LIQUID_FFT_R2R_BENCH_API(16,   LIQUID_FFT_REDFT10)
+void benchmark_fft_REDFT10_32   LIQUID_FFT_R2R_BENCH_API(32,   LIQUID_FFT_REDFT10)
+void benchmark_fft_REDFT10_64   LIQUID_FFT_R2R_BENCH_API(64,   LIQUID_FFT_REDFT10)
+void benchmark_fft_REDFT10_256  LIQUID_FFT_R2R_BENCH_API(256,  LIQUID_FFT_REDFT10)
+void benchmark_fft_REDFT10_1024 LIQUID_FFT_R2R_BENCH_API(1024, LIQUID_FFT_REDFT10)
+void benchmark_fft_REDFT10_4096 LIQUID_FFT_R2R_BENCH_API(4096, LIQUID_FFT_REDFT10)
+
 // Radix-2
 
 void benchmark_fft_REDFT00_128  LIQUID_FFT_R2R_BENCH_API(128,  LIQUID_FFT_REDFT00)
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// sdft_benchmark.c : per-sample spectrum updates with the sliding DFT
+//                    compared to spgram with small hop sizes
+//
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define LIQUID_SDFT_BENCH_API(N,B)          \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ sdft_bench(_start, _finish, _num_iterations, N, B); }
+
+#define LIQUID_SPGRAM_HOP_BENCH_API(N,D)    \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ spgram_hop_bench(_start, _finish, _num_iterations, N, D); }
+
+// Helper function to keep code base small
+//  _nfft       :   transform size
+//  _num_bins   :   number of tracked bins (0: all bins)
+void sdft_bench(struct rusage *     _start,
+                struct rusage *     _finish,
+                unsigned long int * _num_iterations,
+                unsigned int        _nfft,
+                unsigned int        _num_bins)
+{
+    // create object tracking bins evenly spaced across the band
+    unsigned int i;
+    unsigned int bins[_nfft];
+    for (i=0; i<_nfft; i++)
+        bins[i] = _num_bins == 0 ? i : (i*_nfft/_num_bins) % _nfft;
+    sdft_cccf q = _num_bins == 0 ? sdft_cccf_create(_nfft) :
+                                   sdft_cccf_create_bins(_nfft, bins, _num_bins);
+
+    // scale number of iterations (one iteration is one input sample)
+    unsigned int n = _num_bins == 0 ? _nfft : _num_bins;
+    *_num_iterations *= 20;
+    *_num_iterations /= n;
+    *_num_iterations += 1;
+
+    float complex x[64];
+    for (i=0; i<64; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int k;
+    getrusage(RUSAGE_SELF, _start);
+    for (k=0; k<(*_num_iterations); k++)
+        sdft_cccf_push(q, x[k & 63]);
+    getrusage(RUSAGE_SELF, _finish);
+
+    sdft_cccf_destroy(q);
+}
+
+// Helper function to keep code base small
+//  _nfft       :   transform size
+//  _delay      :   samples between transforms (hop size)
+void spgram_hop_bench(struct rusage *     _start,
+                      struct rusage *     _finish,
+                      unsigned long int * _num_iterations,
+                      unsigned int        _nfft,
+                      unsigned int        _delay)
+{
+    // window spans full transform, as with the sliding DFT
+    spgramcf q = spgramcf_create(_nfft, LIQUID_WINDOW_HAMMING, _nfft, _delay);
+
+    // scale number of iterations (one iteration is one input sample)
+    *_num_iterations *= 20;
+    *_num_iterations /= _nfft;
+    *_num_iterations += 1;
+
+    unsigned int i;
+    float complex x[64];
+    for (i=0; i<64; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int k;
+    getrusage(RUSAGE_SELF, _start);
+    for (k=0; k<(*_num_iterations); k++)
+        spgramcf_push(q, x[k & 63]);
+    getrusage(RUSAGE_SELF, _finish);
+
+    spgramcf_destroy(q);
+}
+
+// sliding DFT, few and all bins
+void benchmark_sdft_64_bins4         LIQUID_SDFT_BENCH_API(  64,  4)
+void benchmark_sdft_64_all           LIQUID_SDFT_BENCH_API(  64,  0)
+void benchmark_sdft_1024_bins4       LIQUID_SDFT_BENCH_API(1024,  4)
+void benchmark_sdft_1024_bins16      LIQUID_SDFT_BENCH_API(1024, 16)
+void benchmark_sdft_1024_all         LIQUID_SDFT_BENCH_API(1024,  0)
+
+// periodogram with small hop sizes
+void benchmark_sdft_spgram_64_hop1    LIQUID_SPGRAM_HOP_BENCH_API(  64,  1)
+void benchmark_sdft_spgram_64_hop4    LIQUID_SPGRAM_HOP_BENCH_API(  64,  4)
+void benchmark_sdft_spgram_1024_hop1  LIQUID_SPGRAM_HOP_BENCH_API(1024,  1)
+void benchmark_sdft_spgram_1024_hop16 LIQUID_SPGRAM_HOP_BENCH_API(1024, 16)
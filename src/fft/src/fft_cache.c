@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_cache.c : reference-counted tables shared between transform plans
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "liquid.internal.h"
+
+// shared table entry
+struct FFT(_cache_s) {
+    liquid_fft_table       table;   // table type
+    unsigned int           nfft;    // transform size
+    int                    dir;     // direction (zero if independent)
+    unsigned int           param;   // additional parameter (zero if none)
+    unsigned int           refs;    // number of plans referencing table
+    void *                 data;    // table data (read only once shared)
+    struct FFT(_cache_s) * next;    // next entry in list
+};
+
+// list of shared tables
+static struct FFT(_cache_s) * FFT(_cache_list) = NULL;
+
+// lock protecting list of shared tables; plans may be created and destroyed
+// from multiple threads
+#if defined(__GNUC__)
+static volatile int FFT(_cache_lock_flag) = 0;
+static void FFT(_cache_lock)(void)
+{
+    while (__sync_lock_test_and_set(&FFT(_cache_lock_flag), 1))
+        ;
+}
+static void FFT(_cache_unlock)(void)
+{
+    __sync_lock_release(&FFT(_cache_lock_flag));
+}
+#else
+static void FFT(_cache_lock)(void)   {}
+static void FFT(_cache_unlock)(void) {}
+#endif
+
+// find table entry without locking, returning NULL if none exists
+static struct FFT(_cache_s) * FFT(_cache_find)(liquid_fft_table _table,
+                                               unsigned int     _nfft,
+                                               int              _dir,
+                                               unsigned int     _param)
+{
+    struct FFT(_cache_s) * c;
+    for (c=FFT(_cache_list); c!=NULL; c=c->next) {
+        if (c->table == _table && c->nfft == _nfft && c->dir == _dir && c->param == _param)
+            return c;
+    }
+    return NULL;
+}
+
+// look up shared table, incrementing its reference count if it exists
+void * FFT(_cache_lookup)(liquid_fft_table _table,
+                          unsigned int     _nfft,
+                          int              _dir,
+                          unsigned int     _param)
+{
+    FFT(_cache_lock)();
+    struct FFT(_cache_s) * c = FFT(_cache_find)(_table, _nfft, _dir, _param);
+    if (c != NULL)
+        c->refs++;
+    FFT(_cache_unlock)();
+    return c == NULL ? NULL : c->data;
+}
+
+// insert newly-computed table (allocated with malloc) and return shared
+// version; if an identical table was inserted in the meantime the new one
+// is freed and the existing table is returned instead
+void * FFT(_cache_insert)(liquid_fft_table _table,
+                          unsigned int     _nfft,
+                          int              _dir,
+                          unsigned int     _param,
+                          void *           _data)
+{
+    FFT(_cache_lock)();
+    struct FFT(_cache_s) * c = FFT(_cache_find)(_table, _nfft, _dir, _param);
+    if (c != NULL) {
+        c->refs++;
+        free(_data);
+    } else {
+        c = (struct FFT(_cache_s) *) malloc(sizeof(struct FFT(_cache_s)));
+        c->table = _table;
+        c->nfft  = _nfft;
+        c->dir   = _dir;
+        c->param = _param;
+        c->refs  = 1;
+        c->data  = _data;
+        c->next  = FFT(_cache_list);
+        FFT(_cache_list) = c;
+    }
+    FFT(_cache_unlock)();
+    return c->data;
+}
+
+// release reference to shared table, freeing it once no longer used
+int FFT(_cache_release)(void * _data)
+{
+    if (_data == NULL)
+        return LIQUID_OK;
+
+    FFT(_cache_lock)();
+    struct FFT(_cache_s) ** p = &FFT(_cache_list);
+    while (*p != NULL && (*p)->data != _data)
+        p = &(*p)->next;
+    struct FFT(_cache_s) * c = *p;
+    int found = c != NULL;
+    if (found && --c->refs == 0)
+        *p = c->next;   // unlink entry, freed below
+    else
+        c = NULL;       // still referenced (or not found)
+    FFT(_cache_unlock)();
+
+    if (!found)
+        return liquid_error(LIQUID_EIVAL,"fft_cache_release(), table is not shared");
+    if (c != NULL) {
+        free(c->data);
+        free(c);
+    }
+    return LIQUID_OK;
+}
+
+// get number of tables currently shared between plans
+unsigned int FFT(_cache_num_tables)(void)
+{
+    FFT(_cache_lock)();
+    unsigned int n = 0;
+    struct FFT(_cache_s) * c;
+    for (c=FFT(_cache_list); c!=NULL; c=c->next)
+        n++;
+    FFT(_cache_unlock)();
+    return n;
+}
+
+// acquire twiddle factors exp(-/+ j 2 pi i / nfft) for i in [0, nfft),
+// shared between radix-2 and mixed-radix plans
+TC * FFT(_cache_twiddle)(unsigned int _nfft,
+                         int          _dir)
+{
+    TC * twiddle = (TC *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_TWIDDLE, _nfft, _dir, 0);
+    if (twiddle != NULL)
+        return twiddle;
+
+    twiddle = (TC *) malloc(_nfft * sizeof(TC));
+    T d = (_dir == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        twiddle[i] = CEXP(_Complex_I*d*2*M_PI*(T)i / (T)(_nfft));
+    return (TC *) FFT(_cache_insert)(LIQUID_FFT_TABLE_TWIDDLE, _nfft, _dir, 0, twiddle);
+}
+
+// acquire twiddle factors for each radix-4 stage of length n, stored as
+// { w^p }, { w^2p }, { w^3p } for p in [0, n/4) with w = exp(-/+ j 2 pi / n),
+// total length less than nfft; shared between radix-4 and batched plans
+TC * FFT(_cache_radix4)(unsigned int _nfft,
+                        int          _dir)
+{
+    TC * twiddle = (TC *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_RADIX4, _nfft, _dir, 0);
+    if (twiddle != NULL)
+        return twiddle;
+
+    twiddle = (TC *) malloc(_nfft * sizeof(TC));
+    T d = (_dir == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+    TC * w = twiddle;
+    unsigned int n, p, k;
+    for (n=_nfft; n>=4; n/=4) {
+        unsigned int n1 = n/4;
+        for (k=1; k<=3; k++) {
+            for (p=0; p<n1; p++)
+                w[(k-1)*n1 + p] = (TC) cexp(_Complex_I*d*2*M_PI*(double)(k*p) / (double)n);
+        }
+        w += 3*n1;
+    }
+    return (TC *) FFT(_cache_insert)(LIQUID_FFT_TABLE_RADIX4, _nfft, _dir, 0, twiddle);
+}
+
+// acquire sequence g^(i+1) mod nfft for i in [0, nfft-1) where g is the
+// primitive root of prime nfft, shared between Rader plans
+unsigned int * FFT(_cache_rader_seq)(unsigned int _nfft)
+{
+    unsigned int * seq = (unsigned int *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_RADER_SEQ, _nfft, 0, 0);
+    if (seq != NULL)
+        return seq;
+
+    // compute primitive root of nfft and initialize sequence
+    unsigned int g = liquid_primitive_root_prime(_nfft);
+    seq = (unsigned int *) malloc((_nfft-1)*sizeof(unsigned int));
+    unsigned int i;
+    for (i=0; i<_nfft-1; i++)
+        seq[i] = liquid_modpow(g, i+1, _nfft);
+    return (unsigned int *) FFT(_cache_insert)(LIQUID_FFT_TABLE_RADER_SEQ, _nfft, 0, 0, seq);
+}
+
+// acquire twiddle factors exp(-/+ j 2 pi n1 k2 / nfft) for four-step
+// transform with factor _n1, stored as nfft/_n1 rows of _n1 factors
+// (k2 in [0,nfft/_n1), n1 in [0,_n1)) in the order they are applied
+TC * FFT(_cache_four_step)(unsigned int _nfft,
+                           unsigned int _n1,
+                           int          _dir)
+{
+    TC * twiddle = (TC *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_FOUR_STEP, _nfft, _dir, _n1);
+    if (twiddle != NULL)
+        return twiddle;
+
+    twiddle = (TC *) malloc(_nfft * sizeof(TC));
+    double d = (_dir == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+    unsigned int n2 = _nfft / _n1;
+    unsigned int i, k;
+    for (k=0; k<n2; k++) {
+        for (i=0; i<_n1; i++)
+            twiddle[k*_n1 + i] = (TC) cexp(_Complex_I*d*2*M_PI*(double)(i*k) / (double)_nfft);
+    }
+    return (TC *) FFT(_cache_insert)(LIQUID_FFT_TABLE_FOUR_STEP, _nfft, _dir, _n1, twiddle);
+}
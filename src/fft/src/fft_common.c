@@ -28,6 +28,17 @@
 #include <stdlib.h>
 #include "liquid.internal.h"
 
+// resources of each thread executing a four-step transform: blocks of
+// sub-transforms are computed by several threads at once, each with its
+// own buffers and sub-plans (which hold work buffers of their own)
+struct FFT(_four_step_thread_s) {
+    TC * t0;            // block of sub-transform inputs
+    TC * t1;            // block of sub-transform outputs
+    TC * buf_work;      // radix-4 work buffer (interleaved columns only)
+    FFT(plan) fft_N1;   // sub-transform of size N1
+    FFT(plan) fft_N2;   // sub-transform of size N2 (NULL if columns interleaved)
+};
+
 struct FFT(plan_s)
 {
     // common data
@@ -57,8 +68,8 @@ struct FFT(plan_s)
         // radix-2 transform data
         struct {
             unsigned int m;             // log2(nfft)
-            unsigned int * index_rev;   // reversed indices
-            TC * twiddle;               // twiddle factors
+            unsigned int * index_rev;   // reversed indices (shared)
+            TC * twiddle;               // twiddle factors (shared)
         } radix2;
 
         // recursive mixed-radix transform data:
@@ -72,15 +83,15 @@ struct FFT(plan_s)
             TC * x;             // input buffer (copied)
             TC * t0;            // temporary buffer (small FFT input)
             TC * t1;            // temporary buffer (small FFT output)
-            TC * twiddle;       // twiddle factors
+            TC * twiddle;       // twiddle factors (shared)
             FFT(plan) fft_P;    // sub-transform of size P
             FFT(plan) fft_Q;    // sub-transform of size Q
         } mixedradix;
 
         // Rader's algorithm for computing FFTs of prime length
         struct {
-            unsigned int * seq; // transformation sequence, size: nfft-1
-            TC * R;             // DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft-1
+            unsigned int * seq; // transformation sequence, size: nfft-1 (shared)
+            TC * R;             // DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft-1 (shared)
             TC * x_prime;       // sub-transform time-domain buffer
             TC * X_prime;       // sub-transform freq-domain buffer
             FFT(plan) fft;      // sub-FFT of size nfft-1
@@ -90,13 +101,76 @@ struct FFT(plan_s)
         // Rader's alternate algorithm for computing FFTs of prime length
         struct {
             unsigned int nfft_prime;
-            unsigned int * seq; // transformation sequence, size: nfft_prime
-            TC * R;             // DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft_prime
+            unsigned int * seq; // transformation sequence, size: nfft-1 (shared)
+            TC * R;             // DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft_prime (shared)
             TC * x_prime;       // sub-transform time-domain buffer
             TC * X_prime;       // sub-transform freq-domain buffer
             FFT(plan) fft;      // sub-FFT of size nfft_prime
             FFT(plan) ifft;     // sub-IFFT of size nfft_prime
         } rader2;
+
+        // radix-4 (Stockham) transform data
+        struct {
+            TC * twiddle;               // twiddle factors for each stage (shared)
+            TC * buf;                   // work buffer for alternating stages
+        } radix4;
+
+        // four-step transform of size N1*N2 (see fft_four_step.c)
+        struct {
+            unsigned int N1;            // number of columns, size of second transforms
+            unsigned int N2;            // number of rows, size of first transforms
+            unsigned int block;         // number of transforms computed per block
+            TC * buf;                   // intermediate result [size: nfft x 1]
+            TC * twiddle;               // twiddle factors (shared)
+            TC * twiddle_N2;            // radix-4 stage twiddle factors (shared, interleaved columns only)
+            unsigned int num_threads;   // number of threads
+            struct FFT(_four_step_thread_s) * thread; // buffers and sub-plans for each thread
+            liquid_fft_pool pool;       // worker threads (NULL: calling thread only)
+        } fourstep;
+
+        // pruned transform (see fft_pruned.c)
+        struct {
+            unsigned int num_in;        // number of non-zero input samples
+            unsigned int out_offset;    // index of first required output
+            unsigned int num_out;       // number of required outputs
+            unsigned int p_in;          // input decimation factor (1: none)
+            unsigned int p_out;         // output decimation factor (1: none)
+            TC * buf;                   // interleaved sub-transform input or output
+            TC * twiddle;               // twiddle factors (shared)
+            TC * twiddle_M;             // radix-4 stage twiddle factors (shared, NULL if batch plan)
+            TC * buf_work;              // radix-4 work buffer
+            FFT(plan) fft;              // batch of sub-transforms (regular if not pruned)
+        } pruned;
+
+        // batch of transforms of the same size (see fft_many.c)
+        struct {
+            unsigned int howmany;   // number of transforms
+            unsigned int istride;   // input distance between samples
+            unsigned int idist;     // input distance between transforms
+            unsigned int ostride;   // output distance between samples
+            unsigned int odist;     // output distance between transforms
+            unsigned int lanes;     // transforms per block (0: regular plan)
+            TC * twiddle;           // radix-4 stage twiddle factors (shared)
+            TC * buf_in;            // block input buffer (NULL if direct)
+            TC * buf_out;           // block output buffer (NULL if direct)
+            TC * buf_work;          // work buffer for alternating stages
+            FFT(plan) fft;          // single transform (not batched)
+        } many;
+
+        // real-input (r2c) and real-output (c2r) transforms
+        struct {
+            TC * twiddle;       // exp(-j 2 pi k / nfft), k in [0, nfft/4] (shared)
+            TC * buf;           // sub-transform buffer
+            FFT(plan) fft;      // complex sub-transform of size nfft/2 (nfft if odd)
+        } real;
+
+        // real-to-real transforms (DCT/DST) computed with an FFT
+        struct {
+            T  * xp;            // real buffer (extended/permuted samples)
+            TC * Xp;            // complex buffer
+            TC * twiddle;       // pre/post-twiddle factors
+            FFT(plan) fft;      // internal transform
+        } r2r;
     } data;
 };
 
@@ -105,26 +179,54 @@ struct FFT(plan_s)
 //  _x      :   input array [size: _nfft x 1]
 //  _y      :   output array [size: _nfft x 1]
 //  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
-//  _flags  :   fft method
+//  _flags  :   planner flags, e.g. LIQUID_FFT_MEASURE
 FFT(plan) FFT(_create_plan)(unsigned int _nfft,
                             TC *         _x,
                             TC *         _y,
                             int          _dir,
                             int          _flags)
 {
-    // determine best method for execution
-    // TODO : check flags and allow user override
-    liquid_fft_method method = liquid_fft_estimate_method(_nfft);
+    // determine best method for execution from wisdom, by measuring
+    // candidates (LIQUID_FFT_MEASURE), or by estimate
+    liquid_fft_method method;
+    unsigned int      factor;
+    if (FFT(_planner_select)(_nfft, _flags, &method, &factor) != LIQUID_OK)
+        return liquid_error_config("fft_create_plan(), could not determine method for _nfft=%u", _nfft);
+
+    return FFT(_create_plan_method)(_nfft, _x, _y, _dir, _flags, method, factor);
+}
 
+// create FFT plan using specific method
+//  _nfft   :   FFT size
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags  :   planner flags
+//  _method :   fft method
+//  _factor :   mixed-radix factor Q (0 to estimate)
+FFT(plan) FFT(_create_plan_method)(unsigned int      _nfft,
+                                   TC *              _x,
+                                   TC *              _y,
+                                   int               _dir,
+                                   int               _flags,
+                                   liquid_fft_method _method,
+                                   unsigned int      _factor)
+{
     // initialize fft based on method
-    switch (method) {
+    switch (_method) {
     case LIQUID_FFT_METHOD_RADIX2:
         // use radix-2 decimation-in-time method
         return FFT(_create_plan_radix2)(_nfft, _x, _y, _dir, _flags);
 
+    case LIQUID_FFT_METHOD_RADIX4:
+        // use radix-4 Stockham method
+        return FFT(_create_plan_radix4)(_nfft, _x, _y, _dir, _flags);
+
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // use Cooley-Tukey mixed-radix algorithm
-        return FFT(_create_plan_mixed_radix)(_nfft, _x, _y, _dir, _flags);
+        if (_factor == 0)
+            return FFT(_create_plan_mixed_radix)(_nfft, _x, _y, _dir, _flags);
+        return FFT(_create_plan_mixed_radix_factor)(_nfft, _factor, _x, _y, _dir, _flags);
 
     case LIQUID_FFT_METHOD_RADER:
         // use Rader's algorithm for FFTs of prime length
@@ -138,10 +240,14 @@ FFT(plan) FFT(_create_plan)(unsigned int _nfft,
         // use slow DFT
         return FFT(_create_plan_dft)(_nfft, _x, _y, _dir, _flags);
 
+    case LIQUID_FFT_METHOD_FOUR_STEP:
+        // use four-step algorithm for large transforms
+        return FFT(_create_plan_four_step)(_nfft, _x, _y, _dir, _flags);
+
     case LIQUID_FFT_METHOD_UNKNOWN:
     default:;
     }
-    return liquid_error_config("fft_create_plan(), unknown/invalid fft method (%u)", method);
+    return liquid_error_config("fft_create_plan(), unknown/invalid fft method (%u)", _method);
 }
 
 // destroy FFT plan
@@ -157,6 +263,10 @@ int FFT(_destroy_plan)(FFT(plan) _q)
         case LIQUID_FFT_METHOD_MIXED_RADIX: return FFT(_destroy_plan_mixed_radix)(_q);
         case LIQUID_FFT_METHOD_RADER:       return FFT(_destroy_plan_rader)(_q);
         case LIQUID_FFT_METHOD_RADER2:      return FFT(_destroy_plan_rader2)(_q);
+        case LIQUID_FFT_METHOD_RADIX4:      return FFT(_destroy_plan_radix4)(_q);
+        case LIQUID_FFT_METHOD_MANY:        return FFT(_destroy_plan_many)(_q);
+        case LIQUID_FFT_METHOD_FOUR_STEP:   return FFT(_destroy_plan_four_step)(_q);
+        case LIQUID_FFT_METHOD_PRUNED:      return FFT(_destroy_plan_pruned)(_q);
         case LIQUID_FFT_METHOD_UNKNOWN:
         default:;
         }
@@ -179,6 +289,11 @@ int FFT(_destroy_plan)(FFT(plan) _q)
     case LIQUID_FFT_IMDCT:
         return LIQUID_OK;
 
+    // real-input and real-output transforms
+    case LIQUID_FFT_R2C:
+    case LIQUID_FFT_C2R:
+        return FFT(_destroy_plan_real)(_q);
+
     case LIQUID_FFT_UNKNOWN:
     default:;
     }
@@ -201,6 +316,10 @@ int FFT(_print_plan)(FFT(plan) _q)
         case LIQUID_FFT_METHOD_MIXED_RADIX: printf("Cooley-Tukey\n");       break;
         case LIQUID_FFT_METHOD_RADER:       printf("Rader (Type I)\n");     break;
         case LIQUID_FFT_METHOD_RADER2:      printf("Rader (Type II)\n");    break;
+        case LIQUID_FFT_METHOD_RADIX4:      printf("Radix-4\n");            break;
+        case LIQUID_FFT_METHOD_MANY:        printf("Batch\n");              break;
+        case LIQUID_FFT_METHOD_FOUR_STEP:   printf("Four-step\n");          break;
+        case LIQUID_FFT_METHOD_PRUNED:      printf("Pruned\n");             break;
         case LIQUID_FFT_METHOD_UNKNOWN:
         default:
             return liquid_error(LIQUID_EIMODE,"fft_print_plan(), unknown/invalid fft method (%u)", _q->method);
@@ -217,12 +336,20 @@ int FFT(_print_plan)(FFT(plan) _q)
     case LIQUID_FFT_RODFT10:
     case LIQUID_FFT_RODFT01:
     case LIQUID_FFT_RODFT11:
-        return FFT(_print_plan)(_q);
+        return FFT(_print_plan_r2r_1d)(_q);
 
     // modified discrete cosine transform
     case LIQUID_FFT_MDCT:   return LIQUID_OK;
     case LIQUID_FFT_IMDCT:  return LIQUID_OK;
 
+    // real-input and real-output transforms
+    case LIQUID_FFT_R2C:
+    case LIQUID_FFT_C2R:
+        printf("fft plan [%s], n=%u, packed complex\n",
+                _q->type == LIQUID_FFT_R2C ? "real-input" : "real-output",
+                _q->nfft);
+        return FFT(_print_plan_recursive)(_q->data.real.fft, 1);
+
     case LIQUID_FFT_UNKNOWN:
     default:;
     }
@@ -248,6 +375,10 @@ int FFT(_print_plan_recursive)(FFT(plan)    _q,
         printf("Radix-2\n");
         break;
 
+    case LIQUID_FFT_METHOD_RADIX4:
+        printf("Radix-4 (Stockham)\n");
+        break;
+
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // two internal transforms
         printf("Cooley-Tukey mixed radix, Q=%u, P=%u\n",
@@ -267,6 +398,58 @@ int FFT(_print_plan_recursive)(FFT(plan)    _q,
         FFT(_print_plan_recursive)(_q->data.rader2.fft, _level+1);
         break;
 
+    case LIQUID_FFT_METHOD_FOUR_STEP:
+        // two internal transforms
+        printf("four-step, N1=%u, N2=%u, %u transforms per block, %u thread%s\n",
+                _q->data.fourstep.N1,
+                _q->data.fourstep.N2,
+                _q->data.fourstep.block,
+                _q->data.fourstep.num_threads,
+                _q->data.fourstep.num_threads == 1 ? "" : "s");
+        if (_q->data.fourstep.thread[0].fft_N2 == NULL) {
+            for (i=0; i<_level+1; i++)
+                printf("  ");
+            printf("%u, Radix-4 (Stockham) with columns interleaved\n", _q->data.fourstep.N2);
+        } else {
+            FFT(_print_plan_recursive)(_q->data.fourstep.thread[0].fft_N2, _level+1);
+        }
+        FFT(_print_plan_recursive)(_q->data.fourstep.thread[0].fft_N1, _level+1);
+        break;
+
+    case LIQUID_FFT_METHOD_MANY:
+        printf("batch of %u", _q->data.many.howmany);
+        if (_q->data.many.lanes == 1) {
+            printf(", Radix-4 (Stockham)\n");
+        } else if (_q->data.many.lanes > 1) {
+            printf(", Radix-4 (Stockham) with %u transforms interleaved\n", _q->data.many.lanes);
+        } else {
+            printf("\n");
+            FFT(_print_plan_recursive)(_q->data.many.fft, _level+1);
+        }
+        break;
+
+    case LIQUID_FFT_METHOD_PRUNED:
+        printf("pruned, %u inputs, %u outputs from %u",
+                _q->data.pruned.num_in,
+                _q->data.pruned.num_out,
+                _q->data.pruned.out_offset);
+        if (_q->data.pruned.p_in > 1)
+            printf(", input decimated by %u\n", _q->data.pruned.p_in);
+        else if (_q->data.pruned.p_out > 1)
+            printf(", output decimated by %u\n", _q->data.pruned.p_out);
+        else
+            printf(", not pruned\n");
+        if (_q->data.pruned.fft != NULL) {
+            FFT(_print_plan_recursive)(_q->data.pruned.fft, _level+1);
+        } else {
+            for (i=0; i<_level+1; i++)
+                printf("  ");
+            printf("%u, Radix-4 (Stockham) with %u transforms interleaved\n",
+                    _q->nfft / (_q->data.pruned.p_in * _q->data.pruned.p_out),
+                    _q->data.pruned.p_in * _q->data.pruned.p_out);
+        }
+        break;
+
     case LIQUID_FFT_METHOD_UNKNOWN:     printf("(unknown)\n");      break;
     default:                            printf("(unknown)\n");      break;
     }
@@ -280,6 +463,91 @@ int FFT(_execute)(FFT(plan) _q)
     return _q->execute(_q);
 }
 
+// execute fft on arrays other than those bound to the plan at creation
+//  _q      :   fft plan (complex transform)
+//  _x      :   input array [size: nfft x 1]
+//  _y      :   output array [size: nfft x 1]
+int FFT(_execute_arrays)(FFT(plan) _q,
+                         TC *      _x,
+                         TC *      _y)
+{
+    if (_q->type != LIQUID_FFT_FORWARD && _q->type != LIQUID_FFT_BACKWARD)
+        return liquid_error(LIQUID_EIMODE,"fft_execute_arrays(), plan is not a complex transform");
+
+    // bind arrays for this transform only; every method reads its
+    // input and output through _q->x and _q->y
+    TC * x = _q->x;
+    TC * y = _q->y;
+    _q->x = _x;
+    _q->y = _y;
+    int rc = _q->execute(_q);
+    _q->x = x;
+    _q->y = y;
+    return rc;
+}
+
+// set number of threads used to run transform
+//  _q      :   fft plan
+//  _n      :   number of threads, _n > 0
+int FFT(_set_num_threads)(FFT(plan)    _q,
+                          unsigned int _n)
+{
+    if (_n == 0)
+        return liquid_error(LIQUID_EICONFIG,"fft_set_num_threads(), number of threads must be greater than zero");
+
+    switch (_q->type) {
+    // complex one-dimensional transforms
+    case LIQUID_FFT_FORWARD:
+    case LIQUID_FFT_BACKWARD:
+        // only four-step transforms are split between threads
+        if (_q->method == LIQUID_FFT_METHOD_FOUR_STEP)
+            return FFT(_set_num_threads_four_step)(_q, _n);
+        if (_q->method == LIQUID_FFT_METHOD_PRUNED && _q->data.pruned.fft != NULL)
+            return FFT(_set_num_threads)(_q->data.pruned.fft, _n);
+        if (_n == 1)
+            return LIQUID_OK;
+
+        // switch large single transforms to the four-step method in place
+        if (_q->method != LIQUID_FFT_METHOD_PRUNED &&
+            _q->method != LIQUID_FFT_METHOD_MANY   &&
+            _q->nfft >= FFT_FOUR_STEP_NFFT_MIN     &&
+            fft_estimate_four_step(_q->nfft) > 0)
+        {
+            FFT(plan) p = FFT(_create_plan_four_step)(_q->nfft, _q->x, _q->y, _q->direction, _q->flags);
+            struct FFT(plan_s) t = *_q;
+            *_q = *p;
+            *p  = t;
+            FFT(_destroy_plan)(p);
+            return FFT(_set_num_threads_four_step)(_q, _n);
+        }
+        break;
+
+    // real-to-real and real-input/real-output transforms use an internal
+    // complex transform
+    case LIQUID_FFT_REDFT00:
+    case LIQUID_FFT_REDFT10:
+    case LIQUID_FFT_REDFT01:
+    case LIQUID_FFT_REDFT11:
+    case LIQUID_FFT_RODFT00:
+    case LIQUID_FFT_RODFT10:
+    case LIQUID_FFT_RODFT01:
+    case LIQUID_FFT_RODFT11:
+        if (_q->data.r2r.fft != NULL)
+            return FFT(_set_num_threads)(_q->data.r2r.fft, _n);
+        break;
+    case LIQUID_FFT_R2C:
+    case LIQUID_FFT_C2R:
+        return FFT(_set_num_threads)(_q->data.real.fft, _n);
+
+    default:;
+    }
+
+    // plan always runs on the calling thread
+    if (_n == 1)
+        return LIQUID_OK;
+    return liquid_error(LIQUID_EIMODE,"fft_set_num_threads(), transform of size %u cannot be split between threads", _q->nfft);
+}
+
 // perform n-point FFT allocating plan internally
 //  _nfft   :   fft size
 //  _x      :   input array [size: _nfft x 1]
@@ -89,7 +89,7 @@ FFT(plan) FFT(_create_plan_dft)(unsigned int _nfft,
             // initialize twiddle factors
             // NOTE: no need to compute first twiddle because exp(-j*2*pi*0) = 1
             for (k=1; k<q->nfft; k++)
-                q->data.dft.twiddle[k-1] = cexpf(_Complex_I*d*2*M_PI*(T)(k*i) / (T)(q->nfft));
+                q->data.dft.twiddle[k-1] = CEXP(_Complex_I*d*2*M_PI*(T)(k*i) / (T)(q->nfft));
 
             // create dotprod object
             q->data.dft.dotprod[i] = DOTPROD(_create)(q->data.dft.twiddle, q->nfft-1);
@@ -185,27 +185,27 @@ int FFT(_execute_dft_3)(FFT(plan) _q)
     T k1, k2, k3, k4;
 
     // compute both _q->x[1]*g and _q->x[1]*conj(g) with only 4 real multiplications
-    a = crealf(_q->x[1]);
-    b = cimagf(_q->x[1]);
+    a = REAL(_q->x[1]);
+    b = IMAG(_q->x[1]);
     //k1 = a*(-0.5f + -0.866025403784439f);
-    k1 = -1.36602540378444f*a;
-    k2 = -0.866025403784439f*(    a + b);
+    k1 = (T)(-1.36602540378444)*a;
+    k2 = (T)(-0.866025403784439)*(    a + b);
     k3 =               -0.5f*(    b - a);
     //k4 =                   b*(-0.5f + -0.866025403784439f);
-    k4 = -1.36602540378444f*b;
+    k4 = (T)(-1.36602540378444)*b;
 
     TC ta1 = (k1-k2) + _Complex_I*(k1+k3);   // 
     TC tb1 = (k4-k3) + _Complex_I*(k4-k2);   // 
     
     // compute both _q->x[2]*g and _q->x[2]*conj(g) with only 4 real multiplications
-    a = crealf(_q->x[2]);
-    b = cimagf(_q->x[2]);
+    a = REAL(_q->x[2]);
+    b = IMAG(_q->x[2]);
     //k1 = a*(-0.5f + -0.866025403784439f);
-    k1 = -1.36602540378444f*a;
-    k2 = -0.866025403784439f*(    a + b);
+    k1 = (T)(-1.36602540378444)*a;
+    k2 = (T)(-0.866025403784439)*(    a + b);
     k3 =               -0.5f*(    b - a);
     //k4 =                   b*(-0.5f + -0.866025403784439f);
-    k4 = -1.36602540378444f*b;
+    k4 = (T)(-1.36602540378444)*b;
 
     TC ta2 = (k1-k2) + _Complex_I*(k1+k3);   // 
     TC tb2 = (k4-k3) + _Complex_I*(k4-k2);   // 
@@ -223,8 +223,8 @@ int FFT(_execute_dft_3)(FFT(plan) _q)
     TC g  = -0.5f - _Complex_I*0.866025403784439; // sqrt(3)/2
 
     _q->y[0] = _q->x[0] + _q->x[1]          + _q->x[2];
-    TC ta    = _q->x[0] + _q->x[1]*g        + _q->x[2]*conjf(g);
-    TC tb    = _q->x[0] + _q->x[1]*conjf(g) + _q->x[2]*g;
+    TC ta    = _q->x[0] + _q->x[1]*g        + _q->x[2]*CONJ(g);
+    TC tb    = _q->x[0] + _q->x[1]*CONJ(g) + _q->x[2]*g;
 
     // set return values
     if (_q->direction == LIQUID_FFT_FORWARD) {
@@ -267,7 +267,7 @@ int FFT(_execute_dft_4)(FFT(plan) _q)
     y[0] = y[0] + yp;
 
     // k0 = 1, k1=3
-    yp = cimagf(y[3]) - _Complex_I*crealf(y[3]);
+    yp = IMAG(y[3]) - _Complex_I*REAL(y[3]);
     if (_q->direction == LIQUID_FFT_BACKWARD)
         yp = -yp;
     y[3] = y[1] - yp;
@@ -291,11 +291,11 @@ int FFT(_execute_dft_5)(FFT(plan) _q)
     TC g1 = -0.809016994374947 - 0.587785252292473*_Complex_I;
 
     if (_q->direction == LIQUID_FFT_BACKWARD) {
-        g0 = conjf(g0);
-        g1 = conjf(g1);
+        g0 = CONJ(g0);
+        g1 = CONJ(g1);
     }
-    TC g0_conj = conjf(g0);
-    TC g1_conj = conjf(g1);
+    TC g0_conj = CONJ(g0);
+    TC g1_conj = CONJ(g1);
 
     y[1] = x[0] + x[1]*g0      + x[2]*g1      + x[3]*g1_conj + x[4]*g0_conj;
     y[2] = x[0] + x[1]*g1      + x[2]*g0_conj + x[3]*g0      + x[4]*g1_conj;
@@ -320,13 +320,13 @@ int FFT(_execute_dft_6)(FFT(plan) _q)
 
     if (_q->direction == LIQUID_FFT_FORWARD) {
         g1 =        g;  // exp(-j*2*pi*1/6)
-        g2 = -conjf(g); // exp(-j*2*pi*2/6)
+        g2 = -CONJ(g); // exp(-j*2*pi*2/6)
         g4 =       -g;  // exp(-j*2*pi*4/6)
-        g5 =  conjf(g); // exp(-j*2*pi*5/6)
+        g5 =  CONJ(g); // exp(-j*2*pi*5/6)
     } else {
-        g1 =  conjf(g); // exp( j*2*pi*1/6)
+        g1 =  CONJ(g); // exp( j*2*pi*1/6)
         g2 =       -g;  // exp( j*2*pi*2/6)
-        g4 = -conjf(g); // exp( j*2*pi*4/6)
+        g4 = -CONJ(g); // exp( j*2*pi*4/6)
         g5 =        g;  // exp( j*2*pi*5/6)
     }
 
@@ -354,14 +354,14 @@ int FFT(_execute_dft_7)(FFT(plan) _q)
 
     if (_q->direction == LIQUID_FFT_FORWARD) {
     } else {
-        g1 = conjf(g1); // exp(+j*2*pi*1/7)
-        g2 = conjf(g2); // exp(+j*2*pi*2/7)
-        g3 = conjf(g3); // exp(+j*2*pi*3/7)
+        g1 = CONJ(g1); // exp(+j*2*pi*1/7)
+        g2 = CONJ(g2); // exp(+j*2*pi*2/7)
+        g3 = CONJ(g3); // exp(+j*2*pi*3/7)
     }
 
-    TC g4 = conjf(g3);
-    TC g5 = conjf(g2);
-    TC g6 = conjf(g1);
+    TC g4 = CONJ(g3);
+    TC g5 = CONJ(g2);
+    TC g6 = CONJ(g1);
 
     y[1] = x[0] + x[1]*g1 + x[2]*g2 + x[3]*g3 + x[4]*g4 + x[5]*g5 + x[6]*g6;
     y[2] = x[0] + x[1]*g2 + x[2]*g4 + x[3]*g6 + x[4]*g1 + x[5]*g3 + x[6]*g5;
@@ -403,13 +403,13 @@ int FFT(_execute_dft_8)(FFT(plan) _q)
     yp = y[2];  y[2] = y[0]-yp;     y[0] += yp;
     yp = y[6];  y[6] = y[4]-yp;     y[4] += yp;
 
-    if (fft) yp =  cimagf(y[3]) - crealf(y[3])*_Complex_I;
-    else     yp = -cimagf(y[3]) + crealf(y[3])*_Complex_I;
+    if (fft) yp =  IMAG(y[3]) - REAL(y[3])*_Complex_I;
+    else     yp = -IMAG(y[3]) + REAL(y[3])*_Complex_I;
     y[3] = y[1]-yp;
     y[1] += yp;
 
-    if (fft) yp =  cimagf(y[7]) - crealf(y[7])*_Complex_I;
-    else     yp = -cimagf(y[7]) + crealf(y[7])*_Complex_I;
+    if (fft) yp =  IMAG(y[7]) - REAL(y[7])*_Complex_I;
+    else     yp = -IMAG(y[7]) + REAL(y[7])*_Complex_I;
     y[7] = y[5]-yp;
     y[5] += yp;
 
@@ -422,8 +422,8 @@ int FFT(_execute_dft_8)(FFT(plan) _q)
     y[5] = y[1]-yp;
     y[1] += yp;
 
-    if (fft) yp =  cimagf(y[6]) - crealf(y[6])*_Complex_I;
-    else     yp = -cimagf(y[6]) + crealf(y[6])*_Complex_I;
+    if (fft) yp =  IMAG(y[6]) - REAL(y[6])*_Complex_I;
+    else     yp = -IMAG(y[6]) + REAL(y[6])*_Complex_I;
     y[6] = y[2]-yp;
     y[2] += yp;
 
@@ -493,39 +493,39 @@ int FFT(_execute_dft_16)(FFT(plan) _q)
     yp =  y[ 4];    y[ 4]  = y[ 0] - yp;    y[ 0] += yp;
     yp =  y[12];    y[12]  = y[ 8] - yp;    y[ 8] += yp;
     if (fft) {
-        yp =  y[ 5]*(  0.70710677 + _Complex_I* -0.70710677);  y[ 5]  = y[ 1] - yp;  y[ 1] += yp;
-        yp =  y[13]*(  0.70710677 + _Complex_I* -0.70710677);  y[13]  = y[ 9] - yp;  y[ 9] += yp;
+        yp =  y[ 5]*(  0.70710678118654752 + _Complex_I* -0.70710678118654752);  y[ 5]  = y[ 1] - yp;  y[ 1] += yp;
+        yp =  y[13]*(  0.70710678118654752 + _Complex_I* -0.70710678118654752);  y[13]  = y[ 9] - yp;  y[ 9] += yp;
         yp = -y[ 6]*_Complex_I;                                y[ 6]  = y[ 2] - yp;  y[ 2] += yp;
         yp = -y[14]*_Complex_I;                                y[14]  = y[10] - yp;  y[10] += yp;
-        yp =  y[ 7]*( -0.70710677 + _Complex_I* -0.70710677);  y[ 7]  = y[ 3] - yp;  y[ 3] += yp;
-        yp =  y[15]*( -0.70710677 + _Complex_I* -0.70710677);  y[15]  = y[11] - yp;  y[11] += yp;
+        yp =  y[ 7]*( -0.70710678118654752 + _Complex_I* -0.70710678118654752);  y[ 7]  = y[ 3] - yp;  y[ 3] += yp;
+        yp =  y[15]*( -0.70710678118654752 + _Complex_I* -0.70710678118654752);  y[15]  = y[11] - yp;  y[11] += yp;
     } else {
-        yp =  y[ 5]*(  0.70710677 - _Complex_I* -0.70710677);  y[ 5]  = y[ 1] - yp;  y[ 1] += yp;
-        yp =  y[13]*(  0.70710677 - _Complex_I* -0.70710677);  y[13]  = y[ 9] - yp;  y[ 9] += yp;
+        yp =  y[ 5]*(  0.70710678118654752 - _Complex_I* -0.70710678118654752);  y[ 5]  = y[ 1] - yp;  y[ 1] += yp;
+        yp =  y[13]*(  0.70710678118654752 - _Complex_I* -0.70710678118654752);  y[13]  = y[ 9] - yp;  y[ 9] += yp;
         yp  =  y[ 6]*_Complex_I;                               y[ 6]  = y[ 2] - yp;  y[ 2] += yp;
         yp  =  y[14]*_Complex_I;                               y[14]  = y[10] - yp;  y[10] += yp;
-        yp =  y[ 7]*( -0.70710677 - _Complex_I* -0.70710677);  y[ 7]  = y[ 3] - yp;  y[ 3] += yp;
-        yp =  y[15]*( -0.70710677 - _Complex_I* -0.70710677);  y[15]  = y[11] - yp;  y[11] += yp;
+        yp =  y[ 7]*( -0.70710678118654752 - _Complex_I* -0.70710678118654752);  y[ 7]  = y[ 3] - yp;  y[ 3] += yp;
+        yp =  y[15]*( -0.70710678118654752 - _Complex_I* -0.70710678118654752);  y[15]  = y[11] - yp;  y[11] += yp;
     }
 
     // i=3
     yp =  y[ 8];    y[ 8]  = y[ 0] - yp;    y[ 0] += yp;
     if (fft) {
-        yp =  y[ 9]*(  0.92387950 + _Complex_I* -0.38268346);  y[ 9]  = y[ 1] - yp;  y[ 1] += yp;
-        yp =  y[10]*(  0.70710677 + _Complex_I* -0.70710677);  y[10]  = y[ 2] - yp;  y[ 2] += yp;
-        yp =  y[11]*(  0.38268343 + _Complex_I* -0.92387950);  y[11]  = y[ 3] - yp;  y[ 3] += yp;
+        yp =  y[ 9]*(  0.92387953251128674 + _Complex_I* -0.38268343236508977);  y[ 9]  = y[ 1] - yp;  y[ 1] += yp;
+        yp =  y[10]*(  0.70710678118654752 + _Complex_I* -0.70710678118654752);  y[10]  = y[ 2] - yp;  y[ 2] += yp;
+        yp =  y[11]*(  0.38268343236508977 + _Complex_I* -0.92387953251128674);  y[11]  = y[ 3] - yp;  y[ 3] += yp;
         yp = -y[12]*_Complex_I;                                y[12]  = y[ 4] - yp;  y[ 4] += yp;
-        yp =  y[13]*( -0.38268340 + _Complex_I* -0.92387956);  y[13]  = y[ 5] - yp;  y[ 5] += yp;
-        yp =  y[14]*( -0.70710677 + _Complex_I* -0.70710677);  y[14]  = y[ 6] - yp;  y[ 6] += yp;
-        yp =  y[15]*( -0.92387950 + _Complex_I* -0.38268349);  y[15]  = y[ 7] - yp;  y[ 7] += yp;
+        yp =  y[13]*( -0.38268343236508977 + _Complex_I* -0.92387953251128674);  y[13]  = y[ 5] - yp;  y[ 5] += yp;
+        yp =  y[14]*( -0.70710678118654752 + _Complex_I* -0.70710678118654752);  y[14]  = y[ 6] - yp;  y[ 6] += yp;
+        yp =  y[15]*( -0.92387953251128674 + _Complex_I* -0.38268343236508977);  y[15]  = y[ 7] - yp;  y[ 7] += yp;
     } else {
-        yp =  y[ 9]*(  0.92387950 - _Complex_I* -0.38268346);  y[ 9]  = y[ 1] - yp;  y[ 1] += yp;
-        yp =  y[10]*(  0.70710677 - _Complex_I* -0.70710677);  y[10]  = y[ 2] - yp;  y[ 2] += yp;
-        yp =  y[11]*(  0.38268343 - _Complex_I* -0.92387950);  y[11]  = y[ 3] - yp;  y[ 3] += yp;
+        yp =  y[ 9]*(  0.92387953251128674 - _Complex_I* -0.38268343236508977);  y[ 9]  = y[ 1] - yp;  y[ 1] += yp;
+        yp =  y[10]*(  0.70710678118654752 - _Complex_I* -0.70710678118654752);  y[10]  = y[ 2] - yp;  y[ 2] += yp;
+        yp =  y[11]*(  0.38268343236508977 - _Complex_I* -0.92387953251128674);  y[11]  = y[ 3] - yp;  y[ 3] += yp;
         yp =  y[12]*_Complex_I;                                y[12]  = y[ 4] - yp;  y[ 4] += yp;
-        yp =  y[13]*( -0.38268340 - _Complex_I* -0.92387956);  y[13]  = y[ 5] - yp;  y[ 5] += yp;
-        yp =  y[14]*( -0.70710677 - _Complex_I* -0.70710677);  y[14]  = y[ 6] - yp;  y[ 6] += yp;
-        yp =  y[15]*( -0.92387950 - _Complex_I* -0.38268349);  y[15]  = y[ 7] - yp;  y[ 7] += yp;
+        yp =  y[13]*( -0.38268343236508977 - _Complex_I* -0.92387953251128674);  y[13]  = y[ 5] - yp;  y[ 5] += yp;
+        yp =  y[14]*( -0.70710678118654752 - _Complex_I* -0.70710678118654752);  y[14]  = y[ 6] - yp;  y[ 6] += yp;
+        yp =  y[15]*( -0.92387953251128674 - _Complex_I* -0.38268343236508977);  y[15]  = y[ 7] - yp;  y[ 7] += yp;
     }
     return LIQUID_OK;
 }
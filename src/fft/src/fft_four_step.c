@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_four_step.c : large transforms computed with the four-step
+//                   (six-step) algorithm
+//
+// A transform of size nfft = N1*N2 is computed as N1 transforms of size
+// N2 followed by N2 transforms of size N1, each small enough to stay in
+// cache. With input index n = n1 + N1*n2 and output index k = k2 + N2*k1:
+//  1. compute transforms of size N2 over n2 on columns n1 of the input
+//     (viewed as N2 rows of N1 samples), written into an internal buffer
+//  2. apply twiddle factors exp(-/+ j 2 pi n1 k2 / nfft)
+//  3. compute transforms of size N1 over n1 on rows k2 of the buffer
+//  4. transpose into the output
+// Rather than transposing the whole array at once, columns and rows are
+// processed in blocks of several adjacent transforms so that every cache
+// line read from or written to main memory is used in full, and each pass
+// moves the data through memory only once. Compared with recursive
+// mixed-radix plans (and radix-4 stages which each pass over the entire
+// array) this keeps the working set in cache for sizes well beyond it.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "liquid.internal.h"
+
+// number of samples per block when the cache size cannot be determined
+#define FFT_FOUR_STEP_BLOCK_SIZE    (1<<15)
+
+// determine number of transforms computed in each block: buffers for a
+// block of transforms should occupy about half of the level-2 cache, and
+// each block spans at least one cache line (8 complex samples)
+static unsigned int FFT(_four_step_block)(unsigned int _n)
+{
+    long int block_size = FFT_FOUR_STEP_BLOCK_SIZE;
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    long int cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (cache_size > 0)
+        block_size = cache_size / (4*sizeof(TC));
+#endif
+    unsigned int b = block_size / _n;
+    if (b < 8)  b = 8;
+    if (b > 64) b = 64;
+    return b & ~7U;
+}
+
+// allocate buffers and create sub-plans for thread
+static int FFT(_four_step_thread_create)(FFT(plan)                         _q,
+                                         struct FFT(_four_step_thread_s) * _t)
+{
+    unsigned int N1    = _q->data.fourstep.N1;
+    unsigned int N2    = _q->data.fourstep.N2;
+    unsigned int block = _q->data.fourstep.block;
+    unsigned int n     = N1 > N2 ? N1 : N2;
+
+    _t->t0 = (TC *) malloc(block * n * sizeof(TC));
+    _t->t1 = (TC *) malloc(block * n * sizeof(TC));
+
+    if (_q->data.fourstep.twiddle_N2 != NULL) {
+        // columns are transformed with the radix-4 stages operating on
+        // all columns of a block at once, interleaved as in the input
+        _t->buf_work = (TC *) malloc(block * N2 * sizeof(TC));
+        _t->fft_N2   = NULL;
+    } else {
+        // columns are transposed into rows and transformed one at a time
+        _t->buf_work = NULL;
+        _t->fft_N2   = FFT(_create_plan)(N2, _t->t0, _t->t1, _q->direction, _q->flags);
+    }
+
+    // create row sub-transform, executed on blocks in place of its arrays
+    _t->fft_N1 = FFT(_create_plan)(N1, _t->t0, _t->t1, _q->direction, _q->flags);
+    return LIQUID_OK;
+}
+
+// free buffers and destroy sub-plans for thread
+static int FFT(_four_step_thread_destroy)(struct FFT(_four_step_thread_s) * _t)
+{
+    FFT(_destroy_plan)(_t->fft_N1);
+    if (_t->fft_N2 != NULL)
+        FFT(_destroy_plan)(_t->fft_N2);
+    free(_t->t0);
+    free(_t->t1);
+    free(_t->buf_work);
+    return LIQUID_OK;
+}
+
+// create FFT plan for four-step transform
+//  _nfft   :   FFT size
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags  :   fft flags
+FFT(plan) FFT(_create_plan_four_step)(unsigned int _nfft,
+                                      TC *         _x,
+                                      TC *         _y,
+                                      int          _dir,
+                                      int          _flags)
+{
+    // validate input
+    unsigned int N1 = fft_estimate_four_step(_nfft);
+    if (N1 == 0)
+        return liquid_error_config("fft_create_plan_four_step(), _nfft=%u has no factor suitable for four-step transform", _nfft);
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_FOUR_STEP;
+
+    q->execute   = FFT(_execute_four_step);
+
+    // set four-step data
+    unsigned int N2 = _nfft / N1;
+    unsigned int n  = N1 > N2 ? N1 : N2;
+    unsigned int block = FFT(_four_step_block)(n);
+    if (block > n)
+        block = n;
+    q->data.fourstep.N1    = N1;
+    q->data.fourstep.N2    = N2;
+    q->data.fourstep.block = block;
+
+    // allocate memory for intermediate result
+    q->data.fourstep.buf = (TC *) malloc(_nfft * sizeof(TC));
+
+    // twiddle factors (shared)
+    q->data.fourstep.twiddle    = FFT(_cache_four_step)(_nfft, N1, q->direction);
+    q->data.fourstep.twiddle_N2 = fft_is_radix2(N2) ? FFT(_cache_radix4)(N2, q->direction) : NULL;
+
+    // resources for a single thread
+    q->data.fourstep.pool        = NULL;
+    q->data.fourstep.num_threads = 1;
+    q->data.fourstep.thread = (struct FFT(_four_step_thread_s) *) malloc(sizeof(struct FFT(_four_step_thread_s)));
+    FFT(_four_step_thread_create)(q, &q->data.fourstep.thread[0]);
+
+    return q;
+}
+
+// destroy FFT plan
+int FFT(_destroy_plan_four_step)(FFT(plan) _q)
+{
+    // destroy resources for each thread
+    unsigned int i;
+    for (i=0; i<_q->data.fourstep.num_threads; i++)
+        FFT(_four_step_thread_destroy)(&_q->data.fourstep.thread[i]);
+    free(_q->data.fourstep.thread);
+    if (_q->data.fourstep.pool != NULL)
+        liquid_fft_pool_destroy(_q->data.fourstep.pool);
+
+    // free data specific to four-step transforms
+    free(_q->data.fourstep.buf);
+    FFT(_cache_release)(_q->data.fourstep.twiddle);
+    FFT(_cache_release)(_q->data.fourstep.twiddle_N2);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// set number of threads executing four-step FFT
+int FFT(_set_num_threads_four_step)(FFT(plan)    _q,
+                                    unsigned int _num_threads)
+{
+    unsigned int i;
+    unsigned int n = _q->data.fourstep.num_threads;
+
+    // destroy resources of threads no longer used
+    for (i=_num_threads; i<n; i++)
+        FFT(_four_step_thread_destroy)(&_q->data.fourstep.thread[i]);
+
+    // create resources for new threads
+    _q->data.fourstep.thread = (struct FFT(_four_step_thread_s) *)
+        realloc(_q->data.fourstep.thread, _num_threads*sizeof(struct FFT(_four_step_thread_s)));
+    for (i=n; i<_num_threads; i++)
+        FFT(_four_step_thread_create)(_q, &_q->data.fourstep.thread[i]);
+
+    _q->data.fourstep.num_threads = _num_threads;
+
+    // start worker threads once here rather than on every execution
+    if (_q->data.fourstep.pool != NULL && n != _num_threads) {
+        liquid_fft_pool_destroy(_q->data.fourstep.pool);
+        _q->data.fourstep.pool = NULL;
+    }
+    if (_q->data.fourstep.pool == NULL && _num_threads > 1)
+        _q->data.fourstep.pool = liquid_fft_pool_create(_num_threads);
+    return LIQUID_OK;
+}
+
+// compute transforms of size N2 on columns of input, written into columns
+// of buffer, for blocks of columns in [_begin, _end)
+static void FFT(_four_step_columns)(void *       _context,
+                                    unsigned int _thread,
+                                    unsigned int _begin,
+                                    unsigned int _end)
+{
+    FFT(plan) q = (FFT(plan)) _context;
+    struct FFT(_four_step_thread_s) * t = &q->data.fourstep.thread[_thread];
+
+    // set internal constants
+    unsigned int N1    = q->data.fourstep.N1;
+    unsigned int N2    = q->data.fourstep.N2;
+    unsigned int block = q->data.fourstep.block;
+
+    // set pointers
+    TC * buf = q->data.fourstep.buf;    // intermediate result, N2 rows of N1
+    TC * t0  = t->t0;                   // block of sub-transform inputs
+    TC * t1  = t->t1;                   // block of sub-transform outputs
+
+    unsigned int i, b, k, r, j;
+    for (j=_begin; j<_end; j++) {
+        i = j*block;
+        r = N1 - i < block ? N1 - i : block;
+
+        if (t->fft_N2 == NULL) {
+            // gather columns [i, i+r) of input, interleaved, padding with
+            // zeros to a multiple of four columns
+            unsigned int lanes = (r + 3) & ~3U;
+            for (k=0; k<N2; k++) {
+                memmove(t0 + k*lanes, q->x + k*N1 + i, r*sizeof(TC));
+                for (b=r; b<lanes; b++)
+                    t0[k*lanes + b] = 0;
+            }
+
+            // run all column transforms in block
+            FFT_RADIX4(_execute)(N2,
+                                 lanes,
+                                 q->data.fourstep.twiddle_N2,
+                                 q->direction,
+                                 t0,
+                                 t1,
+                                 t->buf_work);
+
+            // scatter columns, writing rows of r samples
+            for (k=0; k<N2; k++)
+                memmove(buf + k*N1 + i, t1 + k*lanes, r*sizeof(TC));
+        } else {
+            // gather columns [i, i+r) of input into rows, reading rows of
+            // r samples
+            for (k=0; k<N2; k++) {
+                TC * x = q->x + k*N1 + i;
+                for (b=0; b<r; b++)
+                    t0[b*N2 + k] = x[b];
+            }
+
+            // run column transforms one at a time
+            for (b=0; b<r; b++)
+                FFT(_execute_arrays)(t->fft_N2, t0 + b*N2, t1 + b*N2);
+
+            // transpose back into columns, writing rows of r samples
+            for (k=0; k<N2; k++) {
+                TC * y = buf + k*N1 + i;
+                for (b=0; b<r; b++)
+                    y[b] = t1[b*N2 + k];
+            }
+        }
+    }
+}
+
+// compute transforms of size N1 on rows of buffer after applying twiddle
+// factors, transposed into output, for blocks of rows in [_begin, _end)
+static void FFT(_four_step_rows)(void *       _context,
+                                 unsigned int _thread,
+                                 unsigned int _begin,
+                                 unsigned int _end)
+{
+    FFT(plan) q = (FFT(plan)) _context;
+    struct FFT(_four_step_thread_s) * t = &q->data.fourstep.thread[_thread];
+
+    // set internal constants
+    unsigned int N1    = q->data.fourstep.N1;
+    unsigned int N2    = q->data.fourstep.N2;
+    unsigned int block = q->data.fourstep.block;
+
+    // set pointers
+    TC * buf     = q->data.fourstep.buf;        // intermediate result, N2 rows of N1
+    TC * twiddle = q->data.fourstep.twiddle;    // twiddle factors, N2 rows of N1
+    TC * t0      = t->t0;                       // block of sub-transform inputs
+    TC * t1      = t->t1;                       // block of sub-transform outputs
+
+    unsigned int i, b, k, r, j;
+    for (j=_begin; j<_end; j++) {
+        i = j*block;
+        r = N2 - i < block ? N2 - i : block;
+
+        // run transforms on rows [i, i+r)
+        for (b=0; b<r; b++) {
+            TC * v = buf     + (i+b)*N1;
+            TC * w = twiddle + (i+b)*N1;
+            for (k=0; k<N1; k++) {
+                T vr = REAL(v[k]), vi = IMAG(v[k]);
+                T wr = REAL(w[k]), wi = IMAG(w[k]);
+                t0[k] = (vr*wr - vi*wi) + _Complex_I*(vr*wi + vi*wr);
+            }
+            FFT(_execute_arrays)(t->fft_N1, t0, t1 + b*N1);
+        }
+
+        // transpose into columns [i, i+r) of output
+        for (k=0; k<N1; k++) {
+            TC * y = q->y + k*N2 + i;
+            for (b=0; b<r; b++)
+                y[b] = t1[b*N1 + k];
+        }
+    }
+}
+
+// execute four-step FFT; blocks are the same regardless of the number of
+// threads, so the result does not depend on it
+int FFT(_execute_four_step)(FFT(plan) _q)
+{
+    unsigned int N1          = _q->data.fourstep.N1;
+    unsigned int N2          = _q->data.fourstep.N2;
+    unsigned int block       = _q->data.fourstep.block;
+    liquid_fft_pool pool     = _q->data.fourstep.pool;
+
+    // all columns must be complete before any row is computed
+    if (pool == NULL) {
+        FFT(_four_step_columns)(_q, 0, 0, (N1 + block - 1) / block);
+        FFT(_four_step_rows)   (_q, 0, 0, (N2 + block - 1) / block);
+    } else {
+        liquid_fft_pool_execute(pool, (N1 + block - 1) / block, FFT(_four_step_columns), _q);
+        liquid_fft_pool_execute(pool, (N2 + block - 1) / block, FFT(_four_step_rows),    _q);
+    }
+    return LIQUID_OK;
+}
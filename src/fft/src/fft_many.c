@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_many.c : batch of transforms of the same size
+//
+// Transforms whose size is a power of two are computed with the radix-4
+// Stockham stages, sharing twiddle factors and work buffer between them:
+//  - when transforms are not contiguous (e.g. interleaved), several
+//    small transforms are computed at once: they are gathered into a
+//    block interleaved sample by sample
+//    (element i of transform b at index i*lanes + b) so that each stage
+//    operates on all of them with the batch index across SIMD lanes,
+//    loading each twiddle factor once per block; transforms that are
+//    already interleaved this way are computed in place without copying
+//  - when each transform is contiguous, interleaving would cost as much
+//    as the transform itself for small sizes, so transforms are instead
+//    computed one at a time directly on the input and output arrays
+// Other sizes are computed one at a time with a regular plan.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "liquid.internal.h"
+
+// maximum number of samples in each block (lanes x nfft), keeping the
+// block buffers in cache
+#define FFT_MANY_BLOCK_SIZE     (2048)
+
+// maximum transform size for computing transforms in blocks; beyond
+// this, gathering samples into blocks costs more than is saved
+#define FFT_MANY_NFFT_MAX       (512)
+
+// create batch of FFT plans of the same size
+//  _nfft    :   FFT size
+//  _howmany :   number of transforms
+//  _x       :   input array
+//  _istride :   input distance between samples
+//  _idist   :   input distance between transforms
+//  _y       :   output array
+//  _ostride :   output distance between samples
+//  _odist   :   output distance between transforms
+//  _dir     :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags   :   planner flags, e.g. LIQUID_FFT_MEASURE
+FFT(plan) FFT(_create_plan_many)(unsigned int _nfft,
+                                 unsigned int _howmany,
+                                 TC *         _x,
+                                 unsigned int _istride,
+                                 unsigned int _idist,
+                                 TC *         _y,
+                                 unsigned int _ostride,
+                                 unsigned int _odist,
+                                 int          _dir,
+                                 int          _flags)
+{
+    // validate input
+    if (_nfft == 0)
+        return liquid_error_config("fft_create_plan_many(), fft size must be greater than zero");
+    if (_howmany == 0)
+        return liquid_error_config("fft_create_plan_many(), number of transforms must be greater than zero");
+    if (_istride == 0 || _ostride == 0)
+        return liquid_error_config("fft_create_plan_many(), strides must be greater than zero");
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_MANY;
+
+    q->execute   = FFT(_execute_many);
+
+    q->data.many.howmany = _howmany;
+    q->data.many.istride = _istride;
+    q->data.many.idist   = _idist;
+    q->data.many.ostride = _ostride;
+    q->data.many.odist   = _odist;
+    q->data.many.twiddle = NULL;
+    q->data.many.fft     = NULL;
+
+    q->data.many.buf_in   = NULL;
+    q->data.many.buf_out  = NULL;
+    q->data.many.buf_work = NULL;
+
+    if (_nfft >= 16 && fft_is_radix2(_nfft) && _istride == 1 && _ostride == 1) {
+        // contiguous transforms: compute one at a time in place
+        q->data.many.lanes    = 1;
+        q->data.many.twiddle  = FFT(_cache_radix4)(_nfft, q->direction);
+        q->data.many.buf_work = (TC *) malloc(_nfft * sizeof(TC));
+    } else if (_nfft >= 2 && fft_is_radix2(_nfft) && _nfft <= FFT_MANY_NFFT_MAX && _howmany > 1) {
+        // number of transforms in each block: a multiple of four, no
+        // larger than required for the batch
+        unsigned int lanes = (FFT_MANY_BLOCK_SIZE / _nfft) & ~3U;
+        if (lanes < 4)
+            lanes = 4;
+        if (lanes > ((_howmany + 3) & ~3U))
+            lanes = (_howmany + 3) & ~3U;
+        q->data.many.lanes    = lanes;
+        q->data.many.twiddle  = FFT(_cache_radix4)(_nfft, q->direction);
+        q->data.many.buf_work = (TC *) malloc(lanes * _nfft * sizeof(TC));
+
+        // use input and output arrays directly when already interleaved
+        // as a single block
+        if (_howmany != lanes || _istride != lanes || _idist != 1)
+            q->data.many.buf_in  = (TC *) malloc(lanes * _nfft * sizeof(TC));
+        if (_howmany != lanes || _ostride != lanes || _odist != 1)
+            q->data.many.buf_out = (TC *) malloc(lanes * _nfft * sizeof(TC));
+    } else {
+        // compute one transform at a time with regular plan
+        q->data.many.lanes    = 0;
+        q->data.many.buf_in   = (TC *) malloc(_nfft * sizeof(TC));
+        q->data.many.buf_out  = (TC *) malloc(_nfft * sizeof(TC));
+        q->data.many.fft      = FFT(_create_plan)(_nfft, q->data.many.buf_in, q->data.many.buf_out, _dir, _flags);
+    }
+
+    return q;
+}
+
+// destroy batch of FFT plans
+int FFT(_destroy_plan_many)(FFT(plan) _q)
+{
+    // free data specific to batch
+    free(_q->data.many.buf_in);
+    free(_q->data.many.buf_out);
+    free(_q->data.many.buf_work);
+    if (_q->data.many.twiddle != NULL)
+        FFT(_cache_release)(_q->data.many.twiddle);
+    if (_q->data.many.fft != NULL)
+        FFT(_destroy_plan)(_q->data.many.fft);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// execute batch of FFTs
+int FFT(_execute_many)(FFT(plan) _q)
+{
+    unsigned int nfft    = _q->nfft;
+    unsigned int howmany = _q->data.many.howmany;
+    unsigned int istride = _q->data.many.istride;
+    unsigned int idist   = _q->data.many.idist;
+    unsigned int ostride = _q->data.many.ostride;
+    unsigned int odist   = _q->data.many.odist;
+    TC * buf_in  = _q->data.many.buf_in;
+    TC * buf_out = _q->data.many.buf_out;
+    unsigned int i, b, b0;
+
+    if (_q->data.many.fft != NULL) {
+        // compute one transform at a time with regular plan
+        for (b=0; b<howmany; b++) {
+            TC * x = _q->x + b*idist;
+            TC * y = _q->y + b*odist;
+            if (istride == 1 && ostride == 1 && _q->x != _q->y) {
+                // contiguous and out of place: run on the arrays directly
+                FFT(_execute_arrays)(_q->data.many.fft, x, y);
+                continue;
+            }
+            for (i=0; i<nfft; i++)
+                buf_in[i] = x[i*istride];
+            FFT(_execute)(_q->data.many.fft);
+            for (i=0; i<nfft; i++)
+                y[i*ostride] = buf_out[i];
+        }
+        return LIQUID_OK;
+    }
+
+    if (_q->data.many.lanes == 1) {
+        // compute contiguous transforms one at a time in place
+        for (b=0; b<howmany; b++) {
+            FFT_RADIX4(_execute)(nfft,
+                                 1,
+                                 _q->data.many.twiddle,
+                                 _q->direction,
+                                 _q->x + b*idist,
+                                 _q->y + b*odist,
+                                 _q->data.many.buf_work);
+        }
+        return LIQUID_OK;
+    }
+
+    // compute transforms in blocks; the last block is padded with zeros
+    // so that the number of interleaved transforms is a multiple of four
+    for (b0=0; b0<howmany; b0+=_q->data.many.lanes) {
+        unsigned int r     = howmany - b0 < _q->data.many.lanes ? howmany - b0 : _q->data.many.lanes;
+        unsigned int lanes = (r + 3) & ~3U;
+
+        // gather input samples, interleaved; samples of adjacent
+        // transforms are copied as a block
+        TC * x = _q->x + b0*idist;
+        if (buf_in != NULL) {
+            for (i=0; i<nfft; i++) {
+                TC * v = buf_in + i*lanes;
+                if (idist == 1) {
+                    memmove(v, x + i*istride, r*sizeof(TC));
+                } else {
+                    for (b=0; b<r; b++)
+                        v[b] = x[b*idist + i*istride];
+                }
+                for (b=r; b<lanes; b++)
+                    v[b] = 0;
+            }
+            x = buf_in;
+        }
+
+        // run all transforms in block
+        TC * y = _q->y + b0*odist;
+        FFT_RADIX4(_execute)(nfft,
+                             lanes,
+                             _q->data.many.twiddle,
+                             _q->direction,
+                             x,
+                             buf_out != NULL ? buf_out : y,
+                             _q->data.many.buf_work);
+
+        // scatter output samples
+        if (buf_out != NULL) {
+            for (i=0; i<nfft; i++) {
+                TC * v = buf_out + i*lanes;
+                if (odist == 1) {
+                    memmove(y + i*ostride, v, r*sizeof(TC));
+                } else {
+                    for (b=0; b<r; b++)
+                        y[b*odist + i*ostride] = v[b];
+                }
+            }
+        }
+    }
+    return LIQUID_OK;
+}
+
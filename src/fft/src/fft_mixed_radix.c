@@ -45,6 +45,35 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
                                         int          _dir,
                                         int          _flags)
 {
+    // find first 'prime' factor of _nfft
+    unsigned int Q = FFT(_estimate_mixed_radix)(_nfft);
+    if (Q==0)
+        return liquid_error_config("fft_create_plan_mixed_radix(), _nfft=%u is prime", _nfft);
+
+    return FFT(_create_plan_mixed_radix_factor)(_nfft, Q, _x, _y, _dir, _flags);
+}
+
+// create FFT plan for mixed-radix transform with specific factor
+//  _nfft   :   FFT size
+//  _Q      :   factor of _nfft, size of second transform
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags  :   fft flags
+FFT(plan) FFT(_create_plan_mixed_radix_factor)(unsigned int _nfft,
+                                               unsigned int _Q,
+                                               TC *         _x,
+                                               TC *         _y,
+                                               int          _dir,
+                                               int          _flags)
+{
+    // validate input
+    unsigned int Q = _Q;
+    if (Q < 2 || Q >= _nfft)
+        return liquid_error_config("fft_create_plan_mixed_radix(), invalid factor Q=%u for _nfft=%u", Q, _nfft);
+    if ( (_nfft % Q) != 0 )
+        return liquid_error_config("fft_create_plan_mixed_radix(), _nfft=%u is not divisible by Q=%u", _nfft, Q);
+
     // allocate plan and initialize all internal arrays to NULL
     FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
 
@@ -58,14 +87,6 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
 
     q->execute   = FFT(_execute_mixed_radix);
 
-    // find first 'prime' factor of _nfft
-    unsigned int i;
-    unsigned int Q = FFT(_estimate_mixed_radix)(_nfft);
-    if (Q==0)
-        return liquid_error_config("fft_create_plan_mixed_radix(), _nfft=%u is prime", _nfft);
-    if ( (_nfft % Q) != 0 )
-        return liquid_error_config("fft_create_plan_mixed_radix(), _nfft=%u is not divisible by Q=%u", _nfft, Q);
-
     // set mixed-radix data
     unsigned int P = q->nfft / Q;
     q->data.mixedradix.Q = Q;
@@ -93,13 +114,9 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
                                                  q->direction,
                                                  q->flags);
 
-    // initialize twiddle factors, indices for mixed-radix transforms
+    // initialize twiddle factors for mixed-radix transforms (shared)
     // TODO : only allocate necessary twiddle factors
-    q->data.mixedradix.twiddle = (TC *) malloc(q->nfft * sizeof(TC));
-    
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft; i++)
-        q->data.mixedradix.twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+    q->data.mixedradix.twiddle = FFT(_cache_twiddle)(q->nfft, q->direction);
 
     return q;
 }
@@ -115,7 +132,7 @@ int FFT(_destroy_plan_mixed_radix)(FFT(plan) _q)
     free(_q->data.mixedradix.t0);
     free(_q->data.mixedradix.t1);
     free(_q->data.mixedradix.x);
-    free(_q->data.mixedradix.twiddle);
+    FFT(_cache_release)(_q->data.mixedradix.twiddle);
 
     // free main object memory
     free(_q);
@@ -160,7 +177,7 @@ int FFT(_execute_mixed_radix)(FFT(plan) _q)
 #if FFT_DEBUG_MIXED_RADIX
         printf("i=%3u/%3u\n", i, Q);
         for (k=0; k<P; k++)
-            printf("  %12.6f %12.6f\n", crealf(x[Q*k+i]), cimagf(x[Q*k+i]));
+            printf("  %12.6f %12.6f\n", REAL(x[Q*k+i]), IMAG(x[Q*k+i]));
 #endif
     }
 
@@ -183,7 +200,7 @@ int FFT(_execute_mixed_radix)(FFT(plan) _q)
 #if DEBUG
         printf("i=%3u/%3u\n", i, P);
         for (k=0; k<Q; k++)
-            printf("  %12.6f %12.6f\n", crealf(_q->y[k*P+i]), cimagf(_q->y[k*P+i]));
+            printf("  %12.6f %12.6f\n", REAL(_q->y[k*P+i]), IMAG(_q->y[k*P+i]));
 #endif
     }
     return LIQUID_OK;
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_planner.c : measuring planner and wisdom for complex transforms
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "liquid.internal.h"
+
+// minimum time spent executing each candidate method [seconds]
+#define FFT_PLANNER_MEASURE_TIME    (1e-3)
+
+// largest transform size for which regular DFT is a candidate
+#define FFT_PLANNER_DFT_MAX         (64)
+
+// largest mixed-radix factor considered as a candidate
+#define FFT_PLANNER_FACTOR_MAX      (64)
+
+// wisdom entry: method selected for a particular transform size, measured
+// either with or without threads
+struct FFT(_wisdom_s) {
+    unsigned int      nfft;     // transform size
+    int               threads;  // measured with LIQUID_FFT_THREADS?
+    liquid_fft_method method;   // transform method
+    unsigned int      factor;   // mixed-radix factor Q (zero otherwise)
+};
+
+// accumulated wisdom, sorted by transform size then thread flag
+static struct FFT(_wisdom_s) * FFT(_wisdom_table) = NULL;
+static unsigned int            FFT(_wisdom_len)   = 0;
+
+// lock protecting wisdom; plans may be created (reading wisdom) while
+// another thread measures, imports, or clears wisdom
+#if defined(__GNUC__)
+static volatile int FFT(_wisdom_lock_flag) = 0;
+static void FFT(_wisdom_lock)(void)
+{
+    while (__sync_lock_test_and_set(&FFT(_wisdom_lock_flag), 1))
+        ;
+}
+static void FFT(_wisdom_unlock)(void)
+{
+    __sync_lock_release(&FFT(_wisdom_lock_flag));
+}
+#else
+static void FFT(_wisdom_lock)(void)   {}
+static void FFT(_wisdom_unlock)(void) {}
+#endif
+
+// method names as they appear in wisdom files
+static const char * FFT(_wisdom_method_str)[] = {
+    [LIQUID_FFT_METHOD_UNKNOWN]     = "unknown",
+    [LIQUID_FFT_METHOD_RADIX2]      = "radix2",
+    [LIQUID_FFT_METHOD_MIXED_RADIX] = "mixed-radix",
+    [LIQUID_FFT_METHOD_RADER]       = "rader",
+    [LIQUID_FFT_METHOD_RADER2]      = "rader2",
+    [LIQUID_FFT_METHOD_DFT]         = "dft",
+    [LIQUID_FFT_METHOD_RADIX4]      = "radix4",
+    [LIQUID_FFT_METHOD_MANY]        = "many",
+    [LIQUID_FFT_METHOD_FOUR_STEP]   = "four-step",
+    [LIQUID_FFT_METHOD_PRUNED]      = "pruned",
+};
+#define FFT_WISDOM_NUM_METHODS (sizeof(FFT(_wisdom_method_str))/sizeof(char*))
+
+// compare wisdom entry against key (nfft, threads)
+static int FFT(_wisdom_less)(struct FFT(_wisdom_s) * _w,
+                             unsigned int            _nfft,
+                             int                     _threads)
+{
+    return _w->nfft < _nfft || (_w->nfft == _nfft && _w->threads < _threads);
+}
+
+// find wisdom entry for transform size without locking, returning NULL
+// if none exists
+static struct FFT(_wisdom_s) * FFT(_wisdom_lookup)(unsigned int _nfft,
+                                                   int          _threads)
+{
+    unsigned int lo = 0, hi = FFT(_wisdom_len);
+    while (lo < hi) {
+        unsigned int mid = (lo + hi) / 2;
+        if (FFT(_wisdom_less)(&FFT(_wisdom_table)[mid], _nfft, _threads)) lo = mid + 1;
+        else                                                             hi = mid;
+    }
+    if (lo < FFT(_wisdom_len) && FFT(_wisdom_table)[lo].nfft    == _nfft
+                              && FFT(_wisdom_table)[lo].threads == _threads)
+        return &FFT(_wisdom_table)[lo];
+    return NULL;
+}
+
+// add entry to wisdom without locking, replacing any existing entry of
+// the same size
+static int FFT(_wisdom_add)(unsigned int      _nfft,
+                            int               _threads,
+                            liquid_fft_method _method,
+                            unsigned int      _factor)
+{
+    struct FFT(_wisdom_s) * w = FFT(_wisdom_lookup)(_nfft, _threads);
+    if (w == NULL) {
+        // grow table and insert in order
+        struct FFT(_wisdom_s) * table = (struct FFT(_wisdom_s) *)
+            realloc(FFT(_wisdom_table), (FFT(_wisdom_len)+1)*sizeof(struct FFT(_wisdom_s)));
+        if (table == NULL)
+            return liquid_error(LIQUID_EIMEM,"fft_wisdom_add(), could not allocate memory");
+        FFT(_wisdom_table) = table;
+
+        unsigned int i = FFT(_wisdom_len);
+        while (i > 0 && !FFT(_wisdom_less)(&table[i-1], _nfft, _threads)) {
+            table[i] = table[i-1];
+            i--;
+        }
+        FFT(_wisdom_len)++;
+        w = &table[i];
+    }
+    w->nfft    = _nfft;
+    w->threads = _threads;
+    w->method  = _method;
+    w->factor  = _method == LIQUID_FFT_METHOD_MIXED_RADIX ? _factor : 0;
+    return LIQUID_OK;
+}
+
+// check that method (and factor) can compute transform of given size
+static int FFT(_planner_is_valid)(unsigned int      _nfft,
+                                  liquid_fft_method _method,
+                                  unsigned int      _factor)
+{
+    switch (_method) {
+    case LIQUID_FFT_METHOD_DFT:         return _nfft > 0;
+    case LIQUID_FFT_METHOD_RADIX2:      return _nfft >= 2 && fft_is_radix2(_nfft);
+    case LIQUID_FFT_METHOD_RADIX4:      return _nfft >= 16 && fft_is_radix2(_nfft);
+    case LIQUID_FFT_METHOD_MIXED_RADIX: return _factor >= 2 && _factor < _nfft && (_nfft % _factor) == 0;
+    case LIQUID_FFT_METHOD_FOUR_STEP:   return fft_estimate_four_step(_nfft) > 0;
+    case LIQUID_FFT_METHOD_RADER:
+    case LIQUID_FFT_METHOD_RADER2:      return _nfft > 2 && liquid_is_prime(_nfft);
+    case LIQUID_FFT_METHOD_UNKNOWN:
+    default:;
+    }
+    return 0;
+}
+
+// wall-clock time [seconds]; cpu time would charge candidates using
+// several threads for every thread
+static double FFT(_planner_time)(void)
+{
+#if HAVE_CLOCK_GETTIME
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + 1e-9*(double)ts.tv_nsec;
+#else
+    return (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
+}
+
+// measure average execution time of candidate method [seconds], returning
+// a negative value if the plan could not be created
+static double FFT(_planner_measure)(unsigned int      _nfft,
+                                    int               _flags,
+                                    liquid_fft_method _method,
+                                    unsigned int      _factor,
+                                    TC *              _x,
+                                    TC *              _y)
+{
+    FFT(plan) q = FFT(_create_plan_method)(_nfft, _x, _y, LIQUID_FFT_FORWARD,
+                                           _flags, _method, _factor);
+    if (q == NULL)
+        return -1.0;
+
+    // run once to warm up caches, then repeat until enough time has elapsed
+    FFT(_execute)(q);
+    unsigned long int num_trials = 0;
+    double t0 = FFT(_planner_time)();
+    double t1;
+    do {
+        FFT(_execute)(q);
+        FFT(_execute)(q);
+        num_trials += 2;
+        t1 = FFT(_planner_time)();
+    } while (t1 - t0 < FFT_PLANNER_MEASURE_TIME);
+
+    FFT(_destroy_plan)(q);
+    return (t1 - t0) / (double)num_trials;
+}
+
+// determine method for transform size: use wisdom if available, otherwise
+// measure all candidate methods if requested, otherwise estimate
+int FFT(_planner_select)(unsigned int        _nfft,
+                         int                 _flags,
+                         liquid_fft_method * _method,
+                         unsigned int      * _factor)
+{
+    // use existing wisdom (measured or imported) for the same thread flag
+    int threads = (_flags & LIQUID_FFT_THREADS) ? 1 : 0;
+    FFT(_wisdom_lock)();
+    struct FFT(_wisdom_s) * w = FFT(_wisdom_lookup)(_nfft, threads);
+    if (w != NULL) {
+        *_method = w->method;
+        *_factor = w->factor;
+    }
+    FFT(_wisdom_unlock)();
+    if (w != NULL)
+        return LIQUID_OK;
+
+    // plan for threads: large transforms are split into independent
+    // sub-transforms with the four-step algorithm
+    if ( (_flags & LIQUID_FFT_THREADS) && !(_flags & LIQUID_FFT_MEASURE) &&
+         _nfft >= FFT_FOUR_STEP_NFFT_MIN && fft_estimate_four_step(_nfft) > 0)
+    {
+        *_method = LIQUID_FFT_METHOD_FOUR_STEP;
+        *_factor = 0;
+        return LIQUID_OK;
+    }
+
+    // estimate method without measuring
+    if ( !(_flags & LIQUID_FFT_MEASURE) || _nfft < 2) {
+        *_method = liquid_fft_estimate_method(_nfft);
+        *_factor = 0;
+        if (*_method == LIQUID_FFT_METHOD_UNKNOWN)
+            return liquid_error(LIQUID_EICONFIG,"fft_planner_select(), could not estimate method for _nfft=%u", _nfft);
+        return LIQUID_OK;
+    }
+
+    // build list of candidate methods
+    liquid_fft_method methods[FFT_PLANNER_FACTOR_MAX + 4];
+    unsigned int      factors[FFT_PLANNER_FACTOR_MAX + 4];
+    unsigned int num_candidates = 0;
+    unsigned int i;
+    liquid_fft_method list[] = {LIQUID_FFT_METHOD_DFT,
+                                LIQUID_FFT_METHOD_RADIX2,
+                                LIQUID_FFT_METHOD_RADIX4,
+                                LIQUID_FFT_METHOD_RADER,
+                                LIQUID_FFT_METHOD_RADER2,
+                                LIQUID_FFT_METHOD_FOUR_STEP};
+    for (i=0; i<sizeof(list)/sizeof(list[0]); i++) {
+        if (list[i] == LIQUID_FFT_METHOD_DFT && _nfft > FFT_PLANNER_DFT_MAX)
+            continue;
+        if (FFT(_planner_is_valid)(_nfft, list[i], 0)) {
+            methods[num_candidates] = list[i];
+            factors[num_candidates] = 0;
+            num_candidates++;
+        }
+    }
+    // mixed-radix transforms for each factor
+    for (i=2; i<=FFT_PLANNER_FACTOR_MAX && i<_nfft; i++) {
+        if (FFT(_planner_is_valid)(_nfft, LIQUID_FFT_METHOD_MIXED_RADIX, i)) {
+            methods[num_candidates] = LIQUID_FFT_METHOD_MIXED_RADIX;
+            factors[num_candidates] = i;
+            num_candidates++;
+        }
+    }
+
+    // allocate buffers and initialize input
+    TC * x = (TC*) malloc(_nfft*sizeof(TC));
+    TC * y = (TC*) malloc(_nfft*sizeof(TC));
+    for (i=0; i<_nfft; i++)
+        x[i] = (T)((int)(i % 7) - 3) + _Complex_I*(T)((int)(i % 5) - 2);
+
+    // measure each candidate and keep the fastest
+    liquid_fft_method method_opt = liquid_fft_estimate_method(_nfft);
+    unsigned int      factor_opt = 0;
+    double            time_opt   = -1.0;
+    for (i=0; i<num_candidates; i++) {
+        double t = FFT(_planner_measure)(_nfft, _flags, methods[i], factors[i], x, y);
+        if (t >= 0 && (time_opt < 0 || t < time_opt)) {
+            method_opt = methods[i];
+            factor_opt = factors[i];
+            time_opt   = t;
+        }
+    }
+    free(x);
+    free(y);
+
+    // save result as wisdom
+    *_method = method_opt;
+    *_factor = factor_opt;
+    FFT(_wisdom_lock)();
+    int rc = FFT(_wisdom_add)(_nfft, threads, method_opt, factor_opt);
+    FFT(_wisdom_unlock)();
+    return rc;
+}
+
+// export planner wisdom to file
+int FFT(_wisdom_export)(const char * _filename)
+{
+    FILE * fid = fopen(_filename,"w");
+    if (fid == NULL)
+        return liquid_error(LIQUID_EIO,"fft_wisdom_export(), could not open '%s' for writing",_filename);
+
+    // copy wisdom so the lock is not held while writing the file
+    FFT(_wisdom_lock)();
+    unsigned int num_entries = FFT(_wisdom_len);
+    struct FFT(_wisdom_s) * entries = (struct FFT(_wisdom_s) *)
+        malloc((num_entries > 0 ? num_entries : 1)*sizeof(struct FFT(_wisdom_s)));
+    if (entries != NULL && num_entries > 0)
+        memmove(entries, FFT(_wisdom_table), num_entries*sizeof(struct FFT(_wisdom_s)));
+    FFT(_wisdom_unlock)();
+    if (entries == NULL) {
+        fclose(fid);
+        return liquid_error(LIQUID_EIMEM,"fft_wisdom_export(), could not allocate memory");
+    }
+
+    fprintf(fid,"# liquid-dsp fft wisdom : <nfft> <method> [<factor>] [threads]\n");
+    fprintf(fid,"liquid-fft-wisdom 2 %u\n", (unsigned int)sizeof(T));
+    unsigned int i;
+    for (i=0; i<num_entries; i++) {
+        struct FFT(_wisdom_s) * w = &entries[i];
+        fprintf(fid,"%u %s", w->nfft, FFT(_wisdom_method_str)[w->method]);
+        if (w->method == LIQUID_FFT_METHOD_MIXED_RADIX)
+            fprintf(fid," %u", w->factor);
+        fprintf(fid,"%s\n", w->threads ? " threads" : "");
+    }
+    fclose(fid);
+    free(entries);
+    return LIQUID_OK;
+}
+
+// import planner wisdom from file, merging with existing wisdom
+int FFT(_wisdom_import)(const char * _filename)
+{
+    FILE * fid = fopen(_filename,"r");
+    if (fid == NULL)
+        return liquid_error(LIQUID_EIO,"fft_wisdom_import(), could not open '%s' for reading",_filename);
+
+    // parse all entries before merging so that a malformed file leaves
+    // existing wisdom untouched
+    struct FFT(_wisdom_s) * entries = NULL;
+    unsigned int num_entries = 0;
+    int header_found = 0;
+    unsigned int version = 0;
+    int rc = LIQUID_OK;
+    char line[256];
+    unsigned int line_num = 0;
+    while (fgets(line, sizeof(line), fid) != NULL) {
+        line_num++;
+
+        // skip comments and empty lines
+        char * s = line;
+        while (*s == ' ' || *s == '\t') s++;
+        if (*s == '#' || *s == '\n' || *s == '\r' || *s == '\0')
+            continue;
+
+        // check header for version and sample size
+        if (!header_found) {
+            // version 1 has no thread flag
+            unsigned int size;
+            if (sscanf(s, "liquid-fft-wisdom %u %u", &version, &size) != 2 || version < 1 || version > 2) {
+                rc = liquid_error(LIQUID_EIVAL,"fft_wisdom_import(), '%s' is not a wisdom file",_filename);
+                break;
+            }
+            if (size != sizeof(T)) {
+                rc = liquid_error(LIQUID_EIVAL,"fft_wisdom_import(), '%s' has wisdom for %u-byte samples",_filename,size);
+                break;
+            }
+            header_found = 1;
+            continue;
+        }
+
+        // parse entry: size, method, then optional factor and thread flag
+        unsigned int nfft, factor = 0;
+        int threads = 0, valid = 1, pos = 0;
+        char name[32], token[32];
+        int n = sscanf(s, "%u %31s%n", &nfft, name, &pos);
+        liquid_fft_method method = LIQUID_FFT_METHOD_UNKNOWN;
+        unsigned int i;
+        for (i=1; n >= 2 && i<FFT_WISDOM_NUM_METHODS; i++) {
+            if (strcmp(name, FFT(_wisdom_method_str)[i]) == 0)
+                method = (liquid_fft_method)i;
+        }
+        char * r = s + pos;
+        int k = 0;
+        while (n >= 2 && valid && sscanf(r, "%31s%n", token, &k) == 1) {
+            if (token[0] >= '0' && token[0] <= '9' && factor == 0 && !threads)
+                valid = sscanf(token, "%u", &factor) == 1;
+            else if (strcmp(token, "threads") == 0 && version >= 2 && !threads)
+                threads = 1;
+            else
+                valid = 0;
+            r += k;
+        }
+        if (factor != 0 && method != LIQUID_FFT_METHOD_MIXED_RADIX)
+            valid = 0;
+        if (!valid || !FFT(_planner_is_valid)(nfft, method, factor)) {
+            rc = liquid_error(LIQUID_EIVAL,"fft_wisdom_import(), '%s' line %u: invalid entry",_filename,line_num);
+            break;
+        }
+        entries = (struct FFT(_wisdom_s) *) realloc(entries, (num_entries+1)*sizeof(struct FFT(_wisdom_s)));
+        entries[num_entries].nfft    = nfft;
+        entries[num_entries].threads = threads;
+        entries[num_entries].method  = method;
+        entries[num_entries].factor  = factor;
+        num_entries++;
+    }
+    fclose(fid);
+    if (rc == LIQUID_OK && !header_found)
+        rc = liquid_error(LIQUID_EIVAL,"fft_wisdom_import(), '%s' is not a wisdom file",_filename);
+
+    // merge entries
+    unsigned int i;
+    FFT(_wisdom_lock)();
+    for (i=0; rc == LIQUID_OK && i<num_entries; i++)
+        rc = FFT(_wisdom_add)(entries[i].nfft, entries[i].threads, entries[i].method, entries[i].factor);
+    FFT(_wisdom_unlock)();
+    free(entries);
+    return rc;
+}
+
+// forget all planner wisdom
+int FFT(_wisdom_clear)(void)
+{
+    FFT(_wisdom_lock)();
+    free(FFT(_wisdom_table));
+    FFT(_wisdom_table) = NULL;
+    FFT(_wisdom_len)   = 0;
+    FFT(_wisdom_unlock)();
+    return LIQUID_OK;
+}
@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_pruned.c : transforms of zero-padded inputs or with only some of
+//                the outputs required (pruned transforms)
+//
+// When only the first L input samples of a transform of size N = P*M are
+// non-zero (M >= L), writing the output index as k = P*q + p gives
+//   X[P*q + p] = sum_{n<L} (x[n] W^(n*p)) W_M^(n*q),   W = exp(-/+ j 2 pi / N)
+// i.e. P transforms of size M on twiddled copies of the input, computed
+// together as a batch (interleaved so that their outputs land in order).
+// Conversely when only L outputs are needed, writing the input index as
+// n = P*m + p gives
+//   X[k] = sum_{p<P} W^(p*k) Y_p[k mod M],   Y_p = DFT_M{ x[P*m + p] }
+// so that P transforms of size M are followed by P multiply-accumulates
+// for each required output. Either way the butterflies of the first (or
+// last) log2(P) stages that would only operate on zeros (or compute unused
+// outputs) are skipped, reducing the cost from about N log2(N) to
+// N log2(M) + P*L. The factor P is chosen to minimize this cost; when
+// pruning saves nothing (e.g. half of the input is zero) a regular
+// transform is used instead.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "liquid.internal.h"
+
+// relative cost of each twiddle multiply-accumulate, in units of one
+// sample of one radix-2 stage of a regular transform (measured: twiddles
+// are applied one sample at a time while stages run across SIMD lanes)
+#define FFT_PRUNED_TWIDDLE_COST     (8.0)
+
+// find factor P of _nfft minimizing cost of pruned transform when only
+// _len input samples are non-zero (or _len outputs are required),
+// returning estimated cost and setting _factor to 1 if pruning does not
+// reduce the cost of a regular transform; for powers of two the factor
+// is a multiple of four so that sub-transforms run as radix-4 batches
+static double FFT(_pruned_cost)(unsigned int   _nfft,
+                                unsigned int   _len,
+                                unsigned int * _factor)
+{
+    double cost = (double)_nfft * log2((double)_nfft);
+    *_factor = 1;
+    unsigned int p;
+    for (p=2; p<=_nfft/_len && p<=_nfft/2; p++) {
+        if ((_nfft % p) || (fft_is_radix2(_nfft) && (p % 4)))
+            continue;
+        double c = (double)_nfft * log2((double)(_nfft/p)) +
+                   FFT_PRUNED_TWIDDLE_COST * (double)_len * (double)p;
+        if (c < cost) {
+            cost     = c;
+            *_factor = p;
+        }
+    }
+    return cost;
+}
+
+// create FFT plan for pruned transform
+//  _nfft       :   FFT size, _nfft > 0
+//  _x          :   input array [size: _nfft x 1]
+//  _y          :   output array [size: _nfft x 1]
+//  _dir        :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags      :   fft flags
+//  _num_in     :   number of non-zero input samples, in [1, _nfft]
+//  _out_offset :   index of first required output, less than _nfft
+//  _num_out    :   number of required outputs, in [1, _nfft]
+FFT(plan) FFT(_create_plan_pruned)(unsigned int _nfft,
+                                   TC *         _x,
+                                   TC *         _y,
+                                   int          _dir,
+                                   int          _flags,
+                                   unsigned int _num_in,
+                                   unsigned int _out_offset,
+                                   unsigned int _num_out)
+{
+    // validate input
+    if (_nfft == 0)
+        return liquid_error_config("fft_create_plan_pruned(), fft size must be greater than zero");
+    if (_num_in == 0 || _num_in > _nfft)
+        return liquid_error_config("fft_create_plan_pruned(), number of input samples (%u) must be in [1,%u]", _num_in, _nfft);
+    if (_num_out == 0 || _num_out > _nfft)
+        return liquid_error_config("fft_create_plan_pruned(), number of outputs (%u) must be in [1,%u]", _num_out, _nfft);
+    if (_out_offset >= _nfft)
+        return liquid_error_config("fft_create_plan_pruned(), output offset (%u) must be less than %u", _out_offset, _nfft);
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_PRUNED;
+
+    q->execute   = FFT(_execute_pruned);
+
+    q->data.pruned.num_in     = _num_in;
+    q->data.pruned.out_offset = _out_offset;
+    q->data.pruned.num_out    = _num_out;
+    q->data.pruned.buf        = NULL;
+    q->data.pruned.buf_work   = NULL;
+    q->data.pruned.twiddle    = NULL;
+    q->data.pruned.twiddle_M  = NULL;
+    q->data.pruned.fft        = NULL;
+
+    // prune whichever side reduces the cost the most
+    unsigned int p_in, p_out;
+    double cost_in  = FFT(_pruned_cost)(_nfft, _num_in,  &p_in);
+    double cost_out = FFT(_pruned_cost)(_nfft, _num_out, &p_out);
+    q->data.pruned.p_in  = cost_in <= cost_out ? p_in  : 1;
+    q->data.pruned.p_out = cost_in <= cost_out ? 1     : p_out;
+
+    // create batch of sub-transforms; sub-transforms of size M = nfft/P
+    // are interleaved (element m of transform p at index P*m + p), which
+    // for powers of two is the same as starting radix-4 stages at stride P
+    unsigned int P = q->data.pruned.p_in * q->data.pruned.p_out;
+    unsigned int M = _nfft / P;
+    if (P == 1) {
+        // pruning saves nothing: regular transform
+        q->data.pruned.fft = FFT(_create_plan)(_nfft, q->x, q->y, q->direction, _flags);
+        return q;
+    }
+    if (fft_is_radix2(_nfft) && (P % 4) == 0) {
+        q->data.pruned.twiddle_M = FFT(_cache_radix4)(M, q->direction);
+        q->data.pruned.buf_work  = (TC *) malloc(_nfft * sizeof(TC));
+    } else {
+        q->data.pruned.fft = FFT(_create_plan_many)(M, P, q->x, P, 1, q->y, P, 1,
+                                                    q->direction, _flags);
+    }
+
+    // buffer for twiddled copies of input (samples beyond the input
+    // length remain zero) or for outputs of sub-transforms
+    q->data.pruned.buf = (TC *) malloc(_nfft * sizeof(TC));
+    memset(q->data.pruned.buf, 0x00, _nfft * sizeof(TC));
+    q->data.pruned.twiddle = FFT(_cache_twiddle)(_nfft, q->direction);
+
+    return q;
+}
+
+// destroy FFT plan
+int FFT(_destroy_plan_pruned)(FFT(plan) _q)
+{
+    // free data specific to pruned transforms
+    if (_q->data.pruned.fft != NULL)
+        FFT(_destroy_plan)(_q->data.pruned.fft);
+    if (_q->data.pruned.twiddle != NULL)
+        FFT(_cache_release)(_q->data.pruned.twiddle);
+    if (_q->data.pruned.twiddle_M != NULL)
+        FFT(_cache_release)(_q->data.pruned.twiddle_M);
+    free(_q->data.pruned.buf);
+    free(_q->data.pruned.buf_work);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// run batch of interleaved sub-transforms
+static int FFT(_pruned_batch)(FFT(plan) _q,
+                              TC *      _x,
+                              TC *      _y)
+{
+    if (_q->data.pruned.fft != NULL)
+        return FFT(_execute_arrays)(_q->data.pruned.fft, _x, _y);
+
+    unsigned int P = _q->data.pruned.p_in * _q->data.pruned.p_out;
+    FFT_RADIX4(_execute)(_q->nfft / P,
+                         P,
+                         _q->data.pruned.twiddle_M,
+                         _q->direction,
+                         _x,
+                         _y,
+                         _q->data.pruned.buf_work);
+    return LIQUID_OK;
+}
+
+// execute pruned FFT
+int FFT(_execute_pruned)(FFT(plan) _q)
+{
+    unsigned int nfft    = _q->nfft;
+    TC *         twiddle = _q->data.pruned.twiddle;
+    TC *         buf     = _q->data.pruned.buf;
+    unsigned int i, n, p, k, kk, t;
+
+    if (_q->data.pruned.p_in > 1) {
+        // twiddle non-zero input samples: buf[P*n + p] = x[n] W^(n*p)
+        unsigned int P = _q->data.pruned.p_in;
+        for (n=0; n<_q->data.pruned.num_in; n++) {
+            TC v = _q->x[n];
+            T  vr = REAL(v), vi = IMAG(v);
+            buf[P*n] = v;
+            for (p=1, t=n; p<P; p++) {
+                T wr = REAL(twiddle[t]), wi = IMAG(twiddle[t]);
+                buf[P*n + p] = (vr*wr - vi*wi) + _Complex_I*(vr*wi + vi*wr);
+                t += n;
+                if (t >= nfft) t -= nfft;
+            }
+        }
+
+        // run sub-transforms, writing output in order
+        return FFT(_pruned_batch)(_q, buf, _q->y);
+    }
+
+    if (_q->data.pruned.p_out > 1) {
+        // run sub-transforms on decimated input: buf[P*k + p] = Y_p[k]
+        unsigned int P = _q->data.pruned.p_out;
+        unsigned int M = nfft / P;
+        FFT(_pruned_batch)(_q, _q->x, buf);
+
+        // combine sub-transforms for required outputs only
+        k  = _q->data.pruned.out_offset;
+        kk = k % M;
+        for (i=0; i<_q->data.pruned.num_out; i++) {
+            TC * u = buf + P*kk;
+            T yr = REAL(u[0]), yi = IMAG(u[0]);
+            for (p=1, t=k; p<P; p++) {
+                T ur = REAL(u[p]),       ui = IMAG(u[p]);
+                T wr = REAL(twiddle[t]), wi = IMAG(twiddle[t]);
+                yr += ur*wr - ui*wi;
+                yi += ur*wi + ui*wr;
+                t += k;
+                if (t >= nfft) t -= nfft;
+            }
+            _q->y[k] = yr + _Complex_I*yi;
+
+            // advance output index
+            if (++k  == nfft) k  = 0;
+            if (++kk == M)    kk = 0;
+        }
+        return LIQUID_OK;
+    }
+
+    // regular transform
+    return FFT(_execute_arrays)(_q->data.pruned.fft, _q->x, _q->y);
+}
@@ -23,9 +23,24 @@
 //
 // fft_r2r_1d.c : real-to-real methods (DCT/DST)
 //
+// Each transform is computed with an FFT and O(n) pre/post-processing:
+//  - DCT-I, DST-I   : real-input transform of the even/odd extension of
+//                     the input, of size 2(n-1) and 2(n+1) respectively
+//  - DCT-II, DST-II : real-input transform of size n on the permuted
+//                     input { x[0], x[2], ..., x[3], x[1] }, followed by
+//                     post-twiddle exp(-j pi k / 2n)
+//  - DCT-III,DST-III: inverse of the above using a real-output transform
+//  - DCT-IV, DST-IV : complex transform of size n/2 with pre-twiddle
+//                     exp(-j pi (j+1/4) / n) and post-twiddle
+//                     exp(-j pi k / n), or of size 2n for odd n
+// The sine transforms are obtained from the cosine transforms of the
+// same kind by reversing the input (types III and IV) or alternating its
+// sign (type II), and alternating the sign of (or reversing) the output.
+//
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include "liquid.internal.h"
 
@@ -34,13 +49,17 @@
 //  _x      :   input array [size: _nfft x 1]
 //  _y      :   output array [size: _nfft x 1]
 //  _type   :   type (e.g. LIQUID_FFT_REDFT00)
-//  _method :   fft method
+//  _flags  :   planner flags, e.g. LIQUID_FFT_MEASURE
 FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _nfft,
                                    T *          _x,
                                    T *          _y,
                                    int          _type,
                                    int          _flags)
 {
+    // validate input
+    if (_nfft == 0)
+        return liquid_error_config("fft_create_plan_r2r_1d(), transform size must be greater than zero");
+
     // allocate plan and initialize all internal arrays to NULL
     FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
 
@@ -49,10 +68,16 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _nfft,
     q->yr     = _y;
     q->type   = _type;
     q->flags  = _flags;
+    q->data.r2r.xp      = NULL;
+    q->data.r2r.Xp      = NULL;
+    q->data.r2r.twiddle = NULL;
+    q->data.r2r.fft     = NULL;
 
     // TODO : use separate 'method' for real-to-real types
     //q->method = LIQUID_FFT_METHOD_NONE;
 
+    unsigned int n = q->nfft;
+    unsigned int i;
     switch (q->type) {
     case LIQUID_FFT_REDFT00:  q->execute = &FFT(_execute_REDFT00);  break;  // DCT-I
     case LIQUID_FFT_REDFT10:  q->execute = &FFT(_execute_REDFT10);  break;  // DCT-II
@@ -64,7 +89,70 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _nfft,
     case LIQUID_FFT_RODFT01:  q->execute = &FFT(_execute_RODFT01);  break;  // DST-III
     case LIQUID_FFT_RODFT11:  q->execute = &FFT(_execute_RODFT11);  break;  // DST-IV
     default:
-        return liquid_error_config("fft_create_plan_r2r_1d(), invalid type, %d", q->type);
+        free(q);
+        return liquid_error_config("fft_create_plan_r2r_1d(), invalid type, %d", _type);
+    }
+
+    // create internal transform, buffers, and twiddle factors
+    switch (q->type) {
+    case LIQUID_FFT_REDFT00:
+    case LIQUID_FFT_RODFT00:
+        // real-input transform of even/odd extension: 2(n-1) or 2(n+1)
+        if (q->type == LIQUID_FFT_REDFT00 && n == 1)
+            break;
+        i = (q->type == LIQUID_FFT_REDFT00) ? 2*(n-1) : 2*(n+1);
+        q->data.r2r.xp  = (T *)  malloc(i * sizeof(T));
+        q->data.r2r.Xp  = (TC *) malloc((i/2+1) * sizeof(TC));
+        q->data.r2r.fft = FFT(_create_plan_r2c)(i, q->data.r2r.xp, q->data.r2r.Xp, _flags);
+        break;
+
+    case LIQUID_FFT_REDFT10:
+    case LIQUID_FFT_RODFT10:
+    case LIQUID_FFT_REDFT01:
+    case LIQUID_FFT_RODFT01:
+        // real-input (type II) or real-output (type III) transform of
+        // size n; twiddle factors exp(-j pi k / 2n), k in [0, n/2]
+        q->data.r2r.xp = (T *)  malloc(n * sizeof(T));
+        q->data.r2r.Xp = (TC *) malloc((n/2+1) * sizeof(TC));
+        q->data.r2r.twiddle = (TC *) malloc((n/2+1) * sizeof(TC));
+        for (i=0; i<=n/2; i++)
+            q->data.r2r.twiddle[i] = (TC) cexp(-_Complex_I*M_PI*(double)i / (double)(2*n));
+        if (q->type == LIQUID_FFT_REDFT10 || q->type == LIQUID_FFT_RODFT10)
+            q->data.r2r.fft = FFT(_create_plan_r2c)(n, q->data.r2r.xp, q->data.r2r.Xp, _flags);
+        else
+            q->data.r2r.fft = FFT(_create_plan_c2r)(n, q->data.r2r.Xp, q->data.r2r.xp, _flags);
+        break;
+
+    case LIQUID_FFT_REDFT11:
+    case LIQUID_FFT_RODFT11:
+        if (n % 2 == 0) {
+            // complex transform of size n/2: pre-twiddle exp(-j pi (j+1/4)/n)
+            // followed by post-twiddle exp(-j pi k / n)
+            unsigned int m = n/2;
+            q->data.r2r.Xp      = (TC *) malloc(2*m * sizeof(TC));
+            q->data.r2r.twiddle = (TC *) malloc(2*m * sizeof(TC));
+            for (i=0; i<m; i++) {
+                q->data.r2r.twiddle[  i] = (TC) cexp(-_Complex_I*M_PI*((double)i + 0.25) / (double)n);
+                q->data.r2r.twiddle[m+i] = (TC) cexp(-_Complex_I*M_PI*(double)i / (double)n);
+            }
+            q->data.r2r.fft = FFT(_create_plan)(m, q->data.r2r.Xp, q->data.r2r.Xp + m,
+                                                LIQUID_FFT_FORWARD, _flags);
+        } else {
+            // complex transform of size 2n of zero-padded input: pre-twiddle
+            // exp(-j pi i / 2n) followed by post-twiddle exp(-j pi (k+1/2) / 2n)
+            q->data.r2r.Xp      = (TC *) malloc(4*n * sizeof(TC));
+            q->data.r2r.twiddle = (TC *) malloc(2*n * sizeof(TC));
+            for (i=0; i<n; i++) {
+                q->data.r2r.twiddle[  i] = (TC) cexp(-_Complex_I*M_PI*(double)i / (double)(2*n));
+                q->data.r2r.twiddle[n+i] = (TC) cexp(-_Complex_I*M_PI*((double)i + 0.5) / (double)(2*n));
+            }
+            for (i=0; i<2*n; i++)
+                q->data.r2r.Xp[i] = 0;
+            q->data.r2r.fft = FFT(_create_plan)(2*n, q->data.r2r.Xp, q->data.r2r.Xp + 2*n,
+                                                LIQUID_FFT_FORWARD, _flags);
+        }
+        break;
+    default:;
     }
 
     return q;
@@ -73,6 +161,13 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _nfft,
 // destroy real-to-real transform plan
 int FFT(_destroy_plan_r2r_1d)(FFT(plan) _q)
 {
+    // destroy internal transform and free buffers
+    if (_q->data.r2r.fft != NULL)
+        FFT(_destroy_plan)(_q->data.r2r.fft);
+    free(_q->data.r2r.xp);
+    free(_q->data.r2r.Xp);
+    free(_q->data.r2r.twiddle);
+
     // free main object memory
     free(_q);
     return LIQUID_OK;
@@ -81,97 +176,211 @@ int FFT(_destroy_plan_r2r_1d)(FFT(plan) _q)
 // print real-to-real transform plan
 int FFT(_print_plan_r2r_1d)(FFT(plan) _q)
 {
-    printf("real-to-real transform...\n");
-    // TODO: print actual transform type
+    const char * name = "";
+    switch (_q->type) {
+    case LIQUID_FFT_REDFT00: name = "DCT-I";    break;
+    case LIQUID_FFT_REDFT10: name = "DCT-II";   break;
+    case LIQUID_FFT_REDFT01: name = "DCT-III";  break;
+    case LIQUID_FFT_REDFT11: name = "DCT-IV";   break;
+    case LIQUID_FFT_RODFT00: name = "DST-I";    break;
+    case LIQUID_FFT_RODFT10: name = "DST-II";   break;
+    case LIQUID_FFT_RODFT01: name = "DST-III";  break;
+    case LIQUID_FFT_RODFT11: name = "DST-IV";   break;
+    default:;
+    }
+    printf("real-to-real transform [%s], n=%u\n", name, _q->nfft);
+    if (_q->data.r2r.fft != NULL)
+        FFT(_print_plan)(_q->data.r2r.fft);
     return LIQUID_OK;
 }
 
 //
-// DCT : Discrete Cosine Transforms
+// internal methods shared between cosine and sine transforms
 //
 
-// DCT-I
-int FFT(_execute_REDFT00)(FFT(plan) _q)
+// type-I transform of size n from real-input transform of size 2(n-1)
+// (DCT-I, even extension) or 2(n+1) (DST-I, odd extension)
+static int FFT(_execute_r2r_type1)(FFT(plan) _q,
+                                   int       _dst)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)(_q->nfft-1);
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        T x0 = _q->xr[0];       // first element
-        T xn = _q->xr[_q->nfft-1]; // last element
-        _q->yr[i] = 0.5f*( x0 + (i%2 ? -xn : xn));
-        for (k=1; k<_q->nfft-1; k++) {
-            phi = M_PI*n_inv*((float)k)*((float)i);
-            _q->yr[i] += _q->xr[k]*cosf(phi);
-        }
+    unsigned int n = _q->nfft;
+    T *  x  = _q->xr;
+    T *  xp = _q->data.r2r.xp;
+    TC * Xp = _q->data.r2r.Xp;
+    unsigned int i;
 
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
+    if (!_dst) {
+        if (n == 1) {
+            _q->yr[0] = 2*x[0];
+            return LIQUID_OK;
+        }
+        // { x[0], ..., x[n-1], x[n-2], ..., x[1] }
+        for (i=0; i<n; i++)
+            xp[i] = x[i];
+        for (i=1; i<n-1; i++)
+            xp[2*(n-1)-i] = x[i];
+        FFT(_execute)(_q->data.r2r.fft);
+        for (i=0; i<n; i++)
+            _q->yr[i] = REAL(Xp[i]);
+    } else {
+        // { 0, x[0], ..., x[n-1], 0, -x[n-1], ..., -x[0] }
+        xp[0]   = 0;
+        xp[n+1] = 0;
+        for (i=0; i<n; i++) {
+            xp[i+1]       =  x[i];
+            xp[2*n+1 - i] = -x[i];
+        }
+        FFT(_execute)(_q->data.r2r.fft);
+        for (i=0; i<n; i++)
+            _q->yr[i] = -IMAG(Xp[i+1]);
     }
     return LIQUID_OK;
 }
 
-// DCT-II (regular 'dct')
-int FFT(_execute_REDFT10)(FFT(plan) _q)
+// type-II transform: permute input, run real-input transform of size n,
+// and apply post-twiddle; Y[k] = 2 Re{w[k] V[k]}, Y[n-k] = -2 Im{w[k] V[k]}
+//  _dst    :   alternate sign of input and reverse output (DST-II)
+static int FFT(_execute_r2r_type2)(FFT(plan) _q,
+                                   int       _dst)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)_q->nfft;
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        _q->yr[i] = 0.0f;
-        for (k=0; k<_q->nfft; k++) {
-            phi = M_PI*n_inv*((float)k + 0.5f)*i;
-            _q->yr[i] += _q->xr[k]*cosf(phi);
-        }
+    unsigned int n = _q->nfft;
+    T *  x  = _q->xr;
+    T *  y  = _q->yr;
+    T *  xp = _q->data.r2r.xp;
+    TC * Xp = _q->data.r2r.Xp;
+    TC * w  = _q->data.r2r.twiddle;
+    unsigned int i;
+
+    // permute input: even samples ascending, odd samples descending
+    T g = _dst ? -1 : 1;
+    for (i=0; 2*i<n; i++)
+        xp[i] = x[2*i];
+    for (i=0; 2*i+1<n; i++)
+        xp[n-1-i] = g*x[2*i+1];
+
+    FFT(_execute)(_q->data.r2r.fft);
 
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
+    // post-twiddle; reverse output index for DST-II
+    unsigned int r = _dst ? n-1 : 0;
+    y[r] = 2*REAL(Xp[0]);
+    for (i=1; 2*i<=n; i++) {
+        TC u = Xp[i]*w[i];
+        y[_dst ? r-i : i] = 2*REAL(u);
+        if (2*i != n)
+            y[_dst ? i-1 : n-i] = -2*IMAG(u);
     }
     return LIQUID_OK;
 }
 
-// DCT-III (regular 'idct')
-int FFT(_execute_REDFT01)(FFT(plan) _q)
+// type-III transform: apply pre-twiddle, run real-output transform of
+// size n, and unpermute; V[k] = conj(w[k]) (X[k] - j X[n-k]), X[n] = 0
+//  _dst    :   reverse input and alternate sign of output (DST-III)
+static int FFT(_execute_r2r_type3)(FFT(plan) _q,
+                                   int       _dst)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)_q->nfft;
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        _q->yr[i] = _q->xr[0]*0.5f;
-        for (k=1; k<_q->nfft; k++) {
-            phi = M_PI*n_inv*((float)i + 0.5f)*k;
-            _q->yr[i] += _q->xr[k]*cosf(phi);
-        }
+    unsigned int n = _q->nfft;
+    T *  x  = _q->xr;
+    T *  y  = _q->yr;
+    T *  xp = _q->data.r2r.xp;
+    TC * Xp = _q->data.r2r.Xp;
+    TC * w  = _q->data.r2r.twiddle;
+    unsigned int i;
 
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
+    // pre-twiddle; reverse input index for DST-III
+    for (i=0; 2*i<=n; i++) {
+        T a = _dst ? x[n-1-i] : x[i];
+        T b = (i == 0) ? 0 : (_dst ? x[i-1] : x[n-i]);
+        Xp[i] = CONJ(w[i]) * (a - _Complex_I*b);
     }
+
+    FFT(_execute)(_q->data.r2r.fft);
+
+    // unpermute output: even samples ascending, odd samples descending
+    T g = _dst ? -1 : 1;
+    for (i=0; 2*i<n; i++)
+        y[2*i] = xp[i];
+    for (i=0; 2*i+1<n; i++)
+        y[2*i+1] = g*xp[n-1-i];
     return LIQUID_OK;
 }
 
-// DCT-IV
-int FFT(_execute_REDFT11)(FFT(plan) _q)
+// type-IV transform using complex transform of size n/2 (n even) or 2n
+// (n odd) with pre/post-twiddle
+//  _dst    :   reverse input and alternate sign of output (DST-IV)
+static int FFT(_execute_r2r_type4)(FFT(plan) _q,
+                                   int       _dst)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)(_q->nfft);
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        _q->yr[i] = 0.0f;
-        for (k=0; k<_q->nfft; k++) {
-            phi = M_PI*n_inv*((float)k+0.5f)*((float)i+0.5f);
-            _q->yr[i] += _q->xr[k]*cosf(phi);
+    unsigned int n = _q->nfft;
+    T *  x  = _q->xr;
+    T *  y  = _q->yr;
+    TC * w  = _q->data.r2r.twiddle;
+    unsigned int i;
+
+    if (n % 2 == 0) {
+        // t[i] = (x[2i] + j x[n-1-2i]) w_pre[i]
+        unsigned int m = n/2;
+        TC * t = _q->data.r2r.Xp;
+        TC * v = _q->data.r2r.Xp + m;
+        for (i=0; i<m; i++) {
+            T a = _dst ? x[n-1-2*i] : x[2*i];
+            T b = _dst ? x[2*i]     : x[n-1-2*i];
+            t[i] = (a + _Complex_I*b) * w[i];
         }
+        FFT(_execute)(_q->data.r2r.fft);
 
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
+        // y[2k] = 2 Re{u[k]}, y[n-1-2k] = -2 Im{u[k]}, u[k] = v[k] w_post[k];
+        // output index n-1-2k is odd so its sign alternates for DST-IV
+        T g = _dst ? 1 : -1;
+        for (i=0; i<m; i++) {
+            TC u = v[i] * w[m+i];
+            y[2*i]       = 2*REAL(u);
+            y[n-1-2*i]   = 2*g*IMAG(u);
+        }
+    } else {
+        // zero-padded input t[i] = x[i] w_pre[i] (upper half remains zero)
+        TC * t = _q->data.r2r.Xp;
+        TC * v = _q->data.r2r.Xp + 2*n;
+        for (i=0; i<n; i++)
+            t[i] = (_dst ? x[n-1-i] : x[i]) * w[i];
+        FFT(_execute)(_q->data.r2r.fft);
+
+        // y[k] = 2 Re{v[k] w_post[k]}
+        for (i=0; i<n; i++) {
+            T g = (_dst && (i % 2)) ? -2 : 2;
+            y[i] = g * REAL(v[i] * w[n+i]);
+        }
     }
     return LIQUID_OK;
 }
 
+//
+// DCT : Discrete Cosine Transforms
+//
+
+// DCT-I
+int FFT(_execute_REDFT00)(FFT(plan) _q)
+{
+    return FFT(_execute_r2r_type1)(_q, 0);
+}
+
+// DCT-II (regular 'dct')
+int FFT(_execute_REDFT10)(FFT(plan) _q)
+{
+    return FFT(_execute_r2r_type2)(_q, 0);
+}
+
+// DCT-III (regular 'idct')
+int FFT(_execute_REDFT01)(FFT(plan) _q)
+{
+    return FFT(_execute_r2r_type3)(_q, 0);
+}
+
+// DCT-IV
+int FFT(_execute_REDFT11)(FFT(plan) _q)
+{
+    return FFT(_execute_r2r_type4)(_q, 0);
+}
+
 //
 // DST : Discrete Sine Transforms
 //
@@ -179,80 +388,24 @@ int FFT(_execute_REDFT11)(FFT(plan) _q)
 // DST-I
 int FFT(_execute_RODFT00)(FFT(plan) _q)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)(_q->nfft+1);
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        _q->yr[i] = 0.0f;
-        for (k=0; k<_q->nfft; k++) {
-            phi = M_PI*n_inv*(float)((k+1)*(i+1));
-            _q->yr[i] += _q->xr[k]*sinf(phi);
-        }
-
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
-    }
-    return LIQUID_OK;
+    return FFT(_execute_r2r_type1)(_q, 1);
 }
 
 // DST-II
 int FFT(_execute_RODFT10)(FFT(plan) _q)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)(_q->nfft);
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        _q->yr[i] = 0.0f;
-        for (k=0; k<_q->nfft; k++) {
-            phi = M_PI*n_inv*((float)k+0.5f)*(i+1);
-            _q->yr[i] += _q->xr[k]*sinf(phi);
-        }
-
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
-    }
-    return LIQUID_OK;
+    return FFT(_execute_r2r_type2)(_q, 1);
 }
 
 // DST-III
 int FFT(_execute_RODFT01)(FFT(plan) _q)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)(_q->nfft);
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        _q->yr[i] = ((i%2)==0 ? 0.5f : -0.5f) * _q->xr[_q->nfft-1];
-        for (k=0; k<_q->nfft-1; k++) {
-            phi = M_PI*n_inv*((float)k+1)*((float)i+0.5f);
-            _q->yr[i] += _q->xr[k]*sinf(phi);
-        }
-
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
-    }
-    return LIQUID_OK;
+    return FFT(_execute_r2r_type3)(_q, 1);
 }
 
 // DST-IV
 int FFT(_execute_RODFT11)(FFT(plan) _q)
 {
-    // ugly, slow method
-    unsigned int i,k;
-    float n_inv = 1.0f / (float)(_q->nfft);
-    float phi;
-    for (i=0; i<_q->nfft; i++) {
-        _q->yr[i] = 0.0f;
-        for (k=0; k<_q->nfft; k++) {
-            phi = M_PI*n_inv*((float)k+0.5f)*((float)i+0.5f);
-            _q->yr[i] += _q->xr[k]*sinf(phi);
-        }
-
-        // compensate for discrepancy
-        _q->yr[i] *= 2.0f;
-    }
-    return LIQUID_OK;
+    return FFT(_execute_r2r_type4)(_q, 1);
 }
 
@@ -81,27 +81,26 @@ FFT(plan) FFT(_create_plan_rader)(unsigned int _nfft,
                                            LIQUID_FFT_BACKWARD,
                                            q->flags);
 
-    // compute primitive root of nfft
-    unsigned int g = liquid_primitive_root_prime(q->nfft);
+    // create and initialize sequence (shared)
+    q->data.rader.seq = FFT(_cache_rader_seq)(q->nfft);
 
-    // create and initialize sequence
-    q->data.rader.seq = (unsigned int *)malloc((q->nfft-1)*sizeof(unsigned int));
-    unsigned int i;
-    for (i=0; i<q->nfft-1; i++)
-        q->data.rader.seq[i] = liquid_modpow(g, i+1, q->nfft);
-    
     // compute DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft-1
     // NOTE: R[0] = -1, |R[k]| = sqrt(nfft) for k != 0
-    // (use newly-created FFT plan of length nfft-1)
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft-1; i++)
-        q->data.rader.x_prime[i] = cexpf(_Complex_I*d*2*M_PI*q->data.rader.seq[i]/(T)(q->nfft));
-    FFT(_execute)(q->data.rader.fft);
-
-    // copy result to R
-    q->data.rader.R = (TC*)malloc((q->nfft-1)*sizeof(TC));
-    memmove(q->data.rader.R, q->data.rader.X_prime, (q->nfft-1)*sizeof(TC));
-    
+    // (use newly-created FFT plan of length nfft-1; shared)
+    q->data.rader.R = (TC *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_RADER_R, q->nfft, q->direction, 0);
+    if (q->data.rader.R == NULL) {
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        unsigned int i;
+        for (i=0; i<q->nfft-1; i++)
+            q->data.rader.x_prime[i] = CEXP(_Complex_I*d*2*M_PI*q->data.rader.seq[i]/(T)(q->nfft));
+        FFT(_execute)(q->data.rader.fft);
+
+        // copy result to R
+        TC * R = (TC*)malloc((q->nfft-1)*sizeof(TC));
+        memmove(R, q->data.rader.X_prime, (q->nfft-1)*sizeof(TC));
+        q->data.rader.R = (TC *) FFT(_cache_insert)(LIQUID_FFT_TABLE_RADER_R, q->nfft, q->direction, 0, R);
+    }
+
     // return main object
     return q;
 }
@@ -110,8 +109,8 @@ FFT(plan) FFT(_create_plan_rader)(unsigned int _nfft,
 int FFT(_destroy_plan_rader)(FFT(plan) _q)
 {
     // free data specific to Rader's algorithm
-    free(_q->data.rader.seq);       // sequence
-    free(_q->data.rader.R);         // pre-computed transform of exp(j*2*pi*seq)
+    FFT(_cache_release)(_q->data.rader.seq);   // sequence
+    FFT(_cache_release)(_q->data.rader.R);     // pre-computed transform of exp(j*2*pi*seq)
     free(_q->data.rader.x_prime);   // sub-transform input array
     free(_q->data.rader.X_prime);   // sub-transform output array
 
@@ -64,13 +64,8 @@ FFT(plan) FFT(_create_plan_rader2)(unsigned int _nfft,
 
     unsigned int i;
 
-    // compute primitive root of nfft
-    unsigned int g = liquid_primitive_root_prime(q->nfft);
-
-    // create and initialize sequence
-    q->data.rader2.seq = (unsigned int *)malloc((q->nfft-1)*sizeof(unsigned int));
-    for (i=0; i<q->nfft-1; i++)
-        q->data.rader2.seq[i] = liquid_modpow(g, i+1, q->nfft);
+    // create and initialize sequence (shared)
+    q->data.rader2.seq = FFT(_cache_rader_seq)(q->nfft);
 
 #if 0
     // compute larger FFT length greater than 2*nfft-4
@@ -148,15 +143,19 @@ FFT(plan) FFT(_create_plan_rader2)(unsigned int _nfft,
 
     // compute DFT of sequence { exp(-j*2*pi*g^i/nfft }, size: nfft_prime
     // NOTE: R[0] = -1, |R[k]| = sqrt(nfft) for k != 0
-    // (use newly-created FFT plan of length nfft_prime)
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->data.rader2.nfft_prime; i++)
-        q->data.rader2.x_prime[i] = cexpf(_Complex_I*d*2*M_PI*q->data.rader2.seq[i%(q->nfft-1)]/(T)(q->nfft));
-    FFT(_execute)(q->data.rader2.fft);
-    
-    // copy result to R
-    q->data.rader2.R = (TC*)malloc(q->data.rader2.nfft_prime*sizeof(TC));
-    memmove(q->data.rader2.R, q->data.rader2.X_prime, q->data.rader2.nfft_prime*sizeof(TC));
+    // (use newly-created FFT plan of length nfft_prime; shared)
+    q->data.rader2.R = (TC *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_RADER2_R, q->nfft, q->direction, 0);
+    if (q->data.rader2.R == NULL) {
+        T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+        for (i=0; i<q->data.rader2.nfft_prime; i++)
+            q->data.rader2.x_prime[i] = CEXP(_Complex_I*d*2*M_PI*q->data.rader2.seq[i%(q->nfft-1)]/(T)(q->nfft));
+        FFT(_execute)(q->data.rader2.fft);
+
+        // copy result to R
+        TC * R = (TC*)malloc(q->data.rader2.nfft_prime*sizeof(TC));
+        memmove(R, q->data.rader2.X_prime, q->data.rader2.nfft_prime*sizeof(TC));
+        q->data.rader2.R = (TC *) FFT(_cache_insert)(LIQUID_FFT_TABLE_RADER2_R, q->nfft, q->direction, 0, R);
+    }
 
     // return main object
     return q;
@@ -166,8 +165,8 @@ FFT(plan) FFT(_create_plan_rader2)(unsigned int _nfft,
 int FFT(_destroy_plan_rader2)(FFT(plan) _q)
 {
     // free data specific to Rader's algorithm
-    free(_q->data.rader2.seq);      // sequence
-    free(_q->data.rader2.R);        // pre-computed transform of exp(j*2*pi*seq)
+    FFT(_cache_release)(_q->data.rader2.seq);  // sequence
+    FFT(_cache_release)(_q->data.rader2.R);    // pre-computed transform of exp(j*2*pi*seq)
 
     free(_q->data.rader2.x_prime);   // sub-transform input array
     free(_q->data.rader2.X_prime);   // sub-transform output array
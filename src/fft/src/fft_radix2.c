@@ -57,17 +57,18 @@ FFT(plan) FFT(_create_plan_radix2)(unsigned int _nfft,
     // initialize twiddle factors, indices for radix-2 transforms
     q->data.radix2.m = liquid_msb_index(q->nfft) - 1;  // m = log2(nfft)
     
-    q->data.radix2.index_rev = (unsigned int *) malloc((q->nfft)*sizeof(unsigned int));
-    unsigned int i;
-    for (i=0; i<q->nfft; i++)
-        q->data.radix2.index_rev[i] = fft_reverse_index(i,q->data.radix2.m);
+    // reversed indices, shared with other plans of the same size
+    q->data.radix2.index_rev = (unsigned int *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_INDEX_REV, q->nfft, 0, 0);
+    if (q->data.radix2.index_rev == NULL) {
+        unsigned int * index_rev = (unsigned int *) malloc((q->nfft)*sizeof(unsigned int));
+        unsigned int i;
+        for (i=0; i<q->nfft; i++)
+            index_rev[i] = fft_reverse_index(i,q->data.radix2.m);
+        q->data.radix2.index_rev = (unsigned int *) FFT(_cache_insert)(LIQUID_FFT_TABLE_INDEX_REV, q->nfft, 0, 0, index_rev);
+    }
 
-    // initialize twiddle factors
-    q->data.radix2.twiddle = (TC *) malloc(q->nfft * sizeof(TC));
-    
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft; i++)
-        q->data.radix2.twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+    // initialize twiddle factors (shared)
+    q->data.radix2.twiddle = FFT(_cache_twiddle)(q->nfft, q->direction);
 
     return q;
 }
@@ -76,8 +77,8 @@ FFT(plan) FFT(_create_plan_radix2)(unsigned int _nfft,
 int FFT(_destroy_plan_radix2)(FFT(plan) _q)
 {
     // free data specific to radix-2 transforms
-    free(_q->data.radix2.index_rev);
-    free(_q->data.radix2.twiddle);
+    FFT(_cache_release)(_q->data.radix2.index_rev);
+    FFT(_cache_release)(_q->data.radix2.twiddle);
 
     // free main object memory
     free(_q);
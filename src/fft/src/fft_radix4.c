@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_radix4.c : definitions for transforms of the form 2^m using
+//                radix-4 Stockham (autosort) stages
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "liquid.internal.h"
+
+// create FFT plan for radix-4 transform
+//  _nfft   :   FFT size, power of two, at least 16
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _method :   fft method
+FFT(plan) FFT(_create_plan_radix4)(unsigned int _nfft,
+                                   TC *         _x,
+                                   TC *         _y,
+                                   int          _dir,
+                                   int          _flags)
+{
+    // validate input
+    if (!fft_is_radix2(_nfft) || _nfft < 16)
+        return liquid_error_config("fft_create_plan_radix4(), _nfft=%u must be a power of two, at least 16", _nfft);
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_RADIX4;
+
+    q->execute   = FFT(_execute_radix4);
+
+    // allocate work buffer for alternating stages
+    q->data.radix4.buf = (TC *) malloc(q->nfft * sizeof(TC));
+
+    // initialize twiddle factors for each radix-4 stage (shared)
+    q->data.radix4.twiddle = FFT(_cache_radix4)(q->nfft, q->direction);
+
+    return q;
+}
+
+// destroy FFT plan
+int FFT(_destroy_plan_radix4)(FFT(plan) _q)
+{
+    // free data specific to radix-4 transforms
+    free(_q->data.radix4.buf);
+    FFT(_cache_release)(_q->data.radix4.twiddle);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// execute radix-4 FFT
+int FFT(_execute_radix4)(FFT(plan) _q)
+{
+    FFT_RADIX4(_execute)(_q->nfft,
+                         1,
+                         _q->data.radix4.twiddle,
+                         _q->direction,
+                         _q->x,
+                         _q->y,
+                         _q->data.radix4.buf);
+    return LIQUID_OK;
+}
+
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_radix4.mmx.c : radix-4 transform stages (SSE2/SSE3)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <emmintrin.h>  // SSE2
+#include <pmmintrin.h>  // SSE3
+
+// complex multiply two pairs of interleaved values
+static inline __m128 fft_radix4_sse_cmul(__m128 _a,
+                                         __m128 _b)
+{
+    __m128 br = _mm_moveldup_ps(_b);
+    __m128 bi = _mm_movehdup_ps(_b);
+    __m128 as = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(2,3,0,1));
+    return _mm_addsub_ps(_mm_mul_ps(_a, br), _mm_mul_ps(as, bi));
+}
+
+// broadcast single complex value to both pairs
+static inline __m128 fft_radix4_sse_load1(float complex * _v)
+{
+    return _mm_castpd_ps(_mm_load1_pd((double*)_v));
+}
+
+// radix-4 butterfly on two sets of inputs; _rot holds the sign mask that
+// rotates (b-d) by -j (forward) or +j (backward) after swapping parts
+static inline void fft_radix4_sse_butterfly(__m128   _rot,
+                                            __m128 * _a,
+                                            __m128 * _b,
+                                            __m128 * _c,
+                                            __m128 * _d)
+{
+    __m128 apc = _mm_add_ps(*_a, *_c);
+    __m128 amc = _mm_sub_ps(*_a, *_c);
+    __m128 bpd = _mm_add_ps(*_b, *_d);
+    __m128 bmd = _mm_sub_ps(*_b, *_d);
+    __m128 u   = _mm_xor_ps(_mm_shuffle_ps(bmd, bmd, _MM_SHUFFLE(2,3,0,1)), _rot);
+    *_a = _mm_add_ps(apc, bpd);
+    *_b = _mm_add_ps(amc, u);
+    *_c = _mm_sub_ps(apc, bpd);
+    *_d = _mm_sub_ps(amc, u);
+}
+
+// first stage (stride 1), vectorized across butterflies and transposed
+// on output
+static void fft_radix4_sse_stage_first(unsigned int    _n,
+                                       float complex * _w,
+                                       __m128          _rot,
+                                       float complex * _x,
+                                       float complex * _y)
+{
+    unsigned int n1 = _n / 4;
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int p;
+    for (p=0; p<n1; p+=2) {
+        __m128 a = _mm_loadu_ps(&x[2*(p     )]);
+        __m128 b = _mm_loadu_ps(&x[2*(p+  n1)]);
+        __m128 c = _mm_loadu_ps(&x[2*(p+2*n1)]);
+        __m128 d = _mm_loadu_ps(&x[2*(p+3*n1)]);
+        fft_radix4_sse_butterfly(_rot, &a, &b, &c, &d);
+        b = fft_radix4_sse_cmul(b, _mm_loadu_ps((float*)&_w[     p]));
+        c = fft_radix4_sse_cmul(c, _mm_loadu_ps((float*)&_w[  n1+p]));
+        d = fft_radix4_sse_cmul(d, _mm_loadu_ps((float*)&_w[2*n1+p]));
+
+        // y[4p+k] = { a, b, c, d }[p]
+        __m128d ad = _mm_castps_pd(a), bd = _mm_castps_pd(b);
+        __m128d cd = _mm_castps_pd(c), dd = _mm_castps_pd(d);
+        _mm_storeu_ps(&y[8*p   ], _mm_castpd_ps(_mm_unpacklo_pd(ad, bd)));
+        _mm_storeu_ps(&y[8*p+ 4], _mm_castpd_ps(_mm_unpacklo_pd(cd, dd)));
+        _mm_storeu_ps(&y[8*p+ 8], _mm_castpd_ps(_mm_unpackhi_pd(ad, bd)));
+        _mm_storeu_ps(&y[8*p+12], _mm_castpd_ps(_mm_unpackhi_pd(cd, dd)));
+    }
+}
+
+// general stage with stride _s >= 2, vectorized within each butterfly group
+static void fft_radix4_sse_stage(unsigned int    _n,
+                                 unsigned int    _s,
+                                 float complex * _w,
+                                 __m128          _rot,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    unsigned int n1 = _n / 4;
+    unsigned int m  = n1 * _s;
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int p, q;
+    for (p=0; p<n1; p++) {
+        __m128 w1 = fft_radix4_sse_load1(&_w[     p]);
+        __m128 w2 = fft_radix4_sse_load1(&_w[  n1+p]);
+        __m128 w3 = fft_radix4_sse_load1(&_w[2*n1+p]);
+        for (q=0; q<_s; q+=2) {
+            unsigned int i = q + _s*p;
+            __m128 a = _mm_loadu_ps(&x[2*(i    )]);
+            __m128 b = _mm_loadu_ps(&x[2*(i+  m)]);
+            __m128 c = _mm_loadu_ps(&x[2*(i+2*m)]);
+            __m128 d = _mm_loadu_ps(&x[2*(i+3*m)]);
+            fft_radix4_sse_butterfly(_rot, &a, &b, &c, &d);
+
+            // twiddle factors are unity for final stage
+            if (n1 > 1) {
+                b = fft_radix4_sse_cmul(b, w1);
+                c = fft_radix4_sse_cmul(c, w2);
+                d = fft_radix4_sse_cmul(d, w3);
+            }
+
+            unsigned int o = q + 4*_s*p;
+            _mm_storeu_ps(&y[2*(o     )], a);
+            _mm_storeu_ps(&y[2*(o+  _s)], b);
+            _mm_storeu_ps(&y[2*(o+2*_s)], c);
+            _mm_storeu_ps(&y[2*(o+3*_s)], d);
+        }
+    }
+}
+
+// final radix-2 stage (stride nfft/2, no twiddle factors)
+static void fft_radix4_sse_stage2(unsigned int    _s,
+                                  float complex * _x,
+                                  float complex * _y)
+{
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int q;
+    for (q=0; q<2*_s; q+=4) {
+        __m128 a = _mm_loadu_ps(&x[q       ]);
+        __m128 b = _mm_loadu_ps(&x[q + 2*_s]);
+        _mm_storeu_ps(&y[q       ], _mm_add_ps(a, b));
+        _mm_storeu_ps(&y[q + 2*_s], _mm_sub_ps(a, b));
+    }
+}
+
+// execute radix-4 Stockham transform (SSE)
+void liquid_fftf_radix4_execute_sse(unsigned int    _nfft,
+                                    unsigned int    _howmany,
+                                    float complex * _twiddle,
+                                    int             _dir,
+                                    float complex * _x,
+                                    float complex * _y,
+                                    float complex * _buf)
+{
+    // sign mask for rotation by -j (forward) or +j (backward)
+    __m128 rot = (_dir == LIQUID_FFT_FORWARD) ?
+        _mm_castsi128_ps(_mm_setr_epi32(0, 0x80000000, 0, 0x80000000)) :
+        _mm_castsi128_ps(_mm_setr_epi32(0x80000000, 0, 0x80000000, 0));
+
+    // number of stages (radix-4, plus radix-2 if log2(nfft) is odd)
+    unsigned int num_stages = liquid_msb_index(_nfft) / 2;
+
+    // set first output so that last stage writes to _y
+    float complex * src = _x;
+    float complex * dst = (num_stages & 1) ? _y : _buf;
+    if (src == dst) {
+        memmove(_buf, _x, _nfft*_howmany*sizeof(float complex));
+        src = _buf;
+    }
+
+    unsigned int n = _nfft;
+    unsigned int s = _howmany;
+    float complex * w = _twiddle;
+    unsigned int k;
+    for (k=0; k<num_stages; k++) {
+        if (n == 2) {
+            fft_radix4_sse_stage2(s, src, dst);
+        } else {
+            if (s == 1) fft_radix4_sse_stage_first(n,    w, rot, src, dst);
+            else        fft_radix4_sse_stage      (n, s, w, rot, src, dst);
+            w += 3*(n/4);
+        }
+
+        // swap buffers
+        src = dst;
+        dst = (dst == _y) ? _buf : _y;
+        n /= 4;
+        s *= 4;
+    }
+}
+
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_radix4.neon.c : radix-4 transform stages (ARM Neon)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for ARM Neon
+#include <arm_neon.h>
+
+// complex multiply two pairs of interleaved values
+static inline float32x4_t fft_radix4_neon_cmul(float32x4_t _a,
+                                               float32x4_t _b)
+{
+    // { br, br }, { bi, bi } and swapped { ai, ar }
+    float32x4x2_t b  = vtrnq_f32(_b, _b);
+    float32x4_t   as = vrev64q_f32(_a);
+
+    // { ar*br - ai*bi, ai*br + ar*bi }
+    const float32x4_t sign = {-1.0f, 1.0f, -1.0f, 1.0f};
+    return vmlaq_f32(vmulq_f32(_a, b.val[0]), as, vmulq_f32(b.val[1], sign));
+}
+
+// broadcast single complex value to both pairs
+static inline float32x4_t fft_radix4_neon_load1(float complex * _v)
+{
+    float32x2_t v = vld1_f32((float*)_v);
+    return vcombine_f32(v, v);
+}
+
+// radix-4 butterfly on two sets of inputs; _rot holds the signs that
+// rotate (b-d) by -j (forward) or +j (backward) after swapping parts
+static inline void fft_radix4_neon_butterfly(float32x4_t   _rot,
+                                             float32x4_t * _a,
+                                             float32x4_t * _b,
+                                             float32x4_t * _c,
+                                             float32x4_t * _d)
+{
+    float32x4_t apc = vaddq_f32(*_a, *_c);
+    float32x4_t amc = vsubq_f32(*_a, *_c);
+    float32x4_t bpd = vaddq_f32(*_b, *_d);
+    float32x4_t bmd = vsubq_f32(*_b, *_d);
+    float32x4_t u   = vmulq_f32(vrev64q_f32(bmd), _rot);
+    *_a = vaddq_f32(apc, bpd);
+    *_b = vaddq_f32(amc, u);
+    *_c = vsubq_f32(apc, bpd);
+    *_d = vsubq_f32(amc, u);
+}
+
+// first stage (stride 1), vectorized across butterflies and transposed
+// on output
+static void fft_radix4_neon_stage_first(unsigned int    _n,
+                                        float complex * _w,
+                                        float32x4_t     _rot,
+                                        float complex * _x,
+                                        float complex * _y)
+{
+    unsigned int n1 = _n / 4;
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int p;
+    for (p=0; p<n1; p+=2) {
+        float32x4_t a = vld1q_f32(&x[2*(p     )]);
+        float32x4_t b = vld1q_f32(&x[2*(p+  n1)]);
+        float32x4_t c = vld1q_f32(&x[2*(p+2*n1)]);
+        float32x4_t d = vld1q_f32(&x[2*(p+3*n1)]);
+        fft_radix4_neon_butterfly(_rot, &a, &b, &c, &d);
+        b = fft_radix4_neon_cmul(b, vld1q_f32((float*)&_w[     p]));
+        c = fft_radix4_neon_cmul(c, vld1q_f32((float*)&_w[  n1+p]));
+        d = fft_radix4_neon_cmul(d, vld1q_f32((float*)&_w[2*n1+p]));
+
+        // y[4p+k] = { a, b, c, d }[p]
+        vst1q_f32(&y[8*p   ], vcombine_f32(vget_low_f32 (a), vget_low_f32 (b)));
+        vst1q_f32(&y[8*p+ 4], vcombine_f32(vget_low_f32 (c), vget_low_f32 (d)));
+        vst1q_f32(&y[8*p+ 8], vcombine_f32(vget_high_f32(a), vget_high_f32(b)));
+        vst1q_f32(&y[8*p+12], vcombine_f32(vget_high_f32(c), vget_high_f32(d)));
+    }
+}
+
+// general stage with stride _s >= 2, vectorized within each butterfly group
+static void fft_radix4_neon_stage(unsigned int    _n,
+                                  unsigned int    _s,
+                                  float complex * _w,
+                                  float32x4_t     _rot,
+                                  float complex * _x,
+                                  float complex * _y)
+{
+    unsigned int n1 = _n / 4;
+    unsigned int m  = n1 * _s;
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int p, q;
+    for (p=0; p<n1; p++) {
+        float32x4_t w1 = fft_radix4_neon_load1(&_w[     p]);
+        float32x4_t w2 = fft_radix4_neon_load1(&_w[  n1+p]);
+        float32x4_t w3 = fft_radix4_neon_load1(&_w[2*n1+p]);
+        for (q=0; q<_s; q+=2) {
+            unsigned int i = q + _s*p;
+            float32x4_t a = vld1q_f32(&x[2*(i    )]);
+            float32x4_t b = vld1q_f32(&x[2*(i+  m)]);
+            float32x4_t c = vld1q_f32(&x[2*(i+2*m)]);
+            float32x4_t d = vld1q_f32(&x[2*(i+3*m)]);
+            fft_radix4_neon_butterfly(_rot, &a, &b, &c, &d);
+
+            // twiddle factors are unity for final stage
+            if (n1 > 1) {
+                b = fft_radix4_neon_cmul(b, w1);
+                c = fft_radix4_neon_cmul(c, w2);
+                d = fft_radix4_neon_cmul(d, w3);
+            }
+
+            unsigned int o = q + 4*_s*p;
+            vst1q_f32(&y[2*(o     )], a);
+            vst1q_f32(&y[2*(o+  _s)], b);
+            vst1q_f32(&y[2*(o+2*_s)], c);
+            vst1q_f32(&y[2*(o+3*_s)], d);
+        }
+    }
+}
+
+// final radix-2 stage (stride nfft/2, no twiddle factors)
+static void fft_radix4_neon_stage2(unsigned int    _s,
+                                   float complex * _x,
+                                   float complex * _y)
+{
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int q;
+    for (q=0; q<2*_s; q+=4) {
+        float32x4_t a = vld1q_f32(&x[q       ]);
+        float32x4_t b = vld1q_f32(&x[q + 2*_s]);
+        vst1q_f32(&y[q       ], vaddq_f32(a, b));
+        vst1q_f32(&y[q + 2*_s], vsubq_f32(a, b));
+    }
+}
+
+// execute radix-4 Stockham transform (Neon)
+void liquid_fftf_radix4_execute(unsigned int    _nfft,
+                                unsigned int    _howmany,
+                                float complex * _twiddle,
+                                int             _dir,
+                                float complex * _x,
+                                float complex * _y,
+                                float complex * _buf)
+{
+    // signs for rotation by -j (forward) or +j (backward)
+    const float32x4_t rot_fwd = { 1.0f, -1.0f,  1.0f, -1.0f};
+    const float32x4_t rot_bwd = {-1.0f,  1.0f, -1.0f,  1.0f};
+    float32x4_t rot = (_dir == LIQUID_FFT_FORWARD) ? rot_fwd : rot_bwd;
+
+    // number of stages (radix-4, plus radix-2 if log2(nfft) is odd)
+    unsigned int num_stages = liquid_msb_index(_nfft) / 2;
+
+    // set first output so that last stage writes to _y
+    float complex * src = _x;
+    float complex * dst = (num_stages & 1) ? _y : _buf;
+    if (src == dst) {
+        memmove(_buf, _x, _nfft*_howmany*sizeof(float complex));
+        src = _buf;
+    }
+
+    unsigned int n = _nfft;
+    unsigned int s = _howmany;
+    float complex * w = _twiddle;
+    unsigned int k;
+    for (k=0; k<num_stages; k++) {
+        if (n == 2) {
+            fft_radix4_neon_stage2(s, src, dst);
+        } else {
+            if (s == 1) fft_radix4_neon_stage_first(n,    w, rot, src, dst);
+            else        fft_radix4_neon_stage      (n, s, w, rot, src, dst);
+            w += 3*(n/4);
+        }
+
+        // swap buffers
+        src = dst;
+        dst = (dst == _y) ? _buf : _y;
+        n /= 4;
+        s *= 4;
+    }
+}
+
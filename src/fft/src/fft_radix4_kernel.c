@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Radix-4 Stockham (autosort) transform stages, portable C
+//
+//  RADIX4()    :   name-mangling macro
+//  T           :   primitive type
+//  TC          :   primitive type (complex)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <complex.h>
+
+// compute radix-4 stage of sub-transform length _n and stride _s
+//  _n      :   sub-transform length at this stage
+//  _s      :   stride, _s*_n = nfft
+//  _w      :   stage twiddle factors [size: 3*_n/4 x 1]
+//  _dir    :   fft direction
+//  _x      :   input array [size: nfft x 1]
+//  _y      :   output array [size: nfft x 1]
+static void RADIX4(_stage)(unsigned int    _n,
+                           unsigned int    _s,
+                           TC *            _w,
+                           int             _dir,
+                           TC *            _x,
+                           TC *            _y)
+{
+    unsigned int n1 = _n / 4;       // butterflies per sub-transform
+    unsigned int m  = n1 * _s;      // quarter length of full transform
+    T * x = (T*)_x;
+    T * y = (T*)_y;
+    T * w = (T*)_w;
+
+    // rotate (b-d) by -j (forward) or +j (backward)
+    T g = (_dir == LIQUID_FFT_FORWARD) ? 1 : -1;
+
+    unsigned int p, q;
+    for (p=0; p<n1; p++) {
+        T w1r = w[2*(     p)], w1i = w[2*(     p)+1];
+        T w2r = w[2*(  n1+p)], w2i = w[2*(  n1+p)+1];
+        T w3r = w[2*(2*n1+p)], w3i = w[2*(2*n1+p)+1];
+        for (q=0; q<_s; q++) {
+            unsigned int i = q + _s*p;
+            T ar = x[2*(i    )], ai = x[2*(i    )+1];
+            T br = x[2*(i+  m)], bi = x[2*(i+  m)+1];
+            T cr = x[2*(i+2*m)], ci = x[2*(i+2*m)+1];
+            T dr = x[2*(i+3*m)], di = x[2*(i+3*m)+1];
+
+            // butterfly
+            T apcr = ar + cr, apci = ai + ci;
+            T amcr = ar - cr, amci = ai - ci;
+            T bpdr = br + dr, bpdi = bi + di;
+            T ur   =  g*(bi - di);
+            T ui   = -g*(br - dr);
+            T z1r  = amcr + ur,   z1i = amci + ui;
+            T z2r  = apcr - bpdr, z2i = apci - bpdi;
+            T z3r  = amcr - ur,   z3i = amci - ui;
+
+            // apply twiddle factors and store
+            unsigned int o = q + 4*_s*p;
+            y[2*(o     )  ] = apcr + bpdr;
+            y[2*(o     )+1] = apci + bpdi;
+            y[2*(o+  _s)  ] = z1r*w1r - z1i*w1i;
+            y[2*(o+  _s)+1] = z1r*w1i + z1i*w1r;
+            y[2*(o+2*_s)  ] = z2r*w2r - z2i*w2i;
+            y[2*(o+2*_s)+1] = z2r*w2i + z2i*w2r;
+            y[2*(o+3*_s)  ] = z3r*w3r - z3i*w3i;
+            y[2*(o+3*_s)+1] = z3r*w3i + z3i*w3r;
+        }
+    }
+}
+
+// compute final radix-2 stage (stride nfft/2, no twiddle factors)
+static void RADIX4(_stage2)(unsigned int    _s,
+                            TC *            _x,
+                            TC *            _y)
+{
+    T * x = (T*)_x;
+    T * y = (T*)_y;
+    unsigned int q;
+    for (q=0; q<2*_s; q++) {
+        T a = x[q];
+        T b = x[q + 2*_s];
+        y[q]        = a + b;
+        y[q + 2*_s] = a - b;
+    }
+}
+
+// execute radix-4 Stockham transform, alternating between output and
+// work buffer so that the final stage writes the output; a batch of
+// transforms interleaved with stride _howmany is the same as starting
+// the recursion at stride _howmany
+//  _nfft    :   transform size, power of two (at least 16 unless batched)
+//  _howmany :   number of interleaved transforms, 1 or a multiple of 4
+//  _twiddle :   twiddle factors for each stage
+//  _dir     :   fft direction
+//  _x       :   input array [size: _nfft*_howmany x 1]
+//  _y       :   output array [size: _nfft*_howmany x 1]
+//  _buf     :   work buffer [size: _nfft*_howmany x 1]
+void RADIX4(_execute)(unsigned int    _nfft,
+                      unsigned int    _howmany,
+                      TC *            _twiddle,
+                      int             _dir,
+                      TC *            _x,
+                      TC *            _y,
+                      TC *            _buf)
+{
+    // number of stages (radix-4, plus radix-2 if log2(nfft) is odd)
+    unsigned int num_stages = liquid_msb_index(_nfft) / 2;
+
+    // set first output so that last stage writes to _y
+    TC * src = _x;
+    TC * dst = (num_stages & 1) ? _y : _buf;
+    if (src == dst) {
+        memmove(_buf, _x, _nfft*_howmany*sizeof(TC));
+        src = _buf;
+    }
+
+    unsigned int n = _nfft;
+    unsigned int s = _howmany;
+    TC * w = _twiddle;
+    unsigned int k;
+    for (k=0; k<num_stages; k++) {
+        if (n == 2) {
+            RADIX4(_stage2)(s, src, dst);
+        } else {
+            RADIX4(_stage)(n, s, w, _dir, src, dst);
+            w += 3*(n/4);
+        }
+
+        // swap buffers
+        src = dst;
+        dst = (dst == _y) ? _buf : _y;
+        n /= 4;
+        s *= 4;
+    }
+}
+
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_real.c : transforms of real-valued signals, computing the
+//              non-redundant half-spectrum (r2c) or its inverse (c2r)
+//
+// For even sizes the n real samples are packed into n/2 complex samples
+// z[k] = x[2k] + j x[2k+1] so that only an n/2-point complex transform is
+// required; the half-spectrum is recovered from Z = FFT{z} as
+//   X[k] = E[k] + W^k P[k],    W = exp(-j 2 pi / n),
+// where E[k] = (Z[k] + conj(Z[n/2-k]))/2 and P[k] = (Z[k] - conj(Z[n/2-k]))/2j
+// are the transforms of the even and odd samples, respectively. The
+// inverse transform runs these steps in reverse; see fft_real_kernel.c for
+// the split/merge stages. Odd sizes fall back to a full complex transform.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "liquid.internal.h"
+
+// acquire twiddle factors exp(-j 2 pi k / _nfft) for k in [0, _nfft/4],
+// shared between real-input and real-output plans
+static TC * FFT(_real_twiddle)(unsigned int _nfft)
+{
+    TC * twiddle = (TC *) FFT(_cache_lookup)(LIQUID_FFT_TABLE_REAL, _nfft, 0, 0);
+    if (twiddle != NULL)
+        return twiddle;
+
+    unsigned int n = _nfft/4 + 1;
+    twiddle = (TC *) malloc(n * sizeof(TC));
+    unsigned int k;
+    for (k=0; k<n; k++)
+        twiddle[k] = (TC) cexp(-_Complex_I*2*M_PI*(double)k / (double)_nfft);
+    return (TC *) FFT(_cache_insert)(LIQUID_FFT_TABLE_REAL, _nfft, 0, 0, twiddle);
+}
+
+// create FFT plan for real-input transform
+//  _nfft   :   FFT size, _nfft > 0
+//  _x      :   input array (real) [size: _nfft x 1]
+//  _y      :   output array [size: _nfft/2+1 x 1]
+//  _flags  :   planner flags, e.g. LIQUID_FFT_MEASURE
+FFT(plan) FFT(_create_plan_r2c)(unsigned int _nfft,
+                                T *          _x,
+                                TC *         _y,
+                                int          _flags)
+{
+    // validate input
+    if (_nfft == 0)
+        return liquid_error_config("fft_create_plan_r2c(), fft size must be greater than zero");
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->xr        = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = LIQUID_FFT_R2C;
+    q->direction = LIQUID_FFT_FORWARD;
+    q->execute   = FFT(_execute_r2c);
+
+    if (q->nfft % 2) {
+        // odd size: full complex transform on internal buffers
+        q->data.real.twiddle = NULL;
+        q->data.real.buf     = (TC *) malloc(2 * q->nfft * sizeof(TC));
+        q->data.real.fft     = FFT(_create_plan)(q->nfft, q->data.real.buf,
+                                    q->data.real.buf + q->nfft, LIQUID_FFT_FORWARD, _flags);
+    } else {
+        // even size: transform packed input directly into output array
+        q->data.real.twiddle = FFT(_real_twiddle)(q->nfft);
+        q->data.real.buf     = NULL;
+        q->data.real.fft     = FFT(_create_plan)(q->nfft/2, (TC *)_x, _y, LIQUID_FFT_FORWARD, _flags);
+    }
+    q->method = q->data.real.fft->method;
+
+    return q;
+}
+
+// create FFT plan for real-output transform (inverse of r2c, unnormalized)
+//  _nfft   :   FFT size, _nfft > 0
+//  _x      :   input array [size: _nfft/2+1 x 1]
+//  _y      :   output array (real) [size: _nfft x 1]
+//  _flags  :   planner flags, e.g. LIQUID_FFT_MEASURE
+FFT(plan) FFT(_create_plan_c2r)(unsigned int _nfft,
+                                TC *         _x,
+                                T *          _y,
+                                int          _flags)
+{
+    // validate input
+    if (_nfft == 0)
+        return liquid_error_config("fft_create_plan_c2r(), fft size must be greater than zero");
+
+    // allocate plan and initialize all internal arrays to NULL
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->yr        = _y;
+    q->flags     = _flags;
+    q->type      = LIQUID_FFT_C2R;
+    q->direction = LIQUID_FFT_BACKWARD;
+    q->execute   = FFT(_execute_c2r);
+
+    if (q->nfft % 2) {
+        // odd size: full complex transform on internal buffers
+        q->data.real.twiddle = NULL;
+        q->data.real.buf     = (TC *) malloc(2 * q->nfft * sizeof(TC));
+        q->data.real.fft     = FFT(_create_plan)(q->nfft, q->data.real.buf,
+                                    q->data.real.buf + q->nfft, LIQUID_FFT_BACKWARD, _flags);
+    } else {
+        // even size: transform into packed output array directly
+        q->data.real.twiddle = FFT(_real_twiddle)(q->nfft);
+        q->data.real.buf     = (TC *) malloc(q->nfft/2 * sizeof(TC));
+        q->data.real.fft     = FFT(_create_plan)(q->nfft/2, q->data.real.buf, (TC *)_y, LIQUID_FFT_BACKWARD, _flags);
+    }
+    q->method = q->data.real.fft->method;
+
+    return q;
+}
+
+// destroy real-input/real-output transform plan
+int FFT(_destroy_plan_real)(FFT(plan) _q)
+{
+    // destroy sub-transform and free internal buffers
+    FFT(_destroy_plan)(_q->data.real.fft);
+    free(_q->data.real.buf);
+    if (_q->data.real.twiddle != NULL)
+        FFT(_cache_release)(_q->data.real.twiddle);
+
+    // free main object memory
+    free(_q);
+    return LIQUID_OK;
+}
+
+// execute real-input transform
+int FFT(_execute_r2c)(FFT(plan) _q)
+{
+    unsigned int i;
+    unsigned int n = _q->nfft;
+    TC * y = _q->y;
+
+    if (n % 2) {
+        // odd size: copy input, run full transform, keep half-spectrum
+        TC * buf = _q->data.real.buf;
+        for (i=0; i<n; i++)
+            buf[i] = _q->xr[i];
+        FFT(_execute)(_q->data.real.fft);
+        for (i=0; i<=n/2; i++)
+            y[i] = buf[n+i];
+        return LIQUID_OK;
+    }
+
+    // compute n/2-point transform of packed input, Z, into output array
+    FFT(_execute)(_q->data.real.fft);
+
+    // separate transforms of even and odd samples and combine into
+    // half-spectrum, in place
+    FFT_REAL(_split)(n/2, _q->data.real.twiddle, y);
+    return LIQUID_OK;
+}
+
+// execute real-output transform
+int FFT(_execute_c2r)(FFT(plan) _q)
+{
+    unsigned int i;
+    unsigned int n = _q->nfft;
+    TC * x = _q->x;
+    TC * buf = _q->data.real.buf;
+
+    if (n % 2) {
+        // odd size: extend half-spectrum with conjugate symmetry, run full
+        // transform, keep real part
+        for (i=0; i<=n/2; i++)
+            buf[i] = x[i];
+        for (i=n/2+1; i<n; i++)
+            buf[i] = CONJ(x[n-i]);
+        FFT(_execute)(_q->data.real.fft);
+        for (i=0; i<n; i++)
+            _q->yr[i] = REAL(buf[n+i]);
+        return LIQUID_OK;
+    }
+
+    // combine transforms of even and odd output samples, E + j P, scaled
+    // by two so that the result matches the full n-point inverse
+    FFT_REAL(_merge)(n/2, _q->data.real.twiddle, x, buf);
+
+    // compute n/2-point inverse transform into packed output array
+    return FFT(_execute)(_q->data.real.fft);
+}
+
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_real.mmx.c : real-input transform split/merge stages (SSE2/SSE3)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <emmintrin.h>  // SSE2
+#include <pmmintrin.h>  // SSE3
+
+// complex multiply two pairs of interleaved values
+static inline __m128 fft_real_sse_cmul(__m128 _a,
+                                       __m128 _b)
+{
+    __m128 br = _mm_moveldup_ps(_b);
+    __m128 bi = _mm_movehdup_ps(_b);
+    __m128 as = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(2,3,0,1));
+    return _mm_addsub_ps(_mm_mul_ps(_a, br), _mm_mul_ps(as, bi));
+}
+
+// swap the two complex values held in a register
+static inline __m128 fft_real_sse_reverse(__m128 _a)
+{
+    return _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(1,0,3,2));
+}
+
+// split packed transform (SSE2/SSE3), operating on bins { k, k+1 } and
+// { m-k-1, m-k } at a time until the two ranges meet
+void liquid_fftf_real_split_sse(unsigned int    _m,
+                                float complex * _w,
+                                float complex * _z)
+{
+    float * z = (float*)_z;
+    float * w = (float*)_w;
+    unsigned int m = _m;
+
+    // sign mask for conjugating both values in a register
+    const __m128 conj = _mm_castsi128_ps(_mm_setr_epi32(0, 0x80000000, 0, 0x80000000));
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    // DC and Nyquist bins
+    float z0r = z[0], z0i = z[1];
+    z[0]   = z0r + z0i;     z[1]     = 0;
+    z[2*m] = z0r - z0i;     z[2*m+1] = 0;
+
+    unsigned int k;
+    for (k=1; 2*k+2<m; k+=2) {
+        // a = Z[k], b = conj(Z[m-k])
+        __m128 a = _mm_loadu_ps(&z[2*k]);
+        __m128 b = _mm_xor_ps(fft_real_sse_reverse(_mm_loadu_ps(&z[2*(m-k-1)])), conj);
+
+        // e = (a + b)/2, p = (a - b)/2j, v = W^k p
+        __m128 e = _mm_mul_ps(half, _mm_add_ps(a, b));
+        __m128 d = _mm_sub_ps(a, b);
+        __m128 p = _mm_mul_ps(half, _mm_xor_ps(_mm_shuffle_ps(d, d, _MM_SHUFFLE(2,3,0,1)), conj));
+        __m128 v = fft_real_sse_cmul(p, _mm_loadu_ps(&w[2*k]));
+
+        // X[k] = e + v, X[m-k] = conj(e - v)
+        _mm_storeu_ps(&z[2*k], _mm_add_ps(e, v));
+        _mm_storeu_ps(&z[2*(m-k-1)], fft_real_sse_reverse(_mm_xor_ps(_mm_sub_ps(e, v), conj)));
+    }
+
+    // remaining bins near m/2
+    for ( ; 2*k<=m; k++) {
+        float ar = z[2*k],     ai =  z[2*k+1];
+        float br = z[2*(m-k)], bi = -z[2*(m-k)+1];
+        float er = 0.5f*(ar + br), ei = 0.5f*(ai + bi);
+        float pr = 0.5f*(ai - bi), pi = 0.5f*(br - ar);
+        float wr = w[2*k], wi = w[2*k+1];
+        float vr = wr*pr - wi*pi;
+        float vi = wr*pi + wi*pr;
+        z[2*k]     = er + vr;       z[2*k+1]     = ei + vi;
+        z[2*(m-k)] = er - vr;       z[2*(m-k)+1] = vi - ei;
+    }
+}
+
+// merge half-spectrum (SSE2/SSE3), operating on bins { k, k+1 } and
+// { m-k-1, m-k } at a time until the two ranges meet
+void liquid_fftf_real_merge_sse(unsigned int    _m,
+                                float complex * _w,
+                                float complex * _x,
+                                float complex * _z)
+{
+    float * x = (float*)_x;
+    float * z = (float*)_z;
+    float * w = (float*)_w;
+    unsigned int m = _m;
+
+    // sign masks for conjugating both values, and for negating real parts
+    const __m128 conj = _mm_castsi128_ps(_mm_setr_epi32(0, 0x80000000, 0, 0x80000000));
+    const __m128 negr = _mm_castsi128_ps(_mm_setr_epi32(0x80000000, 0, 0x80000000, 0));
+
+    // DC and Nyquist bins
+    z[0] = x[0] + x[2*m] - x[1] - x[2*m+1];
+    z[1] = x[0] - x[2*m] + x[1] - x[2*m+1];
+
+    unsigned int k;
+    for (k=1; 2*k+2<m; k+=2) {
+        // a = X[k], b = conj(X[m-k])
+        __m128 a = _mm_loadu_ps(&x[2*k]);
+        __m128 b = _mm_xor_ps(fft_real_sse_reverse(_mm_loadu_ps(&x[2*(m-k-1)])), conj);
+
+        // e = a + b, p = (a - b) conj(W^k), q = j p
+        __m128 e = _mm_add_ps(a, b);
+        __m128 p = fft_real_sse_cmul(_mm_sub_ps(a, b), _mm_xor_ps(_mm_loadu_ps(&w[2*k]), conj));
+        __m128 q = _mm_xor_ps(_mm_shuffle_ps(p, p, _MM_SHUFFLE(2,3,0,1)), negr);
+
+        // Z[k] = e + j p, Z[m-k] = conj(e - j p)
+        _mm_storeu_ps(&z[2*k], _mm_add_ps(e, q));
+        _mm_storeu_ps(&z[2*(m-k-1)], fft_real_sse_reverse(_mm_xor_ps(_mm_sub_ps(e, q), conj)));
+    }
+
+    // remaining bins near m/2
+    for ( ; 2*k<=m; k++) {
+        float ar = x[2*k],     ai =  x[2*k+1];
+        float br = x[2*(m-k)], bi = -x[2*(m-k)+1];
+        float er = ar + br, ei = ai + bi;
+        float dr = ar - br, di = ai - bi;
+        float wr = w[2*k], wi = w[2*k+1];
+        float pr = dr*wr + di*wi;
+        float pi = di*wr - dr*wi;
+        z[2*k]     = er - pi;       z[2*k+1]     = ei + pr;
+        z[2*(m-k)] = er + pi;       z[2*(m-k)+1] = pr - ei;
+    }
+}
+
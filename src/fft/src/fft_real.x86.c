@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_real.x86.c : real-input transform split/merge stages, run-time
+//                  selection of SIMD kernels
+//
+
+#include "liquid.internal.h"
+
+// portable C kernel
+#define FFTREAL(name)   liquid_fftf_real ## name ## _portable
+#define T               float
+#define TC              float complex
+#include "fft_real_kernel.c"
+#undef FFTREAL
+
+// split packed transform using selected kernel
+void liquid_fftf_real_split(unsigned int    _m,
+                            float complex * _w,
+                            float complex * _z)
+{
+    liquid_simd_get_kernels()->fftf_real_split(_m, _w, _z);
+}
+
+// merge half-spectrum using selected kernel
+void liquid_fftf_real_merge(unsigned int    _m,
+                            float complex * _w,
+                            float complex * _x,
+                            float complex * _z)
+{
+    liquid_simd_get_kernels()->fftf_real_merge(_m, _w, _x, _z);
+}
+
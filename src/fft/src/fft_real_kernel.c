@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Real-input transform split/merge stages, portable C
+//
+//  FFTREAL()   :   name-mangling macro
+//  T           :   primitive type
+//  TC          :   primitive type (complex)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <complex.h>
+
+// split packed m-point transform Z into half-spectrum X of 2m-point
+// real-input transform, in place:
+//   X[k] = E[k] + W^k P[k], X[m-k] = conj(E[k] - W^k P[k]),
+// with E[k] = (Z[k] + conj(Z[m-k]))/2 and P[k] = (Z[k] - conj(Z[m-k]))/2j
+//  _m      :   packed transform size
+//  _w      :   twiddle factors exp(-j 2 pi k / 2m) [size: m/2+1 x 1]
+//  _z      :   input Z [size: m x 1], output X [size: m+1 x 1]
+void FFTREAL(_split)(unsigned int    _m,
+                     TC *            _w,
+                     TC *            _z)
+{
+    T * z = (T*)_z;
+    T * w = (T*)_w;
+    unsigned int m = _m;
+
+    // DC and Nyquist bins
+    T z0r = z[0], z0i = z[1];
+    z[0]   = z0r + z0i;     z[1]     = 0;
+    z[2*m] = z0r - z0i;     z[2*m+1] = 0;
+
+    // pairs of bins k and m-k
+    unsigned int k;
+    for (k=1; 2*k<=m; k++) {
+        // a = Z[k], b = conj(Z[m-k])
+        T ar = z[2*k],     ai =  z[2*k+1];
+        T br = z[2*(m-k)], bi = -z[2*(m-k)+1];
+
+        // e = (a + b)/2, p = (a - b)/2j, v = W^k p
+        T er = (T)0.5*(ar + br), ei = (T)0.5*(ai + bi);
+        T pr = (T)0.5*(ai - bi), pi = (T)0.5*(br - ar);
+        T wr = w[2*k], wi = w[2*k+1];
+        T vr = wr*pr - wi*pi;
+        T vi = wr*pi + wi*pr;
+
+        // X[k] = e + v, X[m-k] = conj(e - v)
+        z[2*k]     = er + vr;       z[2*k+1]     = ei + vi;
+        z[2*(m-k)] = er - vr;       z[2*(m-k)+1] = vi - ei;
+    }
+}
+
+// merge half-spectrum X of 2m-point real-output transform into packed
+// m-point spectrum Z = E + j P, scaled by two (inverse of split):
+//   E[k] = X[k] + conj(X[m-k]), P[k] = (X[k] - conj(X[m-k])) conj(W^k)
+//  _m      :   packed transform size
+//  _w      :   twiddle factors exp(-j 2 pi k / 2m) [size: m/2+1 x 1]
+//  _x      :   input X [size: m+1 x 1]
+//  _z      :   output Z [size: m x 1]
+void FFTREAL(_merge)(unsigned int    _m,
+                     TC *            _w,
+                     TC *            _x,
+                     TC *            _z)
+{
+    T * x = (T*)_x;
+    T * z = (T*)_z;
+    T * w = (T*)_w;
+    unsigned int m = _m;
+
+    // DC and Nyquist bins
+    z[0] = x[0] + x[2*m] - x[1] - x[2*m+1];
+    z[1] = x[0] - x[2*m] + x[1] - x[2*m+1];
+
+    // pairs of bins k and m-k
+    unsigned int k;
+    for (k=1; 2*k<=m; k++) {
+        // a = X[k], b = conj(X[m-k])
+        T ar = x[2*k],     ai =  x[2*k+1];
+        T br = x[2*(m-k)], bi = -x[2*(m-k)+1];
+
+        // e = a + b, p = (a - b) conj(W^k)
+        T er = ar + br, ei = ai + bi;
+        T dr = ar - br, di = ai - bi;
+        T wr = w[2*k], wi = w[2*k+1];
+        T pr = dr*wr + di*wi;
+        T pi = di*wr - dr*wi;
+
+        // Z[k] = e + j p, Z[m-k] = conj(e) + j conj(p)
+        z[2*k]     = er - pi;       z[2*k+1]     = ei + pr;
+        z[2*(m-k)] = er + pi;       z[2*(m-k)+1] = pr - ei;
+    }
+}
+
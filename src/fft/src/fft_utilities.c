@@ -30,6 +30,10 @@
 
 #include "liquid.internal.h"
 
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#   include <pthread.h>
+#endif
+
 // determine best FFT method based on size
 liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft)
 {
@@ -44,13 +48,8 @@ liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft)
 
     } else if (fft_is_radix2(_nfft)) {
         // transform is of the form 2^m
-#if 0
-        // use radix-2 algorithm
-        return LIQUID_FFT_METHOD_RADIX2;
-#else
-        // acutally, prefer Cooley-Tukey algorithm
-        return LIQUID_FFT_METHOD_MIXED_RADIX;
-#endif
+        // use radix-4 Stockham algorithm with vectorized stages
+        return LIQUID_FFT_METHOD_RADIX4;
 
     } else if (liquid_is_prime(_nfft)) {
         // prefer Rader's alternate method (using radix-2 transform)
@@ -60,6 +59,11 @@ liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft)
             return LIQUID_FFT_METHOD_RADER;
         else
             return LIQUID_FFT_METHOD_RADER2;
+
+    } else if (_nfft >= FFT_FOUR_STEP_NFFT_MIN && fft_estimate_four_step(_nfft) > 0) {
+        // large composite transform: use four-step algorithm so that
+        // sub-transforms operate in cache
+        return LIQUID_FFT_METHOD_FOUR_STEP;
     }
 
     // last resort
@@ -67,6 +71,20 @@ liquid_fft_method liquid_fft_estimate_method(unsigned int _nfft)
     return LIQUID_FFT_METHOD_MIXED_RADIX;   // use mixed radix method
 }
 
+// find factor N1 of _n for four-step transform: the largest factor no
+// larger than sqrt(_n) so that both sub-transforms are about the same
+// size, returning zero if none is at least FFT_FOUR_STEP_FACTOR_MIN
+unsigned int fft_estimate_four_step(unsigned int _n)
+{
+    unsigned int n1;
+    unsigned int n1_opt = 0;
+    for (n1=FFT_FOUR_STEP_FACTOR_MIN; n1<=_n/n1; n1++) {
+        if ((_n % n1) == 0)
+            n1_opt = n1;
+    }
+    return n1_opt;
+}
+
 // is input radix-2?
 int fft_is_radix2(unsigned int _n)
 {
@@ -98,4 +116,174 @@ unsigned int fft_reverse_index(unsigned int _i, unsigned int _n)
     return j;
 }
 
+// pool of threads running tasks in parallel; workers are started once
+// and wait for tasks between runs
+struct liquid_fft_pool_s {
+    unsigned int      num_threads;  // number of threads, calling thread included
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+    pthread_t *       thread;       // worker threads [size: num_threads-1 x 1]
+    pthread_mutex_t   lock;         // protects all fields below
+    pthread_cond_t    start;        // signalled when a task is posted
+    pthread_cond_t    done;         // signalled when the last worker finishes
+    unsigned long int generation;   // incremented for each task posted
+    unsigned int      pending;      // number of workers yet to finish task
+    int               shutdown;     // workers should exit
+#endif
+    liquid_fft_task * task;         // current task
+    void *            context;      // current task context
+    unsigned int      n;            // number of items in current task
+    unsigned int      num_ranges;   // number of ranges current task is split into
+};
+
+// run range _i of current task, if any
+static void liquid_fft_pool_run_range(liquid_fft_pool _p,
+                                      unsigned int    _i)
+{
+    if (_i >= _p->num_ranges)
+        return;
+    unsigned int begin = (unsigned int)(((unsigned long int) _i    * _p->n) / _p->num_ranges);
+    unsigned int end   = (unsigned int)(((unsigned long int)(_i+1) * _p->n) / _p->num_ranges);
+    _p->task(_p->context, _i, begin, end);
+}
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+// worker thread and its index within the pool
+struct liquid_fft_pool_worker_s {
+    liquid_fft_pool pool;
+    unsigned int    index;
+};
+
+// worker thread entry point: wait for task, run its range, repeat
+static void * liquid_fft_pool_worker(void * _arg)
+{
+    struct liquid_fft_pool_worker_s w = *(struct liquid_fft_pool_worker_s *) _arg;
+    free(_arg);
+    liquid_fft_pool p = w.pool;
+    unsigned long int generation = 0;
+
+    pthread_mutex_lock(&p->lock);
+    while (1) {
+        while (p->generation == generation && !p->shutdown)
+            pthread_cond_wait(&p->start, &p->lock);
+        if (p->shutdown)
+            break;
+        generation = p->generation;
+        pthread_mutex_unlock(&p->lock);
+
+        liquid_fft_pool_run_range(p, w.index);
+
+        pthread_mutex_lock(&p->lock);
+        if (--p->pending == 0)
+            pthread_cond_signal(&p->done);
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+#endif
+
+// create pool of _num_threads threads, the calling thread included
+liquid_fft_pool liquid_fft_pool_create(unsigned int _num_threads)
+{
+    liquid_fft_pool p = (liquid_fft_pool) malloc(sizeof(struct liquid_fft_pool_s));
+    p->num_threads = _num_threads > 0 ? _num_threads : 1;
+    p->task        = NULL;
+    p->context     = NULL;
+    p->n           = 0;
+    p->num_ranges  = 0;
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init (&p->start, NULL);
+    pthread_cond_init (&p->done,  NULL);
+    p->generation = 0;
+    p->pending    = 0;
+    p->shutdown   = 0;
+
+    // start workers, keeping only as many threads as could be created
+    p->thread = (pthread_t *) malloc(p->num_threads*sizeof(pthread_t));
+    unsigned int i;
+    for (i=1; i<p->num_threads; i++) {
+        struct liquid_fft_pool_worker_s * w = (struct liquid_fft_pool_worker_s *)
+            malloc(sizeof(struct liquid_fft_pool_worker_s));
+        w->pool  = p;
+        w->index = i;
+        if (pthread_create(&p->thread[i-1], NULL, liquid_fft_pool_worker, w) != 0) {
+            free(w);
+            break;
+        }
+    }
+    p->num_threads = i;
+#endif
+    return p;
+}
+
+// stop worker threads and free pool
+int liquid_fft_pool_destroy(liquid_fft_pool _p)
+{
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+    pthread_mutex_lock(&_p->lock);
+    _p->shutdown = 1;
+    pthread_cond_broadcast(&_p->start);
+    pthread_mutex_unlock(&_p->lock);
+    unsigned int i;
+    for (i=1; i<_p->num_threads; i++)
+        pthread_join(_p->thread[i-1], NULL);
+    free(_p->thread);
+    pthread_cond_destroy (&_p->start);
+    pthread_cond_destroy (&_p->done);
+    pthread_mutex_destroy(&_p->lock);
+#endif
+    free(_p);
+    return LIQUID_OK;
+}
 
+// get number of threads in pool, the calling thread included
+unsigned int liquid_fft_pool_get_num_threads(liquid_fft_pool _p)
+{
+    return _p->num_threads;
+}
+
+// run task on _n items split into contiguous ranges across the threads
+// of the pool; the calling thread takes the first range
+int liquid_fft_pool_execute(liquid_fft_pool   _p,
+                            unsigned int      _n,
+                            liquid_fft_task * _task,
+                            void *            _context)
+{
+    unsigned int num_ranges = _p->num_threads < _n ? _p->num_threads : _n;
+    if (num_ranges <= 1) {
+        if (_n > 0)
+            _task(_context, 0, 0, _n);
+        return LIQUID_OK;
+    }
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+    // post task to all workers; those without a range finish immediately
+    pthread_mutex_lock(&_p->lock);
+    _p->task       = _task;
+    _p->context    = _context;
+    _p->n          = _n;
+    _p->num_ranges = num_ranges;
+    _p->pending    = _p->num_threads - 1;
+    _p->generation++;
+    pthread_cond_broadcast(&_p->start);
+    pthread_mutex_unlock(&_p->lock);
+
+    liquid_fft_pool_run_range(_p, 0);
+
+    // wait for workers to complete
+    pthread_mutex_lock(&_p->lock);
+    while (_p->pending > 0)
+        pthread_cond_wait(&_p->done, &_p->lock);
+    pthread_mutex_unlock(&_p->lock);
+#else
+    // threads not available: run each range in turn
+    _p->task       = _task;
+    _p->context    = _context;
+    _p->n          = _n;
+    _p->num_ranges = num_ranges;
+    unsigned int i;
+    for (i=0; i<num_ranges; i++)
+        liquid_fft_pool_run_range(_p, i);
+#endif
+    return LIQUID_OK;
+}
@@ -29,6 +29,8 @@
 // Macro definitions
 #define FFT(name)           LIQUID_CONCAT(fft,name)
 #define DOTPROD(name)       LIQUID_CONCAT(dotprod_cccf,name)
+#define FFT_RADIX4(name)    LIQUID_CONCAT(liquid_fftf_radix4,name)
+#define FFT_REAL(name)      LIQUID_CONCAT(liquid_fftf_real,name)
 
 #define T                   float           /* primitive type */
 #define TC                  float complex   /* primitive type (complex) */
@@ -36,12 +38,24 @@
 #define PRINTVAL_T(X,F)     PRINTVAL_FLOAT(X,F)
 #define PRINTVAL_TC(X,F)    PRINTVAL_CFLOAT(X,F)
 
+#define REAL(X)             crealf(X)
+#define IMAG(X)             cimagf(X)
+#define CONJ(X)             conjf(X)
+#define CEXP(X)             cexpf(X)
+
 // include main files
 #include "fft_common.c"         // common source must come first (object definition)
+#include "fft_cache.c"          // tables shared between plans
 #include "fft_dft.c"            // FFT definitions for DFT
 #include "fft_radix2.c"         // FFT definitions for radix-2 transforms
+#include "fft_radix4.c"         // FFT definitions for radix-4 transforms (Stockham)
 #include "fft_mixed_radix.c"    // FFT definitions for mixed-radix transforms (Cooley-Tukey)
 #include "fft_rader.c"          // FFT definitions for transforms of prime length (Rader's algorithm)
 #include "fft_rader2.c"         // FFT definitions for transforms of prime length (Rader's alternate algorithm)
+#include "fft_many.c"           // batch of transforms of the same size
+#include "fft_four_step.c"      // FFT definitions for large transforms (four-step algorithm)
+#include "fft_pruned.c"         // FFT definitions for zero-padded input or partial output
+#include "fft_real.c"           // real-input and real-output transforms (r2c/c2r)
 #include "fft_r2r_1d.c"         // real-to-real definitions (DCT/DST)
+#include "fft_planner.c"        // measuring planner and wisdom
 
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// sdft_cccf.c : sliding discrete Fourier transform
+//
+// Updates selected bins of an nfft-point DFT over the most recent nfft
+// input samples once per sample using the recursion
+//   X_k(n) = exp(j 2 pi k / nfft) ( X_k(n-1) + x(n) - x(n-nfft) ),
+// costing O(num_bins) operations per sample. Rounding errors in the
+// recursion accumulate without bound, so every nfft samples the bins
+// are recomputed exactly from the input buffer: with a regular transform
+// if many bins are tracked, otherwise directly.
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+struct sdft_cccf_s {
+    unsigned int    nfft;       // transform size
+    unsigned int    num_bins;   // number of tracked bins
+    unsigned int *  bins;       // tracked bin indices, [size: num_bins x 1]
+
+    // bin state and per-sample rotation, split into real and imaginary
+    // components to keep the update loop free of complex arithmetic
+    float *         Xr;         // bin values (real), [size: num_bins x 1]
+    float *         Xi;         // bin values (imag), [size: num_bins x 1]
+    float *         wr;         // bin rotation (real), [size: num_bins x 1]
+    float *         wi;         // bin rotation (imag), [size: num_bins x 1]
+
+    float complex * buf;        // input buffer, [size: nfft x 1]
+    unsigned int    index;      // buffer index of oldest sample
+
+    // renormalization
+    fftplan         fft;        // full transform of buffer (NULL if direct)
+    float complex * buf_freq;   // transform output, [size: nfft x 1]
+};
+
+// recompute all tracked bins exactly from input buffer; the buffer index
+// must be zero such that buf[0] is the oldest sample
+int sdft_cccf_renormalize(sdft_cccf _q);
+
+// create sliding DFT object tracking all bins
+//  _nfft   : transform size, _nfft > 0
+sdft_cccf sdft_cccf_create(unsigned int _nfft)
+{
+    if (_nfft == 0)
+        return liquid_error_config("sdft_cccf_create(), transform size must be greater than zero");
+
+    // track all bins; list is allocated on the heap as it may be large
+    unsigned int * bins = (unsigned int*) malloc(_nfft*sizeof(unsigned int));
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        bins[i] = i;
+
+    sdft_cccf q = sdft_cccf_create_bins(_nfft, bins, _nfft);
+    free(bins);
+    return q;
+}
+
+// create sliding DFT object tracking a set of bins
+//  _nfft       : transform size, _nfft > 0
+//  _bins       : bin indices to track, each in [0,_nfft), [size: _num_bins x 1]
+//  _num_bins   : number of bins to track, _num_bins > 0
+sdft_cccf sdft_cccf_create_bins(unsigned int   _nfft,
+                                unsigned int * _bins,
+                                unsigned int   _num_bins)
+{
+    // validate input
+    if (_nfft == 0)
+        return liquid_error_config("sdft_cccf_create_bins(), transform size must be greater than zero");
+    if (_num_bins == 0)
+        return liquid_error_config("sdft_cccf_create_bins(), number of bins must be greater than zero");
+    if (_bins == NULL)
+        return liquid_error_config("sdft_cccf_create_bins(), bins array cannot be NULL");
+    unsigned int i;
+    for (i=0; i<_num_bins; i++) {
+        if (_bins[i] >= _nfft)
+            return liquid_error_config("sdft_cccf_create_bins(), bin index (%u) must be less than transform size (%u)", _bins[i], _nfft);
+    }
+
+    // create object and initialize
+    sdft_cccf q = (sdft_cccf) malloc(sizeof(struct sdft_cccf_s));
+    q->nfft     = _nfft;
+    q->num_bins = _num_bins;
+    q->bins     = (unsigned int*)  malloc(q->num_bins*sizeof(unsigned int));
+    q->Xr       = (float*)         malloc(q->num_bins*sizeof(float));
+    q->Xi       = (float*)         malloc(q->num_bins*sizeof(float));
+    q->wr       = (float*)         malloc(q->num_bins*sizeof(float));
+    q->wi       = (float*)         malloc(q->num_bins*sizeof(float));
+    q->buf      = (float complex*) malloc(q->nfft*sizeof(float complex));
+    memmove(q->bins, _bins, q->num_bins*sizeof(unsigned int));
+
+    // compute per-sample rotation for each bin
+    for (i=0; i<q->num_bins; i++) {
+        double theta = 2*M_PI*(double)q->bins[i] / (double)q->nfft;
+        q->wr[i] = cos(theta);
+        q->wi[i] = sin(theta);
+    }
+
+    // renormalize with a regular transform when computing each tracked bin
+    // directly (nfft operations each) costs more
+    if (q->num_bins > liquid_nextpow2(q->nfft)) {
+        q->buf_freq = (float complex*) malloc(q->nfft*sizeof(float complex));
+        q->fft      = fft_create_plan(q->nfft, q->buf, q->buf_freq, LIQUID_FFT_FORWARD, 0);
+    } else {
+        q->buf_freq = NULL;
+        q->fft      = NULL;
+    }
+
+    // reset object and return
+    sdft_cccf_reset(q);
+    return q;
+}
+
+// destroy sliding DFT object, freeing all internal memory
+int sdft_cccf_destroy(sdft_cccf _q)
+{
+    if (_q == NULL)
+        return liquid_error(LIQUID_EIOBJ,"sdft_cccf_destroy(), invalid null pointer passed");
+
+    if (_q->fft != NULL) {
+        fft_destroy_plan(_q->fft);
+        free(_q->buf_freq);
+    }
+    free(_q->bins);
+    free(_q->Xr);
+    free(_q->Xi);
+    free(_q->wr);
+    free(_q->wi);
+    free(_q->buf);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print sliding DFT object
+int sdft_cccf_print(sdft_cccf _q)
+{
+    printf("<liquid.sdft_cccf, nfft=%u, bins=%u, renorm=%s>\n",
+            _q->nfft, _q->num_bins, _q->fft == NULL ? "direct" : "fft");
+    return LIQUID_OK;
+}
+
+// reset sliding DFT object: clear input buffer and bins
+int sdft_cccf_reset(sdft_cccf _q)
+{
+    memset(_q->Xr,  0, _q->num_bins*sizeof(float));
+    memset(_q->Xi,  0, _q->num_bins*sizeof(float));
+    memset(_q->buf, 0, _q->nfft*sizeof(float complex));
+    _q->index = 0;
+    return LIQUID_OK;
+}
+
+// get transform size
+unsigned int sdft_cccf_get_nfft(sdft_cccf _q)
+{
+    return _q->nfft;
+}
+
+// get number of tracked bins
+unsigned int sdft_cccf_get_num_bins(sdft_cccf _q)
+{
+    return _q->num_bins;
+}
+
+// push single sample into object, updating all tracked bins
+int sdft_cccf_push(sdft_cccf     _q,
+                   float complex _x)
+{
+    // replace oldest sample in buffer
+    float complex d = _x - _q->buf[_q->index];
+    _q->buf[_q->index] = _x;
+    float dr = crealf(d);
+    float di = cimagf(d);
+
+    // update bins: X <- (X + d) * w
+    unsigned int i;
+    for (i=0; i<_q->num_bins; i++) {
+        float vr = _q->Xr[i] + dr;
+        float vi = _q->Xi[i] + di;
+        _q->Xr[i] = vr*_q->wr[i] - vi*_q->wi[i];
+        _q->Xi[i] = vr*_q->wi[i] + vi*_q->wr[i];
+    }
+
+    // recompute bins from buffer each time it wraps around
+    _q->index++;
+    if (_q->index == _q->nfft) {
+        _q->index = 0;
+        sdft_cccf_renormalize(_q);
+    }
+    return LIQUID_OK;
+}
+
+// write block of samples into object, updating all tracked bins
+int sdft_cccf_write(sdft_cccf       _q,
+                    float complex * _x,
+                    unsigned int    _n)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        sdft_cccf_push(_q, _x[i]);
+    return LIQUID_OK;
+}
+
+// get tracked bins of transform over most recent nfft samples
+int sdft_cccf_get_bins(sdft_cccf       _q,
+                       float complex * _X)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_bins; i++)
+        _X[i] = _q->Xr[i] + _Complex_I*_q->Xi[i];
+    return LIQUID_OK;
+}
+
+// recompute all tracked bins exactly from input buffer
+int sdft_cccf_renormalize(sdft_cccf _q)
+{
+    unsigned int i, m;
+    if (_q->fft != NULL) {
+        // buffer is in order (oldest sample first): run regular transform
+        fft_execute(_q->fft);
+        for (i=0; i<_q->num_bins; i++) {
+            _q->Xr[i] = crealf(_q->buf_freq[_q->bins[i]]);
+            _q->Xi[i] = cimagf(_q->buf_freq[_q->bins[i]]);
+        }
+        return LIQUID_OK;
+    }
+
+    // compute each bin directly, advancing the twiddle factor by the
+    // bin's rotation (in double precision to avoid repeating the drift)
+    for (i=0; i<_q->num_bins; i++) {
+        double theta = -2*M_PI*(double)_q->bins[i] / (double)_q->nfft;
+        double complex w = cexp(_Complex_I*theta);
+        double complex t = 1.0;
+        double complex v = 0.0;
+        for (m=0; m<_q->nfft; m++) {
+            v += _q->buf[m] * t;
+            t *= w;
+        }
+        _q->Xr[i] = creal(v);
+        _q->Xi[i] = cimag(v);
+    }
+    return LIQUID_OK;
+}
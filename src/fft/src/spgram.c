@@ -47,8 +47,9 @@ struct SPGRAM(_s) {
     int             accumulate;     // accumulate? or use time-average
 
     WINDOW()        buffer;         // input buffer
-    TC *            buf_time;       // pointer to input array (allocated)
+    TI *            buf_time;       // pointer to input array (allocated)
     TC *            buf_freq;       // output fft (allocated)
+    unsigned int    nfreq;          // number of output bins computed by fft
     T  *            w;              // tapering window [size: window_len x 1]
     FFT_PLAN        fft;            // FFT plan
 
@@ -110,10 +111,20 @@ SPGRAM() SPGRAM(_create)(unsigned int _nfft,
     SPGRAM(_set_alpha)(q, -1.0f);
 
     // create FFT arrays, object
-    q->buf_time = (TC*) malloc((q->nfft)*sizeof(TC));
-    q->buf_freq = (TC*) malloc((q->nfft)*sizeof(TC));
-    q->psd      = (T *) malloc((q->nfft)*sizeof(T ));
+#if TI_COMPLEX
+    q->nfreq    = q->nfft;
+#else
+    // real input: compute non-redundant half of spectrum only
+    q->nfreq    = q->nfft/2 + 1;
+#endif
+    q->buf_time = (TI*) malloc((q->nfft )*sizeof(TI));
+    q->buf_freq = (TC*) malloc((q->nfreq)*sizeof(TC));
+    q->psd      = (T *) malloc((q->nfft )*sizeof(T ));
+#if TI_COMPLEX
     q->fft      = FFT_CREATE_PLAN(q->nfft, q->buf_time, q->buf_freq, FFT_DIR_FORWARD, FFT_METHOD);
+#else
+    q->fft      = FFT_CREATE_PLAN_R2C(q->nfft, q->buf_time, q->buf_freq, FFT_METHOD);
+#endif
 
     // create buffer
     q->buffer = WINDOW(_create)(q->window_len);
@@ -385,14 +396,18 @@ int SPGRAM(_step)(SPGRAM() _q)
 
     // accumulate output
     // TODO: vectorize this operation
-    for (i=0; i<_q->nfft; i++) {
-        T v = crealf( _q->buf_freq[i] * conjf(_q->buf_freq[i]) );
+    for (i=0; i<_q->nfreq; i++) {
+        T v = REAL( _q->buf_freq[i] * CONJ(_q->buf_freq[i]) );
         if (_q->num_transforms == 0)
             _q->psd[i] = v;
         else
             _q->psd[i] = _q->gamma*_q->psd[i] + _q->alpha*v;
     }
 
+    // spectrum of real input is conjugate symmetric: mirror upper half
+    for (i=_q->nfreq; i<_q->nfft; i++)
+        _q->psd[i] = _q->psd[_q->nfft - i];
+
     _q->num_transforms++;
     _q->num_transforms_total++;
     return LIQUID_OK;
@@ -405,14 +420,21 @@ int SPGRAM(_step)(SPGRAM() _q)
 int SPGRAM(_get_psd)(SPGRAM() _q,
                      T *      _X)
 {
-    // compute magnitude in dB and run FFT shift
+    // run FFT shift, limiting to minimum value
     unsigned int i;
     unsigned int nfft_2 = _q->nfft / 2;
-    T scale = _q->accumulate ? -10*log10f(max(1,_q->num_transforms)) : 0.0f;
-    // TODO: adjust scale if infinite integration
     for (i=0; i<_q->nfft; i++) {
         unsigned int k = (i + nfft_2) % _q->nfft;
-        _X[i] = 10*log10f( max(LIQUID_SPGRAM_PSD_MIN,_q->psd[k]) ) + scale;
+        _X[i] = max(LIQUID_SPGRAM_PSD_MIN,_q->psd[k]);
+    }
+
+    // compute magnitude in dB
+    VECTOR_DB(_X, _q->nfft, _X);
+
+    // TODO: adjust scale if infinite integration
+    if (_q->accumulate) {
+        T scale = -10*log10f(max(1,_q->num_transforms));
+        VECTOR_ADDSCALAR(_X, _q->nfft, scale, _X);
     }
     return LIQUID_OK;
 }
@@ -46,6 +46,11 @@
 #define PRINTVAL_TC(X,F)    PRINTVAL_CFLOAT(X,F)
 #define PRINTVAL_TI(X,F)    PRINTVAL_CFLOAT(X,F)
 
+#define REAL(X)             crealf(X)
+#define CONJ(X)             conjf(X)
+#define VECTOR_DB(X,N,Y)    liquid_vectorf_db(X,N,Y)
+#define VECTOR_ADDSCALAR(X,N,S,Y) liquid_vectorf_addscalar(X,N,S,Y)
+
 // source files
 #include "asgram.c"
 #include "spgram.c"
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// spectral periodogram API: double-precision floating-point
+//
+
+#include "liquid.internal.h"
+
+// naming extensions (useful for print statements)
+#define EXTENSION           "d"
+
+// name-mangling macros
+#define SPGRAM(name)        LIQUID_CONCAT(spgramd,name)
+#define WINDOW(name)        LIQUID_CONCAT(windowd,name)
+#define FFT(name)           LIQUID_CONCAT(fftd,name)
+
+#define T                   double          // primitive type (real)
+#define TC                  double complex  // primitive type (complex)
+#define TI                  double          // input type
+
+#define TI_COMPLEX          0
+
+#define PRINTVAL_T(X,F)     PRINTVAL_DOUBLE(X,F)
+#define PRINTVAL_TC(X,F)    PRINTVAL_CDOUBLE(X,F)
+#define PRINTVAL_TI(X,F)    PRINTVAL_DOUBLE(X,F)
+
+#define REAL(X)             creal(X)
+#define CONJ(X)             conj(X)
+#define VECTOR_DB(X,N,Y)                                    \
+    { unsigned int _i; for (_i=0; _i<(N); _i++)             \
+          (Y)[_i] = 10*log10((X)[_i]); }
+#define VECTOR_ADDSCALAR(X,N,S,Y)                           \
+    { unsigned int _i; for (_i=0; _i<(N); _i++)             \
+          (Y)[_i] = (X)[_i] + (S); }
+
+// always use internal double-precision transforms, even when linking
+// against fftw (which only provides single-precision plans here)
+#undef  FFT_PLAN
+#undef  FFT_CREATE_PLAN
+#undef  FFT_CREATE_PLAN_R2C
+#undef  FFT_DESTROY_PLAN
+#undef  FFT_EXECUTE
+#undef  FFT_DIR_FORWARD
+#undef  FFT_METHOD
+#define FFT_PLAN            fftdplan
+#define FFT_CREATE_PLAN     fftd_create_plan
+#define FFT_CREATE_PLAN_R2C fftd_create_plan_r2c
+#define FFT_DESTROY_PLAN    fftd_destroy_plan
+#define FFT_EXECUTE         fftd_execute
+#define FFT_DIR_FORWARD     LIQUID_FFT_FORWARD
+#define FFT_METHOD          0
+
+// source files
+#include "spgram.c"
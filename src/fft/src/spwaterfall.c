@@ -325,16 +325,22 @@ int SPWATERFALL(_consolidate_buffer)(SPWATERFALL() _q)
     //printf("consolidating... (rollover = %10u, total samples : %16llu, index : %u)\n",
     //        _q->rollover, SPGRAM(_get_num_samples_total)(_q->periodogram), _q->index_time);
     unsigned int i; // time index
-    unsigned int k; // freq index
     for (i=0; i<_q->time; i++) {
-        for (k=0; k<_q->nfft; k++) {
-            // convert to linear, compute average, convert back to log
-            T v0 = powf(10.0f, _q->psd[ (2*i + 0)*_q->nfft + k ]*0.1f);
-            T v1 = powf(10.0f, _q->psd[ (2*i + 1)*_q->nfft + k ]*0.1f);
-
-            // save result
-            _q->psd[ i*_q->nfft + k ] = 10.0f*log10f(0.5f*(v0+v1));
-        }
+        // NOTE: rows 2i and 2i+1 are not needed after row i is written
+        T * v0 = _q->psd + (2*i + 0)*_q->nfft;
+        T * v1 = _q->psd + (2*i + 1)*_q->nfft;
+        T * y  = _q->psd + i*_q->nfft;
+
+        // convert to linear: 10^(v/10) = exp(v ln(10)/10)
+        liquid_vectorf_mulscalar(v0, _q->nfft, 0.1f*M_LN10, v0);
+        liquid_vectorf_mulscalar(v1, _q->nfft, 0.1f*M_LN10, v1);
+        liquid_vectorf_exp(v0, _q->nfft, v0);
+        liquid_vectorf_exp(v1, _q->nfft, v1);
+
+        // compute average, convert back to log
+        liquid_vectorf_add(v0, v1, _q->nfft, y);
+        liquid_vectorf_mulscalar(y, _q->nfft, 0.5f, y);
+        liquid_vectorf_db(y, _q->nfft, y);
     }
 
     // update time index
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_arrays_autotest.c : test running transforms on caller-provided arrays
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// helper function (run plan on other arrays, verify result matches
+// running the plan on its own arrays, and that its own arrays are not
+// touched)
+//  _nfft   : transform size
+//  _dir    : transform direction
+//  _method : transform method
+void runtest_fft_arrays(unsigned int      _nfft,
+                        int               _dir,
+                        liquid_fft_method _method)
+{
+    float complex * x0 = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * x1 = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(_nfft*sizeof(float complex));
+    unsigned int i, k;
+    fftplan q = fft_create_plan_method(_nfft, x0, y0, _dir, 0, _method, 0);
+
+    for (k=0; k<3; k++) {
+        // run on plan arrays
+        for (i=0; i<_nfft; i++) {
+            x0[i] = randnf() + _Complex_I*randnf();
+            x1[i] = x0[i];
+        }
+        fft_execute(q);
+
+        // run on other arrays; plan arrays must be unchanged
+        for (i=0; i<_nfft; i++)
+            x0[i] = y1[i] = 0;
+        CONTEND_EQUALITY( fft_execute_arrays(q, x1, y1), LIQUID_OK );
+        for (i=0; i<_nfft; i++) {
+            CONTEND_EQUALITY( crealf(y1[i]), crealf(y0[i]) );
+            CONTEND_EQUALITY( cimagf(y1[i]), cimagf(y0[i]) );
+            CONTEND_EQUALITY( cabsf(x0[i]), 0 );
+        }
+    }
+
+    fft_destroy_plan(q);
+    free(x0);
+    free(y0);
+    free(x1);
+    free(y1);
+}
+
+void autotest_fft_arrays_dft()         { runtest_fft_arrays( 13, LIQUID_FFT_FORWARD,  LIQUID_FFT_METHOD_DFT        ); }
+void autotest_fft_arrays_radix2()      { runtest_fft_arrays(256, LIQUID_FFT_FORWARD,  LIQUID_FFT_METHOD_RADIX2     ); }
+void autotest_fft_arrays_radix4()      { runtest_fft_arrays(512, LIQUID_FFT_BACKWARD, LIQUID_FFT_METHOD_RADIX4     ); }
+void autotest_fft_arrays_mixed_radix() { runtest_fft_arrays(360, LIQUID_FFT_FORWARD,  LIQUID_FFT_METHOD_MIXED_RADIX); }
+void autotest_fft_arrays_rader()       { runtest_fft_arrays(107, LIQUID_FFT_BACKWARD, LIQUID_FFT_METHOD_RADER      ); }
+void autotest_fft_arrays_rader2()      { runtest_fft_arrays(107, LIQUID_FFT_FORWARD,  LIQUID_FFT_METHOD_RADER2     ); }
+
+// batch of transforms run on other arrays, out of place and in place
+//  _nfft   : transform size
+//  _howmany: number of transforms
+void runtest_fft_arrays_many(unsigned int _nfft,
+                             unsigned int _howmany)
+{
+    unsigned int n = _nfft*_howmany;
+    float complex * x0 = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(n*sizeof(float complex));
+    float complex * x1 = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    fftplan q = fft_create_plan_many(_nfft, _howmany, x0, 1, _nfft, y0, 1, _nfft,
+                                     LIQUID_FFT_FORWARD, 0);
+    for (i=0; i<n; i++) {
+        x0[i] = randnf() + _Complex_I*randnf();
+        x1[i] = x0[i];
+    }
+    fft_execute(q);
+
+    // out of place
+    CONTEND_EQUALITY( fft_execute_arrays(q, x1, y1), LIQUID_OK );
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY( crealf(y1[i]), crealf(y0[i]) );
+        CONTEND_EQUALITY( cimagf(y1[i]), cimagf(y0[i]) );
+    }
+
+    // in place
+    CONTEND_EQUALITY( fft_execute_arrays(q, x0, x0), LIQUID_OK );
+    for (i=0; i<n; i++)
+        CONTEND_DELTA( cabsf(x0[i] - y0[i]), 0, 1e-4f*_nfft );
+
+    fft_destroy_plan(q);
+    free(x0);
+    free(y0);
+    free(x1);
+    free(y1);
+}
+
+void autotest_fft_arrays_many_pow2()   { runtest_fft_arrays_many(64, 7); }
+void autotest_fft_arrays_many_mixed()  { runtest_fft_arrays_many(12, 5); }
+void autotest_fft_arrays_many_prime()  { runtest_fft_arrays_many(17, 3); }
+
+// test configuration errors
+void autotest_fft_arrays_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping fft_arrays config test with strict exit enabled\n");
+    return;
+#else
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    // real-valued transforms cannot be run on complex arrays
+    float         xr[16];
+    float complex x[16], y[16];
+    fftplan q = fft_create_plan_r2c(16, xr, y, 0);
+    CONTEND_INEQUALITY(LIQUID_OK, fft_execute_arrays(q, x, y));
+    fft_destroy_plan(q);
+#endif
+}
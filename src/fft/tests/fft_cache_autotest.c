@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_cache_autotest.c : test tables shared between transform plans
+//
+
+#include <stdlib.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// helper function (create many plans of the same size, verify that tables
+// are shared and released, and that each plan computes the same result
+// as a plan created on its own)
+//  _nfft   : transform size
+//  _method : transform method
+void runtest_fft_cache(unsigned int      _nfft,
+                       liquid_fft_method _method)
+{
+    unsigned int num_plans = 8;
+    unsigned int num_tables = fft_cache_num_tables();
+
+    // reference transform
+    float complex * x   = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * ref = (float complex*) malloc(_nfft*sizeof(float complex));
+    unsigned int i, k;
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    fftplan q0 = fft_create_plan_method(_nfft, x, ref, LIQUID_FFT_FORWARD, 0, _method, 0);
+    fft_execute(q0);
+    unsigned int num_tables_plan = fft_cache_num_tables();
+    CONTEND_GREATER_THAN( num_tables_plan, num_tables );
+
+    // create more plans in both directions: forward tables are all shared
+    // with first plan
+    fftplan qf[num_plans], qr[num_plans];
+    float complex * y[num_plans];
+    float complex * z[num_plans];
+    for (k=0; k<num_plans; k++) {
+        y[k] = (float complex*) malloc(_nfft*sizeof(float complex));
+        z[k] = (float complex*) malloc(_nfft*sizeof(float complex));
+        qf[k] = fft_create_plan_method(_nfft, x, y[k], LIQUID_FFT_FORWARD, 0, _method, 0);
+    }
+    CONTEND_EQUALITY( fft_cache_num_tables(), num_tables_plan );
+    for (k=0; k<num_plans; k++)
+        qr[k] = fft_create_plan_method(_nfft, y[k], z[k], LIQUID_FFT_BACKWARD, 0, _method, 0);
+    unsigned int num_tables_all = fft_cache_num_tables();
+
+    // destroy reference plan; tables are still referenced by other plans
+    fft_destroy_plan(q0);
+    CONTEND_EQUALITY( fft_cache_num_tables(), num_tables_all );
+
+    // run transforms and compare with reference
+    for (k=0; k<num_plans; k++) {
+        fft_execute(qf[k]);
+        for (i=0; i<_nfft; i++) {
+            CONTEND_EQUALITY( crealf(y[k][i]), crealf(ref[i]) );
+            CONTEND_EQUALITY( cimagf(y[k][i]), cimagf(ref[i]) );
+        }
+        fft_execute(qr[k]);
+        for (i=0; i<_nfft; i++)
+            CONTEND_DELTA( cabsf(z[k][i]/_nfft - x[i]), 0, 1e-5f );
+    }
+
+    // destroy plans and check that all tables have been released
+    for (k=0; k<num_plans; k++) {
+        fft_destroy_plan(qf[k]);
+        fft_destroy_plan(qr[k]);
+        free(y[k]);
+        free(z[k]);
+    }
+    CONTEND_EQUALITY( fft_cache_num_tables(), num_tables );
+    free(x);
+    free(ref);
+}
+
+void autotest_fft_cache_radix2()      { runtest_fft_cache(256, LIQUID_FFT_METHOD_RADIX2     ); }
+void autotest_fft_cache_radix4()      { runtest_fft_cache(512, LIQUID_FFT_METHOD_RADIX4     ); }
+void autotest_fft_cache_mixed_radix() { runtest_fft_cache(360, LIQUID_FFT_METHOD_MIXED_RADIX); }
+void autotest_fft_cache_rader()       { runtest_fft_cache(107, LIQUID_FFT_METHOD_RADER      ); }
+void autotest_fft_cache_rader2()      { runtest_fft_cache(107, LIQUID_FFT_METHOD_RADER2     ); }
+
+
+// four-step tables of the same size but different factors are distinct
+void autotest_fft_cache_four_step_factor()
+{
+    unsigned int nfft = 4096;
+    unsigned int n = fft_cache_num_tables();
+    float complex * w0 = fft_cache_four_step(nfft,  64, LIQUID_FFT_FORWARD);
+    float complex * w1 = fft_cache_four_step(nfft, 128, LIQUID_FFT_FORWARD);
+    float complex * w2 = fft_cache_four_step(nfft,  64, LIQUID_FFT_FORWARD);
+    CONTEND_EXPRESSION( w0 != w1 );
+    CONTEND_EXPRESSION( w0 == w2 );
+    CONTEND_EQUALITY( fft_cache_num_tables(), n + 2 );
+
+    // entry (k2=1, n1=1) is exp(-j 2 pi k2 n1 / nfft) for each factor
+    float complex v = cexpf(-_Complex_I*2*M_PI/(float)nfft);
+    CONTEND_DELTA( cabsf(w0[ 64 + 1] - v), 0, 1e-6f );
+    CONTEND_DELTA( cabsf(w1[128 + 1] - v), 0, 1e-6f );
+
+    fft_cache_release(w0);
+    fft_cache_release(w1);
+    fft_cache_release(w2);
+    CONTEND_EQUALITY( fft_cache_num_tables(), n );
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_four_step_autotest.c : test four-step transforms of large size
+//                            against other methods
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// helper function (compare four-step transform against reference plan)
+//  _nfft   : transform size
+//  _dir    : transform direction
+void runtest_fft_four_step(unsigned int _nfft,
+                           int          _dir)
+{
+    float complex * x     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y_ref = (float complex*) malloc(_nfft*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // reference: radix-4 if possible, mixed-radix otherwise
+    liquid_fft_method method = fft_is_radix2(_nfft) ? LIQUID_FFT_METHOD_RADIX4 :
+                                                      LIQUID_FFT_METHOD_MIXED_RADIX;
+    fftplan q_ref = fft_create_plan_method(_nfft, x, y_ref, _dir, 0, method, 0);
+    fft_execute(q_ref);
+    fft_destroy_plan(q_ref);
+
+    // four-step transform; input must not be modified
+    float complex * x0 = (float complex*) malloc(_nfft*sizeof(float complex));
+    memmove(x0, x, _nfft*sizeof(float complex));
+    fftplan q = fft_create_plan_method(_nfft, x, y, _dir, 0, LIQUID_FFT_METHOD_FOUR_STEP, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    float tol = 2e-6f * sqrtf((float)_nfft) * (1 + liquid_nextpow2(_nfft));
+    for (i=0; i<_nfft; i++) {
+        CONTEND_DELTA( crealf(y[i]), crealf(y_ref[i]), tol );
+        CONTEND_DELTA( cimagf(y[i]), cimagf(y_ref[i]), tol );
+        CONTEND_EQUALITY( crealf(x[i]), crealf(x0[i]) );
+        CONTEND_EQUALITY( cimagf(x[i]), cimagf(x0[i]) );
+    }
+
+    // run again in place
+    q = fft_create_plan_method(_nfft, x, x, _dir, 0, LIQUID_FFT_METHOD_FOUR_STEP, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+    for (i=0; i<_nfft; i++) {
+        CONTEND_DELTA( crealf(x[i]), crealf(y_ref[i]), tol );
+        CONTEND_DELTA( cimagf(x[i]), cimagf(y_ref[i]), tol );
+    }
+
+    free(x);
+    free(y);
+    free(y_ref);
+    free(x0);
+}
+
+// power-of-two column transforms, interleaved (576 = 18 x 32 pads blocks)
+void autotest_fft_four_step_256()    { runtest_fft_four_step(  256, LIQUID_FFT_FORWARD ); }
+void autotest_fft_four_step_576()    { runtest_fft_four_step(  576, LIQUID_FFT_BACKWARD); }
+void autotest_fft_four_step_65536()  { runtest_fft_four_step(65536, LIQUID_FFT_FORWARD ); }
+void autotest_fft_four_step_49152()  { runtest_fft_four_step(49152, LIQUID_FFT_BACKWARD); }
+
+// other column transforms
+void autotest_fft_four_step_360()    { runtest_fft_four_step(  360, LIQUID_FFT_FORWARD ); }
+void autotest_fft_four_step_1000()   { runtest_fft_four_step( 1000, LIQUID_FFT_BACKWARD); }
+void autotest_fft_four_step_30000()  { runtest_fft_four_step(30000, LIQUID_FFT_FORWARD ); }
+
+// test configuration errors and plan selection
+void autotest_fft_four_step_config()
+{
+    // large composite transforms use the four-step algorithm by default
+    CONTEND_EQUALITY(liquid_fft_estimate_method(3*65536), LIQUID_FFT_METHOD_FOUR_STEP);
+    CONTEND_EQUALITY(fft_estimate_four_step(3*65536), 384);
+    CONTEND_EQUALITY(fft_estimate_four_step(2*65537),   0);
+
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping fft_four_step config test with strict exit enabled\n");
+    return;
+#else
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    // no factor of at least 16 below square root
+    float complex x[254], y[254];
+    CONTEND_EXPRESSION(fft_create_plan_method(254, x, y, LIQUID_FFT_FORWARD, 0,
+                       LIQUID_FFT_METHOD_FOUR_STEP, 0)==NULL);
+
+    // print plans
+    fftplan q = fft_create_plan_method(320, x, y, LIQUID_FFT_FORWARD, 0, LIQUID_FFT_METHOD_FOUR_STEP, 0);
+    CONTEND_EQUALITY(LIQUID_OK, fft_print_plan(q));
+    fft_destroy_plan(q);
+    q = fft_create_plan_method(256, x, y, LIQUID_FFT_FORWARD, 0, LIQUID_FFT_METHOD_FOUR_STEP, 0);
+    CONTEND_EQUALITY(LIQUID_OK, fft_print_plan(q));
+    fft_destroy_plan(q);
+#endif
+}
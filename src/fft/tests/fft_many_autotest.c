@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_many_autotest.c : test batch of transforms against double-precision
+//                       reference for several memory layouts
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper function (compare batch of transforms against double-precision DFT)
+//  _nfft       : transform size
+//  _howmany    : number of transforms
+//  _interleave : interleave transforms (otherwise contiguous with padding)
+//  _inplace    : run transforms in place
+//  _dir        : transform direction
+void runtest_fft_many(unsigned int _nfft,
+                      unsigned int _howmany,
+                      int          _interleave,
+                      int          _inplace,
+                      int          _dir)
+{
+    // layout: element i of transform b at b*dist + i*stride; contiguous
+    // transforms are padded to check that samples in between are untouched
+    unsigned int stride = _interleave ? _howmany : 1;
+    unsigned int dist   = _interleave ? 1        : _nfft + 3;
+    unsigned int len    = _interleave ? _nfft*_howmany : dist*_howmany;
+    float complex *  x     = (float complex*)  malloc(len*sizeof(float complex));
+    float complex *  y     = (float complex*)  malloc(len*sizeof(float complex));
+    double complex * y_ref = (double complex*) malloc(_nfft*sizeof(double complex));
+    unsigned int i, k, b;
+
+    // generate random input and set output to known value
+    for (i=0; i<len; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        y[i] = 7.0f;
+    }
+    float complex * x0 = (float complex*) malloc(len*sizeof(float complex));
+    memmove(x0, x, len*sizeof(float complex));
+
+    // compute transforms
+    float complex * yp = _inplace ? x : y;
+    fftplan q = fft_create_plan_many(_nfft, _howmany, x, stride, dist, yp, stride, dist, _dir, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    // check each transform against reference
+    float tol = 2e-6f * sqrtf((float)_nfft) * (1 + liquid_nextpow2(_nfft));
+    double d = _dir == LIQUID_FFT_FORWARD ? -1.0 : 1.0;
+    for (b=0; b<_howmany; b++) {
+        for (k=0; k<_nfft; k++) {
+            y_ref[k] = 0;
+            for (i=0; i<_nfft; i++)
+                y_ref[k] += x0[b*dist + i*stride] * cexp(_Complex_I*d*2*M_PI*(double)((i*k)%_nfft) / (double)_nfft);
+        }
+        for (k=0; k<_nfft; k++) {
+            CONTEND_DELTA( crealf(yp[b*dist + k*stride]), creal(y_ref[k]), tol );
+            CONTEND_DELTA( cimagf(yp[b*dist + k*stride]), cimag(y_ref[k]), tol );
+        }
+    }
+
+    // check that padding is untouched
+    if (!_interleave) {
+        for (b=0; b<_howmany; b++) {
+            for (i=_nfft; i<dist; i++) {
+                float complex v = _inplace ? x0[b*dist + i] : 7.0f;
+                CONTEND_EQUALITY( crealf(yp[b*dist + i]), crealf(v) );
+                CONTEND_EQUALITY( cimagf(yp[b*dist + i]), cimagf(v) );
+            }
+        }
+    }
+
+    free(x);
+    free(x0);
+    free(y);
+    free(y_ref);
+}
+
+// contiguous transforms, power of two
+void autotest_fft_many_2x5()        { runtest_fft_many(   2,  5, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_4x8()        { runtest_fft_many(   4,  8, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_8x3()        { runtest_fft_many(   8,  3, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_16x4()       { runtest_fft_many(  16,  4, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_32x64()      { runtest_fft_many(  32, 64, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_64x65()      { runtest_fft_many(  64, 65, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_128x7()      { runtest_fft_many( 128,  7, 0, 0, LIQUID_FFT_BACKWARD); }
+void autotest_fft_many_256x17()     { runtest_fft_many( 256, 17, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_1024x5()     { runtest_fft_many(1024,  5, 0, 0, LIQUID_FFT_BACKWARD); }
+
+// other sizes and single transforms
+void autotest_fft_many_1x3()        { runtest_fft_many(   1,  3, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_12x6()       { runtest_fft_many(  12,  6, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_17x4()       { runtest_fft_many(  17,  4, 0, 0, LIQUID_FFT_BACKWARD); }
+void autotest_fft_many_64x1()       { runtest_fft_many(  64,  1, 0, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_2048x2()     { runtest_fft_many(2048,  2, 0, 0, LIQUID_FFT_FORWARD); }
+
+// interleaved transforms
+void autotest_fft_many_interleave_16x9()    { runtest_fft_many(  16,  9, 1, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_interleave_64x32()   { runtest_fft_many(  64, 32, 1, 0, LIQUID_FFT_BACKWARD); }
+void autotest_fft_many_interleave_20x6()    { runtest_fft_many(  20,  6, 1, 0, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_interleave_1024x3()  { runtest_fft_many(1024,  3, 1, 0, LIQUID_FFT_FORWARD); }
+
+// in-place transforms
+void autotest_fft_many_inplace_32x10()      { runtest_fft_many(  32, 10, 0, 1, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_inplace_15x3()       { runtest_fft_many(  15,  3, 0, 1, LIQUID_FFT_FORWARD); }
+void autotest_fft_many_inplace_interleave_128x12() { runtest_fft_many( 128, 12, 1, 1, LIQUID_FFT_BACKWARD); }
+
+// run batches in each layout for each SIMD type available on this host
+void autotest_fft_many_simd_types()
+{
+    unsigned int i, m;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (!liquid_simd_is_available(i))
+            continue;
+        liquid_simd_set_type(i);
+        for (m=1; m<=7; m+=2) {
+            runtest_fft_many(1<<m, 12, 0, 0, LIQUID_FFT_FORWARD);
+            runtest_fft_many(1<<m, 12, 1, 0, LIQUID_FFT_BACKWARD);
+            runtest_fft_many(1<<m,  5, 1, 1, LIQUID_FFT_FORWARD);
+        }
+    }
+
+    // restore automatic selection
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
+
+// test configuration errors
+void autotest_fft_many_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping fft_many config test with strict exit enabled\n");
+    return;
+#else
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float complex x[64], y[64];
+    CONTEND_EXPRESSION(fft_create_plan_many( 0, 4, x, 1, 16, y, 1, 16, LIQUID_FFT_FORWARD, 0)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_many(16, 0, x, 1, 16, y, 1, 16, LIQUID_FFT_FORWARD, 0)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_many(16, 4, x, 0, 16, y, 1, 16, LIQUID_FFT_FORWARD, 0)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_many(16, 4, x, 1, 16, y, 0, 16, LIQUID_FFT_FORWARD, 0)==NULL);
+
+    // print plans
+    fftplan q = fft_create_plan_many(16, 4, x, 1, 16, y, 1, 16, LIQUID_FFT_FORWARD, 0);
+    CONTEND_EQUALITY(LIQUID_OK, fft_print_plan(q));
+    fft_destroy_plan(q);
+    q = fft_create_plan_many(12, 4, x, 1, 12, y, 1, 12, LIQUID_FFT_FORWARD, 0);
+    CONTEND_EQUALITY(LIQUID_OK, fft_print_plan(q));
+    fft_destroy_plan(q);
+#endif
+}
+
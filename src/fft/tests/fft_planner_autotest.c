@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_planner_autotest.c : test measuring planner and wisdom
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#   include <pthread.h>
+#endif
+
+// autotest data definitions
+#include "src/fft/tests/fft_runtest.h"
+
+// helper function (compare transform created with given flags against
+// expected output)
+void fft_planner_test(float complex * _x,
+                      float complex * _test,
+                      unsigned int    _n,
+                      int             _flags)
+{
+    float complex y[_n];
+    fftplan q = fft_create_plan(_n, _x, y, LIQUID_FFT_FORWARD, _flags);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        CONTEND_DELTA( cabsf(y[i] - _test[i]), 0, 2e-4f );
+}
+
+// read entire file into string
+int fft_planner_read(const char * _filename, char * _buf, unsigned int _len)
+{
+    FILE * fid = fopen(_filename,"r");
+    if (fid == NULL)
+        return -1;
+    size_t n = fread(_buf, 1, _len-1, fid);
+    _buf[n] = '\0';
+    fclose(fid);
+    return 0;
+}
+
+// measured plans must compute the same transforms as estimated ones
+void autotest_fft_planner_measure()
+{
+    fft_wisdom_clear();
+    fft_planner_test(fft_test_x64,  fft_test_y64,   64, LIQUID_FFT_MEASURE);
+    fft_planner_test(fft_test_x96,  fft_test_y96,   96, LIQUID_FFT_MEASURE);
+    fft_planner_test(fft_test_x120, fft_test_y120, 120, LIQUID_FFT_MEASURE);
+    fft_planner_test(fft_test_x157, fft_test_y157, 157, LIQUID_FFT_MEASURE);
+    fft_planner_test(fft_test_x192, fft_test_y192, 192, LIQUID_FFT_MEASURE);
+    fft_planner_test(fft_test_x509, fft_test_y509, 509, LIQUID_FFT_MEASURE);
+
+    // wisdom is used for subsequent plans without measuring flag
+    fft_planner_test(fft_test_x96,  fft_test_y96,   96, LIQUID_FFT_ESTIMATE);
+    fft_wisdom_clear();
+}
+
+// exported wisdom can be imported again
+void autotest_fft_planner_wisdom_export()
+{
+    const char * filename_0 = "fft_planner_autotest_wisdom_0.txt";
+    const char * filename_1 = "fft_planner_autotest_wisdom_1.txt";
+    char buf_0[4096], buf_1[4096];
+
+    fft_wisdom_clear();
+    fft_planner_test(fft_test_x192, fft_test_y192, 192, LIQUID_FFT_MEASURE);
+    CONTEND_EQUALITY( fft_wisdom_export(filename_0), LIQUID_OK );
+
+    fft_wisdom_clear();
+    CONTEND_EQUALITY( fft_wisdom_import(filename_0), LIQUID_OK );
+    CONTEND_EQUALITY( fft_wisdom_export(filename_1), LIQUID_OK );
+
+    CONTEND_EQUALITY( fft_planner_read(filename_0, buf_0, sizeof(buf_0)), 0 );
+    CONTEND_EQUALITY( fft_planner_read(filename_1, buf_1, sizeof(buf_1)), 0 );
+    CONTEND_EQUALITY( strcmp(buf_0, buf_1), 0 );
+    CONTEND_EXPRESSION( strstr(buf_0, "\n192 ") != NULL );
+    fft_wisdom_clear();
+}
+
+// methods from imported wisdom are used when creating plans
+void autotest_fft_planner_wisdom_import()
+{
+    const char * filename = "fft_planner_autotest_wisdom_import.txt";
+    FILE * fid = fopen(filename,"w");
+    CONTEND_EXPRESSION( fid != NULL );
+    if (fid == NULL)
+        return;
+    fprintf(fid,"# hand-written wisdom\n");
+    fprintf(fid,"liquid-fft-wisdom 1 %u\n", (unsigned int)sizeof(float));
+    fprintf(fid,"64 radix2\n");
+    fprintf(fid,"96 mixed-radix 3\n");
+    fprintf(fid,"157 rader\n");
+    fprintf(fid,"32 dft\n");
+    fclose(fid);
+
+    fft_wisdom_clear();
+    CONTEND_EQUALITY( fft_wisdom_import(filename), LIQUID_OK );
+    fft_planner_test(fft_test_x64,  fft_test_y64,   64, LIQUID_FFT_ESTIMATE);
+    fft_planner_test(fft_test_x96,  fft_test_y96,   96, LIQUID_FFT_ESTIMATE);
+    fft_planner_test(fft_test_x157, fft_test_y157, 157, LIQUID_FFT_ESTIMATE);
+
+    // entries are kept when exporting again
+    char buf[4096];
+    CONTEND_EQUALITY( fft_wisdom_export(filename), LIQUID_OK );
+    CONTEND_EQUALITY( fft_planner_read(filename, buf, sizeof(buf)), 0 );
+    CONTEND_EXPRESSION( strstr(buf, "\n96 mixed-radix 3\n") != NULL );
+    CONTEND_EXPRESSION( strstr(buf, "\n157 rader\n")        != NULL );
+    fft_wisdom_clear();
+}
+
+// invalid wisdom files are rejected without changing existing wisdom
+void autotest_fft_planner_wisdom_invalid()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping fft wisdom invalid test with strict exit enabled\n");
+    return;
+#else
+    const char * filename   = "fft_planner_autotest_wisdom_invalid.txt";
+    const char * filename_0 = "fft_planner_autotest_wisdom_invalid_0.txt";
+    const char * entries[] = {
+        "96 radix4\n",          // radix-4 requires power of two
+        "64 mixed-radix 3\n",   // factor does not divide size
+        "64 mixed-radix\n",     // factor missing
+        "96 rader\n",           // size is not prime
+        "96 unknown-method\n",  // invalid method
+        "64 radix2 threads\n",  // thread flag requires version 2
+        "64 radix2 4\n",        // factor only valid for mixed-radix
+    };
+    char buf[4096];
+    unsigned int i;
+
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+    CONTEND_INEQUALITY( fft_wisdom_import("fft_planner_autotest_missing.txt"), LIQUID_OK );
+
+    fft_wisdom_clear();
+    for (i=0; i<sizeof(entries)/sizeof(entries[0]); i++) {
+        FILE * fid = fopen(filename,"w");
+        fprintf(fid,"liquid-fft-wisdom 1 %u\n", (unsigned int)sizeof(float));
+        fprintf(fid,"32 dft\n");
+        fprintf(fid,"%s", entries[i]);
+        fclose(fid);
+        CONTEND_INEQUALITY( fft_wisdom_import(filename), LIQUID_OK );
+    }
+
+    // missing header or wrong sample size
+    FILE * fid = fopen(filename,"w");
+    fprintf(fid,"32 dft\n");
+    fclose(fid);
+    CONTEND_INEQUALITY( fft_wisdom_import(filename), LIQUID_OK );
+    fid = fopen(filename,"w");
+    fprintf(fid,"liquid-fft-wisdom 1 %u\n", 2*(unsigned int)sizeof(float));
+    fclose(fid);
+    CONTEND_INEQUALITY( fft_wisdom_import(filename), LIQUID_OK );
+
+    // no entries should have been added
+    CONTEND_EQUALITY( fft_wisdom_export(filename_0), LIQUID_OK );
+    CONTEND_EQUALITY( fft_planner_read(filename_0, buf, sizeof(buf)), 0 );
+    CONTEND_EXPRESSION( strstr(buf, "\n32 dft") == NULL );
+#endif
+}
+
+
+// wisdom measured with and without threads is kept separately
+void autotest_fft_planner_wisdom_threads_flag()
+{
+    const char * filename = "fft_planner_autotest_wisdom_flag.txt";
+    FILE * fid = fopen(filename,"w");
+    CONTEND_EXPRESSION( fid != NULL );
+    if (fid == NULL)
+        return;
+    fprintf(fid,"liquid-fft-wisdom 2 %u\n", (unsigned int)sizeof(float));
+    fprintf(fid,"64 dft\n");
+    fprintf(fid,"128 radix2 threads\n");
+    fclose(fid);
+
+    fft_wisdom_clear();
+    CONTEND_EQUALITY( fft_wisdom_import(filename), LIQUID_OK );
+
+    // entries apply only to plans with the same thread flag
+    liquid_fft_method method;
+    unsigned int      factor;
+    fft_planner_select(64, 0, &method, &factor);
+    CONTEND_EQUALITY( method, LIQUID_FFT_METHOD_DFT );
+    fft_planner_select(64, LIQUID_FFT_THREADS, &method, &factor);
+    CONTEND_EQUALITY( method, liquid_fft_estimate_method(64) );
+    fft_planner_select(128, LIQUID_FFT_THREADS, &method, &factor);
+    CONTEND_EQUALITY( method, LIQUID_FFT_METHOD_RADIX2 );
+    fft_planner_select(128, 0, &method, &factor);
+    CONTEND_EQUALITY( method, liquid_fft_estimate_method(128) );
+
+    // thread flag is kept when exporting again
+    char buf[4096];
+    CONTEND_EQUALITY( fft_wisdom_export(filename), LIQUID_OK );
+    CONTEND_EQUALITY( fft_planner_read(filename, buf, sizeof(buf)), 0 );
+    CONTEND_EXPRESSION( strstr(buf, "\n64 dft\n")              != NULL );
+    CONTEND_EXPRESSION( strstr(buf, "\n128 radix2 threads\n")  != NULL );
+    fft_wisdom_clear();
+}
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+// repeatedly import and clear wisdom
+void * fft_planner_wisdom_thread(void * _filename)
+{
+    unsigned int i;
+    for (i=0; i<200; i++) {
+        fft_wisdom_import((const char*)_filename);
+        fft_wisdom_clear();
+    }
+    return NULL;
+}
+#endif
+
+// plans may be created while another thread changes wisdom
+void autotest_fft_planner_wisdom_threads()
+{
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+    const char * filename = "fft_planner_autotest_wisdom_threads.txt";
+    FILE * fid = fopen(filename,"w");
+    CONTEND_EXPRESSION( fid != NULL );
+    if (fid == NULL)
+        return;
+    fprintf(fid,"liquid-fft-wisdom 1 %u\n", (unsigned int)sizeof(float));
+    unsigned int n;
+    for (n=2; n<=512; n++)
+        fprintf(fid,"%u dft\n", n);
+    fprintf(fid,"96 mixed-radix 3\n");
+    fclose(fid);
+
+    fft_wisdom_clear();
+    pthread_t thread;
+    pthread_create(&thread, NULL, fft_planner_wisdom_thread, (void*)filename);
+    unsigned int i;
+    for (i=0; i<50; i++) {
+        fft_planner_test(fft_test_x96,  fft_test_y96,   96, LIQUID_FFT_ESTIMATE);
+        fft_planner_test(fft_test_x157, fft_test_y157, 157, LIQUID_FFT_ESTIMATE);
+    }
+    pthread_join(thread, NULL);
+    fft_wisdom_clear();
+#else
+    AUTOTEST_WARN("skipping fft planner threads test without pthreads\n");
+#endif
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_pruned_autotest.c : test transforms of zero-padded inputs and with
+//                         partial outputs against regular transforms
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// helper function (compare pruned transform against regular transform
+// on required outputs)
+//  _nfft       : transform size
+//  _num_in     : number of non-zero input samples
+//  _out_offset : index of first required output
+//  _num_out    : number of required outputs
+//  _dir        : transform direction
+void runtest_fft_pruned(unsigned int _nfft,
+                        unsigned int _num_in,
+                        unsigned int _out_offset,
+                        unsigned int _num_out,
+                        int          _dir)
+{
+    float complex * x     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y_ref = (float complex*) malloc(_nfft*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = i < _num_in ? randnf() + _Complex_I*randnf() : 0.0f;
+
+    // reference
+    fftplan q = fft_create_plan(_nfft, x, y_ref, _dir, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    // pruned transform
+    q = fft_create_plan_pruned(_nfft, x, y, _dir, 0, _num_in, _out_offset, _num_out);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    float tol = 2e-6f * sqrtf((float)_num_in) * (1 + liquid_nextpow2(_nfft));
+    for (i=0; i<_num_out; i++) {
+        unsigned int k = (_out_offset + i) % _nfft;
+        CONTEND_DELTA( crealf(y[k]), crealf(y_ref[k]), tol );
+        CONTEND_DELTA( cimagf(y[k]), cimagf(y_ref[k]), tol );
+    }
+
+    free(x);
+    free(y);
+    free(y_ref);
+}
+
+// zero-padded input
+void autotest_fft_pruned_in_1024_16()   { runtest_fft_pruned(1024,   16,   0, 1024, LIQUID_FFT_FORWARD ); }
+void autotest_fft_pruned_in_1024_100()  { runtest_fft_pruned(1024,  100,   0, 1024, LIQUID_FFT_BACKWARD); }
+void autotest_fft_pruned_in_1024_512()  { runtest_fft_pruned(1024,  512,   0, 1024, LIQUID_FFT_FORWARD ); }
+void autotest_fft_pruned_in_4096_1()    { runtest_fft_pruned(4096,    1,   0, 4096, LIQUID_FFT_FORWARD ); }
+void autotest_fft_pruned_in_360_20()    { runtest_fft_pruned( 360,   20,   0,  360, LIQUID_FFT_BACKWARD); }
+
+// partial output, wrapping around end of transform
+void autotest_fft_pruned_out_1024_16()  { runtest_fft_pruned(1024, 1024, 100,   16, LIQUID_FFT_FORWARD ); }
+void autotest_fft_pruned_out_1024_64()  { runtest_fft_pruned(1024, 1024, 990,   64, LIQUID_FFT_BACKWARD); }
+void autotest_fft_pruned_out_1024_600() { runtest_fft_pruned(1024, 1024,   0,  600, LIQUID_FFT_FORWARD ); }
+void autotest_fft_pruned_out_4096_1()   { runtest_fft_pruned(4096, 4096, 123,    1, LIQUID_FFT_FORWARD ); }
+void autotest_fft_pruned_out_360_30()   { runtest_fft_pruned( 360,  360, 350,   30, LIQUID_FFT_BACKWARD); }
+
+// both zero-padded input and partial output
+void autotest_fft_pruned_both_2048()    { runtest_fft_pruned(2048,   64, 500,   20, LIQUID_FFT_FORWARD ); }
+void autotest_fft_pruned_both_97()      { runtest_fft_pruned(  97,   10,  90,   10, LIQUID_FFT_BACKWARD); }
+
+// test configuration errors
+void autotest_fft_pruned_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping fft_pruned config test with strict exit enabled\n");
+    return;
+#else
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    float complex x[64], y[64];
+    CONTEND_EXPRESSION(fft_create_plan_pruned( 0, x, y, LIQUID_FFT_FORWARD, 0, 16,  0, 64)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0,  0,  0, 64)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0, 65,  0, 64)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0, 16,  0,  0)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0, 16,  0, 65)==NULL);
+    CONTEND_EXPRESSION(fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0, 16, 64, 16)==NULL);
+
+    // print plans
+    fftplan q = fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0, 4, 0, 64);
+    CONTEND_EQUALITY(LIQUID_OK, fft_print_plan(q));
+    fft_destroy_plan(q);
+    q = fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0, 64, 8, 4);
+    CONTEND_EQUALITY(LIQUID_OK, fft_print_plan(q));
+    fft_destroy_plan(q);
+    q = fft_create_plan_pruned(64, x, y, LIQUID_FFT_FORWARD, 0, 64, 0, 64);
+    CONTEND_EQUALITY(LIQUID_OK, fft_print_plan(q));
+    fft_destroy_plan(q);
+#endif
+}
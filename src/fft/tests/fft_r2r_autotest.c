@@ -103,3 +103,88 @@ void autotest_fft_r2r_RODFT10_n27()  { fft_r2r_test(fftdata_r2r_x27, fftdata_r2r
 void autotest_fft_r2r_RODFT01_n27()  { fft_r2r_test(fftdata_r2r_x27, fftdata_r2r_RODFT01_y27, 27, LIQUID_FFT_RODFT01); }
 void autotest_fft_r2r_RODFT11_n27()  { fft_r2r_test(fftdata_r2r_x27, fftdata_r2r_RODFT11_y27, 27, LIQUID_FFT_RODFT11); }
 
+
+
+//
+// AUTOTESTS: real-to-real ffts against double-precision direct evaluation
+//
+
+// compute transform directly in double precision
+//  _x      : input [size: _n x 1]
+//  _n      : transform size
+//  _kind   : transform type
+//  _k      : output index
+double fft_r2r_direct(float *      _x,
+                      unsigned int _n,
+                      int          _kind,
+                      unsigned int _k)
+{
+    double v = 0;
+    double k = (double)_k;
+    unsigned int j;
+    switch (_kind) {
+    case LIQUID_FFT_REDFT00:
+        if (_n == 1) return 2*_x[0];
+        v = _x[0] + ((_k % 2) ? -1 : 1)*_x[_n-1];
+        for (j=1; j<_n-1; j++) v += 2*_x[j]*cos(M_PI*j*k/(_n-1));
+        return v;
+    case LIQUID_FFT_REDFT10:
+        for (j=0; j<_n; j++) v += 2*_x[j]*cos(M_PI*(j+0.5)*k/_n);
+        return v;
+    case LIQUID_FFT_REDFT01:
+        v = _x[0];
+        for (j=1; j<_n; j++) v += 2*_x[j]*cos(M_PI*j*(k+0.5)/_n);
+        return v;
+    case LIQUID_FFT_REDFT11:
+        for (j=0; j<_n; j++) v += 2*_x[j]*cos(M_PI*(j+0.5)*(k+0.5)/_n);
+        return v;
+    case LIQUID_FFT_RODFT00:
+        for (j=0; j<_n; j++) v += 2*_x[j]*sin(M_PI*(j+1)*(k+1)/(_n+1));
+        return v;
+    case LIQUID_FFT_RODFT10:
+        for (j=0; j<_n; j++) v += 2*_x[j]*sin(M_PI*(j+0.5)*(k+1)/_n);
+        return v;
+    case LIQUID_FFT_RODFT01:
+        v = ((_k % 2) ? -1 : 1)*_x[_n-1];
+        for (j=0; j<_n-1; j++) v += 2*_x[j]*sin(M_PI*(j+1)*(k+0.5)/_n);
+        return v;
+    case LIQUID_FFT_RODFT11:
+        for (j=0; j<_n; j++) v += 2*_x[j]*sin(M_PI*(j+0.5)*(k+0.5)/_n);
+        return v;
+    default:;
+    }
+    return 0;
+}
+
+// run all transform types of a particular size against direct evaluation
+void fft_r2r_test_direct(unsigned int _n)
+{
+    int kinds[8] = {LIQUID_FFT_REDFT00, LIQUID_FFT_REDFT10, LIQUID_FFT_REDFT01, LIQUID_FFT_REDFT11,
+                    LIQUID_FFT_RODFT00, LIQUID_FFT_RODFT10, LIQUID_FFT_RODFT01, LIQUID_FFT_RODFT11};
+    float x[_n], y[_n];
+    unsigned int i, k;
+    for (i=0; i<_n; i++)
+        x[i] = randnf();
+
+    // output magnitude grows as sqrt(n)
+    float tol = 4e-6f * sqrtf((float)_n) * (1 + liquid_nextpow2(_n));
+    for (k=0; k<8; k++) {
+        fftplan q = fft_create_plan_r2r_1d(_n, x, y, kinds[k], 0);
+        fft_execute(q);
+        fft_destroy_plan(q);
+        for (i=0; i<_n; i++)
+            CONTEND_DELTA( y[i], fft_r2r_direct(x, _n, kinds[k], i), tol );
+    }
+}
+
+void autotest_fft_r2r_direct_n1()    { fft_r2r_test_direct(   1); }
+void autotest_fft_r2r_direct_n2()    { fft_r2r_test_direct(   2); }
+void autotest_fft_r2r_direct_n3()    { fft_r2r_test_direct(   3); }
+void autotest_fft_r2r_direct_n4()    { fft_r2r_test_direct(   4); }
+void autotest_fft_r2r_direct_n5()    { fft_r2r_test_direct(   5); }
+void autotest_fft_r2r_direct_n6()    { fft_r2r_test_direct(   6); }
+void autotest_fft_r2r_direct_n17()   { fft_r2r_test_direct(  17); }
+void autotest_fft_r2r_direct_n64()   { fft_r2r_test_direct(  64); }
+void autotest_fft_r2r_direct_n100()  { fft_r2r_test_direct( 100); }
+void autotest_fft_r2r_direct_n1024() { fft_r2r_test_direct(1024); }
+
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_radix4_autotest.c : test radix-4 (Stockham) transforms against
+//                         double-precision reference
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper function (compare transform against double-precision DFT)
+//  _nfft       : transform size
+//  _dir        : direction
+//  _inplace    : run in place (input and output buffers are the same)
+void runtest_fft_radix4(unsigned int _nfft,
+                        int          _dir,
+                        int          _inplace)
+{
+    float complex * x = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y = (float complex*) malloc(_nfft*sizeof(float complex));
+    double complex * y_ref = (double complex*) malloc(_nfft*sizeof(double complex));
+    double complex * w     = (double complex*) malloc(_nfft*sizeof(double complex));
+    unsigned int i, k;
+
+    // generate random input and compute reference transform
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    double d = (_dir == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+    for (i=0; i<_nfft; i++)
+        w[i] = cexp(_Complex_I*d*2*M_PI*(double)i / (double)_nfft);
+    for (k=0; k<_nfft; k++) {
+        y_ref[k] = 0;
+        for (i=0; i<_nfft; i++)
+            y_ref[k] += x[i] * w[(i*k) % _nfft];
+    }
+
+    // compute transform
+    float complex * buf_out = _inplace ? x : y;
+    fftplan q = fft_create_plan(_nfft, x, buf_out, _dir, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    // check error; output magnitude grows as sqrt(nfft) and round-off
+    // error with log2(nfft)
+    float tol = 2e-6f * sqrtf((float)_nfft) * liquid_nextpow2(_nfft);
+    for (k=0; k<_nfft; k++) {
+        CONTEND_DELTA( crealf(buf_out[k]), creal(y_ref[k]), tol );
+        CONTEND_DELTA( cimagf(buf_out[k]), cimag(y_ref[k]), tol );
+    }
+
+    free(x);
+    free(y);
+    free(y_ref);
+    free(w);
+}
+
+// run all sizes and directions for each SIMD type available on this host
+void autotest_fft_radix4_simd_types()
+{
+    unsigned int i, m;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (!liquid_simd_is_available(i))
+            continue;
+        liquid_simd_set_type(i);
+        for (m=5; m<=12; m++) {
+            runtest_fft_radix4(1<<m, LIQUID_FFT_FORWARD,  0);
+            runtest_fft_radix4(1<<m, LIQUID_FFT_BACKWARD, 0);
+            runtest_fft_radix4(1<<m, LIQUID_FFT_FORWARD,  1);
+            runtest_fft_radix4(1<<m, LIQUID_FFT_BACKWARD, 1);
+        }
+    }
+
+    // restore automatic selection
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
+
+// forward and backward transform should recover original input
+void autotest_fft_radix4_inverse()
+{
+    unsigned int nfft = 2048;
+    float complex x[nfft], y[nfft], z[nfft];
+    unsigned int i;
+    for (i=0; i<nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    fftplan qf = fft_create_plan(nfft, x, y, LIQUID_FFT_FORWARD,  0);
+    fftplan qr = fft_create_plan(nfft, y, z, LIQUID_FFT_BACKWARD, 0);
+    fft_execute(qf);
+    fft_execute(qr);
+    fft_destroy_plan(qf);
+    fft_destroy_plan(qr);
+
+    for (i=0; i<nfft; i++) {
+        CONTEND_DELTA( crealf(z[i])/nfft, crealf(x[i]), 1e-5f );
+        CONTEND_DELTA( cimagf(z[i])/nfft, cimagf(x[i]), 1e-5f );
+    }
+}
+
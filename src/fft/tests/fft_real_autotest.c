@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_real_autotest.c : test real-input (r2c) and real-output (c2r)
+//                       transforms against double-precision reference
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper function (compare real-input transform against double-precision DFT)
+//  _nfft       : transform size
+void runtest_fft_r2c(unsigned int _nfft)
+{
+    unsigned int nout = _nfft/2 + 1;
+    float *          x     = (float*)          malloc(_nfft*sizeof(float));
+    float complex *  y     = (float complex*)  malloc(nout *sizeof(float complex));
+    double complex * y_ref = (double complex*) malloc(nout *sizeof(double complex));
+    unsigned int i, k;
+
+    // generate random input and compute reference transform
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf();
+    for (k=0; k<nout; k++) {
+        y_ref[k] = 0;
+        for (i=0; i<_nfft; i++)
+            y_ref[k] += x[i] * cexp(-_Complex_I*2*M_PI*(double)((i*k)%_nfft) / (double)_nfft);
+    }
+
+    // compute transform
+    fftplan q = fft_create_plan_r2c(_nfft, x, y, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    // check error
+    float tol = 2e-6f * sqrtf((float)_nfft) * (1 + liquid_nextpow2(_nfft));
+    for (k=0; k<nout; k++) {
+        CONTEND_DELTA( crealf(y[k]), creal(y_ref[k]), tol );
+        CONTEND_DELTA( cimagf(y[k]), cimag(y_ref[k]), tol );
+    }
+
+    free(x);
+    free(y);
+    free(y_ref);
+}
+
+// helper function (compare real-output transform against double-precision
+// inverse DFT of conjugate-symmetric spectrum)
+//  _nfft       : transform size
+void runtest_fft_c2r(unsigned int _nfft)
+{
+    unsigned int nin = _nfft/2 + 1;
+    float complex * x     = (float complex*) malloc(nin  *sizeof(float complex));
+    float complex * x0    = (float complex*) malloc(nin  *sizeof(float complex));
+    float *         y     = (float*)         malloc(_nfft*sizeof(float));
+    double *        y_ref = (double*)        malloc(_nfft*sizeof(double));
+    unsigned int i, k;
+
+    // generate random half-spectrum; DC and Nyquist bins are real
+    for (k=0; k<nin; k++)
+        x[k] = randnf() + _Complex_I*randnf();
+    x[0] = crealf(x[0]);
+    if (_nfft % 2 == 0)
+        x[_nfft/2] = crealf(x[_nfft/2]);
+    memmove(x0, x, nin*sizeof(float complex));
+
+    // compute reference from full spectrum
+    for (i=0; i<_nfft; i++) {
+        double complex v = 0;
+        for (k=0; k<_nfft; k++) {
+            double complex X = k < nin ? x[k] : conj(x[_nfft-k]);
+            v += X * cexp(_Complex_I*2*M_PI*(double)((i*k)%_nfft) / (double)_nfft);
+        }
+        y_ref[i] = creal(v);
+    }
+
+    // compute transform
+    fftplan q = fft_create_plan_c2r(_nfft, x, y, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    // check error and ensure input is not modified
+    float tol = 2e-6f * sqrtf((float)_nfft) * (1 + liquid_nextpow2(_nfft));
+    for (i=0; i<_nfft; i++)
+        CONTEND_DELTA( y[i], y_ref[i], tol );
+    CONTEND_SAME_DATA( x, x0, nin*sizeof(float complex) );
+
+    free(x);
+    free(x0);
+    free(y);
+    free(y_ref);
+}
+
+// even sizes (packed complex transform of half the size)
+void autotest_fft_r2c_2()       { runtest_fft_r2c(   2); }
+void autotest_fft_r2c_4()       { runtest_fft_r2c(   4); }
+void autotest_fft_r2c_6()       { runtest_fft_r2c(   6); }
+void autotest_fft_r2c_10()      { runtest_fft_r2c(  10); }
+void autotest_fft_r2c_32()      { runtest_fft_r2c(  32); }
+void autotest_fft_r2c_34()      { runtest_fft_r2c(  34); }
+void autotest_fft_r2c_120()     { runtest_fft_r2c( 120); }
+void autotest_fft_r2c_1024()    { runtest_fft_r2c(1024); }
+
+// odd sizes (full complex transform)
+void autotest_fft_r2c_1()       { runtest_fft_r2c(   1); }
+void autotest_fft_r2c_7()       { runtest_fft_r2c(   7); }
+void autotest_fft_r2c_45()      { runtest_fft_r2c(  45); }
+
+void autotest_fft_c2r_2()       { runtest_fft_c2r(   2); }
+void autotest_fft_c2r_4()       { runtest_fft_c2r(   4); }
+void autotest_fft_c2r_6()       { runtest_fft_c2r(   6); }
+void autotest_fft_c2r_10()      { runtest_fft_c2r(  10); }
+void autotest_fft_c2r_32()      { runtest_fft_c2r(  32); }
+void autotest_fft_c2r_34()      { runtest_fft_c2r(  34); }
+void autotest_fft_c2r_120()     { runtest_fft_c2r( 120); }
+void autotest_fft_c2r_1024()    { runtest_fft_c2r(1024); }
+void autotest_fft_c2r_1()       { runtest_fft_c2r(   1); }
+void autotest_fft_c2r_7()       { runtest_fft_c2r(   7); }
+void autotest_fft_c2r_45()      { runtest_fft_c2r(  45); }
+
+// run even sizes for each SIMD type available on this host, covering
+// vectorized split/merge stages and their scalar remainders
+void autotest_fft_real_simd_types()
+{
+    unsigned int i, n;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (!liquid_simd_is_available(i))
+            continue;
+        liquid_simd_set_type(i);
+        for (n=2; n<=40; n+=2) {
+            runtest_fft_r2c(n);
+            runtest_fft_c2r(n);
+        }
+        runtest_fft_r2c(4096);
+        runtest_fft_c2r(4096);
+    }
+
+    // restore automatic selection
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
+
+// forward and inverse transform should recover original input (scaled)
+void autotest_fft_r2c_c2r_inverse()
+{
+    unsigned int nfft = 2048;
+    float x[nfft], z[nfft];
+    float complex y[nfft/2+1];
+    unsigned int i;
+    for (i=0; i<nfft; i++)
+        x[i] = randnf();
+
+    fftplan qf = fft_create_plan_r2c(nfft, x, y, 0);
+    fftplan qr = fft_create_plan_c2r(nfft, y, z, 0);
+    fft_execute(qf);
+    fft_execute(qr);
+    fft_destroy_plan(qf);
+    fft_destroy_plan(qr);
+
+    for (i=0; i<nfft; i++)
+        CONTEND_DELTA( z[i]/nfft, x[i], 1e-5f );
+}
+
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_threads_autotest.c : test transforms executed with several threads
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// helper function (compare transforms run with several threads against a
+// single thread; results must be identical)
+//  _nfft   : transform size
+//  _dir    : transform direction
+void runtest_fft_threads(unsigned int _nfft,
+                         int          _dir)
+{
+    float complex * x     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y     = (float complex*) malloc(_nfft*sizeof(float complex));
+    float complex * y_ref = (float complex*) malloc(_nfft*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // reference: four-step transform on a single thread
+    fftplan q = fft_create_plan_method(_nfft, x, y_ref, _dir, 0, LIQUID_FFT_METHOD_FOUR_STEP, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    // plan for threads, increasing then decreasing number of threads
+    unsigned int num_threads[] = {2, 3, 4, 1, 3};
+    unsigned int n;
+    q = fft_create_plan(_nfft, x, y, _dir, LIQUID_FFT_THREADS);
+    for (n=0; n<5; n++) {
+        memset(y, 0x00, _nfft*sizeof(float complex));
+        CONTEND_EQUALITY(LIQUID_OK, fft_set_num_threads(q, num_threads[n]));
+        fft_execute(q);
+        for (i=0; i<_nfft; i++) {
+            CONTEND_EQUALITY( crealf(y[i]), crealf(y_ref[i]) );
+            CONTEND_EQUALITY( cimagf(y[i]), cimagf(y_ref[i]) );
+        }
+    }
+    fft_destroy_plan(q);
+
+    free(x);
+    free(y);
+    free(y_ref);
+}
+
+// power-of-two (interleaved columns) and other sizes
+void autotest_fft_threads_65536() { runtest_fft_threads(65536, LIQUID_FFT_FORWARD ); }
+void autotest_fft_threads_49152() { runtest_fft_threads(49152, LIQUID_FFT_BACKWARD); }
+void autotest_fft_threads_36000() { runtest_fft_threads(36000, LIQUID_FFT_FORWARD ); }
+
+// a plan created without LIQUID_FFT_THREADS switches to the four-step
+// method when threads are requested; repeated transforms reuse the same
+// worker threads
+void autotest_fft_threads_switch()
+{
+    unsigned int nfft = 65536;
+    float complex * x     = (float complex*) malloc(nfft*sizeof(float complex));
+    float complex * y     = (float complex*) malloc(nfft*sizeof(float complex));
+    float complex * y_ref = (float complex*) malloc(nfft*sizeof(float complex));
+    unsigned int i, n;
+    for (i=0; i<nfft; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    fftplan q = fft_create_plan_method(nfft, x, y_ref, LIQUID_FFT_FORWARD, 0, LIQUID_FFT_METHOD_FOUR_STEP, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    q = fft_create_plan(nfft, x, y, LIQUID_FFT_FORWARD, 0);
+    CONTEND_EQUALITY(LIQUID_OK, fft_set_num_threads(q, 3));
+    for (n=0; n<4; n++) {
+        memset(y, 0x00, nfft*sizeof(float complex));
+        fft_execute(q);
+        for (i=0; i<nfft; i++) {
+            CONTEND_EQUALITY( crealf(y[i]), crealf(y_ref[i]) );
+            CONTEND_EQUALITY( cimagf(y[i]), cimagf(y_ref[i]) );
+        }
+    }
+    fft_destroy_plan(q);
+
+    free(x);
+    free(y);
+    free(y_ref);
+}
+
+// real-input transform using a threaded complex transform of half the size
+void autotest_fft_threads_r2c()
+{
+    unsigned int nfft = 131072;
+    float         * x     = (float        *) malloc(nfft*sizeof(float));
+    float complex * y     = (float complex*) malloc((nfft/2+1)*sizeof(float complex));
+    float complex * y_ref = (float complex*) malloc((nfft/2+1)*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<nfft; i++)
+        x[i] = randnf();
+
+    // run on single thread, then on several threads
+    fftplan q = fft_create_plan_r2c(nfft, x, y, LIQUID_FFT_THREADS);
+    fft_execute(q);
+    memmove(y_ref, y, (nfft/2+1)*sizeof(float complex));
+    memset(y, 0x00, (nfft/2+1)*sizeof(float complex));
+    CONTEND_EQUALITY(LIQUID_OK, fft_set_num_threads(q, 4));
+    fft_execute(q);
+    fft_destroy_plan(q);
+    for (i=0; i<nfft/2+1; i++) {
+        CONTEND_EQUALITY( crealf(y[i]), crealf(y_ref[i]) );
+        CONTEND_EQUALITY( cimagf(y[i]), cimagf(y_ref[i]) );
+    }
+
+    free(x);
+    free(y);
+    free(y_ref);
+}
+
+// test configuration
+void autotest_fft_threads_config()
+{
+    // a single thread is always accepted
+    float complex x[64], y[64];
+    fftplan q = fft_create_plan(64, x, y, LIQUID_FFT_FORWARD, LIQUID_FFT_THREADS);
+    CONTEND_EQUALITY(LIQUID_OK, fft_set_num_threads(q, 1));
+    fft_destroy_plan(q);
+
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping fft_threads config test with strict exit enabled\n");
+    return;
+#else
+#if !LIQUID_SUPPRESS_ERROR_OUTPUT
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+#endif
+    // at least one thread required
+    q = fft_create_plan(64, x, y, LIQUID_FFT_FORWARD, 0);
+    CONTEND_INEQUALITY(LIQUID_OK, fft_set_num_threads(q, 0));
+
+    // plans which cannot be split between threads report it
+    CONTEND_EQUALITY(LIQUID_EIMODE, fft_set_num_threads(q, 4));
+    fft_destroy_plan(q);
+#endif
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fftd_autotest.c : test double-precision transforms against direct DFT
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper function (compare double-precision transform against direct DFT)
+//  _nfft       : transform size
+//  _dir        : transform direction
+void runtest_fftd(unsigned int _nfft,
+                  int          _dir)
+{
+    double complex * x     = (double complex*) malloc(_nfft*sizeof(double complex));
+    double complex * y     = (double complex*) malloc(_nfft*sizeof(double complex));
+    double complex * y_ref = (double complex*) malloc(_nfft*sizeof(double complex));
+    double complex * w     = (double complex*) malloc(_nfft*sizeof(double complex));
+    unsigned int i, k;
+
+    // generate random input and compute reference transform
+    double s = _dir == LIQUID_FFT_FORWARD ? -1.0 : 1.0;
+    for (i=0; i<_nfft; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        w[i] = cexp(s*_Complex_I*2*M_PI*(double)i / (double)_nfft);
+    }
+    for (k=0; k<_nfft; k++) {
+        y_ref[k] = 0;
+        for (i=0; i<_nfft; i++)
+            y_ref[k] += x[i] * w[(unsigned long)i*k % _nfft];
+    }
+
+    // compute transform
+    fftdplan q = fftd_create_plan(_nfft, x, y, _dir, 0);
+    fftd_execute(q);
+    fftd_destroy_plan(q);
+
+    // check error: well beyond what single precision can achieve
+    double tol = 1e-13 * sqrt((double)_nfft) * (1 + liquid_nextpow2(_nfft));
+    for (k=0; k<_nfft; k++) {
+        CONTEND_DELTA( creal(y[k]), creal(y_ref[k]), tol );
+        CONTEND_DELTA( cimag(y[k]), cimag(y_ref[k]), tol );
+    }
+
+    free(x);
+    free(y);
+    free(y_ref);
+    free(w);
+}
+
+// helper function (real-input transform followed by real-output inverse)
+//  _nfft       : transform size
+void runtest_fftd_real(unsigned int _nfft)
+{
+    unsigned int nout = _nfft/2 + 1;
+    double *         x = (double*)         malloc(_nfft*sizeof(double));
+    double complex * X = (double complex*) malloc(nout *sizeof(double complex));
+    double *         y = (double*)         malloc(_nfft*sizeof(double));
+    unsigned int i, k;
+
+    // generate random input
+    for (i=0; i<_nfft; i++)
+        x[i] = randnf();
+
+    // run forward, inverse transforms
+    fftdplan qf = fftd_create_plan_r2c(_nfft, x, X, 0);
+    fftdplan qr = fftd_create_plan_c2r(_nfft, X, y, 0);
+    fftd_execute(qf);
+
+    // check DC bin against sum of input
+    double dc = 0;
+    for (i=0; i<_nfft; i++)
+        dc += x[i];
+    CONTEND_DELTA( creal(X[0]), dc, 1e-12 );
+    CONTEND_DELTA( cimag(X[0]), 0,  1e-12 );
+
+    // check inverse transform recovers scaled input
+    fftd_execute(qr);
+    for (k=0; k<_nfft; k++)
+        CONTEND_DELTA( y[k], _nfft*x[k], 1e-12*_nfft );
+
+    fftd_destroy_plan(qf);
+    fftd_destroy_plan(qr);
+    free(x);
+    free(X);
+    free(y);
+}
+
+void autotest_fftd_2()      { runtest_fftd(   2, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_3()      { runtest_fftd(   3, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_5()      { runtest_fftd(   5, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_8()      { runtest_fftd(   8, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_16()     { runtest_fftd(  16, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_17()     { runtest_fftd(  17, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_30()     { runtest_fftd(  30, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_64()     { runtest_fftd(  64, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_127()    { runtest_fftd( 127, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_1024()   { runtest_fftd(1024, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_6208()   { runtest_fftd(6208, LIQUID_FFT_FORWARD);  }
+void autotest_fftd_64_r()   { runtest_fftd(  64, LIQUID_FFT_BACKWARD); }
+void autotest_fftd_30_r()   { runtest_fftd(  30, LIQUID_FFT_BACKWARD); }
+
+void autotest_fftd_real_64()  { runtest_fftd_real(  64); }
+void autotest_fftd_real_30()  { runtest_fftd_real(  30); }
+void autotest_fftd_real_512() { runtest_fftd_real( 512); }
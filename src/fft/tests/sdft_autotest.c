@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// sdft_autotest.c : test sliding DFT against direct transform of the
+//                   most recent input samples
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper function (compare tracked bins against direct DFT of the most
+// recent nfft input samples at a number of points in time)
+//  _nfft       : transform size
+//  _num_bins   : number of bins to track (0: all bins)
+//  _num_samples: number of samples to push
+void runtest_sdft(unsigned int _nfft,
+                  unsigned int _num_bins,
+                  unsigned int _num_samples)
+{
+    float tol = 1e-5f * _nfft;
+    unsigned int i, k, m;
+
+    // choose bins: spread over band, including DC and last bin
+    unsigned int num_bins = _num_bins == 0 ? _nfft : _num_bins;
+    unsigned int bins[num_bins];
+    for (i=0; i<num_bins; i++)
+        bins[i] = _num_bins == 0 ? i : (i*(_nfft-1)) / (num_bins > 1 ? num_bins-1 : 1);
+    sdft_cccf q = _num_bins == 0 ? sdft_cccf_create(_nfft) :
+                                   sdft_cccf_create_bins(_nfft, bins, num_bins);
+    CONTEND_EQUALITY(sdft_cccf_get_nfft(q),     _nfft);
+    CONTEND_EQUALITY(sdft_cccf_get_num_bins(q), num_bins);
+
+    // generate input, pushing one sample at a time
+    float complex * x = (float complex*) malloc(_num_samples*sizeof(float complex));
+    float complex X[num_bins];
+    for (i=0; i<_num_samples; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        sdft_cccf_push(q, x[i]);
+
+        // check at irregular intervals, including before buffer is full
+        if ((i % 37) != 5 && i != _num_samples-1)
+            continue;
+        sdft_cccf_get_bins(q, X);
+        for (k=0; k<num_bins; k++) {
+            double complex v = 0;
+            for (m=0; m<_nfft; m++) {
+                // window starts nfft-1 samples before current (zeros before input)
+                int t = (int)i - (int)_nfft + 1 + (int)m;
+                if (t >= 0)
+                    v += x[t] * cexp(-_Complex_I*2*M_PI*(double)((bins[k]*m) % _nfft)/(double)_nfft);
+            }
+            CONTEND_DELTA(crealf(X[k]), creal(v), tol);
+            CONTEND_DELTA(cimagf(X[k]), cimag(v), tol);
+        }
+    }
+
+    // reset object and ensure bins are cleared
+    sdft_cccf_reset(q);
+    sdft_cccf_get_bins(q, X);
+    for (k=0; k<num_bins; k++)
+        CONTEND_EQUALITY(X[k], 0.0f);
+
+    sdft_cccf_destroy(q);
+    free(x);
+}
+
+// all bins (renormalized with regular transform)
+void autotest_sdft_all_16()     { runtest_sdft(  16, 0,  200); }
+void autotest_sdft_all_30()     { runtest_sdft(  30, 0,  200); }
+void autotest_sdft_all_64()     { runtest_sdft(  64, 0,  500); }
+
+// selected bins (renormalized directly)
+void autotest_sdft_bins_1()     { runtest_sdft(  64, 1,  500); }
+void autotest_sdft_bins_4()     { runtest_sdft(  64, 4,  500); }
+void autotest_sdft_bins_5_17()  { runtest_sdft(  17, 5,  200); }
+void autotest_sdft_bins_8_256() { runtest_sdft( 256, 8, 1000); }
+
+// run for a long time and ensure bins have not drifted
+void autotest_sdft_drift()
+{
+    unsigned int nfft = 32;
+    unsigned int num_samples = 200000 + 13; // end part-way through recursion
+    unsigned int bins[3] = {1, 7, 31};
+    sdft_cccf q = sdft_cccf_create_bins(nfft, bins, 3);
+
+    // tone at bin 7 with some noise
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        sdft_cccf_push(q, cexpf(_Complex_I*2*M_PI*((7*i) % nfft)/(float)nfft) + 1e-3f*randnf());
+
+    // tone appears in bin 7 only, with phase of the oldest sample in window
+    float complex X[3];
+    sdft_cccf_get_bins(q, X);
+    float complex X7 = nfft * cexpf(_Complex_I*2*M_PI*((7*(num_samples-nfft)) % nfft)/(float)nfft);
+    CONTEND_DELTA(cabsf(X[0]),      0.0f, 0.05f);
+    CONTEND_DELTA(crealf(X[1]), crealf(X7), 0.05f);
+    CONTEND_DELTA(cimagf(X[1]), cimagf(X7), 0.05f);
+    CONTEND_DELTA(cabsf(X[2]),      0.0f, 0.05f);
+    sdft_cccf_destroy(q);
+}
+
+void autotest_sdft_config()
+{
+#if LIQUID_STRICT_EXIT
+    AUTOTEST_WARN("skipping sdft config test with strict exit enabled\n");
+    return;
+#else
+    // check that object returns NULL for invalid configurations
+    fprintf(stderr,"warning: ignore potential errors here; checking for invalid configurations\n");
+    unsigned int bins[2] = {0, 16};
+    CONTEND_EQUALITY(sdft_cccf_create(0)==NULL,1);                  // nfft too small
+    CONTEND_EQUALITY(sdft_cccf_create_bins( 0, bins,  1)==NULL,1);  // nfft too small
+    CONTEND_EQUALITY(sdft_cccf_create_bins(16, bins,  0)==NULL,1);  // no bins
+    CONTEND_EQUALITY(sdft_cccf_create_bins(16, NULL,  1)==NULL,1);  // bins array missing
+    CONTEND_EQUALITY(sdft_cccf_create_bins(16, bins,  2)==NULL,1);  // bin out of range
+    CONTEND_EQUALITY(sdft_cccf_destroy(NULL), LIQUID_EIOBJ);
+
+    // create valid object and print
+    sdft_cccf q = sdft_cccf_create_bins(17, bins, 2);
+    CONTEND_EQUALITY(sdft_cccf_print(q), LIQUID_OK);
+    sdft_cccf_destroy(q);
+#endif
+}
@@ -315,3 +315,49 @@ void autotest_spgramcf_null()
         CONTEND_EQUALITY(psd[i], psd_val);
 }
 
+
+// check double-precision periodogram noise floor
+void autotest_spgramcd_noise()
+{
+    unsigned int nfft        = 400;             // transform size
+    unsigned int num_samples = 2000*nfft;       // number of samples to generate
+    double       noise_floor = -80.0;           // noise floor [dB]
+    double       nstd        = pow(10.0, noise_floor/20.0); // noise std. dev.
+    double       tol         = 0.5;             // error tolerance [dB]
+
+    spgramcd q = spgramcd_create_default(nfft);
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        spgramcd_push(q, nstd*( randnf() + _Complex_I*randnf() ) * M_SQRT1_2);
+    CONTEND_EQUALITY(spgramcd_get_num_samples(q), num_samples);
+
+    // compute power spectral density output and verify result
+    double psd[nfft];
+    spgramcd_get_psd(q, psd);
+    for (i=0; i<nfft; i++)
+        CONTEND_DELTA(psd[i], noise_floor, tol)
+
+    spgramcd_destroy(q);
+}
+
+// check real-valued double-precision periodogram against single precision
+void autotest_spgramd_compare()
+{
+    unsigned int nfft        = 256;     // transform size
+    unsigned int num_samples = 20*nfft; // number of samples to generate
+    float  x[num_samples];
+    double xd[num_samples];
+    unsigned int i;
+    for (i=0; i<num_samples; i++) {
+        x[i]  = randnf();
+        xd[i] = x[i];
+    }
+
+    // estimate spectrum in both precisions
+    float  psd[nfft];
+    double psd_d[nfft];
+    spgramf_estimate_psd(nfft, x,  num_samples, psd);
+    spgramd_estimate_psd(nfft, xd, num_samples, psd_d);
+    for (i=0; i<nfft; i++)
+        CONTEND_DELTA(psd_d[i], psd[i], 1e-3);
+}
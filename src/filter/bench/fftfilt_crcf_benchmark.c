@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -82,4 +83,57 @@ void benchmark_fftfilt_crcf_8    FFTFILT_CRCF_BENCHMARK_API(8)
 void benchmark_fftfilt_crcf_16   FFTFILT_CRCF_BENCHMARK_API(16)
 void benchmark_fftfilt_crcf_32   FFTFILT_CRCF_BENCHMARK_API(32)
 void benchmark_fftfilt_crcf_64   FFTFILT_CRCF_BENCHMARK_API(64)
+void benchmark_fftfilt_crcf_256  FFTFILT_CRCF_BENCHMARK_API(256)
+void benchmark_fftfilt_crcf_1024 FFTFILT_CRCF_BENCHMARK_API(1024)
 
+// Helper function for long filters split into partitions of _n taps
+void fftfilt_crcf_partitioned_bench(struct rusage *     _start,
+                                    struct rusage *     _finish,
+                                    unsigned long int * _num_iterations,
+                                    unsigned int        _h_len,
+                                    unsigned int        _n)
+{
+    // adjust number of iterations: cycles/sample ~ 20*log2(n) + 8*h_len/n
+    unsigned int num_partitions = (_h_len - 2) / _n + 1;
+    *_num_iterations *= 100;
+    *_num_iterations /= _n * (20*liquid_nextpow2(_n) + 8*num_partitions);
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate coefficients
+    float * h = (float*) malloc(_h_len*sizeof(float));
+    unsigned long int i;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    // create filter object
+    fftfilt_crcf q = fftfilt_crcf_create(h,_h_len,_n);
+
+    // generate input vector
+    float complex * x = (float complex*) malloc(_n*sizeof(float complex));
+    for (i=0; i<_n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        fftfilt_crcf_execute(q, x, x);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= _n;
+
+    // destroy filter object
+    fftfilt_crcf_destroy(q);
+    free(h);
+    free(x);
+}
+
+#define FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(H_LEN,N) \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ fftfilt_crcf_partitioned_bench(_start, _finish, _num_iterations, H_LEN, N); }
+
+// 8k-tap filter: latency (block size) against throughput
+void benchmark_fftfilt_crcf_h8192_n64   FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(8192,   64)
+void benchmark_fftfilt_crcf_h8192_n256  FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(8192,  256)
+void benchmark_fftfilt_crcf_h8192_n1024 FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(8192, 1024)
+void benchmark_fftfilt_crcf_h8192_n8192 FFTFILT_CRCF_PARTITIONED_BENCHMARK_API(8192, 8192)
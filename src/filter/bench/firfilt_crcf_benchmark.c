@@ -65,6 +65,47 @@ void firfilt_crcf_bench(struct rusage *_start,
     firfilt_crcf_destroy(f);
 }
 
+// Helper function for block execution
+void firfilt_crcf_block_bench(struct rusage *_start,
+                              struct rusage *_finish,
+                              unsigned long int *_num_iterations,
+                              unsigned int _n)
+{
+    // adjust number of iterations:
+    // cycles/trial ~ 107 + 4.3*_n
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(107+4.3*_n);
+
+    // generate coefficients
+    float h[_n];
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf();
+
+    // create filter object
+    firfilt_crcf f = firfilt_crcf_create(h,_n);
+
+    // generate input vector
+    unsigned int buf_len = 256;
+    float complex x[buf_len];
+    for (i=0; i<buf_len; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // output vector
+    float complex y[buf_len];
+
+    // start trials
+    *_num_iterations /= buf_len;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firfilt_crcf_execute_block(f, x, buf_len, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= buf_len;
+
+    firfilt_crcf_destroy(f);
+}
+
 #define FIRFILT_CRCF_BENCHMARK_API(N)   \
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
@@ -76,4 +117,15 @@ void benchmark_firfilt_crcf_8    FIRFILT_CRCF_BENCHMARK_API(8)
 void benchmark_firfilt_crcf_16   FIRFILT_CRCF_BENCHMARK_API(16)
 void benchmark_firfilt_crcf_32   FIRFILT_CRCF_BENCHMARK_API(32)
 void benchmark_firfilt_crcf_64   FIRFILT_CRCF_BENCHMARK_API(64)
+void benchmark_firfilt_crcf_128  FIRFILT_CRCF_BENCHMARK_API(128)
+
+#define FIRFILT_CRCF_BLOCK_BENCHMARK_API(N) \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ firfilt_crcf_block_bench(_start, _finish, _num_iterations, N); }
 
+void benchmark_firfilt_crcf_block_16    FIRFILT_CRCF_BLOCK_BENCHMARK_API(16)
+void benchmark_firfilt_crcf_block_32    FIRFILT_CRCF_BLOCK_BENCHMARK_API(32)
+void benchmark_firfilt_crcf_block_64    FIRFILT_CRCF_BLOCK_BENCHMARK_API(64)
+void benchmark_firfilt_crcf_block_128   FIRFILT_CRCF_BLOCK_BENCHMARK_API(128)
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <sys/resource.h>
+#include "liquid.internal.h"
+
+// Helper function comparing block execution methods; the crossover
+// between them calibrates LIQUID_FIRFILT_FFT_RATIO in firfilt.c
+//  _h_len  : filter length
+//  _n      : block size
+//  _fft    : use overlap-save transforms (1) or dot products (0)
+void firfilt_crcf_fft_bench(struct rusage *     _start,
+                            struct rusage *     _finish,
+                            unsigned long int * _num_iterations,
+                            unsigned int        _h_len,
+                            unsigned int        _n,
+                            int                 _fft)
+{
+    // normalize number of iterations by approximate cost per block
+    unsigned long int cost = _fft ? 40*(_n + _h_len) : _n*(_h_len/4 + 8);
+    *_num_iterations = (*_num_iterations * 200) / cost;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate coefficients
+    float h[_h_len];
+    unsigned long int i;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    // create filter object
+    firfilt_crcf q = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf_set_block_size(q, _n);
+    firfilt_crcf_set_fft(q, _fft);
+
+    // generate input vector
+    float complex x[_n];
+    for (i=0; i<_n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firfilt_crcf_execute_block(q, x, _n, x);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= _n;
+
+    firfilt_crcf_destroy(q);
+}
+
+#define FIRFILT_CRCF_FFT_BENCHMARK_API(H_LEN,N,FFT) \
+(   struct rusage *     _start,                     \
+    struct rusage *     _finish,                    \
+    unsigned long int * _num_iterations)            \
+{ firfilt_crcf_fft_bench(_start, _finish, _num_iterations, H_LEN, N, FFT); }
+
+// block size 256
+void benchmark_firfilt_crcf_direct_h32_n256     FIRFILT_CRCF_FFT_BENCHMARK_API(  32, 256, 0)
+void benchmark_firfilt_crcf_fft_h32_n256        FIRFILT_CRCF_FFT_BENCHMARK_API(  32, 256, 1)
+void benchmark_firfilt_crcf_direct_h64_n256     FIRFILT_CRCF_FFT_BENCHMARK_API(  64, 256, 0)
+void benchmark_firfilt_crcf_fft_h64_n256        FIRFILT_CRCF_FFT_BENCHMARK_API(  64, 256, 1)
+void benchmark_firfilt_crcf_direct_h128_n256    FIRFILT_CRCF_FFT_BENCHMARK_API( 128, 256, 0)
+void benchmark_firfilt_crcf_fft_h128_n256       FIRFILT_CRCF_FFT_BENCHMARK_API( 128, 256, 1)
+void benchmark_firfilt_crcf_direct_h256_n256    FIRFILT_CRCF_FFT_BENCHMARK_API( 256, 256, 0)
+void benchmark_firfilt_crcf_fft_h256_n256       FIRFILT_CRCF_FFT_BENCHMARK_API( 256, 256, 1)
+void benchmark_firfilt_crcf_direct_h512_n256    FIRFILT_CRCF_FFT_BENCHMARK_API( 512, 256, 0)
+void benchmark_firfilt_crcf_fft_h512_n256       FIRFILT_CRCF_FFT_BENCHMARK_API( 512, 256, 1)
+
+// block size 1024
+void benchmark_firfilt_crcf_direct_h64_n1024    FIRFILT_CRCF_FFT_BENCHMARK_API(  64,1024, 0)
+void benchmark_firfilt_crcf_fft_h64_n1024       FIRFILT_CRCF_FFT_BENCHMARK_API(  64,1024, 1)
+void benchmark_firfilt_crcf_direct_h128_n1024   FIRFILT_CRCF_FFT_BENCHMARK_API( 128,1024, 0)
+void benchmark_firfilt_crcf_fft_h128_n1024      FIRFILT_CRCF_FFT_BENCHMARK_API( 128,1024, 1)
+void benchmark_firfilt_crcf_direct_h256_n1024   FIRFILT_CRCF_FFT_BENCHMARK_API( 256,1024, 0)
+void benchmark_firfilt_crcf_fft_h256_n1024      FIRFILT_CRCF_FFT_BENCHMARK_API( 256,1024, 1)
+void benchmark_firfilt_crcf_direct_h1024_n1024  FIRFILT_CRCF_FFT_BENCHMARK_API(1024,1024, 0)
+void benchmark_firfilt_crcf_fft_h1024_n1024     FIRFILT_CRCF_FFT_BENCHMARK_API(1024,1024, 1)
+void benchmark_firfilt_crcf_direct_h4000_n1024  FIRFILT_CRCF_FFT_BENCHMARK_API(4000,1024, 0)
+void benchmark_firfilt_crcf_fft_h4000_n1024     FIRFILT_CRCF_FFT_BENCHMARK_API(4000,1024, 1)
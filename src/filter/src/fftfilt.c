@@ -24,6 +24,12 @@
 // fftfilt : finite impulse response (FIR) filter using fast Fourier
 //           transforms (FFTs)
 //
+// Filters longer than the block size n (plus one) are split into P
+// partitions of n taps each (uniformly partitioned convolution). The
+// transform of each input block is kept in a frequency-domain delay line
+// and multiplied with the transform of every partition, so the transform
+// size and latency stay at 2n and n regardless of the filter length.
+//
 
 #include <stdio.h>
 #include <string.h>
@@ -36,27 +42,55 @@
 //  DOTPROD()       dotprod macro
 //  PRINTVAL()      print macro
 
+//
+// forward declaration of internal methods
+//
+
+// compute transforms of filter partitions, normalized by transform size
+void FFTFILT(_compute_H)(FFTFILT() _q);
+
 // fftfilt object structure
 struct FFTFILT(_s) {
     TC * h;             // filter coefficients array [size; h_len x 1]
     unsigned int h_len; // filter length
     unsigned int n;     // input/output block size
+    unsigned int num_partitions;    // number of filter partitions, P
+    unsigned int part_len;          // longest partition, at most n+1
 
     // internal memory arrays
-    // TODO: make TI/TO type, but ensuring complex
-    // TODO: use special format for fftfilt_rrrf type
-    float complex * time_buf;   // time buffer [size: 2*n x 1]
+    // the second half of the time buffer holds zeros which are never
+    // overwritten. The inverse transform alternates between two output
+    // buffers so the overlapping tail of the previous block is read in
+    // place. The output scaling is applied once per block to the
+    // accumulated spectrum, so H holds the unscaled partition transforms.
+#if TI_COMPLEX || TC_COMPLEX
+    float complex * time_buf;   // time buffer, zero-padded [size: 2*n x 1]
     float complex * freq_buf;   // freq buffer [size: 2*n x 1]
-    float complex * H;          // FFT of filter coefficients [size: 2*n x 1]
-    float complex * w;          // overlap array [size: n x 1]
+    float complex * out_buf[2]; // inverse transform outputs [size: 2*n x 1]
+    float complex * H;          // FFT of partitions [size: 2*n x P]
+#else
+    // real input and coefficients: real-input transforms operate on the
+    // non-redundant half of the spectrum only
+    float *         time_buf;   // time buffer, zero-padded [size: 2*n x 1]
+    float complex * freq_buf;   // freq buffer [size: n+1 x 1]
+    float *         out_buf[2]; // inverse transform outputs [size: 2*n x 1]
+    float complex * H;          // FFT of partitions [size: n+1 x P]
+#endif
+    unsigned int out_index;     // output buffer of most recent block
+    unsigned int nfreq;         // number of frequency bins
+
+    // frequency-domain delay line, only used for P > 1
+    float complex * fdl;        // past input transforms [size: nfreq x P]
+    float complex * prod;       // product of transforms [size: nfreq x 1]
+    unsigned int    fdl_index;  // position of most recent input transform
 
     // FFT objects
 #ifdef LIQUID_FFTOVERRIDE
     fftplan fft;        // FFT object (forward)
-    fftplan ifft;       // FFT object (inverse)
+    fftplan ifft[2];    // FFT objects (inverse), one per output buffer
 #else
     FFT_PLAN fft;       // FFT object (forward)
-    FFT_PLAN ifft;      // FFT object (inverse)
+    FFT_PLAN ifft[2];   // FFT objects (inverse), one per output buffer
 #endif
 
     TC scale;           // output scaling factor
@@ -65,7 +99,8 @@ struct FFTFILT(_s) {
 // create FFT-based FIR filter using external coefficients
 //  _h      : filter coefficients [size: _h_len x 1]
 //  _h_len  : filter length, _h_len > 0
-//  _n      : block size = nfft/2, at least _h_len-1
+//  _n      : block size = nfft/2, _n > 0; if less than _h_len-1 the
+//            filter is partitioned into ceil((_h_len-1)/_n) sections
 FFTFILT() FFTFILT(_create)(TC *         _h,
                            unsigned int _h_len,
                            unsigned int _n)
@@ -73,46 +108,81 @@ FFTFILT() FFTFILT(_create)(TC *         _h,
     // validate input
     if (_h_len == 0)
         return liquid_error_config("fftfilt_%s_create(), filter length must be greater than zero",EXTENSION_FULL);
-    if (_n < _h_len-1)
-        return liquid_error_config("fftfilt_%s_create(), block length must be greater than _h_len-1 (%u)",EXTENSION_FULL,_h_len-1);
+    if (_n == 0)
+        return liquid_error_config("fftfilt_%s_create(), block length must be greater than zero",EXTENSION_FULL);
 
     // create filter object and initialize
     FFTFILT() q = (FFTFILT()) malloc(sizeof(struct FFTFILT(_s)));
     q->h_len    = _h_len;
     q->n        = _n;
 
+    // partition filter: the first P-1 partitions hold n taps each, the
+    // last one the remainder (at most n+1 taps)
+    q->num_partitions = _h_len > _n+1 ? (_h_len - 2) / _n + 1 : 1;
+    q->part_len       = q->num_partitions == 1 ? _h_len :
+                        _h_len - (q->num_partitions-1)*_n > _n ? _n+1 : _n;
+
     // copy filter coefficients
     q->h = (TC *) malloc((q->h_len)*sizeof(TC));
     memmove(q->h, _h, _h_len*sizeof(TC));
 
     // allocate internal memory arrays
+    unsigned int i;
+#if TI_COMPLEX || TC_COMPLEX
+    q->nfreq    = 2*q->n;
     q->time_buf = (float complex *) malloc((2*q->n)* sizeof(float complex)); // time buffer
-    q->freq_buf = (float complex *) malloc((2*q->n)* sizeof(float complex)); // frequency buffer
-    q->H        = (float complex *) malloc((2*q->n)* sizeof(float complex)); // FFT{ h }
-    q->w        = (float complex *) malloc((  q->n)* sizeof(float complex)); // delay buffer
-
-    // create internal FFT objects
-#ifdef LIQUID_FFTOVERRIDE
-    q->fft  = fft_create_plan(2*q->n, q->time_buf, q->freq_buf, LIQUID_FFT_FORWARD,  0);
-    q->ifft = fft_create_plan(2*q->n, q->freq_buf, q->time_buf, LIQUID_FFT_BACKWARD, 0);
+    for (i=0; i<2; i++)
+        q->out_buf[i] = (float complex *) malloc((2*q->n)* sizeof(float complex)); // output buffers
 #else
-    q->fft  = FFT_CREATE_PLAN(2*q->n, q->time_buf, q->freq_buf, FFT_DIR_FORWARD,  FFT_METHOD);
-    q->ifft = FFT_CREATE_PLAN(2*q->n, q->freq_buf, q->time_buf, FFT_DIR_BACKWARD, FFT_METHOD);
+    q->nfreq    = q->n + 1;
+    q->time_buf = (float *)         malloc((2*q->n)* sizeof(float));         // time buffer
+    for (i=0; i<2; i++)
+        q->out_buf[i] = (float *)   malloc((2*q->n)* sizeof(float));         // output buffers
 #endif
+    q->freq_buf = (float complex *) malloc((q->nfreq)*sizeof(float complex)); // frequency buffer
+    q->H        = (float complex *) malloc((q->nfreq*q->num_partitions)*sizeof(float complex)); // FFT{ h }
+    q->fdl      = NULL;
+    q->prod     = NULL;
+    if (q->num_partitions > 1) {
+        q->fdl  = (float complex *) malloc((q->nfreq*q->num_partitions)*sizeof(float complex));
+        q->prod = (float complex *) malloc((q->nfreq)*sizeof(float complex));
+    }
 
-    // compute FFT of filter coefficients and copy to internal H array
-    unsigned int i;
+    // zero-pad second half of time buffer once: only the first n samples
+    // of each block are non-zero, and only the first n+h_len-1 samples of
+    // the linear convolution are required (the remainder being zero)
     for (i=0; i<2*q->n; i++)
-        q->time_buf[i] = (i < q->h_len) ? q->h[i] : 0;
-    // time_buf > {FFT} > freq_buf
-#ifdef LIQUID_FFTOVERRIDE
-    fft_execute(q->fft);
+        q->time_buf[i] = 0;
+
+    // create internal FFT objects
+#if TI_COMPLEX || TC_COMPLEX
+#  ifdef LIQUID_FFTOVERRIDE
+    q->fft  = fft_create_plan_pruned(2*q->n, q->time_buf, q->freq_buf, LIQUID_FFT_FORWARD,  0,
+                                     q->n, 0, 2*q->n);
+    for (i=0; i<2; i++)
+        q->ifft[i] = fft_create_plan_pruned(2*q->n, q->freq_buf, q->out_buf[i], LIQUID_FFT_BACKWARD, 0,
+                                            2*q->n, 0, q->n + q->part_len - 1);
+#  else
+    q->fft  = FFT_CREATE_PLAN_PRUNED(2*q->n, q->time_buf, q->freq_buf, FFT_DIR_FORWARD,  FFT_METHOD,
+                                     q->n, 0, 2*q->n);
+    for (i=0; i<2; i++)
+        q->ifft[i] = FFT_CREATE_PLAN_PRUNED(2*q->n, q->freq_buf, q->out_buf[i], FFT_DIR_BACKWARD, FFT_METHOD,
+                                            2*q->n, 0, q->n + q->part_len - 1);
+#  endif
 #else
-    FFT_EXECUTE(q->fft);
+#  ifdef LIQUID_FFTOVERRIDE
+    q->fft  = fft_create_plan_r2c(2*q->n, q->time_buf, q->freq_buf, 0);
+    for (i=0; i<2; i++)
+        q->ifft[i] = fft_create_plan_c2r(2*q->n, q->freq_buf, q->out_buf[i], 0);
+#  else
+    q->fft  = FFT_CREATE_PLAN_R2C(2*q->n, q->time_buf, q->freq_buf, FFT_METHOD);
+    for (i=0; i<2; i++)
+        q->ifft[i] = FFT_CREATE_PLAN_C2R(2*q->n, q->freq_buf, q->out_buf[i], FFT_METHOD);
+#  endif
 #endif
-    memmove(q->H, q->freq_buf, 2*q->n*sizeof(float complex));
 
-    // set default scaling
+    // compute transforms of filter partitions and set default scaling
+    FFTFILT(_compute_H)(q);
     FFTFILT(_set_scale)(q, 1);
 
     // reset filter state (clear buffer)
@@ -129,16 +199,21 @@ void FFTFILT(_destroy)(FFTFILT() _q)
     free(_q->h);                // filter coefficients
     free(_q->time_buf);         // buffer (time domain)
     free(_q->freq_buf);         // buffer (frequency domain)
+    free(_q->out_buf[0]);       // buffer (inverse transform output)
+    free(_q->out_buf[1]);       // buffer (inverse transform output)
     free(_q->H);                // frequency response of filter coefficients
-    free(_q->w);                // output window buffer
+    free(_q->fdl);              // frequency-domain delay line
+    free(_q->prod);             // product of transforms
 
     // destroy FFT objects
 #ifdef LIQUID_FFTOVERRIDE
     fft_destroy_plan(_q->fft);       // forward transform
-    fft_destroy_plan(_q->ifft);      // reverse transform
+    fft_destroy_plan(_q->ifft[0]);   // reverse transform
+    fft_destroy_plan(_q->ifft[1]);   // reverse transform
 #else
     FFT_DESTROY_PLAN(_q->fft);  // forward transform
-    FFT_DESTROY_PLAN(_q->ifft); // reverse transform
+    FFT_DESTROY_PLAN(_q->ifft[0]); // reverse transform
+    FFT_DESTROY_PLAN(_q->ifft[1]); // reverse transform
 #endif
 
     // free main object
@@ -148,16 +223,22 @@ void FFTFILT(_destroy)(FFTFILT() _q)
 // reset internal state of filter object
 void FFTFILT(_reset)(FFTFILT() _q)
 {
-    // reset overlap window
-    unsigned int i;
-    for (i=0; i<_q->n; i++)
-        _q->w[i] = 0;
+    // reset overlap (tail of previous output block)
+    memset(_q->out_buf[0], 0, 2*_q->n*sizeof(_q->out_buf[0][0]));
+    memset(_q->out_buf[1], 0, 2*_q->n*sizeof(_q->out_buf[1][0]));
+    _q->out_index = 0;
+
+    // clear frequency-domain delay line
+    if (_q->num_partitions > 1)
+        memset(_q->fdl, 0, _q->nfreq*_q->num_partitions*sizeof(float complex));
+    _q->fdl_index = 0;
 }
 
 // print filter object internals (taps, buffer)
 void FFTFILT(_print)(FFTFILT() _q)
 {
-    printf("fftfilt_%s: [h_len=%u, n=%u]\n", EXTENSION_FULL, _q->h_len, _q->n);
+    printf("fftfilt_%s: [h_len=%u, n=%u, partitions=%u]\n", EXTENSION_FULL,
+            _q->h_len, _q->n, _q->num_partitions);
     unsigned int i;
     unsigned int n = _q->h_len;
     for (i=0; i<n; i++) {
@@ -176,16 +257,15 @@ void FFTFILT(_print)(FFTFILT() _q)
 void FFTFILT(_set_scale)(FFTFILT() _q,
                          TC        _scale)
 {
-    // set scale, normalized by fft size
-    _q->scale = _scale / (float)(2*_q->n);
+    // applied in execute(), so the partition transforms are unchanged
+    _q->scale = _scale;
 }
 
 // get output scaling for filter
 void FFTFILT(_get_scale)(FFTFILT() _q,
                          TC *      _scale)
 {
-    // get scale, normalized by fft size
-    *_scale = _q->scale * (float)(2*_q->n);
+    *_scale = _q->scale;
 }
 
 // execute the filter on internal buffer and coefficients
@@ -196,26 +276,8 @@ void FFTFILT(_execute)(FFTFILT() _q,
                        TI *      _x,
                        TO *      _y)
 {
-    unsigned int i;
-
-    // copy input
-#if 0 //TI_COMPLEX
+    // copy input; end of time-domain buffer remains zero-padded
     memmove(_q->time_buf, _x, _q->n*sizeof(TI));
-#else
-    // manual copy for type conversion
-    // TODO: use DCT or equivalent
-    for (i=0; i<_q->n; i++)
-        _q->time_buf[i] = _x[i];
-#endif
-
-    // pad end of time-domain buffer with zeros
-    // TODO: not necessary to do this every time
-#if 0
-    memset(&_q->time_buf[_q->n], 0, _q->n*sizeof(TI));
-#else
-    for (i=0; i<_q->n; i++)
-        _q->time_buf[_q->n + i] = 0;
-#endif
 
     // run forward transform
 #ifdef LIQUID_FFTOVERRIDE
@@ -224,41 +286,49 @@ void FFTFILT(_execute)(FFTFILT() _q,
     FFT_EXECUTE(_q->fft);
 #endif
 
-    // compute inner product between FFT{ _x } and FFT{ H }
-#if 1
-    for (i=0; i<2*_q->n; i++)
-        _q->freq_buf[i] *= _q->H[i];
-#else
-    // use SIMD vector extensions
-# if TI_COMPLEX
-    // complex floating-point inner product
-    liquid_vectorcf_mul(_q->freq_buf, _q->H, 2*_q->n, _q->freq_buf);
-# else
-    // real floating-point inner product
-    liquid_vectorf_mul(_q->freq_buf, _q->H, 2*_q->n, _q->freq_buf);
-# endif
-#endif
+    if (_q->num_partitions == 1) {
+        // compute inner product between FFT{ _x } and FFT{ H }
+        liquid_vectorcf_mul(_q->freq_buf, _q->H, _q->nfreq, _q->freq_buf);
+    } else {
+        // store transform in delay line, replacing the oldest one
+        unsigned int P = _q->num_partitions;
+        _q->fdl_index = (_q->fdl_index + 1) % P;
+        memmove(&_q->fdl[_q->fdl_index*_q->nfreq], _q->freq_buf, _q->nfreq*sizeof(float complex));
+
+        // accumulate products of past input transforms with partitions;
+        // the transform from p blocks ago is paired with partition p
+        unsigned int p, k = _q->fdl_index;
+        liquid_vectorcf_mul(&_q->fdl[k*_q->nfreq], _q->H, _q->nfreq, _q->freq_buf);
+        for (p=1; p<P; p++) {
+            k = (k == 0) ? P-1 : k-1;
+            liquid_vectorcf_mul(&_q->fdl[k*_q->nfreq], &_q->H[p*_q->nfreq], _q->nfreq, _q->prod);
+            liquid_vectorcf_add(_q->freq_buf, _q->prod, _q->nfreq, _q->freq_buf);
+        }
+    }
 
-    // compute inverse transform
+    // apply output scaling once to the accumulated spectrum
+    if (_q->scale != 1)
+        liquid_vectorcf_mulscalar(_q->freq_buf, _q->nfreq, _q->scale, _q->freq_buf);
+
+    // compute inverse transform into alternate output buffer, keeping the
+    // overlapping tail of the previous block
+    unsigned int m = _q->out_index;
+    _q->out_index = 1 - m;
 #ifdef LIQUID_FFTOVERRIDE
-    fft_execute(_q->ifft);
+    fft_execute(_q->ifft[_q->out_index]);
 #else
-    FFT_EXECUTE(_q->ifft);
+    FFT_EXECUTE(_q->ifft[_q->out_index]);
 #endif
 
-    // copy output summed with buffer and scaled
-#if TI_COMPLEX
-    for (i=0; i<_q->n; i++)
-        _y[i] = (_q->time_buf[i] + _q->w[i]) * _q->scale;
+    // output is sum of the block and the tail of the previous block (its
+    // first part_len-1 samples); the input was copied so _y may be _x
+    unsigned int nw = _q->part_len - 1;
+#if TI_COMPLEX || TC_COMPLEX
+    liquid_vectorcf_add(_q->out_buf[_q->out_index], _q->out_buf[m] + _q->n, nw, _y);
 #else
-    // manual copy for type conversion
-    // TODO: use DCT or equivalent
-    for (i=0; i<_q->n; i++)
-        _y[i] = (T) crealf(_q->time_buf[i] + _q->w[i]) * _q->scale;
+    liquid_vectorf_add (_q->out_buf[_q->out_index], _q->out_buf[m] + _q->n, nw, _y);
 #endif
-
-    // copy buffer
-    memmove(_q->w, &_q->time_buf[_q->n], _q->n*sizeof(float complex));
+    memmove(_y + nw, _q->out_buf[_q->out_index] + nw, (_q->n - nw)*sizeof(TO));
 }
 
 // return length of filter object's internal coefficients
@@ -267,3 +337,55 @@ unsigned int FFTFILT(_get_length)(FFTFILT() _q)
     return _q->h_len;
 }
 
+// return number of partitions of filter coefficients
+unsigned int FFTFILT(_get_num_partitions)(FFTFILT() _q)
+{
+    return _q->num_partitions;
+}
+
+//
+// internal methods
+//
+
+// compute transforms of filter partitions (at most n+1 non-zero samples
+// each) into internal H array, normalized by transform size; called once
+// from create() as it builds a temporary transform plan
+void FFTFILT(_compute_H)(FFTFILT() _q)
+{
+#if TI_COMPLEX || TC_COMPLEX
+#  ifdef LIQUID_FFTOVERRIDE
+    fftplan fft_h = fft_create_plan(2*_q->n, _q->time_buf, _q->freq_buf, LIQUID_FFT_FORWARD, 0);
+#  else
+    FFT_PLAN fft_h = FFT_CREATE_PLAN(2*_q->n, _q->time_buf, _q->freq_buf, FFT_DIR_FORWARD, FFT_METHOD);
+#  endif
+#else
+#  ifdef LIQUID_FFTOVERRIDE
+    fftplan fft_h = fft_create_plan_r2c(2*_q->n, _q->time_buf, _q->freq_buf, 0);
+#  else
+    FFT_PLAN fft_h = FFT_CREATE_PLAN_R2C(2*_q->n, _q->time_buf, _q->freq_buf, FFT_METHOD);
+#  endif
+#endif
+    float g = 1.0f / (float)(2*_q->n);
+    unsigned int i, p;
+    for (p=0; p<_q->num_partitions; p++) {
+        unsigned int k0  = p*_q->n;
+        unsigned int len = (p == _q->num_partitions-1) ? _q->h_len - k0 : _q->n;
+        for (i=0; i<2*_q->n; i++)
+            _q->time_buf[i] = (i < len) ? _q->h[k0+i] * g : 0;
+#ifdef LIQUID_FFTOVERRIDE
+        fft_execute(fft_h);
+#else
+        FFT_EXECUTE(fft_h);
+#endif
+        memmove(&_q->H[p*_q->nfreq], _q->freq_buf, _q->nfreq*sizeof(float complex));
+    }
+#ifdef LIQUID_FFTOVERRIDE
+    fft_destroy_plan(fft_h);
+#else
+    FFT_DESTROY_PLAN(fft_h);
+#endif
+
+    // restore zero padding of time buffer
+    for (i=0; i<2*_q->n; i++)
+        _q->time_buf[i] = 0;
+}
@@ -66,6 +66,11 @@
 #define PRINTVAL_TC(X,F)    PRINTVAL_FLOAT(X,F)
 #define PRINTVAL_TI(X,F)    PRINTVAL_CFLOAT(X,F)
 
+// transforms for overlap-save block execution (firfilt)
+#define TF                  float           // transform type (real)
+#define TFC                 float complex   // transform type (complex)
+#define VECTOR_MUL(X,Y,N,Z) liquid_vectorcf_mul(X,Y,N,Z)
+
 // source files
 //#include "autocorr.c"
 #include "fftfilt.c"
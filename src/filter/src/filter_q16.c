@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Filter API: fixed-point (Q15), real and complex (interleaved I/Q)
+//
+
+#include "liquid.internal.h"
+
+// real fixed-point
+#define EXTENSION_FULL      "q16"
+#define FIRDECIM(name)      LIQUID_CONCAT(firdecim_q16,name)
+#define FIRFILT(name)       LIQUID_CONCAT(firfilt_q16,name)
+#define C                   1   // values per sample
+#define DOTPROD_Q16         dotprod_q16_execute
+
+#include "firdecim_q16.c"
+#include "firfilt_q16.c"
+
+#undef EXTENSION_FULL
+#undef FIRDECIM
+#undef FIRFILT
+#undef C
+#undef DOTPROD_Q16
+
+// complex fixed-point (interleaved I/Q)
+#define EXTENSION_FULL      "cq16"
+#define FIRDECIM(name)      LIQUID_CONCAT(firdecim_cq16,name)
+#define FIRFILT(name)       LIQUID_CONCAT(firfilt_cq16,name)
+#define C                   2   // values per sample
+#define DOTPROD_Q16         dotprod_q16_execute_cq16
+
+#include "firdecim_q16.c"
+#include "firfilt_q16.c"
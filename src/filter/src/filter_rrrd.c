@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Filter API: real double-precision floating-point
+//
+
+#include "liquid.internal.h"
+
+// naming extensions (useful for print statements)
+#define EXTENSION_SHORT     "d"
+#define EXTENSION_FULL      "rrrd"
+
+// 
+#define FIRFILT(name)       LIQUID_CONCAT(firfilt_rrrd,name)
+#define IIRFILT(name)       LIQUID_CONCAT(iirfilt_rrrd,name)
+#define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_rrrd,name)
+
+#define T                   double           // general
+#define TO                  double           // output
+#define TC                  double           // coefficients
+#define TI                  double           // input
+#define DOTPROD(name)       LIQUID_CONCAT(dotprod_rrrd,name)
+
+#define TO_COMPLEX          0
+#define TC_COMPLEX          0
+#define TI_COMPLEX          0
+
+#define PRINTVAL_TO(X,F)    PRINTVAL_DOUBLE(X,F)
+#define PRINTVAL_TC(X,F)    PRINTVAL_DOUBLE(X,F)
+#define PRINTVAL_TI(X,F)    PRINTVAL_DOUBLE(X,F)
+
+// transforms for overlap-save block execution (firfilt), always using
+// internal double-precision plans, even when linking against fftw
+#define TF                  double          // transform type (real)
+#define TFC                 double complex  // transform type (complex)
+#define VECTOR_MUL(X,Y,N,Z)                                 \
+    { unsigned int _i; for (_i=0; _i<(N); _i++)             \
+          (Z)[_i] = (X)[_i] * (Y)[_i]; }
+
+#undef  FFT_PLAN
+#undef  FFT_CREATE_PLAN
+#undef  FFT_CREATE_PLAN_R2C
+#undef  FFT_CREATE_PLAN_C2R
+#undef  FFT_CREATE_PLAN_PRUNED
+#undef  FFT_DESTROY_PLAN
+#undef  FFT_EXECUTE
+#undef  FFT_DIR_FORWARD
+#undef  FFT_DIR_BACKWARD
+#undef  FFT_METHOD
+#define FFT_PLAN                fftdplan
+#define FFT_CREATE_PLAN         fftd_create_plan
+#define FFT_CREATE_PLAN_R2C     fftd_create_plan_r2c
+#define FFT_CREATE_PLAN_C2R     fftd_create_plan_c2r
+#define FFT_CREATE_PLAN_PRUNED  fftd_create_plan_pruned
+#define FFT_DESTROY_PLAN        fftd_destroy_plan
+#define FFT_EXECUTE             fftd_execute
+#define FFT_DIR_FORWARD         LIQUID_FFT_FORWARD
+#define FFT_DIR_BACKWARD        LIQUID_FFT_BACKWARD
+#define FFT_METHOD              0
+
+// source files
+#include "firfilt.c"
+#include "iirfilt.c"
+#include "iirfiltsos.c"
@@ -30,6 +30,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+// maximum number of output samples computed at once in block execution
+#define LIQUID_FIRDECIM_BLOCK_LEN   (64)
+
 // decimator structure
 struct FIRDECIM(_s) {
     TC *            h;      // coefficients array
@@ -39,6 +42,10 @@ struct FIRDECIM(_s) {
     WINDOW()        w;      // buffer
     DOTPROD()       dp;     // vector dot product
     TC              scale;  // output scaling factor
+
+    // contiguous buffer history and input for block execution
+    // [size: h_len - 1 + LIQUID_FIRDECIM_BLOCK_LEN*M x 1]
+    TI *            b;
 };
 
 // create decimator object
@@ -73,6 +80,9 @@ FIRDECIM() FIRDECIM(_create)(unsigned int _M,
     // create dot product object
     q->dp = DOTPROD(_create)(q->h, q->h_len);
 
+    // allocate memory for block execution
+    q->b = (TI*) malloc((q->h_len - 1 + LIQUID_FIRDECIM_BLOCK_LEN*q->M)*sizeof(TI));
+
     // set default scaling
     q->scale = 1;
 
@@ -157,6 +167,7 @@ void FIRDECIM(_destroy)(FIRDECIM() _q)
     WINDOW(_destroy)(_q->w);
     DOTPROD(_destroy)(_q->dp);
     free(_q->h);
+    free(_q->b);
     free(_q);
 }
 
@@ -238,10 +249,30 @@ void FIRDECIM(_execute_block)(FIRDECIM()   _q,
                               unsigned int _n,
                               TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute _M input samples computing just one output each time
-        FIRDECIM(_execute)(_q, &_x[i*_q->M], &_y[i]);
+    unsigned int i = 0;
+    while (i < _n) {
+        // number of output samples in this block
+        unsigned int m = _n - i < LIQUID_FIRDECIM_BLOCK_LEN ? _n - i : LIQUID_FIRDECIM_BLOCK_LEN;
+
+        // copy buffer history and input samples into contiguous array
+        TI * r;
+        TI * b = _q->b;
+        WINDOW(_read)(_q->w, &r);
+        memmove(b, r + 1, (_q->h_len - 1)*sizeof(TI));
+        memmove(b + _q->h_len - 1, &_x[i*_q->M], m*_q->M*sizeof(TI));
+
+        // compute outputs for every _M-th input window
+        DOTPROD(_execute_block_stride)(_q->dp, b, _q->M, m, &_y[i]);
+
+        // update buffer (from copy, as output may overwrite input)
+        WINDOW(_write)(_q->w, b + _q->h_len - 1, m*_q->M);
+
+        // apply scaling factor
+        unsigned int k;
+        for (k=0; k<m; k++)
+            _y[i+k] *= _q->scale;
+
+        i += m;
     }
 }
 
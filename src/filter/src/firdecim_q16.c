@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// firdecim_q16 : fixed-point (Q15) finite impulse response decimator
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FIRDECIM()      name-mangling macro
+//  C               number of 16-bit values per sample (1: real, 2: complex)
+//  DOTPROD_Q16     dot product execute method for sample type
+//  EXTENSION_FULL  full extension string
+
+// decimator structure
+struct FIRDECIM(_s) {
+    int16_t *    h;         // coefficients array (Q15) [size: h_len x 1]
+    unsigned int h_len;     // number of coefficients
+    unsigned int M;         // decimation factor
+
+    // internal buffer; samples are appended to the end and the most
+    // recent h_len-1 samples are moved to the front when it fills
+    int16_t *    w;         // internal buffer [size: C*(w_len + h_len) x 1]
+    unsigned int w_len;     // window length
+    unsigned int w_index;   // window read index
+
+    dotprod_q16  dp;        // dot product object
+};
+
+// create fixed-point decimator object
+//  _M      : decimation factor
+//  _h      : filter coefficients (Q15) [size: _h_len x 1]
+//  _h_len  : filter coefficients length
+FIRDECIM() FIRDECIM(_create)(unsigned int _M,
+                             int16_t *    _h,
+                             unsigned int _h_len)
+{
+    // validate input
+    if (_h_len == 0)
+        return liquid_error_config("decim_%s_create(), filter length must be greater than zero", EXTENSION_FULL);
+    if (_M == 0)
+        return liquid_error_config("decim_%s_create(), decimation factor must be greater than zero", EXTENSION_FULL);
+
+    FIRDECIM() q = (FIRDECIM()) malloc(sizeof(struct FIRDECIM(_s)));
+    q->h_len = _h_len;
+    q->M     = _M;
+
+    // load filter in reverse order
+    q->h = (int16_t*) malloc((q->h_len)*sizeof(int16_t));
+    unsigned int i;
+    for (i=0; i<_h_len; i++)
+        q->h[_h_len-i-1] = _h[i];
+
+    // initialize buffer to hold several output samples' worth of input
+    q->w_len = 8*_M > q->h_len ? 8*_M : q->h_len;
+    q->w     = (int16_t*) malloc(C*(q->w_len + q->h_len)*sizeof(int16_t));
+
+    // create dot product object
+    q->dp = dotprod_q16_create(q->h, q->h_len);
+
+    // reset filter state (clear buffer)
+    FIRDECIM(_reset)(q);
+    return q;
+}
+
+// create fixed-point decimator from Kaiser prototype, quantizing
+// coefficients to Q15
+//  _M      : decimation factor
+//  _m      : filter delay (symbols)
+//  _As     : stop-band attenuation [dB]
+FIRDECIM() FIRDECIM(_create_kaiser)(unsigned int _M,
+                                    unsigned int _m,
+                                    float        _As)
+{
+    // validate input
+    if (_M < 2)
+        return liquid_error_config("decim_%s_create_kaiser(), decim factor must be greater than 1", EXTENSION_FULL);
+    if (_m == 0)
+        return liquid_error_config("decim_%s_create_kaiser(), filter delay must be greater than 0", EXTENSION_FULL);
+    if (_As < 0.0f)
+        return liquid_error_config("decim_%s_create_kaiser(), stop-band attenuation must be positive", EXTENSION_FULL);
+
+    // compute filter coefficients (floating point precision)
+    unsigned int h_len = 2*_M*_m + 1;
+    float hf[h_len];
+    float fc = 0.5f / (float) (_M);
+    liquid_firdes_kaiser(h_len, fc, _As, 0.0f, hf);
+
+    // quantize coefficients, rounding and saturating
+    int16_t hq[h_len];
+    unsigned int i;
+    for (i=0; i<h_len; i++)
+        hq[i] = dotprod_q16_quantize(hf[i]);
+
+    // return decimator object
+    return FIRDECIM(_create)(_M, hq, h_len);
+}
+
+// destroy decimator object
+int FIRDECIM(_destroy)(FIRDECIM() _q)
+{
+    dotprod_q16_destroy(_q->dp);
+    free(_q->w);
+    free(_q->h);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// print decimator object internals
+int FIRDECIM(_print)(FIRDECIM() _q)
+{
+    printf("firdecim_%s [M=%u, h_len=%u, shift=%u]\n", EXTENSION_FULL,
+            _q->M, _q->h_len, dotprod_q16_get_shift(_q->dp));
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++)
+        printf("  h(%3u) = %6d\n", i+1, _q->h[_q->h_len-i-1]);
+    return LIQUID_OK;
+}
+
+// clear/reset decimator object internal state
+int FIRDECIM(_reset)(FIRDECIM() _q)
+{
+    _q->w_index = 0;
+    memset(_q->w, 0, C*(_q->w_len + _q->h_len)*sizeof(int16_t));
+    return LIQUID_OK;
+}
+
+// get decimation rate
+unsigned int FIRDECIM(_get_decim_rate)(FIRDECIM() _q)
+{
+    return _q->M;
+}
+
+// set output shift (right) applied to accumulated value
+int FIRDECIM(_set_shift)(FIRDECIM()   _q,
+                         unsigned int _shift)
+{
+    return dotprod_q16_set_shift(_q->dp, _shift);
+}
+
+// get output shift (right) applied to accumulated value
+unsigned int FIRDECIM(_get_shift)(FIRDECIM() _q)
+{
+    return dotprod_q16_get_shift(_q->dp);
+}
+
+// execute decimator
+//  _q      :   decimator object
+//  _x      :   input sample array [size: C*_M x 1]
+//  _y      :   output sample pointer [size: C x 1]
+int FIRDECIM(_execute)(FIRDECIM() _q,
+                       int16_t *  _x,
+                       int16_t *  _y)
+{
+    // move history (most recent h_len-1 samples) to front of buffer if the next
+    // _M samples do not fit
+    if (_q->w_index + _q->M > _q->w_len) {
+        memmove(_q->w, _q->w + C*_q->w_index, C*(_q->h_len-1)*sizeof(int16_t));
+        _q->w_index = 0;
+    }
+
+    // append samples after the h_len-1 samples of history
+    memmove(_q->w + C*(_q->w_index + _q->h_len - 1), _x, C*_q->M*sizeof(int16_t));
+
+    // compute output on most recent h_len samples and advance window
+    DOTPROD_Q16(_q->dp, _q->w + C*(_q->w_index + _q->M - 1), _y);
+    _q->w_index += _q->M;
+    return LIQUID_OK;
+}
+
+// execute decimator on block of _n*_M input samples
+//  _q      : decimator object
+//  _x      : input array [size: C*_n*_M x 1]
+//  _n      : number of _output_ samples
+//  _y      : output array [size: C*_n x 1]
+int FIRDECIM(_execute_block)(FIRDECIM()   _q,
+                             int16_t *    _x,
+                             unsigned int _n,
+                             int16_t *    _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        FIRDECIM(_execute)(_q, &_x[C*i*_q->M], &_y[C*i]);
+    return LIQUID_OK;
+}
+
@@ -27,6 +27,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
 
 // defined:
 //  FIRFILT()       name-mangling macro
@@ -34,9 +35,34 @@
 //  WINDOW()        window macro
 //  DOTPROD()       dotprod macro
 //  PRINTVAL()      print macro
+//  TF, TFC         transform types (real, complex)
+//  VECTOR_MUL()    element-wise complex multiply for transforms
+//  FFT_*           transform macros
 
 #define LIQUID_FIRFILT_USE_WINDOW   (0)
 
+// Block execution switches to overlap-save FFT convolution when
+//   block_size * h_len > LIQUID_FIRFILT_FFT_RATIO * nfft * log2(nfft)
+// i.e. comparing the dot product cost against the two transforms of size
+// nfft per block. The benchmarks in firfilt_crcf_fft_benchmark break even
+// at a ratio of about 3 (e.g. 64 taps with blocks of 256 or 1024 samples).
+#define LIQUID_FIRFILT_FFT_RATIO    (3.0f)
+
+// 
+// forward declaration of internal methods
+//
+
+// allocate transform buffers and plans for current block size
+int FIRFILT(_fft_create)(FIRFILT() _q);
+
+// free transform buffers and plans
+int FIRFILT(_fft_destroy)(FIRFILT() _q);
+
+// execute overlap-save convolution on one block of input samples
+void FIRFILT(_execute_block_fft)(FIRFILT() _q,
+                                 TI *      _x,
+                                 TO *      _y);
+
 // firfilt object structure
 struct FIRFILT(_s) {
     TC * h;             // filter coefficients array [size; h_len x 1]
@@ -54,6 +80,24 @@ struct FIRFILT(_s) {
 #endif
     DOTPROD() dp;           // dot product object
     TC scale;               // output scaling factor
+
+    // overlap-save convolution for block execution; the history is read
+    // from the internal buffer which stays valid for push/execute
+    unsigned int block_size;    // declared block size (0: disabled)
+    int          fft;           // use transforms for full blocks?
+    unsigned int nfft;          // transform size, >= block_size+h_len-1
+    unsigned int nfreq;         // number of frequency bins
+#if TI_COMPLEX || TC_COMPLEX
+    TFC *        fft_time;      // zero-padded input [size: nfft x 1]
+    TFC *        fft_out;       // inverse transform output [size: nfft x 1]
+#else
+    TF *         fft_time;      // zero-padded input [size: nfft x 1]
+    TF *         fft_out;       // inverse transform output [size: nfft x 1]
+#endif
+    TFC *        fft_freq;      // frequency buffer [size: nfreq x 1]
+    TFC *        fft_H;         // transform of taps, scaled by 1/nfft
+    FFT_PLAN     fft_fwd;       // forward transform
+    FFT_PLAN     fft_rev;       // reverse transform
 };
 
 // create firfilt object
@@ -93,6 +137,10 @@ FIRFILT() FIRFILT(_create)(TC * _h,
     // set default scaling
     q->scale = 1;
 
+    // block execution uses dot products until a block size is declared
+    q->block_size = 0;
+    q->fft        = 0;
+
     // reset filter state (clear buffer)
     FIRFILT(_reset)(q);
 
@@ -312,6 +360,10 @@ FIRFILT() FIRFILT(_recreate)(FIRFILT() _q,
     // re-create internal dot product object
     _q->dp = DOTPROD(_recreate)(_q->dp, _q->h, _q->h_len);
 
+    // re-evaluate block execution method for new coefficients
+    if (_q->block_size > 0)
+        FIRFILT(_set_block_size)(_q, _q->block_size);
+
     return _q;
 }
 
@@ -324,6 +376,7 @@ void FIRFILT(_destroy)(FIRFILT() _q)
     free(_q->w);
 #endif
     DOTPROD(_destroy)(_q->dp);
+    FIRFILT(_fft_destroy)(_q);
     free(_q->h);
     free(_q);
 }
@@ -358,6 +411,12 @@ void FIRFILT(_print)(FIRFILT() _q)
     PRINTVAL_TC(_q->scale,%12.8f);
     printf("\n");
 
+    // print block execution method
+    if (_q->fft)
+        printf("  block : fft (n=%u, nfft=%u)\n", _q->block_size, _q->nfft);
+    else
+        printf("  block : direct\n");
+
 #if LIQUID_FIRFILT_USE_WINDOW
     WINDOW(_print)(_q->w);
 #endif
@@ -452,6 +511,19 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,
                              unsigned int _n,
                              TO *         _y)
 {
+    // run full blocks through transforms, the remainder directly
+    if (_q->fft) {
+        unsigned int i;
+        for (i=0; i + _q->block_size <= _n; i += _q->block_size)
+            FIRFILT(_execute_block_fft)(_q, &_x[i], &_y[i]);
+        if (i == _n)
+            return;
+        _x += i;
+        _y += i;
+        _n -= i;
+    }
+
+#if LIQUID_FIRFILT_USE_WINDOW
     unsigned int i;
     for (i=0; i<_n; i++) {
         // push sample into filter
@@ -460,6 +532,66 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,
         // compute output sample
         FIRFILT(_execute)(_q, &_y[i]);
     }
+#else
+    unsigned int i = 0;
+    while (i < _n) {
+        // number of samples which can be appended before buffer wraps
+        unsigned int m = _q->w_mask - _q->w_index;
+        if (m == 0) {
+            // buffer wraps on next sample: push and compute individually
+            FIRFILT(_push)(_q, _x[i]);
+            FIRFILT(_execute)(_q, &_y[i]);
+            i++;
+            continue;
+        }
+        m = (_n - i) < m ? (_n - i) : m;
+
+        // append samples to end of buffer (input is copied before output
+        // is written, allowing in-place operation)
+        memmove(_q->w + _q->w_index + _q->h_len, &_x[i], m*sizeof(TI));
+
+        // compute output for each input window
+        DOTPROD(_execute_block)(_q->dp, _q->w + _q->w_index + 1, m, &_y[i]);
+        _q->w_index += m;
+
+        // apply scaling factor
+        unsigned int k;
+        for (k=0; k<m; k++)
+            _y[i+k] *= _q->scale;
+
+        i += m;
+    }
+#endif
+}
+
+// declare typical block size for execute_block(); when cheaper, blocks
+// of this size are computed with overlap-save FFT convolution
+//  _q      : filter object
+//  _n      : block size, 0 to always use dot products
+int FIRFILT(_set_block_size)(FIRFILT()    _q,
+                             unsigned int _n)
+{
+    _q->block_size = _n;
+    return FIRFILT(_set_fft)(_q, _n > 0 && FIRFILT(_fft_select)(_q->h_len, _n));
+}
+
+// get block size declared with set_block_size()
+unsigned int FIRFILT(_get_block_size)(FIRFILT() _q)
+{
+    return _q->block_size;
+}
+
+// override automatic selection of block execution method
+//  _q      : filter object
+//  _fft    : use transforms (1) or dot products (0) for full blocks
+int FIRFILT(_set_fft)(FIRFILT() _q,
+                      int       _fft)
+{
+    if (_fft && _q->block_size == 0)
+        return liquid_error(LIQUID_EICONFIG,"firfilt_%s_set_fft(), block size must be set first", EXTENSION_FULL);
+
+    FIRFILT(_fft_destroy)(_q);
+    return _fft ? FIRFILT(_fft_create)(_q) : LIQUID_OK;
 }
 
 // get filter length
@@ -507,3 +639,131 @@ float FIRFILT(_groupdelay)(FIRFILT() _q,
     return fir_group_delay(h, n, _fc);
 }
 
+//
+// internal methods
+//
+
+// estimate whether overlap-save is cheaper than direct dot products
+//  _h_len      : filter length
+//  _block_size : number of outputs computed per transform
+int FIRFILT(_fft_select)(unsigned int _h_len,
+                         unsigned int _block_size)
+{
+    unsigned int m    = liquid_nextpow2(_block_size + _h_len - 1);
+    unsigned int nfft = 1 << m;
+    return (float)_block_size * (float)_h_len > LIQUID_FIRFILT_FFT_RATIO * (float)(nfft * m);
+}
+
+// allocate transform buffers and plans for current block size
+int FIRFILT(_fft_create)(FIRFILT() _q)
+{
+    unsigned int i;
+    unsigned int n = _q->block_size + _q->h_len - 1;
+    _q->nfft = 1 << liquid_nextpow2(n);
+
+    // allocate memory arrays
+#if TI_COMPLEX || TC_COMPLEX
+    _q->nfreq    = _q->nfft;
+    _q->fft_time = (TFC*) malloc(_q->nfft*sizeof(TFC));
+    _q->fft_out  = (TFC*) malloc(_q->nfft*sizeof(TFC));
+#else
+    _q->nfreq    = _q->nfft/2 + 1;
+    _q->fft_time = (TF*)  malloc(_q->nfft*sizeof(TF));
+    _q->fft_out  = (TF*)  malloc(_q->nfft*sizeof(TF));
+#endif
+    _q->fft_freq = (TFC*) malloc(_q->nfreq*sizeof(TFC));
+    _q->fft_H    = (TFC*) malloc(_q->nfreq*sizeof(TFC));
+
+    // compute transform of coefficients (stored in reverse order),
+    // normalized by transform size
+    for (i=0; i<_q->nfft; i++)
+        _q->fft_time[i] = i < _q->h_len ? _q->h[_q->h_len-i-1] / (TF)(_q->nfft) : 0;
+#if TI_COMPLEX || TC_COMPLEX
+    FFT_PLAN fft_h = FFT_CREATE_PLAN(_q->nfft, _q->fft_time, _q->fft_H, FFT_DIR_FORWARD, FFT_METHOD);
+#else
+    FFT_PLAN fft_h = FFT_CREATE_PLAN_R2C(_q->nfft, _q->fft_time, _q->fft_H, FFT_METHOD);
+#endif
+    FFT_EXECUTE(fft_h);
+    FFT_DESTROY_PLAN(fft_h);
+
+    // clear time buffer; samples beyond the first n are never written
+    for (i=0; i<_q->nfft; i++)
+        _q->fft_time[i] = 0;
+
+    // create transform plans; only the last block_size outputs of the
+    // circular convolution are free of aliasing and required
+#if TI_COMPLEX || TC_COMPLEX
+    _q->fft_fwd = FFT_CREATE_PLAN_PRUNED(_q->nfft, _q->fft_time, _q->fft_freq, FFT_DIR_FORWARD,
+                                         FFT_METHOD, n, 0, _q->nfft);
+    _q->fft_rev = FFT_CREATE_PLAN_PRUNED(_q->nfft, _q->fft_freq, _q->fft_out, FFT_DIR_BACKWARD,
+                                         FFT_METHOD, _q->nfft, _q->h_len-1, _q->block_size);
+#else
+    _q->fft_fwd = FFT_CREATE_PLAN_R2C(_q->nfft, _q->fft_time, _q->fft_freq, FFT_METHOD);
+    _q->fft_rev = FFT_CREATE_PLAN_C2R(_q->nfft, _q->fft_freq, _q->fft_out,  FFT_METHOD);
+#endif
+    _q->fft = 1;
+    return LIQUID_OK;
+}
+
+// free transform buffers and plans
+int FIRFILT(_fft_destroy)(FIRFILT() _q)
+{
+    if (!_q->fft)
+        return LIQUID_OK;
+
+    free(_q->fft_time);
+    free(_q->fft_out);
+    free(_q->fft_freq);
+    free(_q->fft_H);
+    FFT_DESTROY_PLAN(_q->fft_fwd);
+    FFT_DESTROY_PLAN(_q->fft_rev);
+    _q->fft = 0;
+    return LIQUID_OK;
+}
+
+// execute overlap-save convolution on one block of input samples,
+// computing the same outputs as pushing each sample and executing
+//  _q      : filter object
+//  _x      : input samples [size: block_size x 1]
+//  _y      : output samples [size: block_size x 1], may be _x
+void FIRFILT(_execute_block_fft)(FIRFILT() _q,
+                                 TI *      _x,
+                                 TO *      _y)
+{
+    unsigned int i;
+    unsigned int n = _q->block_size;
+    unsigned int h_len = _q->h_len;
+
+    // read buffer (last h_len input samples)
+#if LIQUID_FIRFILT_USE_WINDOW
+    TI *r;
+    WINDOW(_read)(_q->w, &r);
+#else
+    TI *r = _q->w + _q->w_index;
+#endif
+
+    // time buffer: last h_len-1 samples of history followed by input
+    for (i=0; i<h_len-1; i++)
+        _q->fft_time[i] = r[i+1];
+    for (i=0; i<n; i++)
+        _q->fft_time[h_len-1+i] = _x[i];
+
+    // update internal buffer before output is written (in-place operation)
+#if LIQUID_FIRFILT_USE_WINDOW
+    WINDOW(_write)(_q->w, _x, n);
+#else
+    unsigned int keep = h_len > n ? h_len - n : 0;
+    memmove(_q->w,        r + n,                  keep*sizeof(TI));
+    memmove(_q->w + keep, _x + n - (h_len-keep),  (h_len-keep)*sizeof(TI));
+    _q->w_index = 0;
+#endif
+
+    // circular convolution with coefficients
+    FFT_EXECUTE(_q->fft_fwd);
+    VECTOR_MUL(_q->fft_freq, _q->fft_H, _q->nfreq, _q->fft_freq);
+    FFT_EXECUTE(_q->fft_rev);
+
+    // apply scaling factor to outputs free of aliasing
+    for (i=0; i<n; i++)
+        _y[i] = _q->fft_out[h_len-1+i] * _q->scale;
+}
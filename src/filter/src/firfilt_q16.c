@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// firfilt_q16 : fixed-point (Q15) finite impulse response (FIR) filter
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FIRFILT()       name-mangling macro
+//  C               number of 16-bit values per sample (1: real, 2: complex)
+//  DOTPROD_Q16     dot product execute method for sample type
+//  EXTENSION_FULL  full extension string
+
+// firfilt_q16 object structure
+struct FIRFILT(_s) {
+    int16_t *    h;         // filter coefficients array (Q15) [size: h_len x 1]
+    unsigned int h_len;     // filter length
+
+    // internal buffer; samples are appended to the end and the most
+    // recent h_len-1 samples are moved to the front when it fills
+    int16_t *    w;         // internal buffer [size: C*(w_len + h_len) x 1]
+    unsigned int w_len;     // window length
+    unsigned int w_mask;    // window index mask
+    unsigned int w_index;   // window read index
+
+    dotprod_q16  dp;        // dot product object
+};
+
+// create fixed-point firfilt object
+//  _h      :   coefficients (Q15) [size: _n x 1]
+//  _n      :   filter length
+FIRFILT() FIRFILT(_create)(int16_t *    _h,
+                           unsigned int _n)
+{
+    // validate input
+    if (_n == 0)
+        return liquid_error_config("firfilt_%s_create(), filter length must be greater than zero", EXTENSION_FULL);
+
+    // create filter object and initialize
+    FIRFILT() q = (FIRFILT()) malloc(sizeof(struct FIRFILT(_s)));
+    q->h_len = _n;
+    q->h = (int16_t *) malloc((q->h_len)*sizeof(int16_t));
+
+    // initialize array for buffering
+    q->w_len   = 1<<liquid_msb_index(q->h_len); // effectively 2^{floor(log2(len))+1}
+    q->w_mask  = q->w_len - 1;
+    q->w       = (int16_t *) malloc(C*(q->w_len + q->h_len + 1)*sizeof(int16_t));
+    q->w_index = 0;
+
+    // load filter in reverse order
+    unsigned int i;
+    for (i=_n; i>0; i--)
+        q->h[i-1] = _h[_n-i];
+
+    // create dot product object
+    q->dp = dotprod_q16_create(q->h, q->h_len);
+
+    // reset filter state (clear buffer)
+    FIRFILT(_reset)(q);
+    return q;
+}
+
+// create fixed-point filter using Kaiser-Bessel windowed sinc method,
+// quantizing the coefficients to Q15
+//  _n      : filter length, _n > 0
+//  _fc     : filter normalized cut-off frequency, 0 < _fc < 0.5
+//  _As     : filter stop-band attenuation [dB], _As > 0
+//  _mu     : fractional sample offset, -0.5 < _mu < 0.5
+FIRFILT() FIRFILT(_create_kaiser)(unsigned int _n,
+                                  float        _fc,
+                                  float        _As,
+                                  float        _mu)
+{
+    // validate input
+    if (_n == 0)
+        return liquid_error_config("firfilt_%s_create_kaiser(), filter length must be greater than zero", EXTENSION_FULL);
+
+    // design filter (floating point precision)
+    float hf[_n];
+    liquid_firdes_kaiser(_n, _fc, _As, _mu, hf);
+
+    // quantize coefficients, rounding and saturating
+    int16_t hq[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        hq[i] = dotprod_q16_quantize(hf[i]);
+
+    return FIRFILT(_create)(hq, _n);
+}
+
+// destroy firfilt object, freeing all internal memory
+int FIRFILT(_destroy)(FIRFILT() _q)
+{
+    dotprod_q16_destroy(_q->dp);
+    free(_q->w);
+    free(_q->h);
+    free(_q);
+    return LIQUID_OK;
+}
+
+// reset internal state of filter object
+int FIRFILT(_reset)(FIRFILT() _q)
+{
+    _q->w_index = 0;
+    memset(_q->w, 0, C*(_q->w_len + _q->h_len + 1)*sizeof(int16_t));
+    return LIQUID_OK;
+}
+
+// print filter object internals (taps, buffer)
+int FIRFILT(_print)(FIRFILT() _q)
+{
+    printf("firfilt_%s [%u taps, shift=%u]:\n", EXTENSION_FULL, _q->h_len,
+            dotprod_q16_get_shift(_q->dp));
+    unsigned int i;
+    unsigned int n = _q->h_len;
+    for (i=0; i<n; i++)
+        printf("  h(%3u) = %6d (%12.9f)\n", i+1, _q->h[n-i-1], (float)_q->h[n-i-1] / 32768.0f);
+    return LIQUID_OK;
+}
+
+// set output shift (right) applied to accumulated value
+int FIRFILT(_set_shift)(FIRFILT()    _q,
+                        unsigned int _shift)
+{
+    return dotprod_q16_set_shift(_q->dp, _shift);
+}
+
+// get output shift (right) applied to accumulated value
+unsigned int FIRFILT(_get_shift)(FIRFILT() _q)
+{
+    return dotprod_q16_get_shift(_q->dp);
+}
+
+// push sample into filter object's internal buffer
+//  _q      :   filter object
+//  _x      :   single input sample [size: C x 1]
+int FIRFILT(_push)(FIRFILT() _q,
+                   int16_t * _x)
+{
+    // increment index
+    _q->w_index++;
+
+    // wrap around pointer
+    _q->w_index &= _q->w_mask;
+
+    // if pointer wraps around, copy excess memory
+    if (_q->w_index == 0)
+        memmove(_q->w, _q->w + C*_q->w_len, C*(_q->h_len)*sizeof(int16_t));
+
+    // append value to end of buffer
+    memmove(_q->w + C*(_q->w_index + _q->h_len - 1), _x, C*sizeof(int16_t));
+    return LIQUID_OK;
+}
+
+// compute output sample (dot product between internal
+// filter coefficients and internal buffer)
+//  _q      :   filter object
+//  _y      :   output sample [size: C x 1]
+int FIRFILT(_execute)(FIRFILT() _q,
+                      int16_t * _y)
+{
+    return DOTPROD_Q16(_q->dp, _q->w + C*_q->w_index, _y);
+}
+
+// execute the filter on a block of input samples; the
+// input and output buffers may be the same
+//  _q      : filter object
+//  _x      : pointer to input array [size: C*_n x 1]
+//  _n      : number of input, output samples
+//  _y      : pointer to output array [size: C*_n x 1]
+int FIRFILT(_execute_block)(FIRFILT()    _q,
+                            int16_t *    _x,
+                            unsigned int _n,
+                            int16_t *    _y)
+{
+    unsigned int i = 0;
+    while (i < _n) {
+        // number of samples which can be appended before buffer wraps
+        unsigned int m = _q->w_mask - _q->w_index;
+        if (m == 0) {
+            // buffer wraps on next sample: push and compute individually
+            FIRFILT(_push)(_q, &_x[C*i]);
+            FIRFILT(_execute)(_q, &_y[C*i]);
+            i++;
+            continue;
+        }
+        m = (_n - i) < m ? (_n - i) : m;
+
+        // append samples to end of buffer (input is copied before output
+        // is written, allowing in-place operation)
+        memmove(_q->w + C*(_q->w_index + _q->h_len), &_x[C*i], C*m*sizeof(int16_t));
+
+        // compute output for each input window
+        unsigned int k;
+        for (k=0; k<m; k++)
+            DOTPROD_Q16(_q->dp, _q->w + C*(_q->w_index + 1 + k), &_y[C*(i+k)]);
+        _q->w_index += m;
+
+        i += m;
+    }
+    return LIQUID_OK;
+}
+
+// get filter length
+unsigned int FIRFILT(_get_length)(FIRFILT() _q)
+{
+    return _q->h_len;
+}
+
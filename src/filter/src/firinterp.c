@@ -259,10 +259,7 @@ void FIRINTERP(_execute_block)(FIRINTERP()  _q,
                                unsigned int _n,
                                TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute one input at a time with an output stride _M
-        FIRINTERP(_execute)(_q, _x[i], &_y[i*_q->M]);
-    }
+    // compute all filterbank outputs for each input sample
+    FIRPFB(_execute_block_bank)(_q->filterbank, _x, _n, _y);
 }
 
@@ -28,6 +28,9 @@
 #include <string.h>
 #include <stdlib.h>
 
+// maximum number of input samples processed at once in block execution
+#define LIQUID_FIRPFB_BLOCK_LEN     (256)
+
 struct FIRPFB(_s) {
     TC * h;                     // filter coefficients array
     unsigned int h_len;         // total number of filter coefficients
@@ -37,6 +40,10 @@ struct FIRPFB(_s) {
     WINDOW() w;                 // window buffer
     DOTPROD() * dp;             // array of vector dot product objects
     TC scale;                   // output scaling factor
+
+    // contiguous buffer history and input for block execution
+    TI * b;                     // [size: h_sub_len - 1 + LIQUID_FIRPFB_BLOCK_LEN x 1]
+    TO * v;                     // [size: LIQUID_FIRPFB_BLOCK_LEN x 1]
 };
 
 // create firpfb from external coefficients
@@ -84,6 +91,10 @@ FIRPFB() FIRPFB(_create)(unsigned int _M,
     // create window buffer
     q->w = WINDOW(_create)(q->h_sub_len);
 
+    // allocate memory for block execution
+    q->b = (TI*) malloc((q->h_sub_len - 1 + LIQUID_FIRPFB_BLOCK_LEN)*sizeof(TI));
+    q->v = (TO*) malloc(LIQUID_FIRPFB_BLOCK_LEN*sizeof(TO));
+
     // set default scaling
     q->scale = 1;
 
@@ -267,6 +278,8 @@ void FIRPFB(_destroy)(FIRPFB() _q)
         DOTPROD(_destroy)(_q->dp[i]);
     free(_q->dp);
     WINDOW(_destroy)(_q->w);
+    free(_q->b);
+    free(_q->v);
     free(_q);
 }
 
@@ -350,13 +363,78 @@ void FIRPFB(_execute_block)(FIRPFB()     _q,
                             unsigned int _n,
                             TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // push sample into filter
-        FIRPFB(_push)(_q, _x[i]);
+    // validate input
+    if (_i >= _q->num_filters) {
+        liquid_error(LIQUID_EICONFIG,"firpfb_execute_block(), filterbank index (%u) exceeds maximum (%u)",_i,_q->num_filters);
+        return;
+    }
+
+    unsigned int i = 0;
+    while (i < _n) {
+        // number of samples in this block
+        unsigned int m = _n - i < LIQUID_FIRPFB_BLOCK_LEN ? _n - i : LIQUID_FIRPFB_BLOCK_LEN;
+
+        // copy buffer history and input samples into contiguous array
+        TI * r;
+        TI * b = _q->b;
+        WINDOW(_read)(_q->w, &r);
+        memmove(b, r + 1, (_q->h_sub_len - 1)*sizeof(TI));
+        memmove(b + _q->h_sub_len - 1, &_x[i], m*sizeof(TI));
+
+        // compute output for each input window
+        DOTPROD(_execute_block)(_q->dp[_i], b, m, &_y[i]);
+
+        // update buffer (from copy, as output may overwrite input)
+        WINDOW(_write)(_q->w, b + _q->h_sub_len - 1, m);
+
+        // apply scaling factor
+        unsigned int k;
+        for (k=0; k<m; k++)
+            _y[i+k] *= _q->scale;
+
+        i += m;
+    }
+}
+
+// execute all filters in the bank on a block of input samples,
+// interleaving outputs such that _y[k*M + i] is the output of filter i
+// after pushing _x[k] into the buffer
+//  _q      : firpfb object
+//  _x      : pointer to input array [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : pointer to output array [size: _n*M x 1]
+void FIRPFB(_execute_block_bank)(FIRPFB()     _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int M = _q->num_filters;
+    unsigned int i = 0;
+    while (i < _n) {
+        // number of samples in this block
+        unsigned int m = _n - i < LIQUID_FIRPFB_BLOCK_LEN ? _n - i : LIQUID_FIRPFB_BLOCK_LEN;
+
+        // copy buffer history and input samples into contiguous array
+        TI * r;
+        TI * b = _q->b;
+        WINDOW(_read)(_q->w, &r);
+        memmove(b, r + 1, (_q->h_sub_len - 1)*sizeof(TI));
+        memmove(b + _q->h_sub_len - 1, &_x[i], m*sizeof(TI));
+
+        // compute output of each filter for each input window, and
+        // interleave into output array
+        TO * v = _q->v;
+        unsigned int j, k;
+        for (j=0; j<M; j++) {
+            DOTPROD(_execute_block)(_q->dp[j], b, m, v);
+            for (k=0; k<m; k++)
+                _y[(i+k)*M + j] = v[k] * _q->scale;
+        }
+
+        // update buffer
+        WINDOW(_write)(_q->w, b + _q->h_sub_len - 1, m);
 
-        // compute output at appropriate index
-        FIRPFB(_execute)(_q, _i, &_y[i]);
+        i += m;
     }
 }
 
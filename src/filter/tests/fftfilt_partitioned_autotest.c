@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare partitioned fftfilt against regular firfilt; the taps are
+// scaled so outputs have unit variance
+//  _h_len  : filter length
+//  _n      : block size (partition length)
+void testbench_fftfilt_partitioned(unsigned int _h_len,
+                                   unsigned int _n)
+{
+    float tol = 2e-4f;
+    unsigned int num_blocks = (_h_len + _n - 1)/_n + 3;
+    unsigned int num_samples = num_blocks * _n;
+    unsigned int i;
+
+    // generate coefficients
+    float         hr[_h_len];
+    float complex hc[_h_len];
+    for (i=0; i<_h_len; i++) {
+        hr[i] = randnf() / sqrtf(_h_len);
+        hc[i] = (randnf() + _Complex_I*randnf()) / sqrtf(2*_h_len);
+    }
+
+    // generate input
+    float *         xr = (float*)         malloc(num_samples*sizeof(float));
+    float complex * xc = (float complex*) malloc(num_samples*sizeof(float complex));
+    float *         yr = (float*)         malloc(num_samples*sizeof(float));
+    float complex * y0 = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(num_samples*sizeof(float complex));
+    for (i=0; i<num_samples; i++) {
+        xr[i] = randnf();
+        xc[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // create objects
+    fftfilt_rrrf qr = fftfilt_rrrf_create(hr, _h_len, _n);
+    fftfilt_crcf q0 = fftfilt_crcf_create(hr, _h_len, _n);
+    fftfilt_cccf q1 = fftfilt_cccf_create(hc, _h_len, _n);
+    firfilt_rrrf fr = firfilt_rrrf_create(hr, _h_len);
+    firfilt_crcf f0 = firfilt_crcf_create(hr, _h_len);
+    firfilt_cccf f1 = firfilt_cccf_create(hc, _h_len);
+    CONTEND_EQUALITY(fftfilt_crcf_get_num_partitions(q0),
+                     _h_len > _n+1 ? (_h_len - 2)/_n + 1 : 1);
+
+    // run in blocks, in place
+    memmove(yr, xr, num_samples*sizeof(float));
+    memmove(y0, xc, num_samples*sizeof(float complex));
+    memmove(y1, xc, num_samples*sizeof(float complex));
+    for (i=0; i<num_blocks; i++) {
+        fftfilt_rrrf_execute(qr, &yr[i*_n], &yr[i*_n]);
+        fftfilt_crcf_execute(q0, &y0[i*_n], &y0[i*_n]);
+        fftfilt_cccf_execute(q1, &y1[i*_n], &y1[i*_n]);
+    }
+
+    // compare to direct convolution
+    for (i=0; i<num_samples; i++) {
+        float         vr;
+        float complex v0, v1;
+        firfilt_rrrf_push(fr, xr[i]); firfilt_rrrf_execute(fr, &vr);
+        firfilt_crcf_push(f0, xc[i]); firfilt_crcf_execute(f0, &v0);
+        firfilt_cccf_push(f1, xc[i]); firfilt_cccf_execute(f1, &v1);
+        CONTEND_DELTA(yr[i], vr, tol);
+        CONTEND_DELTA(crealf(y0[i]), crealf(v0), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(v0), tol);
+        CONTEND_DELTA(crealf(y1[i]), crealf(v1), tol);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(v1), tol);
+    }
+
+    // reset and check that the delay line was cleared
+    fftfilt_crcf_reset(q0);
+    firfilt_crcf_reset(f0);
+    fftfilt_crcf_execute(q0, xc, y0);
+    for (i=0; i<_n; i++) {
+        float complex v0;
+        firfilt_crcf_push(f0, xc[i]); firfilt_crcf_execute(f0, &v0);
+        CONTEND_DELTA(crealf(y0[i]), crealf(v0), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(v0), tol);
+    }
+
+    // destroy objects
+    fftfilt_rrrf_destroy(qr);
+    fftfilt_crcf_destroy(q0);
+    fftfilt_cccf_destroy(q1);
+    firfilt_rrrf_destroy(fr);
+    firfilt_crcf_destroy(f0);
+    firfilt_cccf_destroy(f1);
+    free(xr);
+    free(xc);
+    free(yr);
+    free(y0);
+    free(y1);
+}
+
+void autotest_fftfilt_partitioned_h17_n16()     { testbench_fftfilt_partitioned(  17,  16); }
+void autotest_fftfilt_partitioned_h18_n16()     { testbench_fftfilt_partitioned(  18,  16); }
+void autotest_fftfilt_partitioned_h33_n16()     { testbench_fftfilt_partitioned(  33,  16); }
+void autotest_fftfilt_partitioned_h100_n7()     { testbench_fftfilt_partitioned( 100,   7); }
+void autotest_fftfilt_partitioned_h1000_n1()    { testbench_fftfilt_partitioned(1000,   1); }
+void autotest_fftfilt_partitioned_h8192_n256()  { testbench_fftfilt_partitioned(8192, 256); }
+
+// output scaling is applied once per block; check against firfilt with the
+// same scale, then that restoring unit scale recovers the original response
+void autotest_fftfilt_partitioned_scale()
+{
+    float tol = 2e-4f;
+    unsigned int h_len = 100;
+    unsigned int n     = 16;
+    unsigned int num_blocks = 12;
+    unsigned int i, j;
+
+    float h[h_len];
+    for (i=0; i<h_len; i++)
+        h[i] = randnf() / sqrtf(h_len);
+
+    fftfilt_crcf q = fftfilt_crcf_create(h, h_len, n);
+    firfilt_crcf f = firfilt_crcf_create(h, h_len);
+    float scale = -2.5f;
+    fftfilt_crcf_set_scale(q, scale);
+    firfilt_crcf_set_scale(f, scale);
+
+    float complex x[n], y[n];
+    for (i=0; i<num_blocks; i++) {
+        for (j=0; j<n; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+        fftfilt_crcf_execute(q, x, y);
+        for (j=0; j<n; j++) {
+            float complex v;
+            firfilt_crcf_push(f, x[j]);
+            firfilt_crcf_execute(f, &v);
+            CONTEND_DELTA(crealf(y[j]), crealf(v), tol*fabsf(scale));
+            CONTEND_DELTA(cimagf(y[j]), cimagf(v), tol*fabsf(scale));
+        }
+    }
+
+    // restoring unit scale recovers the unscaled response
+    float s;
+    fftfilt_crcf_set_scale(q, 1);
+    fftfilt_crcf_get_scale(q, &s);
+    CONTEND_EQUALITY(s, 1.0f);
+    fftfilt_crcf_reset(q);
+    firfilt_crcf_set_scale(f, 1);
+    firfilt_crcf_reset(f);
+    for (j=0; j<n; j++)
+        x[j] = randnf() + _Complex_I*randnf();
+    fftfilt_crcf_execute(q, x, y);
+    for (j=0; j<n; j++) {
+        float complex v;
+        firfilt_crcf_push(f, x[j]);
+        firfilt_crcf_execute(f, &v);
+        CONTEND_DELTA(crealf(y[j]), crealf(v), tol);
+        CONTEND_DELTA(cimagf(y[j]), cimagf(v), tol);
+    }
+
+    fftfilt_crcf_destroy(q);
+    firfilt_crcf_destroy(f);
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// filter_xxxd_autotest.c : test double-precision filters
+//
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// 
+// AUTOTEST: firfilt (double) against direct convolution
+//
+void autotest_firfilt_xxxd()
+{
+    double tol = 1e-12;
+    unsigned int h_len = 37;
+    unsigned int num_samples = 200;
+    double         hr[h_len], xr[num_samples], yr[num_samples];
+    double complex hc[h_len], xc[num_samples], ym[num_samples], yc[num_samples];
+
+    unsigned int i, k;
+    for (i=0; i<h_len; i++) {
+        hr[i] = randnf();
+        hc[i] = randnf() + _Complex_I*randnf();
+    }
+    for (i=0; i<num_samples; i++) {
+        xr[i] = randnf();
+        xc[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // run filters, mixing sample-by-sample and block execution
+    firfilt_rrrd qr = firfilt_rrrd_create(hr, h_len);
+    firfilt_crcd qm = firfilt_crcd_create(hr, h_len);
+    firfilt_cccd qc = firfilt_cccd_create(hc, h_len);
+    for (i=0; i<num_samples/2; i++) {
+        firfilt_rrrd_push(qr, xr[i]);
+        firfilt_crcd_push(qm, xc[i]);
+        firfilt_cccd_push(qc, xc[i]);
+        firfilt_rrrd_execute(qr, &yr[i]);
+        firfilt_crcd_execute(qm, &ym[i]);
+        firfilt_cccd_execute(qc, &yc[i]);
+    }
+    i = num_samples/2;
+    firfilt_rrrd_execute_block(qr, xr+i, num_samples-i, yr+i);
+    firfilt_crcd_execute_block(qm, xc+i, num_samples-i, ym+i);
+    firfilt_cccd_execute_block(qc, xc+i, num_samples-i, yc+i);
+    firfilt_rrrd_destroy(qr);
+    firfilt_crcd_destroy(qm);
+    firfilt_cccd_destroy(qc);
+
+    // compare against direct convolution
+    for (i=0; i<num_samples; i++) {
+        double         yr_test = 0;
+        double complex ym_test = 0, yc_test = 0;
+        for (k=0; k<h_len && k<=i; k++) {
+            yr_test += hr[k] * xr[i-k];
+            ym_test += hr[k] * xc[i-k];
+            yc_test += hc[k] * xc[i-k];
+        }
+        CONTEND_DELTA(yr[i],        yr_test,        tol);
+        CONTEND_DELTA(creal(ym[i]), creal(ym_test), tol);
+        CONTEND_DELTA(cimag(ym[i]), cimag(ym_test), tol);
+        CONTEND_DELTA(creal(yc[i]), creal(yc_test), tol);
+        CONTEND_DELTA(cimag(yc[i]), cimag(yc_test), tol);
+    }
+}
+
+// 
+// AUTOTEST: iirfilt (double) against difference equation
+//
+void autotest_iirfilt_xxxd()
+{
+    double tol = 1e-12;
+    unsigned int num_samples = 200;
+    double b[3] = {0.2, 0.4, 0.2};
+    double a[3] = {1.0,-0.6, 0.25};
+    double complex x[num_samples], y[num_samples];
+
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run filter in both direct and second-order sections form
+    iirfilt_crcd q0 = iirfilt_crcd_create(b, 3, a, 3);
+    iirfilt_crcd q1 = iirfilt_crcd_create_sos(b, a, 1);
+    double complex y1[num_samples];
+    iirfilt_crcd_execute_block(q0, x, num_samples, y);
+    iirfilt_crcd_execute_block(q1, x, num_samples, y1);
+    iirfilt_crcd_destroy(q0);
+    iirfilt_crcd_destroy(q1);
+
+    // compare against difference equation
+    double complex x1 = 0, x2 = 0, v1 = 0, v2 = 0;
+    for (i=0; i<num_samples; i++) {
+        double complex v = b[0]*x[i] + b[1]*x1 + b[2]*x2 - a[1]*v1 - a[2]*v2;
+        CONTEND_DELTA(creal(y[i]),  creal(v), tol);
+        CONTEND_DELTA(cimag(y[i]),  cimag(v), tol);
+        CONTEND_DELTA(creal(y1[i]), creal(v), tol);
+        CONTEND_DELTA(cimag(y1[i]), cimag(v), tol);
+        x2 = x1; x1 = x[i];
+        v2 = v1; v1 = v;
+    }
+}
+
+// 
+// AUTOTEST: double-precision prototype matches single-precision filter
+//
+void autotest_iirfilt_rrrd_prototype()
+{
+    unsigned int num_samples = 100;
+    iirfilt_rrrf qf = iirfilt_rrrf_create_lowpass(7, 0.1f);
+    iirfilt_rrrd qd = iirfilt_rrrd_create_lowpass(7, 0.1f);
+
+    unsigned int i;
+    for (i=0; i<num_samples; i++) {
+        float  x = randnf();
+        float  yf;
+        double yd;
+        iirfilt_rrrf_execute(qf, x, &yf);
+        iirfilt_rrrd_execute(qd, x, &yd);
+        CONTEND_DELTA(yd, yf, 1e-4);
+    }
+    iirfilt_rrrf_destroy(qf);
+    iirfilt_rrrd_destroy(qd);
+}
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include <math.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// block sizes exercised in each test, chosen to cross internal buffer
+// boundaries at various offsets
+static unsigned int firfilt_block_len[] = {1, 7, 64, 3, 200, 31, 0, 513, 2};
+#define FIRFILT_BLOCK_NUM (sizeof(firfilt_block_len)/sizeof(unsigned int))
+
+// compare firfilt block execution (in place) against single samples
+void testbench_firfilt_crcf_block(unsigned int _h_len)
+{
+    float tol = 1e-4f;
+    float h[_h_len];
+    unsigned int i, j;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    firfilt_crcf q0 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf q1 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf_set_scale(q0, 0.5f);
+    firfilt_crcf_set_scale(q1, 0.5f);
+
+    for (i=0; i<FIRFILT_BLOCK_NUM; i++) {
+        unsigned int num_samples = firfilt_block_len[i];
+        float complex buf[num_samples+1], y_test;
+        for (j=0; j<num_samples; j++)
+            buf[j] = randnf() + _Complex_I*randnf();
+
+        // run in place
+        float complex x[num_samples+1];
+        memmove(x, buf, num_samples*sizeof(float complex));
+        firfilt_crcf_execute_block(q1, buf, num_samples, buf);
+
+        for (j=0; j<num_samples; j++) {
+            firfilt_crcf_push(q0, x[j]);
+            firfilt_crcf_execute(q0, &y_test);
+            CONTEND_DELTA(crealf(buf[j]), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(buf[j]), cimagf(y_test), tol);
+        }
+    }
+
+    firfilt_crcf_destroy(q0);
+    firfilt_crcf_destroy(q1);
+}
+
+// compare firfilt overlap-save block execution (in place) against
+// single samples for block size _n
+void testbench_firfilt_crcf_block_fft(unsigned int _h_len,
+                                      unsigned int _n)
+{
+    float tol = 1e-4f * sqrtf(_h_len);
+    float h[_h_len];
+    unsigned int i, j;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    firfilt_crcf q0 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf q1 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf_set_scale(q0, 0.5f);
+    firfilt_crcf_set_scale(q1, 0.5f);
+    firfilt_crcf_set_block_size(q1, _n);
+    firfilt_crcf_set_fft(q1, 1);
+    CONTEND_EQUALITY(firfilt_crcf_get_block_size(q1), _n);
+
+    // full blocks, remainders, and single samples interleaved
+    unsigned int block_len[] = {_n, 3*_n+5, 1, 7, 2*_n, _n-1, 0, 513, _n};
+    for (i=0; i<sizeof(block_len)/sizeof(unsigned int); i++) {
+        unsigned int num_samples = block_len[i];
+        float complex buf[num_samples+1], y_test;
+        for (j=0; j<num_samples; j++)
+            buf[j] = randnf() + _Complex_I*randnf();
+
+        float complex x[num_samples+1];
+        memmove(x, buf, num_samples*sizeof(float complex));
+        if (num_samples == 1) {
+            firfilt_crcf_push(q1, buf[0]);
+            firfilt_crcf_execute(q1, &buf[0]);
+        } else {
+            firfilt_crcf_execute_block(q1, buf, num_samples, buf);
+        }
+
+        for (j=0; j<num_samples; j++) {
+            firfilt_crcf_push(q0, x[j]);
+            firfilt_crcf_execute(q0, &y_test);
+            CONTEND_DELTA(crealf(buf[j]), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(buf[j]), cimagf(y_test), tol);
+        }
+    }
+
+    firfilt_crcf_destroy(q0);
+    firfilt_crcf_destroy(q1);
+}
+
+// compare real and complex-coefficient overlap-save paths against
+// dot products on the same input
+void testbench_firfilt_block_fft_types(unsigned int _h_len,
+                                       unsigned int _n)
+{
+    float tol = 1e-4f * sqrtf(_h_len);
+    unsigned int num_samples = 4*_n + 3;
+    float         hr[_h_len], xr[num_samples], yr0[num_samples], yr1[num_samples];
+    float complex hc[_h_len], xc[num_samples], yc0[num_samples], yc1[num_samples];
+    unsigned int i;
+    for (i=0; i<_h_len; i++) {
+        hr[i] = randnf();
+        hc[i] = randnf() + _Complex_I*randnf();
+    }
+    for (i=0; i<num_samples; i++) {
+        xr[i] = randnf();
+        xc[i] = randnf() + _Complex_I*randnf();
+    }
+
+    firfilt_rrrf r0 = firfilt_rrrf_create(hr, _h_len);
+    firfilt_rrrf r1 = firfilt_rrrf_create(hr, _h_len);
+    firfilt_cccf c0 = firfilt_cccf_create(hc, _h_len);
+    firfilt_cccf c1 = firfilt_cccf_create(hc, _h_len);
+    firfilt_rrrf_set_block_size(r1, _n);
+    firfilt_cccf_set_block_size(c1, _n);
+    firfilt_rrrf_set_fft(r1, 1);
+    firfilt_cccf_set_fft(c1, 1);
+
+    firfilt_rrrf_execute_block(r0, xr, num_samples, yr0);
+    firfilt_rrrf_execute_block(r1, xr, num_samples, yr1);
+    firfilt_cccf_execute_block(c0, xc, num_samples, yc0);
+    firfilt_cccf_execute_block(c1, xc, num_samples, yc1);
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA(yr1[i], yr0[i], tol);
+        CONTEND_DELTA(crealf(yc1[i]), crealf(yc0[i]), 2*tol);
+        CONTEND_DELTA(cimagf(yc1[i]), cimagf(yc0[i]), 2*tol);
+    }
+
+    firfilt_rrrf_destroy(r0);
+    firfilt_rrrf_destroy(r1);
+    firfilt_cccf_destroy(c0);
+    firfilt_cccf_destroy(c1);
+}
+
+// compare firdecim block execution against single output samples
+void testbench_firdecim_crcf_block(unsigned int _M,
+                                   unsigned int _h_len)
+{
+    float tol = 1e-4f;
+    float h[_h_len];
+    unsigned int i, j;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf();
+
+    firdecim_crcf q0 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf q1 = firdecim_crcf_create(_M, h, _h_len);
+
+    for (i=0; i<FIRFILT_BLOCK_NUM; i++) {
+        unsigned int num_outputs = firfilt_block_len[i];
+        float complex x[num_outputs*_M+1], y[num_outputs+1], y_test;
+        for (j=0; j<num_outputs*_M; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+
+        firdecim_crcf_execute_block(q1, x, num_outputs, y);
+
+        for (j=0; j<num_outputs; j++) {
+            firdecim_crcf_execute(q0, &x[j*_M], &y_test);
+            CONTEND_DELTA(crealf(y[j]), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(y[j]), cimagf(y_test), tol);
+        }
+    }
+
+    firdecim_crcf_destroy(q0);
+    firdecim_crcf_destroy(q1);
+}
+
+// compare firinterp block execution against single input samples
+void testbench_firinterp_crcf_block(unsigned int _M,
+                                    unsigned int _m)
+{
+    float tol = 1e-4f;
+    unsigned int i, j, k;
+
+    firinterp_crcf q0 = firinterp_crcf_create_kaiser(_M, _m, 60.0f);
+    firinterp_crcf q1 = firinterp_crcf_create_kaiser(_M, _m, 60.0f);
+
+    for (i=0; i<FIRFILT_BLOCK_NUM; i++) {
+        unsigned int num_samples = firfilt_block_len[i];
+        float complex x[num_samples+1], y[num_samples*_M+1], y_test[_M];
+        for (j=0; j<num_samples; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+
+        firinterp_crcf_execute_block(q1, x, num_samples, y);
+
+        for (j=0; j<num_samples; j++) {
+            firinterp_crcf_execute(q0, x[j], y_test);
+            for (k=0; k<_M; k++) {
+                CONTEND_DELTA(crealf(y[j*_M+k]), crealf(y_test[k]), tol);
+                CONTEND_DELTA(cimagf(y[j*_M+k]), cimagf(y_test[k]), tol);
+            }
+        }
+    }
+
+    firinterp_crcf_destroy(q0);
+    firinterp_crcf_destroy(q1);
+}
+
+void autotest_firfilt_crcf_block_h1()   { testbench_firfilt_crcf_block(  1); }
+void autotest_firfilt_crcf_block_h13()  { testbench_firfilt_crcf_block( 13); }
+void autotest_firfilt_crcf_block_h64()  { testbench_firfilt_crcf_block( 64); }
+void autotest_firfilt_crcf_block_h129() { testbench_firfilt_crcf_block(129); }
+
+void autotest_firfilt_crcf_block_fft_h13_n64()   { testbench_firfilt_crcf_block_fft(  13,  64); }
+void autotest_firfilt_crcf_block_fft_h200_n100()  { testbench_firfilt_crcf_block_fft( 200, 100); }
+void autotest_firfilt_crcf_block_fft_h301_n256()  { testbench_firfilt_crcf_block_fft( 301, 256); }
+void autotest_firfilt_crcf_block_fft_h1000_n24()  { testbench_firfilt_crcf_block_fft(1000,  24); }
+void autotest_firfilt_block_fft_types_h77_n50()   { testbench_firfilt_block_fft_types(  77,  50); }
+void autotest_firfilt_block_fft_types_h500_n512() { testbench_firfilt_block_fft_types( 500, 512); }
+
+// long filters with large blocks select transforms automatically; short
+// filters keep using dot products
+void autotest_firfilt_crcf_block_fft_select()
+{
+    CONTEND_EQUALITY(firfilt_crcf_fft_select(1000, 1024), 1);
+    CONTEND_EQUALITY(firfilt_crcf_fft_select(   8, 1024), 0);
+    CONTEND_EQUALITY(firfilt_crcf_fft_select(1000,    1), 0);
+}
+
+void autotest_firdecim_crcf_block_M2()  { testbench_firdecim_crcf_block(2, 21); }
+void autotest_firdecim_crcf_block_M5()  { testbench_firdecim_crcf_block(5, 64); }
+
+void autotest_firinterp_crcf_block_M2() { testbench_firinterp_crcf_block(2, 7); }
+void autotest_firinterp_crcf_block_M7() { testbench_firinterp_crcf_block(7, 4); }
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// reference convolution output: accumulate, round, shift, and saturate
+//  _h      : coefficients [size: _h_len x 1]
+//  _x      : input values, oldest first [size: C*_n x 1]
+//  _c      : values per sample (1: real, 2: complex)
+//  _k      : index of most recent input sample
+static int16_t firfilt_q16_ref(int16_t *    _h,
+                               unsigned int _h_len,
+                               int16_t *    _x,
+                               unsigned int _c,
+                               unsigned int _k,
+                               unsigned int _shift)
+{
+    int64_t v = 0;
+    unsigned int i;
+    for (i=0; i<_h_len && i<=_k; i++)
+        v += (int64_t)_h[i] * (int64_t)_x[_c*(_k-i)];
+    v = (v + ((int64_t)1 << (_shift-1))) >> _shift;
+    return v > 32767 ? 32767 : (v < -32768 ? -32768 : (int16_t)v);
+}
+
+// compare firfilt_q16/cq16 (single sample and in-place block) against
+// reference convolution
+void testbench_firfilt_q16(unsigned int _h_len)
+{
+    unsigned int n = 700;
+    int16_t h[_h_len], x[2*n], y0[2*n], y1[2*n];
+    unsigned int i;
+    for (i=0; i<_h_len; i++) h[i] = (int16_t)(rand() & 0xffff);
+    for (i=0; i<2*n;    i++) x[i] = (int16_t)(rand() & 0xffff);
+
+    firfilt_q16  qr0 = firfilt_q16_create (h, _h_len);
+    firfilt_q16  qr1 = firfilt_q16_create (h, _h_len);
+    firfilt_cq16 qc0 = firfilt_cq16_create(h, _h_len);
+    firfilt_cq16 qc1 = firfilt_cq16_create(h, _h_len);
+    CONTEND_EQUALITY(firfilt_q16_get_length(qr0), _h_len);
+
+    // real: one sample at a time, then in place in several blocks
+    for (i=0; i<n; i++) {
+        firfilt_q16_push(qr0, &x[i]);
+        firfilt_q16_execute(qr0, &y0[i]);
+    }
+    memmove(y1, x, n*sizeof(int16_t));
+    firfilt_q16_execute_block(qr1, y1,       13, y1);
+    firfilt_q16_execute_block(qr1, y1+13,   300, y1+13);
+    firfilt_q16_execute_block(qr1, y1+313, n-313, y1+313);
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY(y0[i], firfilt_q16_ref(h, _h_len, x, 1, i, 15));
+        CONTEND_EQUALITY(y1[i], y0[i]);
+    }
+
+    // complex: one sample at a time, then in place in several blocks
+    for (i=0; i<n; i++) {
+        firfilt_cq16_push(qc0, &x[2*i]);
+        firfilt_cq16_execute(qc0, &y0[2*i]);
+    }
+    memmove(y1, x, 2*n*sizeof(int16_t));
+    firfilt_cq16_execute_block(qc1, y1,          257, y1);
+    firfilt_cq16_execute_block(qc1, y1+2*257, n-257, y1+2*257);
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY(y0[2*i+0], firfilt_q16_ref(h, _h_len, x+0, 2, i, 15));
+        CONTEND_EQUALITY(y0[2*i+1], firfilt_q16_ref(h, _h_len, x+1, 2, i, 15));
+        CONTEND_EQUALITY(y1[2*i+0], y0[2*i+0]);
+        CONTEND_EQUALITY(y1[2*i+1], y0[2*i+1]);
+    }
+
+    firfilt_q16_destroy(qr0);
+    firfilt_q16_destroy(qr1);
+    firfilt_cq16_destroy(qc0);
+    firfilt_cq16_destroy(qc1);
+}
+
+// compare firdecim_q16/cq16 against reference convolution
+void testbench_firdecim_q16(unsigned int _M,
+                            unsigned int _h_len,
+                            unsigned int _shift)
+{
+    unsigned int n = 90;
+    int16_t h[_h_len], x[2*n*_M], y[2*n];
+    unsigned int i;
+    for (i=0; i<_h_len;  i++) h[i] = (int16_t)(rand() & 0xffff);
+    for (i=0; i<2*n*_M;  i++) x[i] = (int16_t)(rand() & 0xffff);
+
+    firdecim_q16  qr = firdecim_q16_create (_M, h, _h_len);
+    firdecim_cq16 qc = firdecim_cq16_create(_M, h, _h_len);
+    firdecim_q16_set_shift (qr, _shift);
+    firdecim_cq16_set_shift(qc, _shift);
+    CONTEND_EQUALITY(firdecim_q16_get_decim_rate(qr), _M);
+
+    // real: single output, then block
+    for (i=0; i<n/2; i++)
+        firdecim_q16_execute(qr, &x[i*_M], &y[i]);
+    firdecim_q16_execute_block(qr, &x[(n/2)*_M], n-n/2, &y[n/2]);
+    for (i=0; i<n; i++)
+        CONTEND_EQUALITY(y[i], firfilt_q16_ref(h, _h_len, x, 1, i*_M+_M-1, _shift));
+
+    // complex: block
+    firdecim_cq16_execute_block(qc, x, n, y);
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY(y[2*i+0], firfilt_q16_ref(h, _h_len, x+0, 2, i*_M+_M-1, _shift));
+        CONTEND_EQUALITY(y[2*i+1], firfilt_q16_ref(h, _h_len, x+1, 2, i*_M+_M-1, _shift));
+    }
+
+    firdecim_q16_destroy(qr);
+    firdecim_cq16_destroy(qc);
+}
+
+// check Kaiser design against floating-point filter on small signal
+void autotest_firfilt_cq16_kaiser()
+{
+    unsigned int h_len = 31;
+    float h[h_len];
+    liquid_firdes_kaiser(h_len, 0.2f, 60.0f, 0.0f, h);
+    firfilt_crcf  qf = firfilt_crcf_create(h, h_len);
+    firfilt_cq16  q  = firfilt_cq16_create_kaiser(h_len, 0.2f, 60.0f, 0.0f);
+
+    unsigned int i;
+    for (i=0; i<200; i++) {
+        float complex x = 0.3f*randnf() + _Complex_I*0.3f*randnf();
+        int16_t xq[2] = {(int16_t)roundf(crealf(x)*4096), (int16_t)roundf(cimagf(x)*4096)};
+        float complex yf;
+        int16_t yq[2];
+        firfilt_crcf_push(qf, x);
+        firfilt_crcf_execute(qf, &yf);
+        firfilt_cq16_push(q, xq);
+        firfilt_cq16_execute(q, yq);
+        CONTEND_DELTA(yq[0]/4096.0f, crealf(yf), 4e-3f);
+        CONTEND_DELTA(yq[1]/4096.0f, cimagf(yf), 4e-3f);
+    }
+
+    firfilt_crcf_destroy(qf);
+    firfilt_cq16_destroy(q);
+}
+
+void autotest_firfilt_q16_h1()      { testbench_firfilt_q16(  1); }
+void autotest_firfilt_q16_h13()     { testbench_firfilt_q16( 13); }
+void autotest_firfilt_q16_h64()     { testbench_firfilt_q16( 64); }
+void autotest_firfilt_q16_h129()    { testbench_firfilt_q16(129); }
+
+void autotest_firdecim_q16_M2()     { testbench_firdecim_q16(2, 21, 15); }
+void autotest_firdecim_q16_M5()     { testbench_firdecim_q16(5, 64, 18); }
+void autotest_firdecim_q16_M16()    { testbench_firdecim_q16(16, 7, 15); }
+
+
+// a tap at -1.0 is quantized to -32767 rather than -32768, so full-scale
+// negative inputs give the same outputs for every SIMD type
+void autotest_firfilt_q16_full_scale()
+{
+    CONTEND_EQUALITY(dotprod_q16_quantize(-1.0f), -32767);
+    CONTEND_EQUALITY(dotprod_q16_quantize( 1.0f),  32767);
+    CONTEND_EQUALITY(dotprod_q16_quantize(-2.0f), -32767);
+
+    unsigned int h_len = 32;
+    unsigned int n     = 64;
+    unsigned int shift = 20;
+    int16_t h[h_len], x[2*n], y[2*n];
+    unsigned int i, t;
+    for (i=0; i<h_len; i++) h[i] = dotprod_q16_quantize(-1.0f);
+    for (i=0; i<2*n;    i++) x[i] = -32768;
+
+    for (t=1; t<LIQUID_SIMD_NUM_TYPES; t++) {
+        if (!liquid_simd_is_available(t))
+            continue;
+        liquid_simd_set_type(t);
+        firfilt_q16  qr = firfilt_q16_create (h, h_len);
+        firfilt_cq16 qc = firfilt_cq16_create(h, h_len);
+        firfilt_q16_set_shift (qr, shift);
+        firfilt_cq16_set_shift(qc, shift);
+
+        firfilt_q16_execute_block(qr, x, n, y);
+        for (i=0; i<n; i++)
+            CONTEND_EQUALITY(y[i], firfilt_q16_ref(h, h_len, x, 1, i, shift));
+
+        firfilt_cq16_execute_block(qc, x, n, y);
+        for (i=0; i<n; i++) {
+            CONTEND_EQUALITY(y[2*i+0], firfilt_q16_ref(h, h_len, x+0, 2, i, shift));
+            CONTEND_EQUALITY(y[2*i+1], firfilt_q16_ref(h, h_len, x+1, 2, i, shift));
+        }
+
+        firfilt_q16_destroy(qr);
+        firfilt_cq16_destroy(qc);
+    }
+
+    // restore automatic selection
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
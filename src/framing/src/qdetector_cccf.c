@@ -42,20 +42,25 @@ int qdetector_cccf_execute_seek(qdetector_cccf _q, float complex  _x);
 // align signal in time, compute offset estimates
 int qdetector_cccf_execute_align(qdetector_cccf _q, float complex  _x);
 
+// cross-multiply received spectrum with conjugated template, shifted by
+// carrier frequency offset index, storing result in buf_freq_1
+int qdetector_cccf_cross_multiply(qdetector_cccf _q, int _offset);
+
 // main object definition
 struct qdetector_cccf_s {
     unsigned int    s_len;          // template (time) length: k * (sequence_len + 2*m)
     float complex * s;              // template (time), [size: s_len x 1]
-    float complex * S;              // template (freq), [size: nfft x 1]
+    float complex * S;              // template (freq), conjugated, [size: nfft x 1]
     float           s2_sum;         // sum{ s^2 }
 
     float complex * buf_time_0;     // time-domain buffer (FFT)
     float complex * buf_freq_0;     // frequence-domain buffer (FFT)
     float complex * buf_freq_1;     // frequence-domain buffer (IFFT)
     float complex * buf_time_1;     // time-domain buffer (IFFT)
+    float *         buf_abs;        // magnitude of frequency/time-domain buffer
     unsigned int    nfft;           // fft size
     fftplan         fft;            // FFT object:  buf_time_0 > buf_freq_0
-    fftplan         ifft;           // IFFT object: buf_freq_1 > buf_freq_1
+    fftplan         ifft;           // IFFT object: buf_freq_1 > buf_time_1
 
     unsigned int    counter;        // sample counter for determining when to compute FFTs
     float           threshold;      // detection threshold
@@ -104,16 +109,23 @@ qdetector_cccf qdetector_cccf_create(float complex * _s,
     q->buf_freq_0 = (float complex*) malloc(q->nfft * sizeof(float complex));
     q->buf_freq_1 = (float complex*) malloc(q->nfft * sizeof(float complex));
     q->buf_time_1 = (float complex*) malloc(q->nfft * sizeof(float complex));
+    q->buf_abs    = (float*)         malloc(q->nfft * sizeof(float));
 
     q->fft  = fft_create_plan(q->nfft, q->buf_time_0, q->buf_freq_0, LIQUID_FFT_FORWARD,  0);
     q->ifft = fft_create_plan(q->nfft, q->buf_freq_1, q->buf_time_1, LIQUID_FFT_BACKWARD, 0);
 
-    // create frequency-domain template by taking nfft-point transform on 's', storing in 'S'
+    // create frequency-domain template by taking nfft-point transform on
+    // zero-padded 's', storing its conjugate in 'S'
     q->S = (float complex*) malloc(q->nfft * sizeof(float complex));
     memset(q->buf_time_0, 0x00, q->nfft*sizeof(float complex));
     memmove(q->buf_time_0, q->s, q->s_len*sizeof(float complex));
-    fft_execute(q->fft);
-    memmove(q->S, q->buf_freq_0, q->nfft*sizeof(float complex));
+    fftplan fft_s = fft_create_plan_pruned(q->nfft, q->buf_time_0, q->buf_freq_0, LIQUID_FFT_FORWARD, 0,
+                                           q->s_len, 0, q->nfft);
+    fft_execute(fft_s);
+    fft_destroy_plan(fft_s);
+    unsigned int i;
+    for (i=0; i<q->nfft; i++)
+        q->S[i] = conjf(q->buf_freq_0[i]);
 
     // reset state variables
     q->counter        = q->nfft/2;
@@ -279,6 +291,7 @@ int qdetector_cccf_destroy(qdetector_cccf _q)
     free(_q->buf_freq_0);
     free(_q->buf_freq_1);
     free(_q->buf_time_1);
+    free(_q->buf_abs   );
 
     // destroy objects
     fft_destroy_plan(_q->fft);
@@ -460,12 +473,7 @@ int qdetector_cccf_execute_seek(qdetector_cccf _q,
     for (offset=-_q->range; offset<=_q->range; offset++) {
 
         // cross-multiply, aligning appropriately
-        for (i=0; i<_q->nfft; i++) {
-            // shifted index
-            unsigned int j = (i + _q->nfft - offset) % _q->nfft;
-
-            _q->buf_freq_1[i] = _q->buf_freq_0[i] * conjf(_q->S[j]);
-        }
+        qdetector_cccf_cross_multiply(_q, offset);
 
         // run inverse transform
         fft_execute(_q->ifft);
@@ -494,10 +502,10 @@ int qdetector_cccf_execute_seek(qdetector_cccf _q,
 #endif
         // search for peak
         // TODO: only search over range [-nfft/2, nfft/2)
+        liquid_vectorcf_abs(_q->buf_time_1, _q->nfft, _q->buf_abs);
         for (i=0; i<_q->nfft; i++) {
-            float rxy_abs = cabsf(_q->buf_time_1[i]);
-            if (rxy_abs > rxy_peak) {
-                rxy_peak   = rxy_abs;
+            if (_q->buf_abs[i] > rxy_peak) {
+                rxy_peak   = _q->buf_abs[i];
                 rxy_index  = i;
                 rxy_offset = offset;
             }
@@ -507,6 +515,8 @@ int qdetector_cccf_execute_seek(qdetector_cccf _q,
     // increment number of transforms (debugging)
     _q->num_transforms++;
 
+    // a peak where the template extends past the end of the buffer is not
+    // accepted; it is detected on a later transform instead
     if (rxy_peak > _q->threshold && rxy_index < _q->nfft - _q->s_len) {
 #if DEBUG_QDETECTOR_PRINT
         printf("*** frame detected! rxy = %12.8f, time index=%u, freq. offset=%d\n", rxy_peak, rxy_index, rxy_offset);
@@ -552,12 +562,7 @@ int qdetector_cccf_execute_align(qdetector_cccf _q,
     fft_execute(_q->fft);
     // cross-multiply frequency-domain components, aligning appropriately with
     // estimated FFT offset index due to carrier frequency offset in received signal
-    unsigned int i;
-    for (i=0; i<_q->nfft; i++) {
-        // shifted index
-        unsigned int j = (i + _q->nfft - _q->offset) % _q->nfft;
-        _q->buf_freq_1[i] = _q->buf_freq_0[i] * conjf(_q->S[j]);
-    }
+    qdetector_cccf_cross_multiply(_q, _q->offset);
     fft_execute(_q->ifft);
     // time aligned to index 0
     // NOTE: taking the sqrt removes bias in the timing estimate, but messes up gamma estimate
@@ -578,6 +583,7 @@ int qdetector_cccf_execute_align(qdetector_cccf _q,
     memmove(_q->buf_time_1, _q->buf_time_0, _q->nfft*sizeof(float complex));
 
     // estimate carrier frequency offset
+    unsigned int i;
     for (i=0; i<_q->nfft; i++)
         _q->buf_time_0[i] *= i < _q->s_len ? conjf(_q->s[i]) : 0.0f;
     fft_execute(_q->fft);
@@ -603,18 +609,18 @@ int qdetector_cccf_execute_align(qdetector_cccf _q,
     // TODO: don't search for peak but just use internal offset
     float        v0 = 0.0f;
     unsigned int i0 = 0;
+    liquid_vectorcf_abs(_q->buf_freq_0, _q->nfft, _q->buf_abs);
     for (i=0; i<_q->nfft; i++) {
-        float v_abs = cabsf(_q->buf_freq_0[i]);
-        if (v_abs > v0) {
-            v0 = v_abs;
+        if (_q->buf_abs[i] > v0) {
+            v0 = _q->buf_abs[i];
             i0 = i;
         }
     }
     // interpolate using quadratic polynomial for carrier frequency estimate
     unsigned int ineg = (i0 + _q->nfft - 1)%_q->nfft;
     unsigned int ipos = (i0            + 1)%_q->nfft;
-    float        vneg = cabsf(_q->buf_freq_0[ineg]);
-    float        vpos = cabsf(_q->buf_freq_0[ipos]);
+    float        vneg = _q->buf_abs[ineg];
+    float        vpos = _q->buf_abs[ipos];
     a            =  0.5f*(vpos + vneg) - v0;
     b            =  0.5f*(vpos - vneg);
     //c            =  v0;
@@ -668,3 +674,17 @@ int qdetector_cccf_execute_align(qdetector_cccf _q,
     return LIQUID_OK;
 }
 
+// cross-multiply received spectrum with conjugated template, shifted by
+// carrier frequency offset index, storing result in buf_freq_1
+int qdetector_cccf_cross_multiply(qdetector_cccf _q,
+                                  int            _offset)
+{
+    // template index aligned with first element; template wraps around
+    // to the beginning after the first (nfft - k) elements
+    unsigned int k = (_q->nfft - _offset) % _q->nfft;
+    unsigned int n = _q->nfft - k;
+    liquid_vectorcf_mul(_q->buf_freq_0,     _q->S + k, n, _q->buf_freq_1);
+    liquid_vectorcf_mul(_q->buf_freq_0 + n, _q->S,     k, _q->buf_freq_1 + n);
+    return LIQUID_OK;
+}
+
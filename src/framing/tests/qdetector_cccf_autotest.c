@@ -306,3 +306,48 @@ void qdetector_cccf_runtest_gmsk(unsigned int _sequence_len)
 }
 
 
+
+// a correlation peak at a lag where the template extends past the end of
+// the buffer suppresses detection for that transform, even if a smaller
+// peak at a valid lag exceeds the threshold; the stronger sequence is
+// then detected on the next transform once it lies entirely within it
+void autotest_qdetector_cccf_invalid_lag()
+{
+    unsigned int s_len = 64;
+    float complex s[s_len];
+    unsigned int i;
+    for (i=0; i<s_len; i++) {
+        s[i] = (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 +
+               (rand() % 2 ? 1.0f : -1.0f) * M_SQRT1_2 * _Complex_I;
+    }
+
+    qdetector_cccf q = qdetector_cccf_create(s, s_len);
+    qdetector_cccf_set_threshold(q, 0.1f);
+    unsigned int buf_len = qdetector_cccf_get_buf_len(q);
+
+    // weak copy entirely within the first buffer, strong copy straddling
+    // its end such that its partial correlation is the largest
+    unsigned int num_samples = 4*buf_len;
+    unsigned int n_weak   = 10;
+    unsigned int n_strong = buf_len - s_len/2;
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = 0.0f;
+    for (i=0; i<s_len; i++) {
+        x[n_weak  +i] += 0.5f*s[i];
+        x[n_strong+i] += 4.0f*s[i];
+    }
+
+    // detected buffer should start with the strong copy
+    float complex * v = NULL;
+    for (i=0; i<num_samples && v == NULL; i++)
+        v = (float complex*) qdetector_cccf_execute(q, x[i]);
+    CONTEND_EXPRESSION(v != NULL);
+    if (v != NULL) {
+        float e = liquid_sumsqcf(v, s_len) / (float)s_len;
+        if (liquid_autotest_verbose)
+            printf("qdetector invalid lag: detected after %u samples, energy %.3f\n", i, e);
+        CONTEND_DELTA(e, 16.0f, 1.0f);
+    }
+    qdetector_cccf_destroy(q);
+}
@@ -30,7 +30,14 @@
 (   struct rusage *     _start,             \
     struct rusage *     _finish,            \
     unsigned long int * _num_iterations)    \
-{ fskdem_bench(_start, _finish, _num_iterations, m, k, bandwidth); }
+{ fskdem_bench(_start, _finish, _num_iterations, m, k, bandwidth, -1); }
+
+// force detector bank (1) or full transform (0)
+#define FSKDEM_BENCH_METHOD_API(m,k,bandwidth,bank) \
+(   struct rusage *     _start,             \
+    struct rusage *     _finish,            \
+    unsigned long int * _num_iterations)    \
+{ fskdem_bench(_start, _finish, _num_iterations, m, k, bandwidth, bank); }
 
 // Helper function to keep code base small
 void fskdem_bench(struct rusage *     _start,
@@ -38,7 +45,8 @@ void fskdem_bench(struct rusage *     _start,
                   unsigned long int * _num_iterations,
                   unsigned int        _m,
                   unsigned int        _k,
-                  float               _bandwidth)
+                  float               _bandwidth,
+                  int                 _bank)
 {
     // normalize number of iterations
     *_num_iterations /= _k;
@@ -47,6 +55,8 @@ void fskdem_bench(struct rusage *     _start,
 
     // initialize demodulator
     fskdem dem = fskdem_create(_m,_k,_bandwidth);
+    if (_bank >= 0)
+        fskdem_set_bank(dem, _bank);
 
     //unsigned int M = 1 << _m;   // constellation size
     
@@ -101,3 +111,15 @@ void benchmark_fskdem_misc_M256    FSKDEM_BENCH_API( 8,  500, 0.3721451)
 void benchmark_fskdem_misc_M512    FSKDEM_BENCH_API( 9, 1000, 0.3721451)
 void benchmark_fskdem_misc_M1024   FSKDEM_BENCH_API(10, 2000, 0.3721451)
 
+// BENCHMARKS: small alphabets with many samples per symbol, full transform
+// compared to bank of single-bin detectors
+void benchmark_fskdem_fft_M2_k64   FSKDEM_BENCH_METHOD_API( 1,   64, 0.25f, 0)
+void benchmark_fskdem_bank_M2_k64  FSKDEM_BENCH_METHOD_API( 1,   64, 0.25f, 1)
+void benchmark_fskdem_fft_M2_k256  FSKDEM_BENCH_METHOD_API( 1,  256, 0.25f, 0)
+void benchmark_fskdem_bank_M2_k256 FSKDEM_BENCH_METHOD_API( 1,  256, 0.25f, 1)
+void benchmark_fskdem_fft_M4_k64   FSKDEM_BENCH_METHOD_API( 2,   64, 0.25f, 0)
+void benchmark_fskdem_bank_M4_k64  FSKDEM_BENCH_METHOD_API( 2,   64, 0.25f, 1)
+void benchmark_fskdem_fft_M4_k256  FSKDEM_BENCH_METHOD_API( 2,  256, 0.25f, 0)
+void benchmark_fskdem_bank_M4_k256 FSKDEM_BENCH_METHOD_API( 2,  256, 0.25f, 1)
+void benchmark_fskdem_fft_M16_k64  FSKDEM_BENCH_METHOD_API( 4,   64, 0.25f, 0)
+void benchmark_fskdem_bank_M16_k64 FSKDEM_BENCH_METHOD_API( 4,   64, 0.25f, 1)
@@ -30,6 +30,9 @@
 
 #include "liquid.internal.h"
 
+// number of samples demodulated at a time in block method
+#define FREQDEM_BLOCK_LEN   (64)
+
 // freqdem
 struct FREQDEM(_s) {
     // common
@@ -113,10 +116,21 @@ int FREQDEM(_demodulate_block)(FREQDEM()    _q,
                                unsigned int _n,
                                T *          _m)
 {
-    // TODO: implement more efficient method
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        FREQDEM(_demodulate)(_q, _r[i], &_m[i]);
+    TC v[FREQDEM_BLOCK_LEN];
+    unsigned int i, j, k;
+    for (i=0; i<_n; i+=k) {
+        k = _n - i < FREQDEM_BLOCK_LEN ? _n - i : FREQDEM_BLOCK_LEN;
+
+        // compute phase difference products
+        for (j=0; j<k; j++) {
+            v[j] = conjf(_q->r_prime)*_r[i+j];
+            _q->r_prime = _r[i+j];
+        }
+
+        // compute angles and normalize by modulation index
+        liquid_vectorcf_carg(v, k, &_m[i]);
+        liquid_vectorf_mulscalar(&_m[i], k, _q->ref, &_m[i]);
+    }
     return LIQUID_OK;
 }
 
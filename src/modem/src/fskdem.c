@@ -37,6 +37,10 @@
 // internal methods
 //
 
+// create/destroy bank of single-bin detectors
+int fskdem_bank_create (fskdem _q);
+int fskdem_bank_destroy(fskdem _q);
+
 // fskdem
 struct fskdem_s {
     // common
@@ -53,6 +57,14 @@ struct fskdem_s {
     FFT_PLAN        fft;        // FFT object
     unsigned int *  demod_map;  // demodulation map
 
+    // bank of single-bin detectors, used in place of the full transform
+    // when only a few of its bins are needed
+    int             bank;       // use detector bank? (allocated only if so)
+    dotprod_cccf *  dp;         // tone detectors [size: M x 1]
+    float complex * twiddle;    // exp(-j 2 pi i/K) [size: K x 1]
+    unsigned int *  bin_stamp;  // symbol count when bin was last computed [size: K x 1]
+    unsigned int    num_symbols;// symbol counter (1 + number demodulated since reset)
+
     // state variables
     unsigned int    s_demod;    // demodulated symbol (used for frequency error)
 };
@@ -141,6 +153,13 @@ fskdem fskdem_create(unsigned int _m,
     q->buf_freq = (float complex*) malloc(q->K * sizeof(float complex));
     q->fft = FFT_CREATE_PLAN(q->K, q->buf_time, q->buf_freq, FFT_DIR_FORWARD, 0);
 
+    // use detector bank when cheaper than the full transform (roughly
+    // K log2(K) operations), e.g. for small alphabets with many samples
+    // per symbol
+    q->bank = 0;
+    if (q->M * q->k < q->K * liquid_nextpow2(q->K))
+        fskdem_bank_create(q);
+
     // reset modem object
     fskdem_reset(q);
 
@@ -157,6 +176,9 @@ int fskdem_destroy(fskdem _q)
     free(_q->buf_freq);
     FFT_DESTROY_PLAN(_q->fft);
 
+    // free detector bank
+    fskdem_bank_destroy(_q);
+
     // free main object memory
     free(_q);
     return LIQUID_OK;
@@ -169,6 +191,7 @@ int fskdem_print(fskdem _q)
     printf("    bits/symbol     :   %u\n", _q->m);
     printf("    samples/symbol  :   %u\n", _q->k);
     printf("    bandwidth       :   %8.5f\n", _q->bandwidth);
+    printf("    detector        :   %s (K=%u)\n", _q->bank ? "bank" : "fft", _q->K);
     return LIQUID_OK;
 }
 
@@ -178,9 +201,12 @@ int fskdem_reset(fskdem _q)
     // reset time and frequency buffers
     unsigned int i;
     for (i=0; i<_q->K; i++) {
-        _q->buf_time[i] = 0.0f;
-        _q->buf_freq[i] = 0.0f;
+        _q->buf_time[i]  = 0.0f;
+        _q->buf_freq[i]  = 0.0f;
     }
+    if (_q->bank)
+        memset(_q->bin_stamp, 0, _q->K*sizeof(unsigned int));
+    _q->num_symbols = 1;
 
     // clear state variables
     _q->s_demod = 0;
@@ -196,12 +222,29 @@ unsigned int fskdem_demodulate(fskdem          _q,
     // copy input to internal time buffer
     memmove(_q->buf_time, _y, _q->k*sizeof(float complex));
 
-    // compute transform, storing result in 'buf_freq'
-    FFT_EXECUTE(_q->fft);
+    // invalidate bins computed for previous symbol (clearing stamps
+    // should the counter ever wrap around)
+    _q->num_symbols++;
+    if (_q->bank && _q->num_symbols == 0) {
+        memset(_q->bin_stamp, 0, _q->K*sizeof(unsigned int));
+        _q->num_symbols = 1;
+    }
+
+    unsigned int s;
+    if (_q->bank) {
+        // compute tone bins only, storing result in 'buf_freq'
+        for (s=0; s<_q->M; s++) {
+            unsigned int index = _q->demod_map[s];
+            dotprod_cccf_execute(_q->dp[s], _q->buf_time, &_q->buf_freq[index]);
+            _q->bin_stamp[index] = _q->num_symbols;
+        }
+    } else {
+        // compute transform, storing result in 'buf_freq'
+        FFT_EXECUTE(_q->fft);
+    }
 
     // find maximum by looking at particular bins
     float        vmax  = 0;
-    unsigned int s     = 0;
 
     // run search
     for (s=0; s<_q->M; s++) {
@@ -226,9 +269,9 @@ float fskdem_get_frequency_error(fskdem _q)
     //unsigned int index = _q->buf_freq[ _q->s_demod ];
 
     // extract peak value of previous, post FFT index
-    float vm = cabsf(_q->buf_freq[(_q->s_demod+_q->K-1)%_q->K]);  // previous
-    float v0 = cabsf(_q->buf_freq[ _q->s_demod               ]);  // peak
-    float vp = cabsf(_q->buf_freq[(_q->s_demod+      1)%_q->K]);  // post
+    float vm = cabsf(fskdem_get_bin(_q, (_q->s_demod+_q->K-1)%_q->K));  // previous
+    float v0 = cabsf(fskdem_get_bin(_q,  _q->s_demod               ));  // peak
+    float vp = cabsf(fskdem_get_bin(_q, (_q->s_demod+      1)%_q->K));  // post
 
     // compute derivative
     // TODO: compensate for bin spacing
@@ -255,7 +298,7 @@ float fskdem_get_symbol_energy(fskdem       _q,
     unsigned int index = _q->demod_map[_s];
 
     // compute energy around FFT bin
-    float complex v = _q->buf_freq[index];
+    float complex v = fskdem_get_bin(_q, index);
     float energy = crealf(v)*crealf(v) + cimagf(v)*cimagf(v);
     int i;
     for (i=0; i<_range; i++) {
@@ -263,8 +306,8 @@ float fskdem_get_symbol_energy(fskdem       _q,
         unsigned int i0 = (index         + i) % _q->K;
         unsigned int i1 = (index + _q->K - i) % _q->K;
 
-        float complex v0 = _q->buf_freq[i0];
-        float complex v1 = _q->buf_freq[i1];
+        float complex v0 = fskdem_get_bin(_q, i0);
+        float complex v1 = fskdem_get_bin(_q, i1);
 
         energy += crealf(v0)*crealf(v0) + cimagf(v0)*cimagf(v0);
         energy += crealf(v1)*crealf(v1) + cimagf(v1)*cimagf(v1);
@@ -273,3 +316,74 @@ float fskdem_get_symbol_energy(fskdem       _q,
     return energy;
 }
 
+// get frequency bin of transform of most recent symbol, computing it
+// directly if the detector bank is in use
+float complex fskdem_get_bin(fskdem       _q,
+                             unsigned int _index)
+{
+    if (!_q->bank || _q->bin_stamp[_index] == _q->num_symbols)
+        return _q->buf_freq[_index];
+
+    // correlate input with complex exponential at bin frequency
+    float complex v = 0.0f;
+    unsigned int n, t = 0;
+    for (n=0; n<_q->k; n++) {
+        v += _q->buf_time[n] * _q->twiddle[t];
+        t += _index;
+        if (t >= _q->K) t -= _q->K;
+    }
+    _q->buf_freq [_index] = v;
+    _q->bin_stamp[_index] = _q->num_symbols;
+    return v;
+}
+
+// select detector bank (1) or full transform (0) for demodulation
+int fskdem_set_bank(fskdem _q,
+                    int    _bank)
+{
+    if (_bank && !_q->bank)
+        return fskdem_bank_create(_q);
+    if (!_bank && _q->bank)
+        return fskdem_bank_destroy(_q);
+    return LIQUID_OK;
+}
+
+// create detector bank: the input only occupies the first k samples of
+// the transform, so each tone bin is a k-point dot product
+int fskdem_bank_create(fskdem _q)
+{
+    _q->twiddle   = (float complex*) malloc(_q->K * sizeof(float complex));
+    _q->bin_stamp = (unsigned int *) malloc(_q->K * sizeof(unsigned int));
+    unsigned int i, n;
+    for (i=0; i<_q->K; i++)
+        _q->twiddle[i] = cexpf(-_Complex_I*2*M_PI*(float)i/(float)(_q->K));
+    _q->dp = (dotprod_cccf*) malloc(_q->M * sizeof(dotprod_cccf));
+    float complex h[_q->k];
+    for (i=0; i<_q->M; i++) {
+        for (n=0; n<_q->k; n++)
+            h[n] = _q->twiddle[(_q->demod_map[i]*n) % _q->K];
+        _q->dp[i] = dotprod_cccf_create(h, _q->k);
+    }
+
+    // bins of transform buffer are no longer current
+    memset(_q->bin_stamp, 0, _q->K*sizeof(unsigned int));
+    _q->num_symbols = 1;
+    _q->bank = 1;
+    return LIQUID_OK;
+}
+
+// destroy detector bank
+int fskdem_bank_destroy(fskdem _q)
+{
+    if (!_q->bank)
+        return LIQUID_OK;
+
+    unsigned int i;
+    for (i=0; i<_q->M; i++)
+        dotprod_cccf_destroy(_q->dp[i]);
+    free(_q->dp);
+    free(_q->twiddle);
+    free(_q->bin_stamp);
+    _q->bank = 0;
+    return LIQUID_OK;
+}
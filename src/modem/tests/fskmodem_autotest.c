@@ -20,8 +20,11 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
+#include <math.h>
+
 #include "autotest/autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 // Help function to keep code base small
 void fskmodem_test_mod_demod(unsigned int _m,
@@ -83,3 +86,65 @@ void autotest_fskmodem_misc_M256()  { fskmodem_test_mod_demod( 8,  500, 0.372145
 void autotest_fskmodem_misc_M512()  { fskmodem_test_mod_demod( 9, 1000, 0.3721451); }
 void autotest_fskmodem_misc_M1024() { fskmodem_test_mod_demod(10, 2000, 0.3721451); }
 
+
+// Help function to keep code base small: compare demodulation using
+// detector bank against full transform
+void fskmodem_test_bank(unsigned int _m,
+                        unsigned int _k,
+                        float        _bandwidth)
+{
+    // create modulator and pair of demodulators
+    fskmod mod  = fskmod_create(_m,_k,_bandwidth);
+    fskdem dem0 = fskdem_create(_m,_k,_bandwidth);
+    fskdem dem1 = fskdem_create(_m,_k,_bandwidth);
+    fskdem_set_bank(dem0, 0);
+    fskdem_set_bank(dem1, 1);
+
+    unsigned int M = 1 << _m;   // constellation size
+    float complex buf[_k];      // transmit buffer
+    unsigned int i, j, s, range;
+    for (i=0; i<4*M; i++) {
+        // modulate random symbol and add noise
+        fskmod_modulate(mod, rand() % M, buf);
+        for (j=0; j<_k; j++)
+            buf[j] += 0.3f*(randnf() + _Complex_I*randnf());
+
+        // decisions must match
+        unsigned int sym0 = fskdem_demodulate(dem0, buf);
+        unsigned int sym1 = fskdem_demodulate(dem1, buf);
+        CONTEND_EQUALITY(sym0, sym1);
+
+        // energies must match
+        for (s=0; s<M && s<4; s++) {
+            for (range=0; range<3; range++) {
+                float e0 = fskdem_get_symbol_energy(dem0, s, range);
+                float e1 = fskdem_get_symbol_energy(dem1, s, range);
+                CONTEND_DELTA(e1, e0, 1e-4f*(e0 + _k));
+            }
+        }
+        // bins around decision must match
+        for (j=(sym0 > 0 ? sym0-1 : 0); j<=sym0+1; j++) {
+            float v0 = cabsf(fskdem_get_bin(dem0, j));
+            float v1 = cabsf(fskdem_get_bin(dem1, j));
+            CONTEND_DELTA(v1, v0, 1e-4f*(v0 + _k));
+        }
+
+        // frequency error is (vp-vm)/v0 which is poorly conditioned when
+        // v0 is small, so scale tolerance by 1/v0
+        float v0  = cabsf(fskdem_get_bin(dem0, sym0));
+        float fe0 = fskdem_get_frequency_error(dem0);
+        float fe1 = fskdem_get_frequency_error(dem1);
+        CONTEND_DELTA(fe1, fe0, 1e-4f*_k*(2.0f + fabsf(fe0)) / (v0 + 1e-6f));
+    }
+
+    // clean it up
+    fskmod_destroy(mod);
+    fskdem_destroy(dem0);
+    fskdem_destroy(dem1);
+}
+
+// AUTOTESTS: detector bank matches full transform
+void autotest_fskmodem_bank_M2()      { fskmodem_test_bank(1, 64, 0.25f    ); }
+void autotest_fskmodem_bank_M4()      { fskmodem_test_bank(2, 64, 0.25f    ); }
+void autotest_fskmodem_bank_M4_misc() { fskmodem_test_bank(2, 50, 0.3721451); }
+void autotest_fskmodem_bank_M16()     { fskmodem_test_bank(4, 32, 0.25f    ); }
@@ -126,9 +126,9 @@ FIRPFBCH() FIRPFBCH(_create)(int          _type,
 
     // create fft plan
     if (q->type == LIQUID_ANALYZER)
-        q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_FORWARD, FFT_METHOD);
+        q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_FORWARD, FFT_METHOD_ARRAYS);
     else
-        q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
+        q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD_ARRAYS);
 
     // reset filterbank object
     FIRPFBCH(_reset)(q);
@@ -307,11 +307,8 @@ int FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,
 {
     unsigned int i;
 
-    // copy channelized symbols to transform input
-    memmove(_q->X, _x, _q->num_channels*sizeof(TI));
-
-    // execute inverse DFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->fft);
+    // execute inverse DFT on channelized symbols, store result in buffer 'x'
+    FFT_EXECUTE_ARRAYS(_q->fft, _x, _q->x);
 
     // push samples into filter bank and execute
     T * r;      // read pointer
@@ -393,11 +390,8 @@ int FIRPFBCH(_analyzer_run)(FIRPFBCH()   _q,
         DOTPROD(_execute)(_q->dp[i], r, &_q->X[_q->num_channels-i-1]);
     }
 
-    // execute DFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->fft);
-
-    // move to output array
-    memmove(_y, _q->x, _q->num_channels*sizeof(TO));
+    // execute DFT, store result in output array
+    FFT_EXECUTE_ARRAYS(_q->fft, _q->X, _y);
     return LIQUID_OK;
 }
 
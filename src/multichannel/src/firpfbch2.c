@@ -108,7 +108,7 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
     // TODO : use fftw_malloc if HAVE_FFTW3_H
     q->X = (T*) malloc((q->M)*sizeof(T));   // IFFT input
     q->x = (T*) malloc((q->M)*sizeof(T));   // IFFT output
-    q->ifft = FFT_CREATE_PLAN(q->M, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
+    q->ifft = FFT_CREATE_PLAN(q->M, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD_ARRAYS);
 
     // create buffer objects
     q->w0 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
@@ -286,11 +286,8 @@ int FIRPFBCH2(_execute_synthesizer)(FIRPFBCH2() _q,
 {
     unsigned int i;
 
-    // copy input array to internal IFFT input buffer
-    memmove(_q->X, _x, _q->M * sizeof(TI));
-
-    // execute IFFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->ifft);
+    // execute IFFT on input array, store result in buffer 'x'
+    FFT_EXECUTE_ARRAYS(_q->ifft, _x, _q->x);
 
     // TODO: ignore this scaling
     // scale result by 1/num_channels (C transform)
@@ -35,6 +35,9 @@
 
 #define LIQUID_DEBUG_NCO            (0)
 
+// number of samples processed at a time in VCO block mixing
+#define NCO_VCO_BLOCK_LEN           (64)
+
 struct NCO(_s) {
     liquid_ncotype  type;           // NCO type (e.g. LIQUID_VCO)
     T               sintab[1024];   // sine look-up table
@@ -64,6 +67,17 @@ uint32_t NCO(_constrain)(float _theta);
 // compute index for sine look-up table
 unsigned int NCO(_index)(NCO() _q);
 
+// convert fixed-point phase to radians in [-pi,pi)
+T NCO(_phase_vco)(uint32_t _theta);
+
+// rotate block of samples by VCO phase using vectorized sine/cosine,
+// negating the phase for the down-conversion direction
+int NCO(_mix_block_vco)(NCO()        _q,
+                        TC *         _x,
+                        TC *         _y,
+                        unsigned int _n,
+                        int          _down);
+
 // create nco/vco object
 NCO() NCO(_create)(liquid_ncotype _type)
 {
@@ -173,12 +187,18 @@ T NCO(_get_frequency)(NCO() _q)
 // compute sine, cosine internally
 T NCO(_sin)(NCO() _q)
 {
+    if (_q->type == LIQUID_VCO)
+        return SIN(NCO(_phase_vco)(_q->theta));
+
     unsigned int index = NCO(_index)(_q);
     return _q->sintab[index];
 }
 
 T NCO(_cos)(NCO() _q)
 {
+    if (_q->type == LIQUID_VCO)
+        return COS(NCO(_phase_vco)(_q->theta));
+
     // add pi/2 phase shift
     unsigned int index = (NCO(_index)(_q) + 256) & 0x3ff;
     return _q->sintab[index];
@@ -189,6 +209,14 @@ int NCO(_sincos)(NCO() _q,
                  T *   _s,
                  T *   _c)
 {
+    // voltage-controlled oscillator computes values directly
+    if (_q->type == LIQUID_VCO) {
+        T theta = NCO(_phase_vco)(_q->theta);
+        *_s = SIN(theta);
+        *_c = COS(theta);
+        return LIQUID_OK;
+    }
+
     // add pi/2 phase shift
     unsigned int index = NCO(_index)(_q);
 
@@ -286,7 +314,6 @@ int NCO(_mix_down)(NCO() _q,
 
 // Rotate input vector array up by NCO angle:
 //      y(t) = x(t) exp{+j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -296,6 +323,9 @@ int NCO(_mix_block_up)(NCO()        _q,
                        TC *         _y,
                        unsigned int _n)
 {
+    if (_q->type == LIQUID_VCO)
+        return NCO(_mix_block_vco)(_q, _x, _y, _n, 0);
+
     unsigned int i;
     // FIXME: this method should be more efficient but is causing occasional
     //        errors so instead favor slower but more reliable algorithm
@@ -324,7 +354,6 @@ int NCO(_mix_block_up)(NCO()        _q,
 
 // Rotate input vector array down by NCO angle:
 //      y(t) = x(t) exp{-j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -334,6 +363,9 @@ int NCO(_mix_block_down)(NCO()        _q,
                          TC *         _y,
                          unsigned int _n)
 {
+    if (_q->type == LIQUID_VCO)
+        return NCO(_mix_block_vco)(_q, _x, _y, _n, 1);
+
     unsigned int i;
     // FIXME: this method should be more efficient but is causing occasional
     //        errors so instead favor slower but more reliable algorithm
@@ -387,3 +419,37 @@ unsigned int NCO(_index)(NCO() _q)
     return ((_q->theta + (1<<21)) >> 22) & 0x3ff; // round appropriately
 }
 
+// convert fixed-point phase to radians in [-pi,pi)
+T NCO(_phase_vco)(uint32_t _theta)
+{
+    // interpret as signed value; 2*pi/2^32 ~ 1.4629180792671596e-9
+    return (T)((int32_t)_theta) * 1.4629180792671596e-9f;
+}
+
+// rotate block of samples by VCO phase using vectorized sine/cosine,
+// negating the phase for the down-conversion direction
+int NCO(_mix_block_vco)(NCO()        _q,
+                        TC *         _x,
+                        TC *         _y,
+                        unsigned int _n,
+                        int          _down)
+{
+    T  theta[NCO_VCO_BLOCK_LEN];
+    TC v    [NCO_VCO_BLOCK_LEN];
+    unsigned int i, j, k;
+    for (i=0; i<_n; i+=k) {
+        k = _n - i < NCO_VCO_BLOCK_LEN ? _n - i : NCO_VCO_BLOCK_LEN;
+
+        // compute phase of each sample from fixed-point accumulator
+        for (j=0; j<k; j++) {
+            T phi = NCO(_phase_vco)(_q->theta);
+            theta[j] = _down ? -phi : phi;
+            _q->theta += _q->d_theta;
+        }
+
+        // compute phasors and rotate input
+        liquid_vectorcf_cexpj(theta, k, v);
+        liquid_vectorcf_mul(&_x[i], v, k, &_y[i]);
+    }
+    return LIQUID_OK;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _op     :   operation (0: mul, 1: mulscalar, 2: abs, 3: cexpj, 4: carg,
+//              5: sincos, 6: atan2, 7: log10, 8: exp)
+void vector_bench(struct rusage *_start,
+                  struct rusage *_finish,
+                  unsigned long int *_num_iterations,
+                  unsigned int _n,
+                  unsigned int _op)
+{
+    // normalize number of iterations
+    *_num_iterations *= 256;
+    *_num_iterations /= _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex x[_n], y[_n], z[_n];
+    float         t[_n], u[_n], v[_n], w[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        y[i] = randnf() + _Complex_I*randnf();
+        t[i] = randnf();
+        u[i] = randnf();
+        w[i] = expf(4.0f*randnf());
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        switch (_op) {
+        case 0: liquid_vectorcf_mul      (x, y, _n, z);     break;
+        case 1: liquid_vectorcf_mulscalar(x, _n, y[0], z);  break;
+        case 2: liquid_vectorcf_abs      (x, _n, t);        break;
+        case 3: liquid_vectorcf_cexpj    (t, _n, z);        break;
+        case 4: liquid_vectorcf_carg     (x, _n, t);        break;
+        case 5: liquid_vectorf_sincos    (t, _n, u, v);     break;
+        case 6: liquid_vectorf_atan2     (t, u, _n, v);     break;
+        case 7: liquid_vectorf_log10     (w, _n, v);        break;
+        case 8: liquid_vectorf_exp       (t, _n, v);        break;
+        default:;
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+}
+
+#define VECTOR_BENCHMARK_API(N,OP)      \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ vector_bench(_start, _finish, _num_iterations, N, OP); }
+
+void benchmark_vectorcf_mul_256         VECTOR_BENCHMARK_API(256, 0)
+void benchmark_vectorcf_mul_4096        VECTOR_BENCHMARK_API(4096,0)
+void benchmark_vectorcf_mulscalar_256   VECTOR_BENCHMARK_API(256, 1)
+void benchmark_vectorcf_mulscalar_4096  VECTOR_BENCHMARK_API(4096,1)
+void benchmark_vectorcf_abs_256         VECTOR_BENCHMARK_API(256, 2)
+void benchmark_vectorcf_abs_4096        VECTOR_BENCHMARK_API(4096,2)
+void benchmark_vectorcf_cexpj_256       VECTOR_BENCHMARK_API(256, 3)
+void benchmark_vectorcf_cexpj_4096      VECTOR_BENCHMARK_API(4096,3)
+void benchmark_vectorcf_carg_256        VECTOR_BENCHMARK_API(256, 4)
+void benchmark_vectorcf_carg_4096       VECTOR_BENCHMARK_API(4096,4)
+void benchmark_vectorf_sincos_256       VECTOR_BENCHMARK_API(256, 5)
+void benchmark_vectorf_sincos_4096      VECTOR_BENCHMARK_API(4096,5)
+void benchmark_vectorf_atan2_256        VECTOR_BENCHMARK_API(256, 6)
+void benchmark_vectorf_atan2_4096       VECTOR_BENCHMARK_API(4096,6)
+void benchmark_vectorf_log10_256        VECTOR_BENCHMARK_API(256, 7)
+void benchmark_vectorf_log10_4096       VECTOR_BENCHMARK_API(4096,7)
+void benchmark_vectorf_exp_256          VECTOR_BENCHMARK_API(256, 8)
+void benchmark_vectorf_exp_4096         VECTOR_BENCHMARK_API(4096,8)
@@ -0,0 +1,535 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector.avx.c : element-wise vector operations (AVX2/FMA)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <immintrin.h>  // AVX/AVX2/FMA
+
+// phase magnitude above which the range reduction in the vectorized
+// sine/cosine loses precision; such inputs use the C library instead
+#define LIQUID_VECTOR_SINCOS_MAX (8192.0f)
+
+// complex multiply four pairs of interleaved values
+static inline __m256 liquid_vector_avx2_cmul(__m256 _a,
+                                             __m256 _b)
+{
+    // { br, br }, { bi, bi } and swapped { ai, ar }
+    __m256 br = _mm256_moveldup_ps(_b);
+    __m256 bi = _mm256_movehdup_ps(_b);
+    __m256 as = _mm256_permute_ps(_a, _MM_SHUFFLE(2,3,0,1));
+
+    // { ar*br - ai*bi, ai*br + ar*bi }
+    return _mm256_fmaddsub_ps(_a, br, _mm256_mul_ps(as, bi));
+}
+
+// restore element order after in-lane operations on two registers,
+// { 0 1 4 5 | 2 3 6 7 } -> { 0 1 2 3 | 4 5 6 7 }
+static inline __m256 liquid_vector_avx2_order(__m256 _v)
+{
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(_v), _MM_SHUFFLE(3,1,2,0)));
+}
+
+// compute sine and cosine of eight values (Cephes range reduction and
+// minimax polynomials), |_x| <= LIQUID_VECTOR_SINCOS_MAX
+static inline void liquid_vector_avx2_sincos(__m256   _x,
+                                             __m256 * _s,
+                                             __m256 * _c)
+{
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+
+    // take absolute value and extract sign of sine
+    __m256 sign_s = _mm256_and_ps(_x, sign_mask);
+    __m256 x      = _mm256_andnot_ps(sign_mask, _x);
+
+    // octant index (rounded up to even) and reduced argument
+    __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f)));
+    j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+    __m256 y = _mm256_cvtepi32_ps(j);
+    x = _mm256_fnmadd_ps(y, _mm256_set1_ps(0.78515625f), x);
+    x = _mm256_fnmadd_ps(y, _mm256_set1_ps(2.4187564849853515625e-4f), x);
+    x = _mm256_fnmadd_ps(y, _mm256_set1_ps(3.77489497744594108e-8f), x);
+
+    // signs and polynomial selection from octant
+    sign_s = _mm256_xor_ps(sign_s, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29)));
+    __m256 sign_c = _mm256_castsi256_ps(_mm256_slli_epi32(
+        _mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+    __m256 mask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_setzero_si256()));
+
+    // evaluate polynomials on [-pi/4, pi/4]
+    __m256 z  = _mm256_mul_ps(x, x);
+    __m256 pc = _mm256_set1_ps(2.443315711809948e-5f);
+    pc = _mm256_fmadd_ps(pc, z, _mm256_set1_ps(-1.388731625493765e-3f));
+    pc = _mm256_fmadd_ps(pc, z, _mm256_set1_ps( 4.166664568298827e-2f));
+    pc = _mm256_mul_ps(_mm256_mul_ps(pc, z), z);
+    pc = _mm256_add_ps(_mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), pc), _mm256_set1_ps(1.0f));
+    __m256 ps = _mm256_set1_ps(-1.9515295891e-4f);
+    ps = _mm256_fmadd_ps(ps, z, _mm256_set1_ps( 8.3321608736e-3f));
+    ps = _mm256_fmadd_ps(ps, z, _mm256_set1_ps(-1.6666654611e-1f));
+    ps = _mm256_fmadd_ps(_mm256_mul_ps(ps, z), x, x);
+
+    *_s = _mm256_xor_ps(_mm256_blendv_ps(pc, ps, mask), sign_s);
+    *_c = _mm256_xor_ps(_mm256_blendv_ps(ps, pc, mask), sign_c);
+}
+
+// compute four-quadrant arctangent of eight values (Cephes minimax
+// polynomial after reduction of min(|x|,|y|)/max(|x|,|y|) below tan(pi/8))
+static inline __m256 liquid_vector_avx2_atan2(__m256 _y,
+                                              __m256 _x)
+{
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    __m256 ax = _mm256_andnot_ps(sign_mask, _x);
+    __m256 ay = _mm256_andnot_ps(sign_mask, _y);
+
+    // ratio in [0,1], zero when both inputs are zero
+    __m256 mx = _mm256_max_ps(ax, ay);
+    __m256 mn = _mm256_min_ps(ax, ay);
+    __m256 t  = _mm256_and_ps(_mm256_div_ps(mn, mx), _mm256_cmp_ps(mx, _mm256_setzero_ps(), _CMP_GT_OQ));
+
+    // reduce to [0, tan(pi/8)]
+    __m256 big = _mm256_cmp_ps(t, _mm256_set1_ps(0.4142135623730950f), _CMP_GT_OQ);
+    t = _mm256_blendv_ps(t,
+            _mm256_div_ps(_mm256_sub_ps(t, _mm256_set1_ps(1.0f)), _mm256_add_ps(t, _mm256_set1_ps(1.0f))), big);
+    __m256 r = _mm256_and_ps(big, _mm256_set1_ps((float)M_PI_4));
+
+    // evaluate polynomial
+    __m256 z = _mm256_mul_ps(t, t);
+    __m256 p = _mm256_set1_ps(8.05374449538e-2f);
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-1.38776856032e-1f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps( 1.99777106478e-1f));
+    p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(-3.33329491539e-1f));
+    r = _mm256_add_ps(r, _mm256_fmadd_ps(_mm256_mul_ps(p, z), t, t));
+
+    // map to quadrant
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps((float)M_PI_2), r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps((float)M_PI), r), _x);
+    return _mm256_or_ps(r, _mm256_and_ps(_y, sign_mask));
+}
+
+// compute natural logarithm of eight values (Cephes minimax polynomial on
+// mantissa in [sqrt(1/2), sqrt(2)) plus scaled exponent); zero gives
+// -infinity, negative values give NaN and subnormals are treated as FLT_MIN
+static inline __m256 liquid_vector_avx2_log(__m256 _x)
+{
+    __m256 invalid = _mm256_cmp_ps(_x, _mm256_setzero_ps(),      _CMP_NGE_UQ);
+    __m256 zero    = _mm256_cmp_ps(_x, _mm256_setzero_ps(),      _CMP_EQ_OQ);
+    __m256 inf     = _mm256_cmp_ps(_x, _mm256_set1_ps(INFINITY), _CMP_EQ_OQ);
+
+    // scale subnormal values into normal range by 2^25
+    __m256 sub     = _mm256_cmp_ps(_x, _mm256_set1_ps(FLT_MIN), _CMP_LT_OQ);
+    __m256 x       = _mm256_blendv_ps(_x, _mm256_mul_ps(_x, _mm256_set1_ps(33554432.0f)), sub);
+    x = _mm256_max_ps(x, _mm256_set1_ps(FLT_MIN));
+
+    // split into exponent and mantissa in [0.5, 1)
+    __m256i xi = _mm256_castps_si256(x);
+    __m256  e  = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(xi, 23), _mm256_set1_epi32(126)));
+    e = _mm256_sub_ps(e, _mm256_and_ps(sub, _mm256_set1_ps(25.0f)));
+    xi = _mm256_or_si256(_mm256_and_si256(xi, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f000000));
+    x  = _mm256_castsi256_ps(xi);
+
+    // shift mantissa to [sqrt(1/2), sqrt(2)) and subtract one
+    __m256 mask = _mm256_cmp_ps(x, _mm256_set1_ps(0.707106781186547524f), _CMP_LT_OQ);
+    e = _mm256_sub_ps(e, _mm256_and_ps(mask, _mm256_set1_ps(1.0f)));
+    x = _mm256_add_ps(_mm256_sub_ps(x, _mm256_set1_ps(1.0f)), _mm256_and_ps(mask, x));
+
+    // evaluate polynomial
+    __m256 z = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_set1_ps(7.0376836292e-2f);
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(-1.1514610310e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps( 1.1676998740e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(-1.2420140846e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps( 1.4249322787e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(-1.6668057665e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps( 2.0000714765e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(-2.4999993993e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps( 3.3333331174e-1f));
+    p = _mm256_mul_ps(_mm256_mul_ps(p, x), z);
+
+    // y = x - z/2 + p + e*ln(2), with ln(2) split into two constants
+    p = _mm256_fmadd_ps(e, _mm256_set1_ps(-2.12194440e-4f), p);
+    p = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), p);
+    __m256 y = _mm256_fmadd_ps(e, _mm256_set1_ps(0.693359375f), _mm256_add_ps(x, p));
+
+    // special values
+    y = _mm256_blendv_ps(y, _mm256_set1_ps(-INFINITY), zero);
+    y = _mm256_blendv_ps(y, _mm256_set1_ps( INFINITY), inf);
+    return _mm256_or_ps(y, invalid);
+}
+
+// compute exponential of eight values (Cephes minimax polynomial after
+// reduction by multiples of ln(2)); scaling by 2^n is split in two steps
+// so that results overflow and underflow gracefully
+static inline __m256 liquid_vector_avx2_exp(__m256 _x)
+{
+    __m256 invalid = _mm256_cmp_ps(_x, _x, _CMP_UNORD_Q);
+    __m256 x = _mm256_min_ps(_mm256_max_ps(_x, _mm256_set1_ps(-104.0f)), _mm256_set1_ps(89.0f));
+
+    // n = round(x/ln(2)), r = x - n*ln(2)
+    __m256i n  = _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)));
+    __m256  fn = _mm256_cvtepi32_ps(n);
+    x = _mm256_fnmadd_ps(fn, _mm256_set1_ps(0.693359375f), x);
+    x = _mm256_fnmadd_ps(fn, _mm256_set1_ps(-2.12194440e-4f), x);
+
+    // evaluate polynomial
+    __m256 z = _mm256_mul_ps(x, x);
+    __m256 p = _mm256_set1_ps(1.9875691500e-4f);
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(1.3981999507e-3f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(8.3334519073e-3f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(4.1665795894e-2f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(1.6666665459e-1f));
+    p = _mm256_fmadd_ps(p, x, _mm256_set1_ps(5.0000001201e-1f));
+    __m256 y = _mm256_add_ps(_mm256_fmadd_ps(p, z, x), _mm256_set1_ps(1.0f));
+
+    // scale by 2^n = 2^(n/2) * 2^(n - n/2)
+    __m256i n1 = _mm256_srai_epi32(n, 1);
+    __m256i n2 = _mm256_sub_epi32(n, n1);
+    y = _mm256_mul_ps(y, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n1, _mm256_set1_epi32(127)), 23)));
+    y = _mm256_mul_ps(y, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n2, _mm256_set1_epi32(127)), 23)));
+    return _mm256_or_ps(y, invalid);
+}
+
+// z[i] = x[i] + y[i]
+void liquid_vectorf_add_avx2(float *      _x,
+                             float *      _y,
+                             unsigned int _n,
+                             float *      _z)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_z[i], _mm256_add_ps(_mm256_loadu_ps(&_x[i]), _mm256_loadu_ps(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] + _y[i];
+}
+
+// z[i] = x[i] + y[i]
+void liquid_vectorcf_add_avx2(float complex * _x,
+                              float complex * _y,
+                              unsigned int    _n,
+                              float complex * _z)
+{
+    // type cast as real arrays of twice the length
+    liquid_vectorf_add_avx2((float*)_x, (float*)_y, 2*_n, (float*)_z);
+}
+
+// y[i] = x[i] + c
+void liquid_vectorf_addscalar_avx2(float *      _x,
+                                   unsigned int _n,
+                                   float        _c,
+                                   float *      _y)
+{
+    __m256 c = _mm256_set1_ps(_c);
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], _mm256_add_ps(_mm256_loadu_ps(&_x[i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] + _c;
+}
+
+// y[i] = x[i] + c
+void liquid_vectorcf_addscalar_avx2(float complex * _x,
+                                    unsigned int    _n,
+                                    float complex   _c,
+                                    float complex * _y)
+{
+    float cr = crealf(_c), ci = cimagf(_c);
+    __m256 c = _mm256_setr_ps(cr, ci, cr, ci, cr, ci, cr, ci);
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm256_storeu_ps(&y[2*i], _mm256_add_ps(_mm256_loadu_ps(&x[2*i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] + _c;
+}
+
+// z[i] = x[i] * y[i]
+void liquid_vectorf_mul_avx2(float *      _x,
+                             float *      _y,
+                             unsigned int _n,
+                             float *      _z)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_z[i], _mm256_mul_ps(_mm256_loadu_ps(&_x[i]), _mm256_loadu_ps(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] * _y[i];
+}
+
+// z[i] = x[i] * y[i]
+void liquid_vectorcf_mul_avx2(float complex * _x,
+                              float complex * _y,
+                              unsigned int    _n,
+                              float complex * _z)
+{
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    float * z = (float*)_z;
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm256_storeu_ps(&z[2*i], liquid_vector_avx2_cmul(_mm256_loadu_ps(&x[2*i]), _mm256_loadu_ps(&y[2*i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] * _y[i];
+}
+
+// y[i] = x[i] * c
+void liquid_vectorf_mulscalar_avx2(float *      _x,
+                                   unsigned int _n,
+                                   float        _c,
+                                   float *      _y)
+{
+    __m256 c = _mm256_set1_ps(_c);
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], _mm256_mul_ps(_mm256_loadu_ps(&_x[i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] * _c;
+}
+
+// y[i] = x[i] * c
+void liquid_vectorcf_mulscalar_avx2(float complex * _x,
+                                    unsigned int    _n,
+                                    float complex   _c,
+                                    float complex * _y)
+{
+    float cr = crealf(_c), ci = cimagf(_c);
+    __m256 c = _mm256_setr_ps(cr, ci, cr, ci, cr, ci, cr, ci);
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm256_storeu_ps(&y[2*i], liquid_vector_avx2_cmul(_mm256_loadu_ps(&x[2*i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] * _c;
+}
+
+// y[i] = |x[i]|
+void liquid_vectorf_abs_avx2(float *      _x,
+                             unsigned int _n,
+                             float *      _y)
+{
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], _mm256_andnot_ps(sign_mask, _mm256_loadu_ps(&_x[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = fabsf(_x[i]);
+}
+
+// y[i] = |x[i]|
+void liquid_vectorcf_abs_avx2(float complex * _x,
+                              unsigned int    _n,
+                              float *         _y)
+{
+    float * x = (float*)_x;
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8) {
+        // load eight complex values and square
+        __m256 v0 = _mm256_loadu_ps(&x[2*i  ]);
+        __m256 v1 = _mm256_loadu_ps(&x[2*i+8]);
+        v0 = _mm256_mul_ps(v0, v0);
+        v1 = _mm256_mul_ps(v1, v1);
+
+        // add in-phase and quadrature components
+        __m256 m = liquid_vector_avx2_order(_mm256_hadd_ps(v0, v1));
+        _mm256_storeu_ps(&_y[i], _mm256_sqrt_ps(m));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = cabsf(_x[i]);
+}
+
+// x[i] = exp{ j theta[i] }
+void liquid_vectorcf_cexpj_avx2(float *         _theta,
+                                unsigned int    _n,
+                                float complex * _x)
+{
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    const __m256 max_abs   = _mm256_set1_ps(LIQUID_VECTOR_SINCOS_MAX);
+    float * x = (float*)_x;
+    unsigned int i, k;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8) {
+        __m256 theta = _mm256_loadu_ps(&_theta[i]);
+
+        // fall back to C library for large phase values
+        if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(sign_mask, theta), max_abs, _CMP_GT_OQ))) {
+            for (k=i; k<i+8; k++)
+                _x[k] = cexpf(_Complex_I*_theta[k]);
+            continue;
+        }
+
+        // compute and interleave { cos, sin }
+        __m256 s, c;
+        liquid_vector_avx2_sincos(theta, &s, &c);
+        __m256 lo = _mm256_unpacklo_ps(c, s);
+        __m256 hi = _mm256_unpackhi_ps(c, s);
+        _mm256_storeu_ps(&x[2*i  ], _mm256_permute2f128_ps(lo, hi, 0x20));
+        _mm256_storeu_ps(&x[2*i+8], _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _x[i] = cexpf(_Complex_I*_theta[i]);
+}
+
+// theta[i] = arg{ x[i] }
+void liquid_vectorcf_carg_avx2(float complex * _x,
+                               unsigned int    _n,
+                               float *         _theta)
+{
+    float * x = (float*)_x;
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8) {
+        // load eight complex values and de-interleave
+        __m256 v0 = _mm256_loadu_ps(&x[2*i  ]);
+        __m256 v1 = _mm256_loadu_ps(&x[2*i+8]);
+        __m256 re = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2,0,2,0));
+        __m256 im = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3,1,3,1));
+        __m256 r  = liquid_vector_avx2_atan2(im, re);
+        _mm256_storeu_ps(&_theta[i], liquid_vector_avx2_order(r));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _theta[i] = cargf(_x[i]);
+}
+
+// s[i] = sin(theta[i]), c[i] = cos(theta[i])
+void liquid_vectorf_sincos_avx2(float *      _theta,
+                                unsigned int _n,
+                                float *      _s,
+                                float *      _c)
+{
+    const __m256 sign_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000));
+    const __m256 max_abs   = _mm256_set1_ps(LIQUID_VECTOR_SINCOS_MAX);
+    unsigned int i, k;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8) {
+        __m256 theta = _mm256_loadu_ps(&_theta[i]);
+
+        // fall back to C library for large phase values
+        if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(sign_mask, theta), max_abs, _CMP_GT_OQ))) {
+            for (k=i; k<i+8; k++) {
+                _s[k] = sinf(_theta[k]);
+                _c[k] = cosf(_theta[k]);
+            }
+            continue;
+        }
+
+        __m256 s, c;
+        liquid_vector_avx2_sincos(theta, &s, &c);
+        _mm256_storeu_ps(&_s[i], s);
+        _mm256_storeu_ps(&_c[i], c);
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++) {
+        _s[i] = sinf(_theta[i]);
+        _c[i] = cosf(_theta[i]);
+    }
+}
+
+// theta[i] = atan2(y[i], x[i])
+void liquid_vectorf_atan2_avx2(float *      _y,
+                               float *      _x,
+                               unsigned int _n,
+                               float *      _theta)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_theta[i], liquid_vector_avx2_atan2(_mm256_loadu_ps(&_y[i]), _mm256_loadu_ps(&_x[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _theta[i] = atan2f(_y[i], _x[i]);
+}
+
+// y[i] = log10(x[i])
+void liquid_vectorf_log10_avx2(float *      _x,
+                               unsigned int _n,
+                               float *      _y)
+{
+    const __m256 log10e = _mm256_set1_ps(0.434294481903251828f);
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], _mm256_mul_ps(liquid_vector_avx2_log(_mm256_loadu_ps(&_x[i])), log10e));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = log10f(_x[i]);
+}
+
+// y[i] = exp(x[i])
+void liquid_vectorf_exp_avx2(float *      _x,
+                             unsigned int _n,
+                             float *      _y)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 3) << 3;
+    for (i=0; i<t; i+=8)
+        _mm256_storeu_ps(&_y[i], liquid_vector_avx2_exp(_mm256_loadu_ps(&_x[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = expf(_x[i]);
+}
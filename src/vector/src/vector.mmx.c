@@ -0,0 +1,532 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector.mmx.c : element-wise vector operations (SSE2/SSE3)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for x86 platforms
+// NOTE: these pre-processor macros are defined in config.h
+
+#include <emmintrin.h>  // SSE2
+#include <pmmintrin.h>  // SSE3
+
+// phase magnitude above which the range reduction in the vectorized
+// sine/cosine loses precision; such inputs use the C library instead
+#define LIQUID_VECTOR_SINCOS_MAX (8192.0f)
+
+// complex multiply two pairs of interleaved values: { a0*b0, a1*b1 }
+static inline __m128 liquid_vector_sse_cmul(__m128 _a,
+                                            __m128 _b)
+{
+    // { br, br }, { bi, bi } and swapped { ai, ar }
+    __m128 br = _mm_moveldup_ps(_b);
+    __m128 bi = _mm_movehdup_ps(_b);
+    __m128 as = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(2,3,0,1));
+
+    // { ar*br - ai*bi, ai*br + ar*bi }
+    return _mm_addsub_ps(_mm_mul_ps(_a, br), _mm_mul_ps(as, bi));
+}
+
+// select _a where mask is set, _b otherwise
+static inline __m128 liquid_vector_sse_select(__m128 _mask,
+                                              __m128 _a,
+                                              __m128 _b)
+{
+    return _mm_or_ps(_mm_and_ps(_mask, _a), _mm_andnot_ps(_mask, _b));
+}
+
+// compute sine and cosine of four values (Cephes range reduction and
+// minimax polynomials), |_x| <= LIQUID_VECTOR_SINCOS_MAX
+static inline void liquid_vector_sse_sincos(__m128   _x,
+                                            __m128 * _s,
+                                            __m128 * _c)
+{
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+
+    // take absolute value and extract sign of sine
+    __m128 sign_s = _mm_and_ps(_x, sign_mask);
+    __m128 x      = _mm_andnot_ps(sign_mask, _x);
+
+    // octant index (rounded up to even) and reduced argument
+    __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+    j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+    __m128 y = _mm_cvtepi32_ps(j);
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(0.78515625f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(2.4187564849853515625e-4f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(3.77489497744594108e-8f)));
+
+    // signs and polynomial selection from octant
+    sign_s = _mm_xor_ps(sign_s, _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29)));
+    __m128 sign_c = _mm_castsi128_ps(_mm_slli_epi32(
+        _mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+    __m128 mask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+
+    // evaluate polynomials on [-pi/4, pi/4]
+    __m128 z  = _mm_mul_ps(x, x);
+    __m128 pc = _mm_set1_ps(2.443315711809948e-5f);
+    pc = _mm_add_ps(_mm_mul_ps(pc, z), _mm_set1_ps(-1.388731625493765e-3f));
+    pc = _mm_add_ps(_mm_mul_ps(pc, z), _mm_set1_ps( 4.166664568298827e-2f));
+    pc = _mm_mul_ps(_mm_mul_ps(pc, z), z);
+    pc = _mm_add_ps(_mm_sub_ps(pc, _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_set1_ps(1.0f));
+    __m128 ps = _mm_set1_ps(-1.9515295891e-4f);
+    ps = _mm_add_ps(_mm_mul_ps(ps, z), _mm_set1_ps( 8.3321608736e-3f));
+    ps = _mm_add_ps(_mm_mul_ps(ps, z), _mm_set1_ps(-1.6666654611e-1f));
+    ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, z), x), x);
+
+    *_s = _mm_xor_ps(liquid_vector_sse_select(mask, ps, pc), sign_s);
+    *_c = _mm_xor_ps(liquid_vector_sse_select(mask, pc, ps), sign_c);
+}
+
+// compute four-quadrant arctangent of four values (Cephes minimax
+// polynomial after reduction of min(|x|,|y|)/max(|x|,|y|) below tan(pi/8))
+static inline __m128 liquid_vector_sse_atan2(__m128 _y,
+                                             __m128 _x)
+{
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+    __m128 ax = _mm_andnot_ps(sign_mask, _x);
+    __m128 ay = _mm_andnot_ps(sign_mask, _y);
+
+    // ratio in [0,1], zero when both inputs are zero
+    __m128 mx = _mm_max_ps(ax, ay);
+    __m128 mn = _mm_min_ps(ax, ay);
+    __m128 t  = _mm_and_ps(_mm_div_ps(mn, mx), _mm_cmpgt_ps(mx, _mm_setzero_ps()));
+
+    // reduce to [0, tan(pi/8)]
+    __m128 big = _mm_cmpgt_ps(t, _mm_set1_ps(0.4142135623730950f));
+    t = liquid_vector_sse_select(big,
+            _mm_div_ps(_mm_sub_ps(t, _mm_set1_ps(1.0f)), _mm_add_ps(t, _mm_set1_ps(1.0f))), t);
+    __m128 r = _mm_and_ps(big, _mm_set1_ps((float)M_PI_4));
+
+    // evaluate polynomial
+    __m128 z = _mm_mul_ps(t, t);
+    __m128 p = _mm_set1_ps(8.05374449538e-2f);
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(-1.38776856032e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps( 1.99777106478e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, z), _mm_set1_ps(-3.33329491539e-1f));
+    r = _mm_add_ps(r, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, z), t), t));
+
+    // map to quadrant
+    r = liquid_vector_sse_select(_mm_cmpgt_ps(ay, ax), _mm_sub_ps(_mm_set1_ps((float)M_PI_2), r), r);
+    __m128 xneg = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(_x), 31));
+    r = liquid_vector_sse_select(xneg, _mm_sub_ps(_mm_set1_ps((float)M_PI), r), r);
+    return _mm_or_ps(r, _mm_and_ps(_y, sign_mask));
+}
+
+// compute natural logarithm of four values (Cephes minimax polynomial on
+// mantissa in [sqrt(1/2), sqrt(2)) plus scaled exponent); zero gives
+// -infinity, negative values give NaN and subnormals are treated as FLT_MIN
+static inline __m128 liquid_vector_sse_log(__m128 _x)
+{
+    __m128 invalid = _mm_cmpnge_ps(_x, _mm_setzero_ps());
+    __m128 zero    = _mm_cmpeq_ps (_x, _mm_setzero_ps());
+    __m128 inf     = _mm_cmpeq_ps (_x, _mm_set1_ps(INFINITY));
+
+    // scale subnormal values into normal range by 2^25
+    __m128 sub     = _mm_cmplt_ps(_x, _mm_set1_ps(FLT_MIN));
+    __m128 x       = liquid_vector_sse_select(sub, _mm_mul_ps(_x, _mm_set1_ps(33554432.0f)), _x);
+    x = _mm_max_ps(x, _mm_set1_ps(FLT_MIN));
+
+    // split into exponent and mantissa in [0.5, 1)
+    __m128i xi = _mm_castps_si128(x);
+    __m128  e  = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(xi, 23), _mm_set1_epi32(126)));
+    e = _mm_sub_ps(e, _mm_and_ps(sub, _mm_set1_ps(25.0f)));
+    xi = _mm_or_si128(_mm_and_si128(xi, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000));
+    x  = _mm_castsi128_ps(xi);
+
+    // shift mantissa to [sqrt(1/2), sqrt(2)) and subtract one
+    __m128 mask = _mm_cmplt_ps(x, _mm_set1_ps(0.707106781186547524f));
+    e = _mm_sub_ps(e, _mm_and_ps(mask, _mm_set1_ps(1.0f)));
+    x = _mm_add_ps(_mm_sub_ps(x, _mm_set1_ps(1.0f)), _mm_and_ps(mask, x));
+
+    // evaluate polynomial
+    __m128 z = _mm_mul_ps(x, x);
+    __m128 p = _mm_set1_ps(7.0376836292e-2f);
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-1.1514610310e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps( 1.1676998740e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-1.2420140846e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps( 1.4249322787e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-1.6668057665e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps( 2.0000714765e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(-2.4999993993e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps( 3.3333331174e-1f));
+    p = _mm_mul_ps(_mm_mul_ps(p, x), z);
+
+    // y = x - z/2 + p + e*ln(2), with ln(2) split into two constants
+    p = _mm_add_ps(p, _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+    p = _mm_sub_ps(p, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+    __m128 y = _mm_add_ps(_mm_add_ps(x, p), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+
+    // special values
+    y = liquid_vector_sse_select(zero, _mm_set1_ps(-INFINITY), y);
+    y = liquid_vector_sse_select(inf,  _mm_set1_ps( INFINITY), y);
+    return _mm_or_ps(y, invalid);
+}
+
+// compute exponential of four values (Cephes minimax polynomial after
+// reduction by multiples of ln(2)); scaling by 2^n is split in two steps
+// so that results overflow and underflow gracefully
+static inline __m128 liquid_vector_sse_exp(__m128 _x)
+{
+    __m128 invalid = _mm_cmpunord_ps(_x, _x);
+    __m128 x = _mm_min_ps(_mm_max_ps(_x, _mm_set1_ps(-104.0f)), _mm_set1_ps(89.0f));
+
+    // n = round(x/ln(2)), r = x - n*ln(2)
+    __m128i n  = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)));
+    __m128  fn = _mm_cvtepi32_ps(n);
+    x = _mm_sub_ps(x, _mm_mul_ps(fn, _mm_set1_ps(0.693359375f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(fn, _mm_set1_ps(-2.12194440e-4f)));
+
+    // evaluate polynomial
+    __m128 z = _mm_mul_ps(x, x);
+    __m128 p = _mm_set1_ps(1.9875691500e-4f);
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.3981999507e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(8.3334519073e-3f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(4.1665795894e-2f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(1.6666665459e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, x), _mm_set1_ps(5.0000001201e-1f));
+    __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(p, z), x), _mm_set1_ps(1.0f));
+
+    // scale by 2^n = 2^(n/2) * 2^(n - n/2)
+    __m128i n1 = _mm_srai_epi32(n, 1);
+    __m128i n2 = _mm_sub_epi32(n, n1);
+    y = _mm_mul_ps(y, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n1, _mm_set1_epi32(127)), 23)));
+    y = _mm_mul_ps(y, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n2, _mm_set1_epi32(127)), 23)));
+    return _mm_or_ps(y, invalid);
+}
+
+// z[i] = x[i] + y[i]
+void liquid_vectorf_add_sse(float *      _x,
+                            float *      _y,
+                            unsigned int _n,
+                            float *      _z)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_z[i], _mm_add_ps(_mm_loadu_ps(&_x[i]), _mm_loadu_ps(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] + _y[i];
+}
+
+// z[i] = x[i] + y[i]
+void liquid_vectorcf_add_sse(float complex * _x,
+                             float complex * _y,
+                             unsigned int    _n,
+                             float complex * _z)
+{
+    // type cast as real arrays of twice the length
+    liquid_vectorf_add_sse((float*)_x, (float*)_y, 2*_n, (float*)_z);
+}
+
+// y[i] = x[i] + c
+void liquid_vectorf_addscalar_sse(float *      _x,
+                                  unsigned int _n,
+                                  float        _c,
+                                  float *      _y)
+{
+    __m128 c = _mm_set1_ps(_c);
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_y[i], _mm_add_ps(_mm_loadu_ps(&_x[i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] + _c;
+}
+
+// y[i] = x[i] + c
+void liquid_vectorcf_addscalar_sse(float complex * _x,
+                                   unsigned int    _n,
+                                   float complex   _c,
+                                   float complex * _y)
+{
+    __m128 c = _mm_setr_ps(crealf(_c), cimagf(_c), crealf(_c), cimagf(_c));
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int i;
+    unsigned int t = (_n >> 1) << 1;
+    for (i=0; i<t; i+=2)
+        _mm_storeu_ps(&y[2*i], _mm_add_ps(_mm_loadu_ps(&x[2*i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] + _c;
+}
+
+// z[i] = x[i] * y[i]
+void liquid_vectorf_mul_sse(float *      _x,
+                            float *      _y,
+                            unsigned int _n,
+                            float *      _z)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_z[i], _mm_mul_ps(_mm_loadu_ps(&_x[i]), _mm_loadu_ps(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] * _y[i];
+}
+
+// z[i] = x[i] * y[i]
+void liquid_vectorcf_mul_sse(float complex * _x,
+                             float complex * _y,
+                             unsigned int    _n,
+                             float complex * _z)
+{
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    float * z = (float*)_z;
+    unsigned int i;
+    unsigned int t = (_n >> 1) << 1;
+    for (i=0; i<t; i+=2)
+        _mm_storeu_ps(&z[2*i], liquid_vector_sse_cmul(_mm_loadu_ps(&x[2*i]), _mm_loadu_ps(&y[2*i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] * _y[i];
+}
+
+// y[i] = x[i] * c
+void liquid_vectorf_mulscalar_sse(float *      _x,
+                                  unsigned int _n,
+                                  float        _c,
+                                  float *      _y)
+{
+    __m128 c = _mm_set1_ps(_c);
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_y[i], _mm_mul_ps(_mm_loadu_ps(&_x[i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] * _c;
+}
+
+// y[i] = x[i] * c
+void liquid_vectorcf_mulscalar_sse(float complex * _x,
+                                   unsigned int    _n,
+                                   float complex   _c,
+                                   float complex * _y)
+{
+    __m128 c = _mm_setr_ps(crealf(_c), cimagf(_c), crealf(_c), cimagf(_c));
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int i;
+    unsigned int t = (_n >> 1) << 1;
+    for (i=0; i<t; i+=2)
+        _mm_storeu_ps(&y[2*i], liquid_vector_sse_cmul(_mm_loadu_ps(&x[2*i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] * _c;
+}
+
+// y[i] = |x[i]|
+void liquid_vectorf_abs_sse(float *      _x,
+                            unsigned int _n,
+                            float *      _y)
+{
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_y[i], _mm_andnot_ps(sign_mask, _mm_loadu_ps(&_x[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = fabsf(_x[i]);
+}
+
+// y[i] = |x[i]|
+void liquid_vectorcf_abs_sse(float complex * _x,
+                             unsigned int    _n,
+                             float *         _y)
+{
+    float * x = (float*)_x;
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4) {
+        // load four complex values and square
+        __m128 v0 = _mm_loadu_ps(&x[2*i  ]);
+        __m128 v1 = _mm_loadu_ps(&x[2*i+4]);
+        v0 = _mm_mul_ps(v0, v0);
+        v1 = _mm_mul_ps(v1, v1);
+
+        // add in-phase and quadrature components
+        _mm_storeu_ps(&_y[i], _mm_sqrt_ps(_mm_hadd_ps(v0, v1)));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = cabsf(_x[i]);
+}
+
+// x[i] = exp{ j theta[i] }
+void liquid_vectorcf_cexpj_sse(float *         _theta,
+                               unsigned int    _n,
+                               float complex * _x)
+{
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+    const __m128 max_abs   = _mm_set1_ps(LIQUID_VECTOR_SINCOS_MAX);
+    float * x = (float*)_x;
+    unsigned int i, k;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4) {
+        __m128 theta = _mm_loadu_ps(&_theta[i]);
+
+        // fall back to C library for large phase values
+        if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(sign_mask, theta), max_abs))) {
+            for (k=i; k<i+4; k++)
+                _x[k] = cexpf(_Complex_I*_theta[k]);
+            continue;
+        }
+
+        // compute and interleave { cos, sin }
+        __m128 s, c;
+        liquid_vector_sse_sincos(theta, &s, &c);
+        _mm_storeu_ps(&x[2*i  ], _mm_unpacklo_ps(c, s));
+        _mm_storeu_ps(&x[2*i+4], _mm_unpackhi_ps(c, s));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _x[i] = cexpf(_Complex_I*_theta[i]);
+}
+
+// theta[i] = arg{ x[i] }
+void liquid_vectorcf_carg_sse(float complex * _x,
+                              unsigned int    _n,
+                              float *         _theta)
+{
+    float * x = (float*)_x;
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4) {
+        // load four complex values and de-interleave
+        __m128 v0 = _mm_loadu_ps(&x[2*i  ]);
+        __m128 v1 = _mm_loadu_ps(&x[2*i+4]);
+        __m128 re = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2,0,2,0));
+        __m128 im = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3,1,3,1));
+        _mm_storeu_ps(&_theta[i], liquid_vector_sse_atan2(im, re));
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _theta[i] = cargf(_x[i]);
+}
+
+// s[i] = sin(theta[i]), c[i] = cos(theta[i])
+void liquid_vectorf_sincos_sse(float *      _theta,
+                               unsigned int _n,
+                               float *      _s,
+                               float *      _c)
+{
+    const __m128 sign_mask = _mm_castsi128_ps(_mm_set1_epi32(0x80000000));
+    const __m128 max_abs   = _mm_set1_ps(LIQUID_VECTOR_SINCOS_MAX);
+    unsigned int i, k;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4) {
+        __m128 theta = _mm_loadu_ps(&_theta[i]);
+
+        // fall back to C library for large phase values
+        if (_mm_movemask_ps(_mm_cmpgt_ps(_mm_andnot_ps(sign_mask, theta), max_abs))) {
+            for (k=i; k<i+4; k++) {
+                _s[k] = sinf(_theta[k]);
+                _c[k] = cosf(_theta[k]);
+            }
+            continue;
+        }
+
+        __m128 s, c;
+        liquid_vector_sse_sincos(theta, &s, &c);
+        _mm_storeu_ps(&_s[i], s);
+        _mm_storeu_ps(&_c[i], c);
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++) {
+        _s[i] = sinf(_theta[i]);
+        _c[i] = cosf(_theta[i]);
+    }
+}
+
+// theta[i] = atan2(y[i], x[i])
+void liquid_vectorf_atan2_sse(float *      _y,
+                              float *      _x,
+                              unsigned int _n,
+                              float *      _theta)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_theta[i], liquid_vector_sse_atan2(_mm_loadu_ps(&_y[i]), _mm_loadu_ps(&_x[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _theta[i] = atan2f(_y[i], _x[i]);
+}
+
+// y[i] = log10(x[i])
+void liquid_vectorf_log10_sse(float *      _x,
+                              unsigned int _n,
+                              float *      _y)
+{
+    const __m128 log10e = _mm_set1_ps(0.434294481903251828f);
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_y[i], _mm_mul_ps(liquid_vector_sse_log(_mm_loadu_ps(&_x[i])), log10e));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = log10f(_x[i]);
+}
+
+// y[i] = exp(x[i])
+void liquid_vectorf_exp_sse(float *      _x,
+                            unsigned int _n,
+                            float *      _y)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        _mm_storeu_ps(&_y[i], liquid_vector_sse_exp(_mm_loadu_ps(&_x[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = expf(_x[i]);
+}
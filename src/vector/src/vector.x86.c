@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector.x86.c : vector operations, run-time selection of SIMD kernels
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+//
+// portable C kernels
+//
+
+#define VECTOR(name)    liquid_vectorf ## name ## _portable
+#define T               float
+#define TP              float
+#define T_COMPLEX       0
+#include "vector_add.c"
+#include "vector_mul.c"
+#include "vector_trig.c"
+#include "vector_math.c"
+#undef VECTOR
+#undef T
+#undef TP
+#undef T_COMPLEX
+
+#define VECTOR(name)    liquid_vectorcf ## name ## _portable
+#define T               float complex
+#define TP              float
+#define T_COMPLEX       1
+#include "vector_add.c"
+#include "vector_mul.c"
+#include "vector_trig.c"
+#undef VECTOR
+#undef T
+#undef TP
+#undef T_COMPLEX
+
+//
+// public methods, using selected kernels
+//
+
+void liquid_vectorf_add(float *      _x,
+                        float *      _y,
+                        unsigned int _n,
+                        float *      _z)
+{
+    liquid_simd_get_kernels()->vectorf_add(_x, _y, _n, _z);
+}
+
+void liquid_vectorcf_add(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _n,
+                         float complex * _z)
+{
+    liquid_simd_get_kernels()->vectorcf_add(_x, _y, _n, _z);
+}
+
+void liquid_vectorf_addscalar(float *      _x,
+                              unsigned int _n,
+                              float        _c,
+                              float *      _y)
+{
+    liquid_simd_get_kernels()->vectorf_addscalar(_x, _n, _c, _y);
+}
+
+void liquid_vectorcf_addscalar(float complex * _x,
+                               unsigned int    _n,
+                               float complex   _c,
+                               float complex * _y)
+{
+    liquid_simd_get_kernels()->vectorcf_addscalar(_x, _n, _c, _y);
+}
+
+void liquid_vectorf_mul(float *      _x,
+                        float *      _y,
+                        unsigned int _n,
+                        float *      _z)
+{
+    liquid_simd_get_kernels()->vectorf_mul(_x, _y, _n, _z);
+}
+
+void liquid_vectorcf_mul(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _n,
+                         float complex * _z)
+{
+    liquid_simd_get_kernels()->vectorcf_mul(_x, _y, _n, _z);
+}
+
+void liquid_vectorf_mulscalar(float *      _x,
+                              unsigned int _n,
+                              float        _c,
+                              float *      _y)
+{
+    liquid_simd_get_kernels()->vectorf_mulscalar(_x, _n, _c, _y);
+}
+
+void liquid_vectorcf_mulscalar(float complex * _x,
+                               unsigned int    _n,
+                               float complex   _c,
+                               float complex * _y)
+{
+    liquid_simd_get_kernels()->vectorcf_mulscalar(_x, _n, _c, _y);
+}
+
+// real-valued phase rotation is a simple sign operation; not dispatched
+void liquid_vectorf_cexpj(float *      _theta,
+                          unsigned int _n,
+                          float *      _x)
+{
+    liquid_vectorf_cexpj_portable(_theta, _n, _x);
+}
+
+void liquid_vectorcf_cexpj(float *         _theta,
+                           unsigned int    _n,
+                           float complex * _x)
+{
+    liquid_simd_get_kernels()->vectorcf_cexpj(_theta, _n, _x);
+}
+
+// real-valued angle is a simple sign operation; not dispatched
+void liquid_vectorf_carg(float *      _x,
+                         unsigned int _n,
+                         float *      _theta)
+{
+    liquid_vectorf_carg_portable(_x, _n, _theta);
+}
+
+void liquid_vectorcf_carg(float complex * _x,
+                          unsigned int    _n,
+                          float *         _theta)
+{
+    liquid_simd_get_kernels()->vectorcf_carg(_x, _n, _theta);
+}
+
+void liquid_vectorf_abs(float *      _x,
+                        unsigned int _n,
+                        float *      _y)
+{
+    liquid_simd_get_kernels()->vectorf_abs(_x, _n, _y);
+}
+
+void liquid_vectorcf_abs(float complex * _x,
+                         unsigned int    _n,
+                         float *         _y)
+{
+    liquid_simd_get_kernels()->vectorcf_abs(_x, _n, _y);
+}
+
+// compute l2-norm on vector using selected sum of squares kernel
+float liquid_vectorf_norm(float *      _x,
+                          unsigned int _n)
+{
+    return sqrtf(liquid_simd_get_kernels()->sumsqf(_x, _n));
+}
+
+// compute l2-norm on vector using selected sum of squares kernel
+float liquid_vectorcf_norm(float complex * _x,
+                           unsigned int    _n)
+{
+    return sqrtf(liquid_simd_get_kernels()->sumsqcf(_x, _n));
+}
+
+// scale vector to its l2-norm
+void liquid_vectorf_normalize(float *      _x,
+                              unsigned int _n,
+                              float *      _y)
+{
+    liquid_vectorf_mulscalar(_x, _n, 1.0f / liquid_vectorf_norm(_x, _n), _y);
+}
+
+// scale vector to its l2-norm
+void liquid_vectorcf_normalize(float complex * _x,
+                               unsigned int    _n,
+                               float complex * _y)
+{
+    liquid_vectorcf_mulscalar(_x, _n, 1.0f / liquid_vectorcf_norm(_x, _n), _y);
+}
+
+void liquid_vectorf_sincos(float *      _theta,
+                           unsigned int _n,
+                           float *      _s,
+                           float *      _c)
+{
+    liquid_simd_get_kernels()->vectorf_sincos(_theta, _n, _s, _c);
+}
+
+void liquid_vectorf_atan2(float *      _y,
+                          float *      _x,
+                          unsigned int _n,
+                          float *      _theta)
+{
+    liquid_simd_get_kernels()->vectorf_atan2(_y, _x, _n, _theta);
+}
+
+void liquid_vectorf_log10(float *      _x,
+                          unsigned int _n,
+                          float *      _y)
+{
+    liquid_simd_get_kernels()->vectorf_log10(_x, _n, _y);
+}
+
+// convert to decibels using selected logarithm and scaling kernels
+void liquid_vectorf_db(float *      _x,
+                       unsigned int _n,
+                       float *      _y)
+{
+    const struct liquid_simd_kernels_s * k = liquid_simd_get_kernels();
+    k->vectorf_log10(_x, _n, _y);
+    k->vectorf_mulscalar(_y, _n, 10.0f, _y);
+}
+
+void liquid_vectorf_exp(float *      _x,
+                        unsigned int _n,
+                        float *      _y)
+{
+    liquid_simd_get_kernels()->vectorf_exp(_x, _n, _y);
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// vector_arith.neon.c : element-wise vector addition and multiplication
+// (ARM Neon)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+// include proper SIMD extensions for ARM Neon
+#include <arm_neon.h>
+
+// z[i] = x[i] + y[i]
+void liquid_vectorf_add(float *      _x,
+                        float *      _y,
+                        unsigned int _n,
+                        float *      _z)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        vst1q_f32(&_z[i], vaddq_f32(vld1q_f32(&_x[i]), vld1q_f32(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] + _y[i];
+}
+
+// z[i] = x[i] + y[i]
+void liquid_vectorcf_add(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _n,
+                         float complex * _z)
+{
+    // type cast as real arrays of twice the length
+    liquid_vectorf_add((float*)_x, (float*)_y, 2*_n, (float*)_z);
+}
+
+// y[i] = x[i] + c
+void liquid_vectorf_addscalar(float *      _x,
+                              unsigned int _n,
+                              float        _c,
+                              float *      _y)
+{
+    float32x4_t c = vdupq_n_f32(_c);
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        vst1q_f32(&_y[i], vaddq_f32(vld1q_f32(&_x[i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] + _c;
+}
+
+// y[i] = x[i] + c
+void liquid_vectorcf_addscalar(float complex * _x,
+                               unsigned int    _n,
+                               float complex   _c,
+                               float complex * _y)
+{
+    float c2[4] = {crealf(_c), cimagf(_c), crealf(_c), cimagf(_c)};
+    float32x4_t c = vld1q_f32(c2);
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int i;
+    unsigned int t = (_n >> 1) << 1;
+    for (i=0; i<t; i+=2)
+        vst1q_f32(&y[2*i], vaddq_f32(vld1q_f32(&x[2*i]), c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] + _c;
+}
+
+// z[i] = x[i] * y[i]
+void liquid_vectorf_mul(float *      _x,
+                        float *      _y,
+                        unsigned int _n,
+                        float *      _z)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        vst1q_f32(&_z[i], vmulq_f32(vld1q_f32(&_x[i]), vld1q_f32(&_y[i])));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] * _y[i];
+}
+
+// z[i] = x[i] * y[i]
+void liquid_vectorcf_mul(float complex * _x,
+                         float complex * _y,
+                         unsigned int    _n,
+                         float complex * _z)
+{
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    float * z = (float*)_z;
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4) {
+        // load four complex values, de-interleaving components
+        float32x4x2_t a = vld2q_f32(&x[2*i]);
+        float32x4x2_t b = vld2q_f32(&y[2*i]);
+
+        // (ar*br - ai*bi) + j(ar*bi + ai*br)
+        float32x4x2_t r;
+        r.val[0] = vmlsq_f32(vmulq_f32(a.val[0], b.val[0]), a.val[1], b.val[1]);
+        r.val[1] = vmlaq_f32(vmulq_f32(a.val[0], b.val[1]), a.val[1], b.val[0]);
+        vst2q_f32(&z[2*i], r);
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _z[i] = _x[i] * _y[i];
+}
+
+// y[i] = x[i] * c
+void liquid_vectorf_mulscalar(float *      _x,
+                              unsigned int _n,
+                              float        _c,
+                              float *      _y)
+{
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4)
+        vst1q_f32(&_y[i], vmulq_n_f32(vld1q_f32(&_x[i]), _c));
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] * _c;
+}
+
+// y[i] = x[i] * c
+void liquid_vectorcf_mulscalar(float complex * _x,
+                               unsigned int    _n,
+                               float complex   _c,
+                               float complex * _y)
+{
+    float cr = crealf(_c);
+    float ci = cimagf(_c);
+    float * x = (float*)_x;
+    float * y = (float*)_y;
+    unsigned int i;
+    unsigned int t = (_n >> 2) << 2;
+    for (i=0; i<t; i+=4) {
+        // load four complex values, de-interleaving components
+        float32x4x2_t a = vld2q_f32(&x[2*i]);
+
+        // (ar*cr - ai*ci) + j(ar*ci + ai*cr)
+        float32x4x2_t r;
+        r.val[0] = vmlsq_n_f32(vmulq_n_f32(a.val[0], cr), a.val[1], ci);
+        r.val[1] = vmlaq_n_f32(vmulq_n_f32(a.val[0], ci), a.val[1], cr);
+        vst2q_f32(&y[2*i], r);
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _y[i] = _x[i] * _c;
+}
+
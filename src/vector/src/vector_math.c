@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Element-wise transcendental functions on real vectors
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+// compute sine and cosine of each element
+//  _theta  :   input array [size: _n x 1]
+//  _n      :   array length
+//  _s      :   output sine array [size: _n x 1]
+//  _c      :   output cosine array [size: _n x 1]
+void VECTOR(_sincos)(float *      _theta,
+                     unsigned int _n,
+                     float *      _s,
+                     float *      _c)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        _s[i] = sinf(_theta[i]);
+        _c[i] = cosf(_theta[i]);
+    }
+}
+
+// compute four-quadrant arctangent of each element pair
+//  _y      :   input imaginary (ordinate) array [size: _n x 1]
+//  _x      :   input real (abscissa) array [size: _n x 1]
+//  _n      :   array length
+//  _theta  :   output array [size: _n x 1]
+void VECTOR(_atan2)(float *      _y,
+                    float *      _x,
+                    unsigned int _n,
+                    float *      _theta)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _theta[i] = atan2f(_y[i], _x[i]);
+}
+
+// compute base-10 logarithm of each element
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _y      :   output array [size: _n x 1]
+void VECTOR(_log10)(float *      _x,
+                    unsigned int _n,
+                    float *      _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = log10f(_x[i]);
+}
+
+// compute exponential of each element
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _y      :   output array [size: _n x 1]
+void VECTOR(_exp)(float *      _x,
+                  unsigned int _n,
+                  float *      _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = expf(_x[i]);
+}
+
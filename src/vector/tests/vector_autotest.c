@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper function (compare vector operations against ordinal
+// computation for a particular length)
+void runtest_vector(unsigned int _n)
+{
+    float tol = 1e-5f;
+    float         xf[_n], yf[_n], zf[_n], af[_n];
+    float complex xc[_n], yc[_n], zc[_n];
+    float         cf = randnf();
+    float complex cc = randnf() + _Complex_I*randnf();
+
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        xf[i] = randnf();
+        yf[i] = randnf();
+        xc[i] = randnf() + _Complex_I*randnf();
+        yc[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // real
+    liquid_vectorf_add(xf, yf, _n, zf);
+    for (i=0; i<_n; i++) CONTEND_DELTA(zf[i], xf[i] + yf[i], tol);
+    liquid_vectorf_addscalar(xf, _n, cf, zf);
+    for (i=0; i<_n; i++) CONTEND_DELTA(zf[i], xf[i] + cf, tol);
+    liquid_vectorf_mul(xf, yf, _n, zf);
+    for (i=0; i<_n; i++) CONTEND_DELTA(zf[i], xf[i] * yf[i], tol);
+    liquid_vectorf_mulscalar(xf, _n, cf, zf);
+    for (i=0; i<_n; i++) CONTEND_DELTA(zf[i], xf[i] * cf, tol);
+    liquid_vectorf_abs(xf, _n, zf);
+    for (i=0; i<_n; i++) CONTEND_DELTA(zf[i], fabsf(xf[i]), tol);
+
+    // complex
+    liquid_vectorcf_add(xc, yc, _n, zc);
+    for (i=0; i<_n; i++) CONTEND_DELTA(cabsf(zc[i] - (xc[i] + yc[i])), 0, tol);
+    liquid_vectorcf_addscalar(xc, _n, cc, zc);
+    for (i=0; i<_n; i++) CONTEND_DELTA(cabsf(zc[i] - (xc[i] + cc)), 0, tol);
+    liquid_vectorcf_mul(xc, yc, _n, zc);
+    for (i=0; i<_n; i++) CONTEND_DELTA(cabsf(zc[i] - xc[i] * yc[i]), 0, tol);
+    liquid_vectorcf_mulscalar(xc, _n, cc, zc);
+    for (i=0; i<_n; i++) CONTEND_DELTA(cabsf(zc[i] - xc[i] * cc), 0, tol);
+    liquid_vectorcf_abs(xc, _n, af);
+    for (i=0; i<_n; i++) CONTEND_DELTA(af[i], cabsf(xc[i]), tol);
+    liquid_vectorcf_carg(xc, _n, af);
+    for (i=0; i<_n; i++) CONTEND_DELTA(af[i], cargf(xc[i]), tol);
+
+    // phase rotation over a wide range of angles
+    for (i=0; i<_n; i++)
+        af[i] = 100.0f*randnf();
+    liquid_vectorcf_cexpj(af, _n, zc);
+    for (i=0; i<_n; i++) {
+        CONTEND_DELTA(crealf(zc[i]), cosf(af[i]), tol);
+        CONTEND_DELTA(cimagf(zc[i]), sinf(af[i]), tol);
+    }
+
+    // norm
+    CONTEND_DELTA(liquid_vectorcf_norm(xc, _n), sqrtf(liquid_sumsqcf(xc, _n)), tol);
+
+    // in-place operation
+    memmove(zc, xc, _n*sizeof(float complex));
+    liquid_vectorcf_mul(zc, yc, _n, zc);
+    for (i=0; i<_n; i++) CONTEND_DELTA(cabsf(zc[i] - xc[i] * yc[i]), 0, tol);
+}
+
+// run all vector operations for each SIMD type available on this host
+void autotest_vector_simd_types()
+{
+    unsigned int i, n;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (!liquid_simd_is_available(i))
+            continue;
+        liquid_simd_set_type(i);
+        for (n=1; n<=67; n++)
+            runtest_vector(n);
+    }
+
+    // restore automatic selection
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
+
+// check special values for angle and phase rotation
+void autotest_vector_cexpj_carg_special()
+{
+    float tol = 1e-5f;
+    float complex x[16] = {
+         1,  -1,  _Complex_I, -_Complex_I,
+         0,  -0.0f,  1+_Complex_I, -1-_Complex_I,
+        -1+1e-6f*_Complex_I, -1-1e-6f*_Complex_I, 1e-30f, 3-4*_Complex_I,
+         1e20f*_Complex_I, -2e-20f, 0.5f+0.5f*_Complex_I, -7+_Complex_I};
+    float theta[16];
+    unsigned int i;
+    liquid_vectorcf_carg(x, 16, theta);
+    for (i=0; i<16; i++)
+        CONTEND_DELTA(theta[i], cargf(x[i]), tol);
+
+    // large phase values (reduced with C library)
+    float phi[16] = {0, 1e-8f, (float)M_PI, -(float)M_PI, 1e4f, -3e5f, 8191.9f, 1e6f,
+                     (float)M_PI_2, -(float)M_PI_2, 0.7853982f, 2.3561945f, 3.9269908f, 5.4977871f, 100.0f, -100.0f};
+    float complex y[16];
+    liquid_vectorcf_cexpj(phi, 16, y);
+    for (i=0; i<16; i++) {
+        CONTEND_DELTA(crealf(y[i]), cosf(phi[i]), 1e-3f);
+        CONTEND_DELTA(cimagf(y[i]), sinf(phi[i]), 1e-3f);
+    }
+}
+
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2007 - 2020 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include <float.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper function (compare transcendental functions against
+// double-precision reference over a wide range of inputs, checking
+// documented maximum error)
+void runtest_vector_math(unsigned int _n)
+{
+    float x[_n], y[_n], s[_n], c[_n];
+    unsigned int i;
+
+    // sine and cosine (absolute error)
+    for (i=0; i<_n; i++)
+        x[i] = (i % 3) == 0 ? 1000.0f*randnf() : 4.0f*randnf();
+    liquid_vectorf_sincos(x, _n, s, c);
+    for (i=0; i<_n; i++) {
+        CONTEND_DELTA(s[i], sin((double)x[i]), 1e-7f);
+        CONTEND_DELTA(c[i], cos((double)x[i]), 1e-7f);
+    }
+
+    // four-quadrant arctangent (absolute error)
+    for (i=0; i<_n; i++) {
+        x[i] = randnf();
+        y[i] = randnf();
+    }
+    liquid_vectorf_atan2(y, x, _n, s);
+    for (i=0; i<_n; i++)
+        CONTEND_DELTA(s[i], atan2((double)y[i], (double)x[i]), 4e-7f);
+
+    // logarithm over many decades (relative error)
+    for (i=0; i<_n; i++)
+        x[i] = expf(20.0f*randnf());
+    liquid_vectorf_log10(x, _n, s);
+    liquid_vectorf_db   (x, _n, c);
+    for (i=0; i<_n; i++) {
+        double v = log10((double)x[i]);
+        CONTEND_DELTA(s[i],      v, 2e-7*fabs(v) + 1e-12);
+        CONTEND_DELTA(c[i], 10.0*v, 3e-6*fabs(v) + 1e-12);
+    }
+
+    // exponential (relative error)
+    for (i=0; i<_n; i++)
+        x[i] = 30.0f*randnf();
+    liquid_vectorf_exp(x, _n, s);
+    for (i=0; i<_n; i++) {
+        double v = exp((double)x[i]);
+        if (v < FLT_MIN || v > FLT_MAX)
+            continue;
+        CONTEND_DELTA(s[i]/v, 1.0, 2e-7);
+    }
+}
+
+// run transcendental functions for each SIMD type available on this host
+void autotest_vector_math_simd_types()
+{
+    unsigned int i, n;
+    for (i=1; i<LIQUID_SIMD_NUM_TYPES; i++) {
+        if (!liquid_simd_is_available(i))
+            continue;
+        liquid_simd_set_type(i);
+        for (n=1; n<=67; n++)
+            runtest_vector_math(n);
+        runtest_vector_math(4096);
+    }
+
+    // restore automatic selection
+    liquid_simd_set_type(LIQUID_SIMD_AUTO);
+}
+
+// check special values
+void autotest_vector_math_special()
+{
+    float x[16] = {0, -0.0f, -1, INFINITY, 1, FLT_MIN, 1e-40f, FLT_MAX,
+                   100, -100, 88.7f, 89, -87, -110, 1e-8f, -1e-8f};
+    float y[16];
+    unsigned int i;
+
+    // logarithm
+    liquid_vectorf_log10(x, 16, y);
+    CONTEND_EXPRESSION( isinf(y[0]) && y[0] < 0 );
+    CONTEND_EXPRESSION( isinf(y[1]) && y[1] < 0 );
+    CONTEND_EXPRESSION( isnan(y[2]) );
+    CONTEND_EXPRESSION( isinf(y[3]) && y[3] > 0 );
+    CONTEND_DELTA( y[4], 0.0f, 1e-7f );
+    CONTEND_DELTA( y[5], log10f(FLT_MIN), 1e-5f );
+    CONTEND_DELTA( y[6], log10((double)1e-40f), 1e-5f );
+    CONTEND_DELTA( y[7], log10f(FLT_MAX), 1e-5f );
+
+    // exponential
+    liquid_vectorf_exp(x, 16, y);
+    CONTEND_DELTA( y[ 0], 1.0f, 1e-7f );
+    CONTEND_DELTA( y[ 1], 1.0f, 1e-7f );
+    CONTEND_DELTA( y[ 2], expf(-1.0f), 1e-7f );
+    CONTEND_EXPRESSION( isinf(y[3]) );
+    CONTEND_EXPRESSION( isinf(y[7]) );
+    CONTEND_EXPRESSION( isinf(y[9]) == 0 && y[9] < 1e-43f );
+    CONTEND_DELTA( y[10]/expf(88.7f), 1.0f, 1e-6f );
+    CONTEND_EXPRESSION( isinf(y[11]) );
+    CONTEND_EXPRESSION( y[13] == 0.0f );
+    for (i=14; i<16; i++)
+        CONTEND_DELTA( y[i], 1.0f, 1e-7f );
+
+    // arctangent of zeros and axes
+    float yy[8] = {0, 0, 1, -1, 0,    0,     1, -1};
+    float xx[8] = {0, 1, 0,  0, -1, -0.0f, -1, -1};
+    liquid_vectorf_atan2(yy, xx, 8, y);
+    for (i=0; i<8; i++)
+        CONTEND_DELTA( y[i], atan2f(yy[i], xx[i]), 1e-6f );
+}
+